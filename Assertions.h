@@ -0,0 +1,12 @@
+#pragma once
+
+#include <format>
+#include <stacktrace>
+#include <stdexcept>
+
+// ---------- Assertions ----------
+
+#define Crash(msg) throw std::runtime_error{ std::format("[CRASH]: {}\n{}", msg, std::stacktrace::current()) };
+#define Unreachable() Crash("unreachable code path")
+#define Check(p) do { if (!(p)) Crash("Assertion failed: " #p); } while (false)
+#define CheckHR(hr) Check(SUCCEEDED(hr))
@@ -0,0 +1,223 @@
+#include <AtlasPackingBenchmark.h>
+
+#include <Assertions.h>
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+
+// ---------- Atlas Packing Benchmark ----------
+
+const char* GlyphSizeDistributionName(GlyphSizeDistribution distribution)
+{
+    switch (distribution)
+    {
+    case GlyphSizeDistribution::LatinUi: return "Latin UI";
+    case GlyphSizeDistribution::Cjk: return "CJK";
+    default: Unreachable();
+    }
+}
+
+struct GlyphSize
+{
+    int width;
+    int height;
+};
+
+// bitmap sizes as stb_truetype rasterizes them: the glyph box rounded out, plus a pixel of antialiasing
+static std::vector<GlyphSize> GenerateGlyphSizes(GlyphSizeDistribution distribution, std::uint32_t count, std::mt19937& rng)
+{
+    std::vector<GlyphSize> sizes(count);
+    switch (distribution)
+    {
+    case GlyphSizeDistribution::LatinUi:
+    {
+        // widths from i to W; heights of x-height, ascender or cap height, and descender glyphs
+        const float font_sizes[]{ 13.0f, 16.0f, 18.0f, 24.0f, 32.0f };
+        std::discrete_distribution<std::size_t> font_size{ 40.0, 25.0, 15.0, 12.0, 8.0 };
+        const float heights[]{ 0.55f, 0.75f, 0.95f };
+        std::discrete_distribution<std::size_t> height{ 45.0, 40.0, 15.0 };
+        std::uniform_real_distribution<float> width{ 0.15f, 0.75f };
+        for (GlyphSize& size : sizes)
+        {
+            const float em{ font_sizes[font_size(rng)] };
+            size.width = static_cast<int>(std::ceil(em * width(rng))) + 1;
+            size.height = static_cast<int>(std::ceil(em * heights[height(rng)])) + 1;
+        }
+        break;
+    }
+    case GlyphSizeDistribution::Cjk:
+    {
+        const float font_sizes[]{ 16.0f, 18.0f, 20.0f };
+        std::discrete_distribution<std::size_t> font_size{ 50.0, 30.0, 20.0 };
+        std::uniform_real_distribution<float> extent{ 0.85f, 1.0f };
+        for (GlyphSize& size : sizes)
+        {
+            const float em{ font_sizes[font_size(rng)] };
+            size.width = static_cast<int>(std::ceil(em * extent(rng))) + 1;
+            size.height = static_cast<int>(std::ceil(em * extent(rng))) + 1;
+        }
+        break;
+    }
+    default: Unreachable();
+    }
+    return sizes;
+}
+
+// operations between releases of replaced textures, standing for a frame
+static constexpr std::uint32_t RELEASE_INTERVAL{ 64 };
+
+// frees the pixels of the textures replaced by growing or repacking, as ImFontAtlasUpdateNewFrame() does once the backend destroyed them
+static void ReleaseReplacedTextures(ImFontAtlas* atlas)
+{
+    for (ImTextureData* tex : atlas->TexList)
+    {
+        if (tex != atlas->TexData && tex->Pixels != nullptr)
+        {
+            tex->DestroyPixels();
+        }
+    }
+}
+
+struct PackedRect
+{
+    ImFontAtlasRectId id;
+    std::uint8_t value; // of every pixel, never 0 which is the padding
+};
+
+static PackedRect AddRect(ImFontAtlas* atlas, GlyphSize size, std::uint8_t value)
+{
+    ImFontAtlasRectId id{ atlas->AddCustomRect(size.width, size.height) };
+    Check(id != ImFontAtlasRectId_Invalid);
+    ImTextureRect* r{ ImFontAtlasPackGetRect(atlas, id) };
+    ImTextureData* tex{ atlas->TexData };
+    for (int y{}; y < r->h; y++)
+    {
+        std::memset(tex->GetPixelsAt(r->x, r->y + y), value, r->w);
+    }
+    return { id, value };
+}
+
+static float Efficiency(ImFontAtlas* atlas)
+{
+    // the skyline counts discarded rectangles as packed until a repack
+    const ImFontAtlasBuilder* builder{ atlas->Builder };
+    const ImTextureData* tex{ atlas->TexData };
+    return static_cast<float>(builder->RectsPackedSurface - builder->RectsDiscardedSurface) / static_cast<float>(tex->Width * tex->Height);
+}
+
+static std::uint32_t CountMismatches(ImFontAtlas* atlas, const std::vector<PackedRect>& rects)
+{
+    ImTextureData* tex{ atlas->TexData };
+    const int padding{ atlas->TexGlyphPadding };
+    std::vector<bool> covered(static_cast<std::size_t>(tex->Width * tex->Height));
+    std::uint32_t mismatches{};
+    for (const PackedRect& rect : rects)
+    {
+        const ImTextureRect* r{ ImFontAtlasPackGetRect(atlas, rect.id) };
+        const int x1{ std::min(r->x + r->w + padding, tex->Width) };
+        const int y1{ std::min(r->y + r->h + padding, tex->Height) };
+        bool mismatch{ r->x + r->w > tex->Width || r->y + r->h > tex->Height };
+        for (int y{ r->y }; y < y1 && !mismatch; y++)
+        {
+            const auto* pixels{ static_cast<const std::uint8_t*>(tex->GetPixelsAt(0, y)) };
+            for (int x{ r->x }; x < x1; x++)
+            {
+                const bool padding_pixel{ x >= r->x + r->w || y >= r->y + r->h };
+                const std::size_t i{ static_cast<std::size_t>(y * tex->Width + x) };
+                mismatch |= covered[i] || pixels[x] != (padding_pixel ? 0 : rect.value);
+                covered[i] = true;
+            }
+        }
+        mismatches += mismatch ? 1 : 0;
+    }
+    return mismatches;
+}
+
+static double ElapsedUs(std::chrono::steady_clock::time_point begin, std::uint32_t count)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count() / std::max(count, 1u);
+}
+
+std::vector<AtlasPackingBenchmarkResult> RunAtlasPackingBenchmark(std::uint32_t rect_count, std::uint32_t churn_count, std::uint32_t repetitions, std::uint32_t seed)
+{
+    Check(rect_count > 0 && repetitions > 0);
+
+    std::vector<AtlasPackingBenchmarkResult> results{};
+    for (std::uint32_t distribution{}; distribution < static_cast<std::uint32_t>(GlyphSizeDistribution::Count); distribution++)
+    {
+        std::mt19937 rng{ seed };
+        const std::vector<GlyphSize> fill_sizes{ GenerateGlyphSizes(static_cast<GlyphSizeDistribution>(distribution), rect_count, rng) };
+        const std::vector<GlyphSize> churn_sizes{ GenerateGlyphSizes(static_cast<GlyphSizeDistribution>(distribution), churn_count, rng) };
+        std::vector<std::uint32_t> churn_victims(churn_count);
+        std::uniform_int_distribution<std::uint32_t> victim{ 0, rect_count - 1 };
+        for (std::uint32_t& v : churn_victims)
+        {
+            v = victim(rng);
+        }
+
+        for (bool max_rects : { false, true })
+        {
+            AtlasPackingBenchmarkResult result{};
+            result.distribution = static_cast<GlyphSizeDistribution>(distribution);
+            result.max_rects = max_rects;
+            result.rect_count = rect_count;
+            result.fill_us = std::numeric_limits<double>::max();
+            result.churn_us = std::numeric_limits<double>::max();
+            for (std::uint32_t repetition{}; repetition < repetitions; repetition++)
+            {
+                // no ImGui context: the atlas is not bound to a renderer backend
+                auto atlas{ std::make_unique<ImFontAtlas>() };
+                atlas->TexDesiredFormat = ImTextureFormat_Alpha8;
+                atlas->Flags |= max_rects ? ImFontAtlasFlags_PackMaxRects : ImFontAtlasFlags_None;
+                ImFontAtlasBuildInit(atlas.get());
+                std::uint8_t value{};
+                auto next_value{ [&] { value = static_cast<std::uint8_t>(value % 255 + 1); return value; } };
+
+                std::vector<PackedRect> rects(rect_count);
+                const int fill_textures{ atlas->TexList.Size };
+                auto begin{ std::chrono::steady_clock::now() };
+                for (std::uint32_t i{}; i < rect_count; i++)
+                {
+                    rects[i] = AddRect(atlas.get(), fill_sizes[i], next_value());
+                    if (i % RELEASE_INTERVAL == RELEASE_INTERVAL - 1)
+                    {
+                        ReleaseReplacedTextures(atlas.get());
+                    }
+                }
+                result.fill_us = std::min(result.fill_us, ElapsedUs(begin, rect_count));
+                result.fill_efficiency = Efficiency(atlas.get());
+                result.fill_textures = static_cast<std::uint32_t>(atlas->TexList.Size - fill_textures);
+                result.mismatches = CountMismatches(atlas.get(), rects);
+
+                const int churn_textures{ atlas->TexList.Size };
+                begin = std::chrono::steady_clock::now();
+                for (std::uint32_t i{}; i < churn_count; i++)
+                {
+                    PackedRect& rect{ rects[churn_victims[i]] };
+                    atlas->RemoveCustomRect(rect.id);
+                    rect = AddRect(atlas.get(), churn_sizes[i], next_value());
+                    if (i % RELEASE_INTERVAL == RELEASE_INTERVAL - 1)
+                    {
+                        ReleaseReplacedTextures(atlas.get());
+                    }
+                }
+                result.churn_us = std::min(result.churn_us, ElapsedUs(begin, churn_count));
+                result.churn_efficiency = Efficiency(atlas.get());
+                result.churn_textures = static_cast<std::uint32_t>(atlas->TexList.Size - churn_textures);
+                result.texture_width = atlas->TexData->Width;
+                result.texture_height = atlas->TexData->Height;
+                result.mismatches += CountMismatches(atlas.get(), rects);
+            }
+            results.emplace_back(result);
+        }
+    }
+    return results;
+}
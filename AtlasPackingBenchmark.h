@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// ---------- Atlas Packing Benchmark ----------
+
+enum class GlyphSizeDistribution : std::uint32_t
+{
+    LatinUi = 0, // proportional glyphs of latin text, mostly at small UI sizes
+    Cjk = 1, // nearly square ideographs at body text sizes
+    Count,
+};
+
+const char* GlyphSizeDistributionName(GlyphSizeDistribution distribution);
+
+struct AtlasPackingBenchmarkResult
+{
+    GlyphSizeDistribution distribution;
+    bool max_rects; // ImFontAtlasFlags_PackMaxRects, otherwise the stb_rectpack skyline
+    std::uint32_t rect_count; // live rectangles, while churning too
+    double fill_us; // AddCustomRect and writing its pixels, per rectangle, into an empty atlas; fastest repetition
+    float fill_efficiency; // padded surface of the live rectangles over the texture surface, after filling
+    std::uint32_t fill_textures; // textures created by growing or repacking while filling
+    double churn_us; // RemoveCustomRect of a random rectangle then AddCustomRect of a new one, per pair; fastest repetition
+    float churn_efficiency; // after churning
+    std::uint32_t churn_textures; // textures created by growing or repacking while churning
+    int texture_width; // after churning
+    int texture_height;
+    std::uint32_t mismatches; // rectangles overlapping another one or with pixels differing from those written, padding included, expected to be 0
+};
+
+/*
+    generated glyph sizes of each distribution packed into a standalone Alpha8 atlas with each packer: rect_count rectangles,
+    then churn_count random replacements, as fonts baked at new sizes replace discarded ones
+    replaced textures are released every few operations, as a renderer backend would every frame
+*/
+std::vector<AtlasPackingBenchmarkResult> RunAtlasPackingBenchmark(std::uint32_t rect_count, std::uint32_t churn_count, std::uint32_t repetitions, std::uint32_t seed);
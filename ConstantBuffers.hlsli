@@ -6,16 +6,49 @@ struct SceneConstants
     matrix view;
     matrix projection;
     float3 world_eye;
-    float _pad[1];
+    float roughness; // perceptual roughness of every lit sphere
+    float3 light_position;
+    float _pad0;
+    float3 light_color;
+    float _pad1;
 };
 
 struct ObjectConstants
 {
     matrix model;
     float3 color;
-    float _pad0;
+    float emissive; // 1: color is output as is, 0: color is the albedo lit by the scene light
     float3 position;
     float radius;
 };
 
+// BRDF models, selected at compile time by BRDF_MODEL; mirrored by BrdfModel in Shading.h
+#define BRDF_MODEL_LAMBERT 0
+#define BRDF_MODEL_BLINN_PHONG 1
+#define BRDF_MODEL_GGX 2
+
+// shading feature bits, combined at compile time in SHADING_FEATURES; mirrored by ShadingFeature in Shading.h
+#define SHADING_FEATURE_FRESNEL (1 << 0)
+#define SHADING_FEATURE_AMBIENT (1 << 1)
+
+// tonemap operators
+#define TONEMAP_OPERATOR_REINHARD 0
+#define TONEMAP_OPERATOR_ACES 1
+#define TONEMAP_OPERATOR_AGX 2
+
+// number of bins of the log luminance histogram used by automatic exposure
+#define EXPOSURE_HISTOGRAM_BINS 256
+
+struct TonemapConstants
+{
+    uint tonemap_operator;
+    uint auto_exposure; // 0: manual exposure, 1: exposure from the luminance histogram
+    float exposure_ev; // manual exposure, or exposure compensation when auto exposure is enabled
+    float adaptation; // blend factor from the previous toward the current average luminance
+    float min_log_luminance; // log2 luminance mapped to the first lit histogram bin
+    float log_luminance_range; // log2 luminance range covered by the histogram
+    uint width; // size of the tonemapped region
+    uint height;
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,231 @@
+#include <DataTableBenchmark.h>
+
+#include <Assertions.h>
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <utility>
+
+// ---------- BRDF Statistics ----------
+
+const char* BrdfStatisticsColumnName(BrdfStatisticsColumn column)
+{
+    switch (column)
+    {
+    case BrdfStatisticsColumn::Material: return "Material";
+    case BrdfStatisticsColumn::Model: return "Model";
+    case BrdfStatisticsColumn::Roughness: return "Roughness";
+    case BrdfStatisticsColumn::MeanError: return "Mean error";
+    case BrdfStatisticsColumn::MaxError: return "Max error";
+    case BrdfStatisticsColumn::Samples: return "Samples";
+    default: Unreachable();
+    }
+}
+
+std::vector<BrdfStatistics> GenerateBrdfStatistics(std::uint32_t count, std::uint32_t seed)
+{
+    std::mt19937 rng{ seed };
+    std::uniform_int_distribution<std::uint32_t> model{ 0, static_cast<std::uint32_t>(BrdfModel::Count) - 1 };
+    std::uniform_real_distribution<float> roughness{ 0.02f, 1.0f };
+    std::normal_distribution<float> log_error{ -5.0f, 1.0f };
+    std::uniform_int_distribution<std::uint32_t> outlier{ 0, 7 };
+    std::uniform_real_distribution<float> spread{ 1.5f, 4.0f };
+    std::uniform_real_distribution<float> outlier_spread{ 20.0f, 100.0f };
+    std::uniform_int_distribution<std::uint32_t> sample_blocks{ 1, 256 };
+
+    std::vector<BrdfStatistics> statistics(count);
+    for (std::uint32_t i{}; i < count; i++)
+    {
+        BrdfStatistics& s{ statistics[i] };
+        s.material = i;
+        s.model = static_cast<BrdfModel>(model(rng));
+        s.roughness = s.model == BrdfModel::Lambert ? 1.0f : roughness(rng);
+        s.mean_error = std::exp(log_error(rng));
+        s.outlier = outlier(rng) == 0;
+        s.max_error = s.mean_error * (s.outlier ? outlier_spread(rng) : spread(rng));
+        s.samples = sample_blocks(rng) * 256;
+    }
+    return statistics;
+}
+
+template<typename T>
+static int CompareValues(T a, T b)
+{
+    return a < b ? -1 : (b < a ? 1 : 0);
+}
+
+int CompareBrdfStatistics(const ImGuiTableColumnSortSpecs* sort_spec, int row_a, int row_b, void* user_data)
+{
+    const auto& statistics{ *static_cast<const std::vector<BrdfStatistics>*>(user_data) };
+    const BrdfStatistics& a{ statistics[static_cast<std::size_t>(row_a)] };
+    const BrdfStatistics& b{ statistics[static_cast<std::size_t>(row_b)] };
+    switch (static_cast<BrdfStatisticsColumn>(sort_spec->ColumnUserID))
+    {
+    case BrdfStatisticsColumn::Material: return CompareValues(a.material, b.material);
+    case BrdfStatisticsColumn::Model: return CompareValues(static_cast<std::uint32_t>(a.model), static_cast<std::uint32_t>(b.model));
+    case BrdfStatisticsColumn::Roughness: return CompareValues(a.roughness, b.roughness);
+    case BrdfStatisticsColumn::MeanError: return CompareValues(a.mean_error, b.mean_error);
+    case BrdfStatisticsColumn::MaxError: return CompareValues(a.max_error, b.max_error);
+    case BrdfStatisticsColumn::Samples: return CompareValues(a.samples, b.samples);
+    default: Unreachable();
+    }
+}
+
+// ---------- Data Table Benchmark ----------
+
+static constexpr float ROW_HEIGHT{ 20.0f };
+static constexpr double VIEW_HEIGHT{ 720.0 };
+static constexpr std::uint32_t FRAME_COUNT{ 256 };
+
+// first visible display row and the display row after the last, summing heights from the top
+static std::pair<int, int> FindVisibleRowsLinear(const ImGuiTableData& data, double offset)
+{
+    int first{};
+    double y{};
+    for (; first < data.RowsCount - 1 && y + data.GetRowHeight(first) <= offset; first++)
+    {
+        y += data.GetRowHeight(first);
+    }
+    int last{ first };
+    for (; last < data.RowsCount - 1 && y + data.GetRowHeight(last) <= offset + VIEW_HEIGHT; last++)
+    {
+        y += data.GetRowHeight(last);
+    }
+    return { first, last + 1 };
+}
+
+static std::pair<int, int> FindVisibleRows(const ImGuiTableData& data, double offset)
+{
+    return { data.FindRow(offset), data.FindRow(offset + VIEW_HEIGHT) + 1 };
+}
+
+static double ElapsedMs(std::chrono::steady_clock::time_point begin)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+std::vector<DataTableBenchmarkResult> RunDataTableBenchmark(std::span<const std::uint32_t> row_counts, std::uint32_t repetitions, std::uint32_t seed)
+{
+    Check(repetitions > 0);
+
+    // sorted by model, then by decreasing mean error
+    ImGuiTableColumnSortSpecs column_specs[2]{};
+    column_specs[0].ColumnUserID = static_cast<ImGuiID>(BrdfStatisticsColumn::Model);
+    column_specs[0].ColumnIndex = 1;
+    column_specs[0].SortOrder = 0;
+    column_specs[0].SortDirection = ImGuiSortDirection_Ascending;
+    column_specs[1].ColumnUserID = static_cast<ImGuiID>(BrdfStatisticsColumn::MeanError);
+    column_specs[1].ColumnIndex = 3;
+    column_specs[1].SortOrder = 1;
+    column_specs[1].SortDirection = ImGuiSortDirection_Descending;
+    ImGuiTableSortSpecs sort_specs{};
+    sort_specs.Specs = column_specs;
+    sort_specs.SpecsCount = 2;
+
+    std::mt19937 rng{ seed };
+    std::vector<DataTableBenchmarkResult> results{};
+    for (std::uint32_t row_count : row_counts)
+    {
+        Check(row_count > 0 && row_count <= static_cast<std::uint32_t>(std::numeric_limits<int>::max()));
+        std::vector<BrdfStatistics> statistics{ GenerateBrdfStatistics(row_count, seed) };
+        void* user_data{ &statistics };
+
+        ImGuiTableData data{};
+        data.SetRowsCount(static_cast<int>(row_count), ROW_HEIGHT);
+        for (std::uint32_t row{}; row < row_count; row++)
+        {
+            if (statistics[row].outlier)
+            {
+                data.SetRowHeight(static_cast<int>(row), ROW_HEIGHT * 2.0f);
+            }
+        }
+
+        DataTableBenchmarkResult result{};
+        result.row_count = row_count;
+        result.sort_ms = std::numeric_limits<double>::max();
+        result.std_sort_ms = std::numeric_limits<double>::max();
+        result.frame_us = std::numeric_limits<double>::max();
+        result.linear_frame_us = std::numeric_limits<double>::max();
+        result.height_update_us = std::numeric_limits<double>::max();
+
+        std::vector<int> reference(row_count);
+        std::uniform_int_distribution<int> random_row{ 0, static_cast<int>(row_count) - 1 };
+        for (std::uint32_t repetition{}; repetition < repetitions; repetition++)
+        {
+            sort_specs.SpecsDirty = true;
+            auto begin{ std::chrono::steady_clock::now() };
+            data.Sort(&sort_specs, 1, CompareBrdfStatistics, user_data);
+            result.sort_ms = std::min(result.sort_ms, ElapsedMs(begin));
+
+            std::iota(reference.begin(), reference.end(), 0);
+            begin = std::chrono::steady_clock::now();
+            std::stable_sort(reference.begin(), reference.end(), [&](int a, int b) {
+                for (const ImGuiTableColumnSortSpecs& spec : column_specs)
+                {
+                    int delta{ CompareBrdfStatistics(&spec, a, b, user_data) };
+                    if (delta != 0)
+                    {
+                        return spec.SortDirection == ImGuiSortDirection_Descending ? delta > 0 : delta < 0;
+                    }
+                }
+                return false;
+            });
+            result.std_sort_ms = std::min(result.std_sort_ms, ElapsedMs(begin));
+
+            // the same scroll offsets for both lookups
+            std::uniform_real_distribution<double> scroll{ 0.0, std::max(0.0, data.GetTotalHeight() - VIEW_HEIGHT) };
+            std::vector<double> offsets(FRAME_COUNT);
+            std::generate(offsets.begin(), offsets.end(), [&]() { return scroll(rng); });
+
+            std::vector<std::pair<int, int>> visible(FRAME_COUNT);
+            begin = std::chrono::steady_clock::now();
+            for (std::uint32_t frame{}; frame < FRAME_COUNT; frame++)
+            {
+                Check(!data.Sort(&sort_specs, 1, CompareBrdfStatistics, user_data));
+                visible[frame] = FindVisibleRows(data, offsets[frame]);
+            }
+            result.frame_us = std::min(result.frame_us, ElapsedMs(begin) * 1000.0 / FRAME_COUNT);
+
+            std::vector<std::pair<int, int>> visible_linear(FRAME_COUNT);
+            begin = std::chrono::steady_clock::now();
+            for (std::uint32_t frame{}; frame < FRAME_COUNT; frame++)
+            {
+                visible_linear[frame] = FindVisibleRowsLinear(data, offsets[frame]);
+            }
+            result.linear_frame_us = std::min(result.linear_frame_us, ElapsedMs(begin) * 1000.0 / FRAME_COUNT);
+
+            // grow random rows, then restore them
+            std::vector<int> rows(FRAME_COUNT);
+            std::generate(rows.begin(), rows.end(), [&]() { return random_row(rng); });
+            begin = std::chrono::steady_clock::now();
+            for (int row : rows)
+            {
+                data.SetRowHeight(row, data.Heights[row] + 1.0f);
+            }
+            result.height_update_us = std::min(result.height_update_us, ElapsedMs(begin) * 1000.0 / FRAME_COUNT);
+            for (int row : rows)
+            {
+                data.SetRowHeight(row, data.Heights[row] - 1.0f);
+            }
+
+            result.mismatches = 0;
+            for (std::uint32_t i{}; i < row_count; i++)
+            {
+                result.mismatches += reference[i] != data.Order[static_cast<int>(i)] ? 1 : 0;
+            }
+            for (std::uint32_t frame{}; frame < FRAME_COUNT; frame++)
+            {
+                result.mismatches += visible[frame] != visible_linear[frame] ? 1 : 0;
+            }
+        }
+        results.emplace_back(result);
+    }
+    return results;
+}
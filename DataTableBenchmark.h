@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Shading.h>
+
+#include <imgui.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// ---------- BRDF Statistics ----------
+
+// also the user id of the table column, given to TableSetupColumn()
+enum class BrdfStatisticsColumn : std::uint32_t
+{
+    Material = 0,
+    Model = 1,
+    Roughness = 2,
+    MeanError = 3,
+    MaxError = 4,
+    Samples = 5,
+    Count,
+};
+
+const char* BrdfStatisticsColumnName(BrdfStatisticsColumn column);
+
+// error of a BRDF evaluation measured against a reference, for one material
+struct BrdfStatistics
+{
+    std::uint32_t material;
+    BrdfModel model;
+    float roughness;
+    float mean_error; // relative, over the samples
+    float max_error;
+    std::uint32_t samples;
+    bool outlier; // max error far above the mean, shown with a second line of details
+};
+
+std::vector<BrdfStatistics> GenerateBrdfStatistics(std::uint32_t count, std::uint32_t seed);
+
+// ImGuiTableDataCompareFunc, user_data is a const std::vector<BrdfStatistics>*
+int CompareBrdfStatistics(const ImGuiTableColumnSortSpecs* sort_spec, int row_a, int row_b, void* user_data);
+
+// ---------- Data Table Benchmark ----------
+
+struct DataTableBenchmarkResult
+{
+    std::uint32_t row_count;
+    double sort_ms; // ImGuiTableData::Sort() on two columns, when the sort specs or the data changed
+    double std_sort_ms; // std::stable_sort of a row index with the same comparison, as user code sorting every frame would
+    double frame_us; // frame without changes: ImGuiTableData::Sort() returning early, then the visible rows lookup
+    double linear_frame_us; // visible rows lookup summing the heights of the rows above, as needed without the prefix sums
+    double height_update_us; // ImGuiTableData::SetRowHeight() of a random row
+    std::uint32_t mismatches; // rows ordered differently than by std::stable_sort and visible rows found differently, expected to be 0
+};
+
+/*
+    sorts generated statistics of each row count, then simulates frames scrolled to random offsets, with one row in 8 twice as high
+    times are the minimum over the repetitions
+*/
+std::vector<DataTableBenchmarkResult> RunDataTableBenchmark(std::span<const std::uint32_t> row_counts, std::uint32_t repetitions, std::uint32_t seed);
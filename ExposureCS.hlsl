@@ -0,0 +1,42 @@
+#include "Tonemapping.hlsli"
+
+RWByteAddressBuffer histogram : register(u0);
+RWStructuredBuffer<float> average_luminance : register(u1);
+
+groupshared float weighted_bins[EXPOSURE_HISTOGRAM_BINS];
+
+[numthreads(EXPOSURE_HISTOGRAM_BINS, 1, 1)]
+void main(uint group_index : SV_GroupIndex)
+{
+    // load this thread's bin and reset it for the next frame
+    uint count = histogram.Load(group_index * 4);
+    histogram.Store(group_index * 4, 0);
+    weighted_bins[group_index] = group_index == 0 ? 0.0f : (float)count * (float)group_index; // bin 0 holds the pixels too dark to count
+    GroupMemoryBarrierWithGroupSync();
+
+    // sum the weighted bins
+    [unroll]
+    for (uint stride = EXPOSURE_HISTOGRAM_BINS / 2; stride > 0; stride >>= 1)
+    {
+        if (group_index < stride)
+        {
+            weighted_bins[group_index] += weighted_bins[group_index + stride];
+        }
+        GroupMemoryBarrierWithGroupSync();
+    }
+
+    // thread 0 owns bin 0, so it knows how many pixels were ignored
+    if (group_index == 0)
+    {
+        float lit_count = (float)(cb_tonemap.width * cb_tonemap.height - count);
+        float previous = average_luminance[0];
+        float current = previous;
+        if (lit_count > 0.0f)
+        {
+            float average_bin = weighted_bins[0] / lit_count;
+            float average_log_luminance = (average_bin - 1.0f) / (EXPOSURE_HISTOGRAM_BINS - 2) * cb_tonemap.log_luminance_range + cb_tonemap.min_log_luminance;
+            current = exp2(average_log_luminance);
+        }
+        average_luminance[0] = previous + (current - previous) * cb_tonemap.adaptation;
+    }
+}
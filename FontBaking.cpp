@@ -0,0 +1,207 @@
+#include <FontBaking.h>
+
+#include <Assertions.h>
+
+#include <imgui_internal.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <memory>
+
+// ---------- Font Baking ----------
+
+static void JobSystemParallelFor(int count, void (*job)(int index, void* job_data), void* job_data, void* user_data)
+{
+    auto job_system{ static_cast<JobSystem*>(user_data) };
+    job_system->ParallelFor(static_cast<std::uint32_t>(count), [job, job_data](std::uint32_t, std::uint32_t slice)
+    {
+        job(static_cast<int>(slice), job_data);
+    });
+}
+
+void PreloadFontGlyphs(ImFontAtlas* atlas, ImFont* font, float font_size, const ImWchar* ranges, JobSystem* job_system)
+{
+    Check(atlas && font && ranges);
+    if (job_system)
+    {
+        ImFontAtlasBuildPreloadGlyphRanges(atlas, font, font_size, ranges, JobSystemParallelFor, job_system);
+    }
+    else
+    {
+        ImFontAtlasBuildPreloadGlyphRanges(atlas, font, font_size, ranges);
+    }
+}
+
+// ---------- Atlas Cache ----------
+
+const char* FontAtlasCacheStatusName(FontAtlasCacheStatus status)
+{
+    switch (status)
+    {
+    case FontAtlasCacheStatus::Missing: return "Missing";
+    case FontAtlasCacheStatus::Loaded: return "Loaded";
+    case FontAtlasCacheStatus::Rejected: return "Rejected";
+    default: Unreachable();
+    }
+}
+
+FontAtlasCacheStatus LoadFontAtlasCache(ImFontAtlas* atlas, std::span<const std::uint8_t> data)
+{
+    Check(atlas && atlas->Builder);
+    if (data.empty())
+    {
+        return FontAtlasCacheStatus::Missing;
+    }
+    return ImFontAtlasCacheLoad(atlas, data.data(), data.size()) ? FontAtlasCacheStatus::Loaded : FontAtlasCacheStatus::Rejected;
+}
+
+std::vector<std::uint8_t> SaveFontAtlasCache(ImFontAtlas* atlas)
+{
+    Check(atlas && atlas->Builder);
+    ImVector<char> data{};
+    ImFontAtlasCacheSave(atlas, &data);
+    return std::vector<std::uint8_t>(data.begin(), data.end());
+}
+
+// ---------- Benchmark ----------
+
+struct BakedAtlas
+{
+    std::unique_ptr<ImFontAtlas> atlas;
+    ImFont* font;
+    bool font_file_loaded;
+};
+
+static BakedAtlas AddAtlasFont(const char* font_path, float font_size)
+{
+    BakedAtlas baked{};
+    baked.atlas = std::make_unique<ImFontAtlas>();
+
+    // AddFontFromFileTTF asserts on missing files
+    std::error_code error{};
+    if (font_path && std::filesystem::is_regular_file(font_path, error))
+    {
+        baked.font = baked.atlas->AddFontFromFileTTF(font_path, font_size);
+        baked.font_file_loaded = baked.font != nullptr;
+    }
+    if (!baked.font)
+    {
+        baked.font = baked.atlas->AddFontDefault();
+    }
+    return baked;
+}
+
+static BakedAtlas BakeAtlas(const char* font_path, std::span<const float> sizes, const ImWchar* ranges, JobSystem* job_system)
+{
+    BakedAtlas baked{ AddAtlasFont(font_path, sizes.front()) };
+    for (float size : sizes)
+    {
+        PreloadFontGlyphs(baked.atlas.get(), baked.font, size, ranges, job_system);
+    }
+    return baked;
+}
+
+static std::uint32_t GlyphCount(const ImFontAtlas* atlas)
+{
+    const ImFontAtlasBuilder* builder{ atlas->Builder };
+    std::uint32_t glyph_count{};
+    for (int i{}; i < builder->BakedPool.Size; i++)
+    {
+        glyph_count += static_cast<std::uint32_t>(builder->BakedPool[i].Glyphs.Size);
+    }
+    return glyph_count;
+}
+
+static bool SameAtlas(const ImFontAtlas* a, const ImFontAtlas* b)
+{
+    const ImTextureData* tex_a{ a->TexData };
+    const ImTextureData* tex_b{ b->TexData };
+    if (tex_a->Width != tex_b->Width || tex_a->Height != tex_b->Height || tex_a->Format != tex_b->Format)
+    {
+        return false;
+    }
+    if (std::memcmp(tex_a->Pixels, tex_b->Pixels, static_cast<std::size_t>(tex_a->GetSizeInBytes())) != 0)
+    {
+        return false;
+    }
+
+    const ImFontAtlasBuilder* builder_a{ a->Builder };
+    const ImFontAtlasBuilder* builder_b{ b->Builder };
+    if (builder_a->BakedPool.Size != builder_b->BakedPool.Size)
+    {
+        return false;
+    }
+    for (int i{}; i < builder_a->BakedPool.Size; i++)
+    {
+        const ImVector<ImFontGlyph>& glyphs_a{ builder_a->BakedPool[i].Glyphs };
+        const ImVector<ImFontGlyph>& glyphs_b{ builder_b->BakedPool[i].Glyphs };
+        if (glyphs_a.Size != glyphs_b.Size || std::memcmp(glyphs_a.Data, glyphs_b.Data, static_cast<std::size_t>(glyphs_a.size_in_bytes())) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+FontBakeBenchmarkResult RunFontBakeBenchmark(JobSystem* job_system, const char* font_path, std::span<const float> sizes, const ImWchar* ranges, std::uint32_t repetitions)
+{
+    Check(job_system);
+    Check(!sizes.empty());
+    Check(repetitions > 0);
+
+    FontBakeBenchmarkResult result{};
+    result.worker_count = job_system->WorkerCount();
+    result.serial_ms = std::numeric_limits<double>::max();
+    result.parallel_ms = std::numeric_limits<double>::max();
+    result.identical = true;
+    for (std::uint32_t repetition{}; repetition < repetitions; repetition++)
+    {
+        auto serial_begin{ std::chrono::steady_clock::now() };
+        BakedAtlas serial{ BakeAtlas(font_path, sizes, ranges, nullptr) };
+        auto serial_end{ std::chrono::steady_clock::now() };
+        BakedAtlas parallel{ BakeAtlas(font_path, sizes, ranges, job_system) };
+        auto parallel_end{ std::chrono::steady_clock::now() };
+
+        result.serial_ms = std::min(result.serial_ms, std::chrono::duration<double, std::milli>(serial_end - serial_begin).count());
+        result.parallel_ms = std::min(result.parallel_ms, std::chrono::duration<double, std::milli>(parallel_end - serial_end).count());
+        result.identical &= SameAtlas(serial.atlas.get(), parallel.atlas.get());
+        result.font_file_loaded = parallel.font_file_loaded;
+        result.glyph_count = GlyphCount(parallel.atlas.get());
+        result.texture_width = parallel.atlas->TexData->Width;
+        result.texture_height = parallel.atlas->TexData->Height;
+    }
+    return result;
+}
+
+FontAtlasCacheBenchmarkResult RunFontAtlasCacheBenchmark(const char* font_path, std::span<const float> sizes, const ImWchar* ranges, std::uint32_t repetitions)
+{
+    Check(!sizes.empty());
+    Check(repetitions > 0);
+
+    FontAtlasCacheBenchmarkResult result{};
+    result.bake_ms = std::numeric_limits<double>::max();
+    result.load_ms = std::numeric_limits<double>::max();
+    result.identical = true;
+    for (std::uint32_t repetition{}; repetition < repetitions; repetition++)
+    {
+        auto bake_begin{ std::chrono::steady_clock::now() };
+        BakedAtlas baked{ BakeAtlas(font_path, sizes, ranges, nullptr) };
+        auto bake_end{ std::chrono::steady_clock::now() };
+        std::vector<std::uint8_t> cache{ SaveFontAtlasCache(baked.atlas.get()) };
+        auto load_begin{ std::chrono::steady_clock::now() };
+        BakedAtlas loaded{ AddAtlasFont(font_path, sizes.front()) };
+        bool cache_loaded{ LoadFontAtlasCache(loaded.atlas.get(), cache) == FontAtlasCacheStatus::Loaded };
+        auto load_end{ std::chrono::steady_clock::now() };
+
+        result.bake_ms = std::min(result.bake_ms, std::chrono::duration<double, std::milli>(bake_end - bake_begin).count());
+        result.load_ms = std::min(result.load_ms, std::chrono::duration<double, std::milli>(load_end - load_begin).count());
+        result.identical &= cache_loaded && SameAtlas(baked.atlas.get(), loaded.atlas.get());
+        result.font_file_loaded = baked.font_file_loaded;
+        result.glyph_count = GlyphCount(baked.atlas.get());
+        result.cache_bytes = cache.size();
+    }
+    return result;
+}
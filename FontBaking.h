@@ -0,0 +1,78 @@
+#pragma once
+
+#include <JobSystem.h>
+
+#include <imgui.h> // ImWchar depends on imconfig.h
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// ---------- Font Baking ----------
+
+/*
+    loads the glyphs of ranges (ImWchar pairs, zero terminated) at font_size into the atlas, instead of on first use
+    with a job system, stb_truetype rasterizes the glyphs on the workers first; packing and copying into the texture stay on the
+    calling thread and in codepoint order, so the atlas is the same byte for byte as without one
+    main thread, outside of any ImGui frame or between frames; the workers allocate through ImGui::MemAlloc
+*/
+void PreloadFontGlyphs(ImFontAtlas* atlas, ImFont* font, float font_size, const ImWchar* ranges, JobSystem* job_system);
+
+// ---------- Atlas Cache ----------
+
+enum class FontAtlasCacheStatus : std::uint32_t
+{
+    Missing = 0, // no cache data
+    Loaded = 1,
+    Rejected = 2, // fonts, font or atlas settings, or the ImGui build changed, or the data is corrupted; the atlas bakes as usual
+};
+
+const char* FontAtlasCacheStatusName(FontAtlasCacheStatus status);
+
+/*
+    restores the texture, packing state and baked fonts written by SaveFontAtlasCache instead of rasterizing them again
+    data is keyed by the contents of the font files, the font and atlas settings and the ImGui build, and checksummed
+    fonts must have been added and nothing baked yet, i.e. before the first frame; the atlas is left untouched unless Loaded
+    and stays dynamic afterwards, glyphs and sizes missing from the cache are baked on first use
+*/
+FontAtlasCacheStatus LoadFontAtlasCache(ImFontAtlas* atlas, std::span<const std::uint8_t> data);
+std::vector<std::uint8_t> SaveFontAtlasCache(ImFontAtlas* atlas);
+
+// ---------- Benchmark ----------
+
+struct FontBakeBenchmarkResult
+{
+    bool font_file_loaded; // false when the benchmark fell back to the embedded default font
+    std::uint32_t glyph_count; // glyphs over every size
+    std::uint32_t worker_count;
+    int texture_width;
+    int texture_height;
+    double serial_ms; // fastest repetition
+    double parallel_ms; // fastest repetition
+    bool identical; // textures and glyphs of both atlases match byte for byte
+};
+
+/*
+    cold start: every repetition builds a new atlas from the font file and preloads ranges at every size, on the calling thread
+    then with the job system
+    font_path may be nullptr or missing, the embedded default font is used then
+*/
+FontBakeBenchmarkResult RunFontBakeBenchmark(JobSystem* job_system, const char* font_path, std::span<const float> sizes, const ImWchar* ranges, std::uint32_t repetitions);
+
+struct FontAtlasCacheBenchmarkResult
+{
+    bool font_file_loaded; // false when the benchmark fell back to the embedded default font
+    std::uint32_t glyph_count; // glyphs over every size
+    std::size_t cache_bytes;
+    double bake_ms; // fastest repetition: add the font and rasterize every glyph
+    double load_ms; // fastest repetition: add the font and load the cache
+    bool identical; // textures and glyphs of both atlases match byte for byte
+};
+
+/*
+    cold start with and without the cache: every repetition builds a new atlas from the font file and preloads ranges at every size,
+    then builds another one from the font file and the cache saved from the first run
+    font_path may be nullptr or missing, the embedded default font is used then
+*/
+FontAtlasCacheBenchmarkResult RunFontAtlasCacheBenchmark(const char* font_path, std::span<const float> sizes, const ImWchar* ranges, std::uint32_t repetitions);
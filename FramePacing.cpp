@@ -0,0 +1,113 @@
+#include <FramePacing.h>
+
+#include <Assertions.h>
+
+#include <algorithm>
+#include <cmath>
+
+// ---------- Frame Limiter ----------
+
+FrameLimiter::FrameLimiter(FrameClock* clock, std::int64_t spin_threshold)
+    : m_clock{ clock }
+    , m_spin_threshold{ spin_threshold }
+    , m_deadline{}
+    , m_has_deadline{}
+{
+    Check(clock);
+    Check(spin_threshold >= 0);
+}
+void FrameLimiter::Wait(double target_fps)
+{
+    Check(target_fps > 0.0);
+    auto period{ static_cast<std::int64_t>(1e9 / target_fps) };
+
+    std::int64_t now{ m_clock->NowNanoseconds() };
+
+    // first frame, or too far behind to catch up: start pacing from now
+    if (!m_has_deadline || now - m_deadline > period)
+    {
+        m_deadline = now;
+        m_has_deadline = true;
+    }
+
+    // sleep through most of the wait
+    std::int64_t remaining{ m_deadline - now };
+    if (remaining > m_spin_threshold)
+    {
+        m_clock->SleepNanoseconds(remaining - m_spin_threshold);
+    }
+
+    // spin through the rest
+    while (m_clock->NowNanoseconds() < m_deadline)
+    {
+        m_clock->SpinOnce();
+    }
+
+    m_deadline += period;
+}
+
+// ---------- Frame Time Statistics ----------
+
+FrameTimeStats::FrameTimeStats(std::uint32_t capacity)
+    : m_samples(capacity)
+    , m_next{}
+    , m_count{}
+{
+    Check(capacity > 0);
+}
+void FrameTimeStats::AddFrame(double frame_ms)
+{
+    m_samples[m_next] = frame_ms;
+    m_next = (m_next + 1) % static_cast<std::uint32_t>(m_samples.size());
+    m_count = std::min(m_count + 1, static_cast<std::uint32_t>(m_samples.size()));
+}
+void FrameTimeStats::Clear() noexcept
+{
+    m_next = 0;
+    m_count = 0;
+}
+FrameTimeSummary FrameTimeStats::Summary() const
+{
+    FrameTimeSummary summary{};
+    summary.frame_count = m_count;
+    if (m_count == 0)
+    {
+        return summary;
+    }
+
+    std::vector<double> sorted(m_count);
+    double sum{};
+    double jitter_sum{};
+    for (std::uint32_t i{}; i < m_count; i++)
+    {
+        sorted[i] = Sample(i);
+        sum += sorted[i];
+        if (i > 0)
+        {
+            jitter_sum += std::abs(sorted[i] - sorted[i - 1]);
+        }
+    }
+    summary.average_ms = sum / m_count;
+    summary.jitter_ms = m_count > 1 ? jitter_sum / (m_count - 1) : 0.0;
+
+    // nearest-rank percentiles
+    auto percentile{ [&](double p)
+    {
+        auto rank{ static_cast<std::size_t>(std::ceil(p * m_count)) };
+        auto it{ sorted.begin() + static_cast<std::ptrdiff_t>(std::clamp<std::size_t>(rank, 1, m_count) - 1) };
+        std::nth_element(sorted.begin(), it, sorted.end());
+        return *it;
+    } };
+    summary.p50_ms = percentile(0.50);
+    summary.p99_ms = percentile(0.99);
+    summary.min_ms = *std::min_element(sorted.begin(), sorted.end());
+    summary.max_ms = *std::max_element(sorted.begin(), sorted.end());
+
+    return summary;
+}
+double FrameTimeStats::Sample(std::uint32_t i) const
+{
+    Check(i < m_count);
+    auto capacity{ static_cast<std::uint32_t>(m_samples.size()) };
+    return m_samples[(m_next + capacity - m_count + i) % capacity];
+}
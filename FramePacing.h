@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// ---------- Frame Pacing Modes ----------
+
+enum class FramePacingMode : std::uint32_t
+{
+    Uncapped = 0, // present without waiting for vsync; for benchmarking
+    VSync = 1, // present on every vertical blank
+    FixedRate = 2, // sleep and spin until the target frame rate deadline, present without vsync
+    LowLatency = 3, // wait on the swap chain frame latency waitable object before starting a frame, present with vsync
+};
+
+// ---------- Frame Clock ----------
+
+// time source of the frame limiter; a fake clock lets the pacing logic run without waiting for real time
+class FrameClock
+{
+public:
+    FrameClock() = default;
+    virtual ~FrameClock() = default;
+    FrameClock(const FrameClock&) = delete;
+    FrameClock(FrameClock&&) noexcept = delete;
+    FrameClock& operator=(const FrameClock&) = delete;
+    FrameClock& operator=(FrameClock&&) noexcept = delete;
+public:
+    // monotonic time
+    virtual std::int64_t NowNanoseconds() = 0;
+    // coarse sleep; may oversleep by up to the scheduler granularity
+    virtual void SleepNanoseconds(std::int64_t duration) = 0;
+    // called between reads of the time while busy-waiting for a deadline, e.g. to yield the processor; a fake clock advances here
+    virtual void SpinOnce() = 0;
+};
+
+// ---------- Frame Limiter ----------
+
+/*
+    holds frames to a target rate
+    the clock sleeps until spin_threshold before the deadline and busy-waits the rest, trading a little CPU for precision
+    deadlines advance by a fixed period so that wake-up jitter does not accumulate; a frame that misses its deadline
+    by more than a period resynchronizes instead of rushing the following frames
+*/
+class FrameLimiter
+{
+public:
+    FrameLimiter(FrameClock* clock, std::int64_t spin_threshold);
+    ~FrameLimiter() = default;
+    FrameLimiter(const FrameLimiter&) = delete;
+    FrameLimiter(FrameLimiter&&) noexcept = default;
+    FrameLimiter& operator=(const FrameLimiter&) = delete;
+    FrameLimiter& operator=(FrameLimiter&&) noexcept = default;
+public:
+    // block until the current frame is allowed to end
+    void Wait(double target_fps);
+    // forget the current deadline; call when switching pacing mode
+    void Reset() noexcept { m_has_deadline = false; }
+private:
+    FrameClock* m_clock;
+    std::int64_t m_spin_threshold;
+    std::int64_t m_deadline;
+    bool m_has_deadline;
+};
+
+// ---------- Frame Time Statistics ----------
+
+struct FrameTimeSummary
+{
+    std::uint32_t frame_count;
+    double average_ms;
+    double min_ms;
+    double max_ms;
+    double p50_ms;
+    double p99_ms;
+    double jitter_ms; // mean absolute difference between consecutive frame times
+};
+
+// frame times of the most recent frames
+class FrameTimeStats
+{
+public:
+    explicit FrameTimeStats(std::uint32_t capacity);
+    ~FrameTimeStats() = default;
+    FrameTimeStats(const FrameTimeStats&) = default;
+    FrameTimeStats(FrameTimeStats&&) noexcept = default;
+    FrameTimeStats& operator=(const FrameTimeStats&) = default;
+    FrameTimeStats& operator=(FrameTimeStats&&) noexcept = default;
+public:
+    void AddFrame(double frame_ms);
+    void Clear() noexcept;
+    FrameTimeSummary Summary() const;
+    std::uint32_t Count() const noexcept { return m_count; }
+    // i-th frame time, from the oldest to the most recent
+    double Sample(std::uint32_t i) const;
+private:
+    std::vector<double> m_samples;
+    std::uint32_t m_next;
+    std::uint32_t m_count;
+};
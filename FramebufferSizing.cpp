@@ -0,0 +1,65 @@
+#include <FramebufferSizing.h>
+
+#include <Assertions.h>
+
+#include <algorithm>
+
+// ---------- Extents ----------
+
+std::uint32_t RoundUpToBucket(std::uint32_t size, std::uint32_t granularity) noexcept
+{
+    std::uint32_t buckets{ (std::max(size, 1u) + granularity - 1) / granularity };
+    return buckets * granularity;
+}
+
+// ---------- Resize Policy ----------
+
+ResizeBucketPolicy::ResizeBucketPolicy(Extent2D initial, std::uint32_t granularity, double shrink_delay_seconds)
+    : m_viewport{ initial }
+    , m_allocation{}
+    , m_granularity{ granularity }
+    , m_shrink_delay_seconds{ shrink_delay_seconds }
+    , m_last_request_seconds{}
+    , m_resize_requests{}
+    , m_reallocations{}
+{
+    Check(granularity > 0);
+    m_allocation = Bucket(initial);
+}
+void ResizeBucketPolicy::RequestResize(Extent2D extent, double now_seconds) noexcept
+{
+    m_viewport = extent;
+    m_last_request_seconds = now_seconds;
+    m_resize_requests++;
+}
+bool ResizeBucketPolicy::Update(double now_seconds) noexcept
+{
+    Extent2D needed{ Bucket(m_viewport) };
+    if (needed == m_allocation)
+    {
+        return false;
+    }
+
+    // the viewport no longer fits: grow only the dimensions that need it, right away
+    if (needed.width > m_allocation.width || needed.height > m_allocation.height)
+    {
+        m_allocation.width = std::max(needed.width, m_allocation.width);
+        m_allocation.height = std::max(needed.height, m_allocation.height);
+        m_reallocations++;
+        return true;
+    }
+
+    // the viewport fits a smaller bucket: release memory once the resize burst is over
+    if (now_seconds - m_last_request_seconds >= m_shrink_delay_seconds)
+    {
+        m_allocation = needed;
+        m_reallocations++;
+        return true;
+    }
+
+    return false;
+}
+Extent2D ResizeBucketPolicy::Bucket(Extent2D extent) const noexcept
+{
+    return { RoundUpToBucket(extent.width, m_granularity), RoundUpToBucket(extent.height, m_granularity) };
+}
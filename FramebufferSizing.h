@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+
+// ---------- Extents ----------
+
+struct Extent2D
+{
+    std::uint32_t width;
+    std::uint32_t height;
+
+    bool operator==(const Extent2D&) const = default;
+};
+
+// round size up to the next multiple of granularity; never returns 0
+std::uint32_t RoundUpToBucket(std::uint32_t size, std::uint32_t granularity) noexcept;
+
+// ---------- Resize Policy ----------
+
+/*
+    decides when the framebuffer must be reallocated while the window is being resized
+    the framebuffer is allocated in buckets and the scene is rendered into the top-left viewport sub-rectangle,
+    so most resizes only change the viewport:
+    - growing past the allocated bucket reallocates right away (the viewport must fit)
+    - shrinking into a smaller bucket waits until resize requests have stopped for shrink_delay_seconds,
+      so that a burst of WM_SIZE messages from dragging a window edge is coalesced into a single reallocation
+*/
+class ResizeBucketPolicy
+{
+public:
+    ResizeBucketPolicy(Extent2D initial, std::uint32_t granularity, double shrink_delay_seconds);
+    ~ResizeBucketPolicy() = default;
+    ResizeBucketPolicy(const ResizeBucketPolicy&) = default;
+    ResizeBucketPolicy(ResizeBucketPolicy&&) noexcept = default;
+    ResizeBucketPolicy& operator=(const ResizeBucketPolicy&) = default;
+    ResizeBucketPolicy& operator=(ResizeBucketPolicy&&) noexcept = default;
+public:
+    // record the new window size
+    void RequestResize(Extent2D extent, double now_seconds) noexcept;
+    // call once per frame; returns true when the framebuffer must be reallocated to Allocation()
+    bool Update(double now_seconds) noexcept;
+public:
+    Extent2D Viewport() const noexcept { return m_viewport; }
+    Extent2D Allocation() const noexcept { return m_allocation; }
+    Extent2D Bucket(Extent2D extent) const noexcept;
+    std::uint32_t ResizeRequests() const noexcept { return m_resize_requests; }
+    std::uint32_t Reallocations() const noexcept { return m_reallocations; }
+private:
+    Extent2D m_viewport;
+    Extent2D m_allocation;
+    std::uint32_t m_granularity;
+    double m_shrink_delay_seconds;
+    double m_last_request_seconds;
+    std::uint32_t m_resize_requests;
+    std::uint32_t m_reallocations;
+};
@@ -0,0 +1,6 @@
+// fullscreen triangle generated from the vertex id; no vertex or index buffer needed
+float4 main(uint vertex_id : SV_VertexID) : SV_POSITION
+{
+    float2 uv = float2((vertex_id << 1) & 2, vertex_id & 2);
+    return float4(uv * float2(2.0f, -2.0f) + float2(-1.0f, 1.0f), 0.0f, 1.0f);
+}
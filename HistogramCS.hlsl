@@ -0,0 +1,26 @@
+#include "Tonemapping.hlsli"
+
+#define GROUP_SIZE 16 // GROUP_SIZE * GROUP_SIZE threads, one per histogram bin
+
+Texture2D<float4> scene_color : register(t0);
+RWByteAddressBuffer histogram : register(u0);
+
+groupshared uint local_histogram[EXPOSURE_HISTOGRAM_BINS];
+
+[numthreads(GROUP_SIZE, GROUP_SIZE, 1)]
+void main(uint3 dispatch_id : SV_DispatchThreadID, uint group_index : SV_GroupIndex)
+{
+    local_histogram[group_index] = 0;
+    GroupMemoryBarrierWithGroupSync();
+
+    // bin this thread's pixel into the group local histogram
+    if (dispatch_id.x < cb_tonemap.width && dispatch_id.y < cb_tonemap.height)
+    {
+        float3 color = scene_color.Load(int3(dispatch_id.xy, 0)).rgb;
+        InterlockedAdd(local_histogram[LuminanceToHistogramBin(Luminance(color))], 1);
+    }
+    GroupMemoryBarrierWithGroupSync();
+
+    // merge into the global histogram, one bin per thread
+    histogram.InterlockedAdd(group_index * 4, local_histogram[group_index]);
+}
@@ -0,0 +1,161 @@
+#include <IdHashBenchmark.h>
+
+#include <Assertions.h>
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <limits>
+#include <random>
+#include <unordered_set>
+
+// ---------- Label Sets ----------
+
+const char* IdLabelSetName(IdLabelSet set)
+{
+    switch (set)
+    {
+    case IdLabelSet::Widgets: return "Widgets";
+    case IdLabelSet::TableCells: return "Table cells";
+    case IdLabelSet::Paths: return "Paths";
+    case IdLabelSet::TripleHash: return "###";
+    default: Unreachable();
+    }
+}
+
+std::vector<std::string> GenerateIdLabels(IdLabelSet set, std::uint32_t count, std::uint32_t seed)
+{
+    const char* words[]{ "Position", "Color", "Target", "Exposure", "Roughness", "Metallic", "Intensity", "Radius", "Enabled", "Mode", "Spacing", "Size" };
+    const char* sections[]{ "Camera", "Sphere", "Light", "Tonemapping", "Material", "Framebuffer", "Renderer", "Settings" };
+    const char* folders[]{ "assets", "textures", "materials", "environment", "meshes", "shaders", "characters", "props" };
+
+    std::mt19937 rng{ seed };
+    auto pick{ [&rng](const auto& options) -> const char* { return options[rng() % std::size(options)]; } };
+
+    std::vector<std::string> labels{};
+    labels.reserve(count);
+    for (std::uint32_t i{}; i < count; i++)
+    {
+        std::string label{};
+        switch (set)
+        {
+        case IdLabelSet::Widgets:
+        {
+            label = std::string{ pick(words) } + "##" + pick(sections);
+        } break;
+        case IdLabelSet::TableCells:
+        {
+            label = "##cell_" + std::to_string(i / 16) + "_" + std::to_string(i % 16);
+        } break;
+        case IdLabelSet::Paths:
+        {
+            auto depth{ 2 + rng() % 5 };
+            for (std::uint32_t d{}; d < depth; d++)
+            {
+                label += std::string{ pick(folders) } + "/";
+            }
+            label += std::string{ pick(words) } + "_" + std::to_string(i) + ".dds";
+        } break;
+        case IdLabelSet::TripleHash:
+        {
+            label = std::string{ pick(words) } + ": " + std::to_string(rng() % 100000) + "###" + pick(sections) + "_" + std::to_string(i);
+        } break;
+        default:
+        {
+            Unreachable();
+        } break;
+        }
+        labels.emplace_back(std::move(label));
+    }
+    return labels;
+}
+
+// ---------- Hash Backends ----------
+
+std::span<const IdHashBackend> IdHashBackends()
+{
+    static const std::array<IdHashBackend, 4> backends
+    {
+        IdHashBackend{ "ImHashStr (selected)", ImHashStr, true },
+        IdHashBackend{ "CRC32c table", ImHashStrCrc32Table, true },
+        IdHashBackend{ "CRC32c hardware", ImHashStrCrc32cHw, ImHashCrc32cHwAvailable() },
+        IdHashBackend{ "Wide", ImHashStrWide, true },
+    };
+    return backends;
+}
+
+// ---------- Benchmark ----------
+
+IdHashBenchmark::IdHashBenchmark(std::uint32_t labels_per_set, std::uint32_t seed)
+    : m_label_sets{}
+{
+    Check(labels_per_set > 0);
+    for (std::uint32_t set{}; set < static_cast<std::uint32_t>(IdLabelSet::Count); set++)
+    {
+        m_label_sets.emplace_back(GenerateIdLabels(static_cast<IdLabelSet>(set), labels_per_set, seed + set));
+    }
+}
+
+std::vector<IdHashBenchmarkResult> IdHashBenchmark::Run(std::uint32_t repetitions) const
+{
+    Check(repetitions > 0);
+
+    // the selected backend must agree with its compile-time counterpart, ### included
+    constexpr ImGuiID widget_id{ ImHashStrConstexpr("Position##Camera", 0x1234) };
+    constexpr ImGuiID triple_hash_id{ ImHashStrConstexpr("FPS: 59.9###fps", 0x1234) };
+    Check(ImHashStr("Position##Camera", 0, 0x1234) == widget_id);
+    Check(ImHashStr("FPS: 12.3###fps", 0, 0x1234) == triple_hash_id);
+
+    const ImGuiID window_id{ ImHashStr("BRDFs") };
+
+    std::vector<IdHashBenchmarkResult> results{};
+    for (const IdHashBackend& backend : IdHashBackends())
+    {
+        for (std::uint32_t set{}; set < static_cast<std::uint32_t>(IdLabelSet::Count); set++)
+        {
+            const std::vector<std::string>& labels{ m_label_sets[set] };
+
+            std::size_t bytes{};
+            std::uint32_t collisions{};
+            std::unordered_set<ImGuiID> ids{};
+            std::unordered_set<std::string> distinct_labels{};
+            for (const std::string& label : labels)
+            {
+                bytes += label.size();
+                // repeated labels hash to the same id on purpose; only count ids shared by different labels
+                if (distinct_labels.insert(label).second && !ids.insert(backend.hash_str(label.c_str(), 0, window_id)).second)
+                {
+                    collisions++;
+                }
+            }
+
+            double best_ns{ std::numeric_limits<double>::max() };
+            ImGuiID sink{};
+            for (std::uint32_t repetition{}; repetition < repetitions; repetition++)
+            {
+                auto begin{ std::chrono::steady_clock::now() };
+                for (const std::string& label : labels)
+                {
+                    sink ^= backend.hash_str(label.c_str(), 0, window_id);
+                }
+                auto end{ std::chrono::steady_clock::now() };
+                best_ns = std::min(best_ns, std::chrono::duration<double, std::nano>(end - begin).count());
+            }
+            // keep the hashes from being optimized away
+            volatile ImGuiID keep{ sink };
+            (void)keep;
+
+            IdHashBenchmarkResult result{};
+            result.backend = backend.name;
+            result.label_set = static_cast<IdLabelSet>(set);
+            result.ns_per_label = best_ns / static_cast<double>(labels.size());
+            result.gb_per_second = best_ns > 0.0 ? static_cast<double>(bytes) / best_ns : 0.0;
+            result.collisions = collisions;
+            results.emplace_back(result);
+        }
+    }
+    return results;
+}
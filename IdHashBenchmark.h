@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+// ---------- Label Sets ----------
+
+// distributions of the strings ImGui hashes into IDs
+enum class IdLabelSet : std::uint32_t
+{
+    Widgets = 0, // short labels with a hidden suffix, e.g. "Position##Camera"
+    TableCells = 1, // hidden per-cell ids, e.g. "##cell_12_3"
+    Paths = 2, // long labels, e.g. tree nodes showing asset paths
+    TripleHash = 3, // labels whose id does not depend on the displayed text, e.g. "FPS: 59.9###fps"
+    Count,
+};
+
+const char* IdLabelSetName(IdLabelSet set);
+
+// deterministic for a given seed
+std::vector<std::string> GenerateIdLabels(IdLabelSet set, std::uint32_t count, std::uint32_t seed);
+
+// ---------- Hash Backends ----------
+
+struct IdHashBackend
+{
+    const char* name;
+    unsigned int (*hash_str)(const char* data, std::size_t data_size, unsigned int seed); // same signature as ImHashStr()
+    bool available; // false when the backend falls back to another one on this CPU
+};
+
+// every backend compiled into ImGui, whichever ImHashStr() uses
+std::span<const IdHashBackend> IdHashBackends();
+
+// ---------- Benchmark ----------
+
+struct IdHashBenchmarkResult
+{
+    const char* backend;
+    IdLabelSet label_set;
+    double ns_per_label; // fastest repetition
+    double gb_per_second;
+    std::uint32_t collisions; // labels sharing an id with a previous label of the set
+};
+
+/*
+    times every backend over every label set
+    labels are hashed as ImGui does: zero-terminated, seeded with the id of the parent window
+    ids are checked against the compile-time hash of the selected backend before measuring anything
+*/
+class IdHashBenchmark
+{
+public:
+    IdHashBenchmark(std::uint32_t labels_per_set, std::uint32_t seed);
+    ~IdHashBenchmark() = default;
+    IdHashBenchmark(const IdHashBenchmark&) = delete;
+    IdHashBenchmark(IdHashBenchmark&&) noexcept = default;
+    IdHashBenchmark& operator=(const IdHashBenchmark&) = delete;
+    IdHashBenchmark& operator=(IdHashBenchmark&&) noexcept = default;
+public:
+    std::vector<IdHashBenchmarkResult> Run(std::uint32_t repetitions) const;
+private:
+    std::vector<std::vector<std::string>> m_label_sets;
+};
@@ -0,0 +1,254 @@
+#include <ImGuiAllocator.h>
+
+#include <Assertions.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <limits>
+
+// ---------- ImGui Allocator ----------
+
+// precedes every block; keeps blocks 16 bytes aligned like malloc
+struct alignas(16) ImGuiAllocator::Header
+{
+    ArenaPage* page; // arena blocks only
+    std::uint32_t kind; // size class index, ARENA_KIND or HEAP_KIND
+    std::uint32_t size; // requested size
+};
+
+struct alignas(16) ImGuiAllocator::ArenaPage
+{
+    std::size_t capacity;
+    std::size_t offset;
+    std::uint32_t live; // blocks carved from this page and not freed yet
+};
+
+static constexpr std::uint32_t ARENA_KIND{ 0xFFFF'FFFE };
+static constexpr std::uint32_t HEAP_KIND{ 0xFFFF'FFFF };
+static constexpr std::size_t POOL_CHUNK_SIZE{ 64 * 1024 };
+
+// arena scopes opened by the calling thread
+static thread_local std::uint32_t t_arena_scope_depth{};
+
+static std::size_t AlignUp16(std::size_t size)
+{
+    return (size + 15) & ~static_cast<std::size_t>(15);
+}
+
+static std::uint32_t SizeClass(std::size_t size)
+{
+    if (size <= ImGuiAllocator::MIN_POOLED_SIZE)
+    {
+        return 0;
+    }
+    return static_cast<std::uint32_t>(std::bit_width(size - 1)) - 4; // 16 B is 2^4
+}
+
+ImGuiAllocator::ImGuiAllocator()
+    : m_mutex{}
+    , m_free_lists{}
+    , m_chunks{}
+    , m_arena_pages{}
+    , m_free_arena_pages{}
+    , m_arena_page{}
+    , m_frame{}
+    , m_last_frame{}
+    , m_live_bytes{}
+    , m_peak_live_bytes{}
+    , m_reserved_bytes{}
+{
+    static_assert(sizeof(Header) == 16 || sizeof(void*) != 8);
+    static_assert((MIN_POOLED_SIZE << (SIZE_CLASS_COUNT - 1)) == MAX_POOLED_SIZE);
+}
+ImGuiAllocator::~ImGuiAllocator()
+{
+    for (void* chunk : m_chunks)
+    {
+        std::free(chunk);
+    }
+    for (ArenaPage* page : m_arena_pages)
+    {
+        std::free(page);
+    }
+}
+void* ImGuiAllocator::Allocate(std::size_t size)
+{
+    Check(size <= std::numeric_limits<std::uint32_t>::max());
+
+    std::scoped_lock lock{ m_mutex };
+
+    m_frame.allocations++;
+    m_frame.bytes_allocated += size;
+    m_live_bytes += size;
+    m_peak_live_bytes = std::max(m_peak_live_bytes, m_live_bytes);
+
+    Header* header{};
+    if (t_arena_scope_depth > 0 && sizeof(Header) + size <= ARENA_PAGE_SIZE - sizeof(ArenaPage))
+    {
+        header = static_cast<Header*>(AllocateFromArena(size));
+    }
+    else if (size <= MAX_POOLED_SIZE)
+    {
+        std::uint32_t size_class{ SizeClass(size) };
+        header = static_cast<Header*>(AllocateFromPool(size_class));
+        header->page = nullptr;
+        header->kind = size_class;
+    }
+    else
+    {
+        header = static_cast<Header*>(HeapAllocate(sizeof(Header) + size));
+        header->page = nullptr;
+        header->kind = HEAP_KIND;
+    }
+    header->size = static_cast<std::uint32_t>(size);
+    return header + 1;
+}
+void ImGuiAllocator::Free(void* ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+    Header* header{ static_cast<Header*>(ptr) - 1 };
+
+    std::scoped_lock lock{ m_mutex };
+
+    m_frame.frees++;
+    m_live_bytes -= header->size;
+
+    if (header->kind == ARENA_KIND)
+    {
+        ArenaPage* page{ header->page };
+        page->live--;
+        if (page->live == 0 && page != m_arena_page)
+        {
+            ReleaseArenaPage(page);
+        }
+    }
+    else if (header->kind == HEAP_KIND)
+    {
+        std::free(header);
+    }
+    else
+    {
+        Check(header->kind < SIZE_CLASS_COUNT);
+        void** block{ reinterpret_cast<void**>(header) };
+        *block = m_free_lists[header->kind];
+        m_free_lists[header->kind] = block;
+    }
+}
+void ImGuiAllocator::NewFrame()
+{
+    std::scoped_lock lock{ m_mutex };
+
+    // every arena block of the frame is gone: rewind instead of moving on to another page
+    if (m_arena_page && m_arena_page->live == 0)
+    {
+        m_arena_page->offset = 0;
+    }
+
+    m_last_frame = m_frame;
+    m_frame = {};
+}
+ImGuiAllocatorStats ImGuiAllocator::Stats()
+{
+    std::scoped_lock lock{ m_mutex };
+
+    ImGuiAllocatorStats stats{};
+    stats.last_frame = m_last_frame;
+    stats.live_bytes = m_live_bytes;
+    stats.peak_live_bytes = m_peak_live_bytes;
+    stats.reserved_bytes = m_reserved_bytes;
+    stats.arena_pages = static_cast<std::uint32_t>(m_arena_pages.size());
+    return stats;
+}
+void* ImGuiAllocator::ImGuiAlloc(std::size_t size, void* user_data)
+{
+    return static_cast<ImGuiAllocator*>(user_data)->Allocate(size);
+}
+void ImGuiAllocator::ImGuiFree(void* ptr, void* user_data)
+{
+    static_cast<ImGuiAllocator*>(user_data)->Free(ptr);
+}
+void* ImGuiAllocator::AllocateFromPool(std::size_t size_class)
+{
+    if (!m_free_lists[size_class])
+    {
+        // carve a new chunk into free blocks
+        std::size_t block_size{ sizeof(Header) + (MIN_POOLED_SIZE << size_class) };
+        std::size_t block_count{ std::max<std::size_t>(1, POOL_CHUNK_SIZE / block_size) };
+        auto chunk{ static_cast<std::byte*>(HeapAllocate(block_size * block_count)) };
+        m_chunks.emplace_back(chunk);
+        m_reserved_bytes += block_size * block_count;
+        for (std::size_t i{ block_count }; i-- > 0;)
+        {
+            void** block{ reinterpret_cast<void**>(chunk + i * block_size) };
+            *block = m_free_lists[size_class];
+            m_free_lists[size_class] = block;
+        }
+    }
+
+    void** block{ static_cast<void**>(m_free_lists[size_class]) };
+    m_free_lists[size_class] = *block;
+    return block;
+}
+void* ImGuiAllocator::AllocateFromArena(std::size_t size)
+{
+    std::size_t block_size{ AlignUp16(sizeof(Header) + size) };
+
+    if (!m_arena_page || m_arena_page->offset + block_size > m_arena_page->capacity)
+    {
+        // leave the full page behind; it is recycled by the last free of one of its blocks
+        if (m_arena_page && m_arena_page->live == 0)
+        {
+            ReleaseArenaPage(m_arena_page);
+        }
+
+        if (!m_free_arena_pages.empty())
+        {
+            m_arena_page = m_free_arena_pages.back();
+            m_free_arena_pages.pop_back();
+        }
+        else
+        {
+            m_arena_page = static_cast<ArenaPage*>(HeapAllocate(ARENA_PAGE_SIZE));
+            m_arena_page->capacity = ARENA_PAGE_SIZE - sizeof(ArenaPage);
+            m_arena_page->offset = 0;
+            m_arena_page->live = 0;
+            m_arena_pages.emplace_back(m_arena_page);
+            m_reserved_bytes += ARENA_PAGE_SIZE;
+        }
+    }
+
+    auto memory{ reinterpret_cast<std::byte*>(m_arena_page + 1) };
+    auto header{ reinterpret_cast<Header*>(memory + m_arena_page->offset) };
+    m_arena_page->offset += block_size;
+    m_arena_page->live++;
+    m_frame.arena_allocations++;
+
+    header->page = m_arena_page;
+    header->kind = ARENA_KIND;
+    return header;
+}
+void ImGuiAllocator::ReleaseArenaPage(ArenaPage* page)
+{
+    page->offset = 0;
+    m_free_arena_pages.emplace_back(page);
+}
+void* ImGuiAllocator::HeapAllocate(std::size_t size)
+{
+    void* ptr{ std::malloc(size) };
+    Check(ptr);
+    m_frame.heap_allocations++;
+    return ptr;
+}
+
+ImGuiAllocatorArenaScope::ImGuiAllocatorArenaScope() noexcept
+{
+    t_arena_scope_depth++;
+}
+ImGuiAllocatorArenaScope::~ImGuiAllocatorArenaScope()
+{
+    t_arena_scope_depth--;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// ---------- Allocation Statistics ----------
+
+struct ImGuiAllocatorFrameStats
+{
+    std::uint32_t allocations;
+    std::uint32_t frees;
+    std::uint32_t heap_allocations; // requests that reached malloc: new pool chunks, new arena pages and oversized blocks
+    std::uint32_t arena_allocations;
+    std::size_t bytes_allocated;
+};
+
+struct ImGuiAllocatorStats
+{
+    ImGuiAllocatorFrameStats last_frame;
+    std::size_t live_bytes;
+    std::size_t peak_live_bytes;
+    std::size_t reserved_bytes; // pool chunks and arena pages
+    std::uint32_t arena_pages;
+};
+
+// ---------- ImGui Allocator ----------
+
+/*
+    allocator for ImGui::SetAllocatorFunctions
+    - blocks up to MAX_POOLED_SIZE bytes come from power of two size class pools; freed blocks go back to the pool free list
+      instead of the heap, so allocation churn settles to zero heap traffic once the pools are warm
+    - inside an arena scope (ImGuiAllocatorArenaScope) blocks are bumped out of shared pages instead; a page is recycled once every
+      block carved from it is freed, and the current page rewinds at every frame boundary when nothing in it is alive
+      meant for code whose ImGui allocations die within the frame (scratch text buffers, temporary draw lists)
+    ImGui's own per-frame buffers (draw list vertices, channel splitters, formatting scratch) live in persistent objects and are
+    reused every frame: they go through the pools and stop allocating once grown to the largest frame, so they stay out of the arena,
+    which they would pin. Tests.cpp checks that steady frames allocate nothing outside the arena and nothing from the heap
+    - larger blocks go straight to the heap
+    thread-safe: ImGui allocates from any thread that builds draw lists or text buffers
+*/
+class ImGuiAllocator
+{
+public:
+    static constexpr std::size_t MIN_POOLED_SIZE{ 16 };
+    static constexpr std::size_t MAX_POOLED_SIZE{ 64 * 1024 };
+    static constexpr std::size_t ARENA_PAGE_SIZE{ 256 * 1024 };
+public:
+    ImGuiAllocator();
+    ~ImGuiAllocator();
+    ImGuiAllocator(const ImGuiAllocator&) = delete;
+    ImGuiAllocator(ImGuiAllocator&&) noexcept = delete;
+    ImGuiAllocator& operator=(const ImGuiAllocator&) = delete;
+    ImGuiAllocator& operator=(ImGuiAllocator&&) noexcept = delete;
+public:
+    void* Allocate(std::size_t size);
+    void Free(void* ptr);
+    // closes the statistics of the current frame and rewinds the arena if it is empty
+    void NewFrame();
+    ImGuiAllocatorStats Stats();
+public:
+    // ImGuiMemAllocFunc / ImGuiMemFreeFunc, user_data is the allocator
+    static void* ImGuiAlloc(std::size_t size, void* user_data);
+    static void ImGuiFree(void* ptr, void* user_data);
+private:
+    friend class ImGuiAllocatorArenaScope;
+    struct Header;
+    struct ArenaPage;
+    static constexpr std::size_t SIZE_CLASS_COUNT{ 13 }; // 16 B .. 64 KB
+private:
+    void* AllocateFromPool(std::size_t size_class);
+    void* AllocateFromArena(std::size_t size);
+    void ReleaseArenaPage(ArenaPage* page);
+    void* HeapAllocate(std::size_t size);
+private:
+    std::mutex m_mutex;
+    std::array<void*, SIZE_CLASS_COUNT> m_free_lists; // intrusive singly linked lists of free blocks
+    std::vector<void*> m_chunks; // pool memory, released on destruction
+    std::vector<ArenaPage*> m_arena_pages; // every page, released on destruction
+    std::vector<ArenaPage*> m_free_arena_pages;
+    ArenaPage* m_arena_page; // page being bumped, may be null
+    ImGuiAllocatorFrameStats m_frame;
+    ImGuiAllocatorFrameStats m_last_frame;
+    std::size_t m_live_bytes;
+    std::size_t m_peak_live_bytes;
+    std::size_t m_reserved_bytes;
+};
+
+// routes the ImGui allocations of the calling thread to the frame arena while alive; scopes nest
+class ImGuiAllocatorArenaScope
+{
+public:
+    ImGuiAllocatorArenaScope() noexcept;
+    ~ImGuiAllocatorArenaScope();
+    ImGuiAllocatorArenaScope(const ImGuiAllocatorArenaScope&) = delete;
+    ImGuiAllocatorArenaScope(ImGuiAllocatorArenaScope&&) noexcept = delete;
+    ImGuiAllocatorArenaScope& operator=(const ImGuiAllocatorArenaScope&) = delete;
+    ImGuiAllocatorArenaScope& operator=(ImGuiAllocatorArenaScope&&) noexcept = delete;
+};
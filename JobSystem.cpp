@@ -0,0 +1,162 @@
+#include <JobSystem.h>
+
+#include <Assertions.h>
+
+#include <algorithm>
+
+// ---------- Linear Allocator ----------
+
+LinearAllocator::LinearAllocator(std::size_t capacity)
+    : m_buffer{ std::make_unique<std::byte[]>(capacity) }
+    , m_capacity{ capacity }
+    , m_offset{}
+{
+}
+void* LinearAllocator::Allocate(std::size_t size, std::size_t alignment)
+{
+    Check(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    auto base{ reinterpret_cast<std::uintptr_t>(m_buffer.get()) };
+    std::uintptr_t aligned{ (base + m_offset + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1) };
+    std::size_t offset{ static_cast<std::size_t>(aligned - base) };
+    Check(offset + size <= m_capacity); // out of scratch memory
+
+    m_offset = offset + size;
+    return m_buffer.get() + offset;
+}
+
+// ---------- Job System ----------
+
+JobSystem::JobSystem(std::uint32_t worker_count, std::size_t allocator_capacity)
+    : m_threads{}
+    , m_allocators{}
+    , m_mutex{}
+    , m_wake_cv{}
+    , m_done_cv{}
+    , m_job{}
+    , m_slice_count{}
+    , m_next_slice{}
+    , m_active_workers{}
+    , m_generation{}
+    , m_exception{}
+    , m_quit{}
+{
+    Check(worker_count > 0);
+
+    m_allocators.reserve(worker_count);
+    for (std::uint32_t i{}; i < worker_count; i++)
+    {
+        m_allocators.emplace_back(allocator_capacity);
+    }
+
+    m_threads.reserve(worker_count);
+    for (std::uint32_t i{}; i < worker_count; i++)
+    {
+        m_threads.emplace_back([this, i]() { WorkerMain(i); });
+    }
+}
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard lock{ m_mutex };
+        m_quit = true;
+    }
+    m_wake_cv.notify_all();
+
+    for (std::thread& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+void JobSystem::ParallelFor(std::uint32_t slice_count, const JobFunction& job)
+{
+    if (slice_count == 0)
+    {
+        return;
+    }
+
+    for (LinearAllocator& allocator : m_allocators)
+    {
+        allocator.Reset();
+    }
+
+    // publish the job
+    {
+        std::lock_guard lock{ m_mutex };
+        m_job = &job;
+        m_slice_count = slice_count;
+        m_next_slice.store(0, std::memory_order_relaxed);
+        m_active_workers = WorkerCount();
+        m_exception = nullptr;
+        m_generation++;
+    }
+    m_wake_cv.notify_all();
+
+    // wait for every worker to run out of slices
+    std::exception_ptr exception{};
+    {
+        std::unique_lock lock{ m_mutex };
+        m_done_cv.wait(lock, [this]() { return m_active_workers == 0; });
+        m_job = nullptr;
+        exception = m_exception;
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+std::uint32_t JobSystem::DefaultWorkerCount() noexcept
+{
+    std::uint32_t hardware_threads{ std::thread::hardware_concurrency() };
+    return std::max(hardware_threads, 2u) - 1;
+}
+void JobSystem::WorkerMain(std::uint32_t worker)
+{
+    std::uint64_t seen_generation{};
+
+    while (true)
+    {
+        const JobFunction* job{};
+        std::uint32_t slice_count{};
+        {
+            std::unique_lock lock{ m_mutex };
+            m_wake_cv.wait(lock, [&]() { return m_quit || m_generation != seen_generation; });
+            if (m_quit)
+            {
+                return;
+            }
+            seen_generation = m_generation;
+            job = m_job;
+            slice_count = m_slice_count;
+        }
+
+        // grab slices until none are left
+        std::exception_ptr exception{};
+        for (std::uint32_t slice{ m_next_slice.fetch_add(1) }; slice < slice_count; slice = m_next_slice.fetch_add(1))
+        {
+            try
+            {
+                (*job)(worker, slice);
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+                m_next_slice.store(slice_count); // stop handing out slices
+            }
+        }
+
+        {
+            std::lock_guard lock{ m_mutex };
+            if (exception && !m_exception)
+            {
+                m_exception = exception;
+            }
+            m_active_workers--;
+            if (m_active_workers == 0)
+            {
+                m_done_cv.notify_one();
+            }
+        }
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ---------- Linear Allocator ----------
+
+// bump allocator over a fixed buffer; individual allocations are never freed, the whole buffer is recycled by Reset
+class LinearAllocator
+{
+public:
+    explicit LinearAllocator(std::size_t capacity);
+    ~LinearAllocator() = default;
+    LinearAllocator(const LinearAllocator&) = delete;
+    LinearAllocator(LinearAllocator&&) noexcept = default;
+    LinearAllocator& operator=(const LinearAllocator&) = delete;
+    LinearAllocator& operator=(LinearAllocator&&) noexcept = default;
+public:
+    void* Allocate(std::size_t size, std::size_t alignment);
+    template <typename T>
+    T* AllocateArray(std::size_t count) { return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T))); }
+    void Reset() noexcept { m_offset = 0; }
+    std::size_t Used() const noexcept { return m_offset; }
+    std::size_t Capacity() const noexcept { return m_capacity; }
+private:
+    std::unique_ptr<std::byte[]> m_buffer;
+    std::size_t m_capacity;
+    std::size_t m_offset;
+};
+
+// ---------- Job System ----------
+
+// job(worker_index, slice_index)
+using JobFunction = std::function<void(std::uint32_t, std::uint32_t)>;
+
+/*
+    fixed pool of worker threads executing slices of a parallel-for
+    each worker owns a linear allocator that is reset at the start of every dispatch
+    the calling thread only waits for completion, it never executes slices itself
+*/
+class JobSystem
+{
+public:
+    JobSystem(std::uint32_t worker_count, std::size_t allocator_capacity);
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem(JobSystem&&) noexcept = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+    JobSystem& operator=(JobSystem&&) noexcept = delete;
+public:
+    // run job for every slice in [0, slice_count) and block until all of them are done; rethrows the first exception thrown by a job
+    void ParallelFor(std::uint32_t slice_count, const JobFunction& job);
+    std::uint32_t WorkerCount() const noexcept { return static_cast<std::uint32_t>(m_threads.size()); }
+    LinearAllocator& Allocator(std::uint32_t worker) { return m_allocators.at(worker); }
+public:
+    // hardware concurrency minus the calling thread, at least one
+    static std::uint32_t DefaultWorkerCount() noexcept;
+private:
+    void WorkerMain(std::uint32_t worker);
+private:
+    std::vector<std::thread> m_threads;
+    std::vector<LinearAllocator> m_allocators;
+    std::mutex m_mutex;
+    std::condition_variable m_wake_cv;
+    std::condition_variable m_done_cv;
+    const JobFunction* m_job;
+    std::uint32_t m_slice_count;
+    std::atomic<std::uint32_t> m_next_slice;
+    std::uint32_t m_active_workers;
+    std::uint64_t m_generation;
+    std::exception_ptr m_exception;
+    bool m_quit;
+};
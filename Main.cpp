@@ -2,10 +2,21 @@
 
 #include <algorithm>
 #include <array> // for std::size
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
 #include <format>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
 #include <stacktrace>
 #include <stdexcept>
+#include <vector>
 
 // ---------- Windows ----------
 
@@ -14,55 +25,95 @@
 #include <Windows.h>
 
 #include <wrl/client.h> // for ComPtr
+#include <wrl/wrappers/corewrappers.h> // for HandleT
 namespace wrl = Microsoft::WRL;
 
 // ---------- DirectX Math ----------
 
 #include <DirectXMath.h>
+#include <DirectXCollision.h>
+#include <DirectXPackedVector.h> // for XMConvertHalfToFloat
 namespace dx = DirectX;
 
 // ---------- D3D11 and DXGI ----------
 
 #include <d3d11.h>
+#include <d3dcompiler.h>
 #include <dxgi1_3.h>
 #if defined(_DEBUG)
 #include <dxgidebug.h>
 #endif
 
 #pragma comment(lib, "d3d11")
+#pragma comment(lib, "d3dcompiler")
 #pragma comment(lib, "dxgi")
 #pragma comment(lib, "dxguid")
 
 // ---------- ImGui ----------
 
 #include <imgui.h>
+#include <imgui_internal.h> // for InputTextLarge, TableDataBeginRows
 #include <imgui_impl_win32.h>
 #include <imgui_impl_dx11.h>
+#include <imgui_impl_software.h>
 
 // ---------- HLSL Constant Buffers ----------
 
 #define matrix dx::XMFLOAT4X4
 #define float3 dx::XMFLOAT3
+#define uint UINT
 #include <ConstantBuffers.hlsli>
 #undef matrix
 #undef float3
+#undef uint
+
+// ---------- Project ----------
+
+#include <Assertions.h>
+#include <AtlasPackingBenchmark.h>
+#include <DataTableBenchmark.h>
+#include <FontBaking.h>
+#include <FramebufferSizing.h>
+#include <FramePacing.h>
+#include <IdHashBenchmark.h>
+#include <ImGuiAllocator.h>
+#include <JobSystem.h>
+#include <MaterialBrowser.h>
+#include <ParallelDrawLists.h>
+#include <PipelineState.h>
+#include <PlotBenchmark.h>
+#include <RenderCommands.h>
+#include <SettingsStore.h>
+#include <ShaderHotReload.h>
+#include <Shading.h>
+#include <StorageBenchmark.h>
+#include <TessellationBenchmark.h>
+#include <TextDocumentBenchmark.h>
+#include <TextFilterBenchmark.h>
+#include <Tonemap.h>
 
 // ---------- Shader Bytecode ----------
 
 #include <VS.h>
 #include <PS.h>
+#include <FullscreenVS.h>
+#include <TonemapPS.h>
+#include <HistogramCS.h>
+#include <ExposureCS.h>
 
 // ---------- Constants ----------
 
 constexpr const char* WIN32_WINDOW_CLASS_NAME{ "brdfs_window_class" };
 constexpr const char* WIN32_WINDOW_TITLE{ "BRDFs" };
 
-// ---------- Assertions ----------
+// the CPU tonemapping reference must agree with the shaders
+static_assert(static_cast<UINT>(TonemapOperator::Reinhard) == TONEMAP_OPERATOR_REINHARD);
+static_assert(static_cast<UINT>(TonemapOperator::ACES) == TONEMAP_OPERATOR_ACES);
+static_assert(static_cast<UINT>(TonemapOperator::AgX) == TONEMAP_OPERATOR_AGX);
+static_assert(EXPOSURE_HISTOGRAM_BIN_COUNT == EXPOSURE_HISTOGRAM_BINS);
 
-#define Crash(msg) throw std::runtime_error{ std::format("[CRASH]: {}\n{}", msg, std::stacktrace::current()) };
-#define Unreachable() Crash("unreachable code path")
-#define Check(p) do { if (!(p)) Crash("Assertion failed: " #p); } while (false)
-#define CheckHR(hr) Check(SUCCEEDED(hr))
+// the frame latency waitable object is always requested so that the frame pacing mode can change at runtime
+constexpr UINT SWAP_CHAIN_FLAGS{ DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT };
 
 // ---------- Global State ----------
 
@@ -173,7 +224,24 @@ static void SetupD3D11InfoQueue([[maybe_unused]] ID3D11Device* d3d_dev)
     #endif
 }
 
-static wrl::ComPtr<IDXGISwapChain1> CreateDXGISwapChain(ID3D11Device* d3d_dev, HWND hwnd)
+static wrl::ComPtr<ID3D11DeviceContext> CreateD3D11DeferredContext(ID3D11Device* d3d_dev)
+{
+    wrl::ComPtr<ID3D11DeviceContext> d3d_ctx{};
+    CheckHR(d3d_dev->CreateDeferredContext(0, d3d_ctx.ReleaseAndGetAddressOf()));
+    return d3d_ctx;
+}
+
+static Extent2D GetWindowClientExtent(HWND hwnd)
+{
+    RECT rect{};
+    Check(GetClientRect(hwnd, &rect)); // the right and bottom members contain the width and height of the window
+    constexpr LONG MIN_WINDOW_DIMENSION{ 8 };
+    auto width{ static_cast<std::uint32_t>(std::max(rect.right, MIN_WINDOW_DIMENSION)) }; // sanitize window size; having size 0 may yield to problems
+    auto height{ static_cast<std::uint32_t>(std::max(rect.bottom, MIN_WINDOW_DIMENSION)) }; // sanitize window size; having size 0 may yield to problems
+    return { width, height };
+}
+
+static wrl::ComPtr<IDXGISwapChain1> CreateDXGISwapChain(ID3D11Device* d3d_dev, HWND hwnd, Extent2D size)
 {
     // get dxgi device from d3d device
     wrl::ComPtr<IDXGIDevice> dxgi_dev{};
@@ -188,8 +256,8 @@ static wrl::ComPtr<IDXGISwapChain1> CreateDXGISwapChain(ID3D11Device* d3d_dev, H
     CheckHR(dxgi_adapter->GetParent(IID_PPV_ARGS(dxgi_factory.ReleaseAndGetAddressOf())));
 
     DXGI_SWAP_CHAIN_DESC1 desc{};
-    desc.Width = 0; // use window width
-    desc.Height = 0; // use window height
+    desc.Width = size.width; // may be larger than the window; scaling none crops the back buffer to the client area
+    desc.Height = size.height; // may be larger than the window; scaling none crops the back buffer to the client area
     desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
     desc.Stereo = false;
     desc.SampleDesc = { .Count = 1, .Quality = 0 };
@@ -198,7 +266,7 @@ static wrl::ComPtr<IDXGISwapChain1> CreateDXGISwapChain(ID3D11Device* d3d_dev, H
     desc.Scaling = DXGI_SCALING_NONE;
     desc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;
     desc.AlphaMode = DXGI_ALPHA_MODE_UNSPECIFIED;
-    desc.Flags = 0;
+    desc.Flags = SWAP_CHAIN_FLAGS;
 
     wrl::ComPtr<IDXGISwapChain1> swap_chain{};
     CheckHR(dxgi_factory->CreateSwapChainForHwnd(d3d_dev, hwnd, &desc, nullptr, nullptr, swap_chain.ReleaseAndGetAddressOf()));
@@ -222,11 +290,17 @@ public:
 public:
     ID3D11Texture2D* BackBuffer() const noexcept { return m_back_buffer.Get(); }
     ID3D11RenderTargetView* BackBufferRTV() const noexcept { return m_back_buffer_rtv.Get(); }
+    ID3D11Texture2D* SceneColor() const noexcept { return m_scene_color.Get(); }
+    ID3D11RenderTargetView* SceneColorRTV() const noexcept { return m_scene_color_rtv.Get(); }
+    ID3D11ShaderResourceView* SceneColorSRV() const noexcept { return m_scene_color_srv.Get(); }
     ID3D11Texture2D* DepthBuffer() const noexcept { return m_depth_buffer.Get(); }
     ID3D11DepthStencilView* DSV() const noexcept { return m_dsv.Get(); }
 private:
     wrl::ComPtr<ID3D11Texture2D> m_back_buffer;
     wrl::ComPtr<ID3D11RenderTargetView> m_back_buffer_rtv;
+    wrl::ComPtr<ID3D11Texture2D> m_scene_color;
+    wrl::ComPtr<ID3D11RenderTargetView> m_scene_color_rtv;
+    wrl::ComPtr<ID3D11ShaderResourceView> m_scene_color_srv;
     wrl::ComPtr<ID3D11Texture2D> m_depth_buffer;
     wrl::ComPtr<ID3D11DepthStencilView> m_dsv;
 };
@@ -234,6 +308,9 @@ private:
 Framebuffer::Framebuffer()
     : m_back_buffer{}
     , m_back_buffer_rtv{}
+    , m_scene_color{}
+    , m_scene_color_rtv{}
+    , m_scene_color_srv{}
     , m_depth_buffer{}
     , m_dsv{}
 {
@@ -248,10 +325,24 @@ Framebuffer::Framebuffer(ID3D11Device* d3d_dev, IDXGISwapChain1* swap_chain)
     CheckHR(d3d_dev->CreateRenderTargetView(m_back_buffer.Get(), nullptr, m_back_buffer_rtv.ReleaseAndGetAddressOf()));
 
     // get back buffer desc
-    D3D11_TEXTURE2D_DESC desc{};
-    m_back_buffer->GetDesc(&desc);
+    D3D11_TEXTURE2D_DESC back_buffer_desc{};
+    m_back_buffer->GetDesc(&back_buffer_desc);
+
+    // create linear HDR scene color buffer; it is tonemapped into the back buffer
+    {
+        D3D11_TEXTURE2D_DESC desc{ back_buffer_desc };
+        desc.Format = DXGI_FORMAT_R16G16B16A16_FLOAT;
+        desc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+        desc.Usage = D3D11_USAGE_DEFAULT;
+        desc.CPUAccessFlags = 0;
+        desc.MiscFlags = 0;
+        CheckHR(d3d_dev->CreateTexture2D(&desc, nullptr, m_scene_color.ReleaseAndGetAddressOf()));
+        CheckHR(d3d_dev->CreateRenderTargetView(m_scene_color.Get(), nullptr, m_scene_color_rtv.ReleaseAndGetAddressOf()));
+        CheckHR(d3d_dev->CreateShaderResourceView(m_scene_color.Get(), nullptr, m_scene_color_srv.ReleaseAndGetAddressOf()));
+    }
 
     // adapt back buffer desc for depth stencil buffer
+    D3D11_TEXTURE2D_DESC desc{ back_buffer_desc };
     desc.Format = DXGI_FORMAT_D32_FLOAT;
     desc.BindFlags = D3D11_BIND_DEPTH_STENCIL;
 
@@ -427,6 +518,7 @@ public:
     SubresourceMap& operator=(SubresourceMap&&) noexcept = delete;
 public:
     void* Data() { return m_mapped_subres.pData; }
+    UINT RowPitch() const noexcept { return m_mapped_subres.RowPitch; }
 private:
     ID3D11DeviceContext* m_d3d_ctx;
     ID3D11Resource* m_res;
@@ -447,219 +539,1427 @@ SubresourceMap::~SubresourceMap()
     m_d3d_ctx->Unmap(m_res, m_subres_idx);
 }
 
-// ---------- ImGui Utilities ----------
+// ---------- D3D11 Render Backend ----------
 
-class ImGuiHandle
+struct D3D11Pipeline
+{
+    wrl::ComPtr<ID3D11VertexShader> vs;
+    wrl::ComPtr<ID3D11PixelShader> ps;
+    wrl::ComPtr<ID3D11InputLayout> input_layout;
+    wrl::ComPtr<ID3D11RasterizerState> rs;
+    D3D11_PRIMITIVE_TOPOLOGY topology;
+};
+
+// tables of the resources referenced by render command handles
+class D3D11RenderResources
 {
 public:
-    ImGuiHandle(HWND hwnd, ID3D11Device* d3d_dev, ID3D11DeviceContext* d3d_ctx);
-    ~ImGuiHandle();
-    ImGuiHandle(const ImGuiHandle&) = delete;
-    ImGuiHandle(ImGuiHandle&) noexcept = delete;
-    ImGuiHandle& operator=(const ImGuiHandle&) = delete;
-    ImGuiHandle& operator=(ImGuiHandle&) noexcept = delete;
+    D3D11RenderResources(ID3D11Buffer* cb_scene, ID3D11Buffer* cb_object);
+    ~D3D11RenderResources() = default;
+    D3D11RenderResources(const D3D11RenderResources&) = delete;
+    D3D11RenderResources(D3D11RenderResources&&) noexcept = delete;
+    D3D11RenderResources& operator=(const D3D11RenderResources&) = delete;
+    D3D11RenderResources& operator=(D3D11RenderResources&&) noexcept = delete;
 public:
-    void BeginFrame() const noexcept;
-    void EndFrame(ID3D11RenderTargetView* rtv) const noexcept;
+    RenderPipelineHandle AddPipeline(D3D11Pipeline pipeline);
+    RenderMeshHandle AddMesh(const Mesh* mesh);
+    const D3D11Pipeline& Pipeline(RenderPipelineHandle handle) const { return m_pipelines.at(handle); }
+    const Mesh& GetMesh(RenderMeshHandle handle) const { return *m_meshes.at(handle); }
+    ID3D11Buffer* SceneCB() const noexcept { return m_cb_scene; }
+    ID3D11Buffer* ObjectCB() const noexcept { return m_cb_object; }
 private:
-    ID3D11DeviceContext* m_d3d_ctx;
+    std::vector<D3D11Pipeline> m_pipelines;
+    std::vector<const Mesh*> m_meshes;
+    ID3D11Buffer* m_cb_scene;
+    ID3D11Buffer* m_cb_object;
 };
 
-ImGuiHandle::ImGuiHandle(HWND hwnd, ID3D11Device* d3d_dev, ID3D11DeviceContext* d3d_ctx)
-    : m_d3d_ctx{ d3d_ctx }
+D3D11RenderResources::D3D11RenderResources(ID3D11Buffer* cb_scene, ID3D11Buffer* cb_object)
+    : m_pipelines{}
+    , m_meshes{}
+    , m_cb_scene{ cb_scene }
+    , m_cb_object{ cb_object }
 {
-    // Make process DPI aware and obtain main monitor scale
-    //ImGui_ImplWin32_EnableDpiAwareness();
-    //float main_scale = ImGui_ImplWin32_GetDpiScaleForMonitor(::MonitorFromPoint(POINT{ 0, 0 }, MONITOR_DEFAULTTOPRIMARY));
+}
+RenderPipelineHandle D3D11RenderResources::AddPipeline(D3D11Pipeline pipeline)
+{
+    Check(m_pipelines.size() < std::numeric_limits<RenderPipelineHandle>::max());
+    m_pipelines.emplace_back(std::move(pipeline));
+    return static_cast<RenderPipelineHandle>(m_pipelines.size() - 1);
+}
+RenderMeshHandle D3D11RenderResources::AddMesh(const Mesh* mesh)
+{
+    Check(mesh);
+    Check(m_meshes.size() < std::numeric_limits<RenderMeshHandle>::max());
+    m_meshes.emplace_back(mesh);
+    return static_cast<RenderMeshHandle>(m_meshes.size() - 1);
+}
 
-    // Setup Dear ImGui context
-    IMGUI_CHECKVERSION();
-    ImGui::CreateContext();
-    ImGuiIO& io = ImGui::GetIO(); (void)io;
-    //io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;     // Enable Keyboard Controls
-    //io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
+// everything a D3D11Pipeline is created from; the spans are only read during D3D11PipelineStateCache::Acquire
+struct D3D11PipelineDesc
+{
+    std::span<const std::uint8_t> vs_bytecode;
+    std::span<const std::uint8_t> ps_bytecode;
+    std::span<const D3D11_INPUT_ELEMENT_DESC> input_elements;
+    D3D11_RASTERIZER_DESC rasterizer;
+    D3D11_PRIMITIVE_TOPOLOGY topology;
+};
 
-    // Setup Dear ImGui style
-    ImGui::StyleColorsDark();
-    //ImGui::StyleColorsLight();
+// creates pipelines and their states once per distinct description, and adds the pipelines to the render resources
+class D3D11PipelineStateCache
+{
+public:
+    D3D11PipelineStateCache(ID3D11Device* d3d_dev, D3D11RenderResources* resources);
+    ~D3D11PipelineStateCache() = default;
+    D3D11PipelineStateCache(const D3D11PipelineStateCache&) = delete;
+    D3D11PipelineStateCache(D3D11PipelineStateCache&&) noexcept = delete;
+    D3D11PipelineStateCache& operator=(const D3D11PipelineStateCache&) = delete;
+    D3D11PipelineStateCache& operator=(D3D11PipelineStateCache&&) noexcept = delete;
+public:
+    // the same handle for the same description; states shared with other pipelines are reused
+    RenderPipelineHandle Acquire(const D3D11PipelineDesc& desc);
+    PipelineCacheStats Stats(PipelineObjectKind kind) const { return m_cache.Stats(kind); }
+private:
+    ID3D11Device* m_d3d_dev;
+    D3D11RenderResources* m_resources;
+    PipelineStateCache m_cache;
+    std::vector<wrl::ComPtr<ID3D11VertexShader>> m_vertex_shaders;
+    std::vector<wrl::ComPtr<ID3D11PixelShader>> m_pixel_shaders;
+    std::vector<wrl::ComPtr<ID3D11InputLayout>> m_input_layouts;
+    std::vector<wrl::ComPtr<ID3D11RasterizerState>> m_rasterizer_states;
+};
 
-    // Setup scaling
-    //ImGuiStyle& style = ImGui::GetStyle();
-    //style.ScaleAllSizes(main_scale);        // Bake a fixed style scale. (until we have a solution for dynamic style scaling, changing this requires resetting Style + calling this again)
-    //style.FontScaleDpi = main_scale;        // Set initial font scale. (using io.ConfigDpiScaleFonts=true makes this unnecessary. We leave both here for documentation purpose)
+D3D11PipelineStateCache::D3D11PipelineStateCache(ID3D11Device* d3d_dev, D3D11RenderResources* resources)
+    : m_d3d_dev{ d3d_dev }
+    , m_resources{ resources }
+    , m_cache{}
+    , m_vertex_shaders{}
+    , m_pixel_shaders{}
+    , m_input_layouts{}
+    , m_rasterizer_states{}
+{
+    Check(m_resources);
+}
+RenderPipelineHandle D3D11PipelineStateCache::Acquire(const D3D11PipelineDesc& desc)
+{
+    // vertex shader
+    PipelineStateKey vs_key{ PipelineStateHasher{}.Bytes(desc.vs_bytecode).Key() };
+    PipelineObjectId vs{ m_cache.Acquire(PipelineObjectKind::VertexShader, vs_key, [&]()
+    {
+        wrl::ComPtr<ID3D11VertexShader> shader{};
+        CheckHR(m_d3d_dev->CreateVertexShader(desc.vs_bytecode.data(), desc.vs_bytecode.size(), nullptr, shader.ReleaseAndGetAddressOf()));
+        m_vertex_shaders.emplace_back(std::move(shader));
+        return static_cast<PipelineObjectId>(m_vertex_shaders.size() - 1);
+    }) };
+
+    // pixel shader
+    PipelineStateKey ps_key{ PipelineStateHasher{}.Bytes(desc.ps_bytecode).Key() };
+    PipelineObjectId ps{ m_cache.Acquire(PipelineObjectKind::PixelShader, ps_key, [&]()
+    {
+        wrl::ComPtr<ID3D11PixelShader> shader{};
+        CheckHR(m_d3d_dev->CreatePixelShader(desc.ps_bytecode.data(), desc.ps_bytecode.size(), nullptr, shader.ReleaseAndGetAddressOf()));
+        m_pixel_shaders.emplace_back(std::move(shader));
+        return static_cast<PipelineObjectId>(m_pixel_shaders.size() - 1);
+    }) };
+
+    // input layout; it is validated against the input signature of the vertex shader, which makes the shader part of the key
+    PipelineStateHasher input_layout_hasher{};
+    input_layout_hasher.Value(vs_key);
+    for (const D3D11_INPUT_ELEMENT_DESC& element : desc.input_elements)
+    {
+        input_layout_hasher.String(element.SemanticName).Value(element.SemanticIndex).Value(element.Format).Value(element.InputSlot);
+        input_layout_hasher.Value(element.AlignedByteOffset).Value(element.InputSlotClass).Value(element.InstanceDataStepRate);
+    }
+    PipelineStateKey input_layout_key{ input_layout_hasher.Key() };
+    PipelineObjectId input_layout{ m_cache.Acquire(PipelineObjectKind::InputLayout, input_layout_key, [&]()
+    {
+        wrl::ComPtr<ID3D11InputLayout> layout{};
+        CheckHR(m_d3d_dev->CreateInputLayout(desc.input_elements.data(), static_cast<UINT>(desc.input_elements.size()), desc.vs_bytecode.data(), desc.vs_bytecode.size(), layout.ReleaseAndGetAddressOf()));
+        m_input_layouts.emplace_back(std::move(layout));
+        return static_cast<PipelineObjectId>(m_input_layouts.size() - 1);
+    }) };
+
+    // rasterizer state; the desc has no padding or pointers, so its bytes are the key
+    PipelineStateKey rasterizer_key{ PipelineStateHasher{}.Value(desc.rasterizer).Key() };
+    PipelineObjectId rasterizer{ m_cache.Acquire(PipelineObjectKind::RasterizerState, rasterizer_key, [&]()
+    {
+        wrl::ComPtr<ID3D11RasterizerState> state{};
+        CheckHR(m_d3d_dev->CreateRasterizerState(&desc.rasterizer, state.ReleaseAndGetAddressOf()));
+        m_rasterizer_states.emplace_back(std::move(state));
+        return static_cast<PipelineObjectId>(m_rasterizer_states.size() - 1);
+    }) };
+
+    // pipeline
+    PipelineStateKey pipeline_key{ PipelineStateHasher{}.Value(vs_key).Value(ps_key).Value(input_layout_key).Value(rasterizer_key).Value(desc.topology).Key() };
+    PipelineObjectId pipeline{ m_cache.Acquire(PipelineObjectKind::Pipeline, pipeline_key, [&]()
+    {
+        return static_cast<PipelineObjectId>(m_resources->AddPipeline({ m_vertex_shaders[vs], m_pixel_shaders[ps], m_input_layouts[input_layout], m_rasterizer_states[rasterizer], desc.topology }));
+    }) };
+    return static_cast<RenderPipelineHandle>(pipeline);
+}
 
-    // Setup Platform/Renderer backends
-    ImGui_ImplWin32_Init(hwnd);
-    ImGui_ImplDX11_Init(d3d_dev, m_d3d_ctx);
+// replays render command lists on a D3D11 device context
+class D3D11RenderBackend : public RenderBackend
+{
+public:
+    D3D11RenderBackend(const D3D11RenderResources* resources, ID3D11DeviceContext* d3d_ctx);
+    ~D3D11RenderBackend() = default;
+    D3D11RenderBackend(const D3D11RenderBackend&) = delete;
+    D3D11RenderBackend(D3D11RenderBackend&&) noexcept = delete;
+    D3D11RenderBackend& operator=(const D3D11RenderBackend&) = delete;
+    D3D11RenderBackend& operator=(D3D11RenderBackend&&) noexcept = delete;
+public:
+    // bind output merger and rasterizer targets; pipeline state is bound lazily by the replayed commands
+    void BeginPass(ID3D11RenderTargetView* rtv, ID3D11DepthStencilView* dsv, const D3D11_VIEWPORT& viewport);
+public:
+    void SetPipeline(RenderPipelineHandle pipeline) override;
+    void SetMesh(RenderMeshHandle mesh) override;
+    void SetObjectConstants(const void* data, std::uint32_t size) override;
+    void DrawIndexed(std::uint32_t index_count, std::uint32_t start_index, std::int32_t base_vertex) override;
+private:
+    const D3D11RenderResources* m_resources;
+    ID3D11DeviceContext* m_d3d_ctx;
+};
 
-    // Load Fonts
-    // - If no fonts are loaded, dear imgui will use the default font. You can also load multiple fonts and use ImGui::PushFont()/PopFont() to select them.
-    // - AddFontFromFileTTF() will return the ImFont* so you can store it if you need to select the font among multiple.
-    // - If the file cannot be loaded, the function will return a nullptr. Please handle those errors in your application (e.g. use an assertion, or display an error and quit).
-    // - Use '#define IMGUI_ENABLE_FREETYPE' in your imconfig file to use Freetype for higher quality font rendering.
-    // - Read 'docs/FONTS.md' for more instructions and details.
-    // - Remember that in C/C++ if you want to include a backslash \ in a string literal you need to write a double backslash \\ !
-    //style.FontSizeBase = 20.0f;
-    //io.Fonts->AddFontDefault();
-    //io.Fonts->AddFontFromFileTTF("c:\\Windows\\Fonts\\segoeui.ttf");
-    //io.Fonts->AddFontFromFileTTF("../../misc/fonts/DroidSans.ttf");
-    //io.Fonts->AddFontFromFileTTF("../../misc/fonts/Roboto-Medium.ttf");
-    //io.Fonts->AddFontFromFileTTF("../../misc/fonts/Cousine-Regular.ttf");
-    //ImFont* font = io.Fonts->AddFontFromFileTTF("c:\\Windows\\Fonts\\ArialUni.ttf");
-    //IM_ASSERT(font != nullptr);
+D3D11RenderBackend::D3D11RenderBackend(const D3D11RenderResources* resources, ID3D11DeviceContext* d3d_ctx)
+    : m_resources{ resources }
+    , m_d3d_ctx{ d3d_ctx }
+{
 }
-ImGuiHandle::~ImGuiHandle()
+void D3D11RenderBackend::BeginPass(ID3D11RenderTargetView* rtv, ID3D11DepthStencilView* dsv, const D3D11_VIEWPORT& viewport)
 {
-    ImGui_ImplDX11_Shutdown();
-    ImGui_ImplWin32_Shutdown();
-    ImGui::DestroyContext();
+    m_d3d_ctx->RSSetViewports(1, &viewport);
+    m_d3d_ctx->OMSetRenderTargets(1, &rtv, dsv);
 }
-void ImGuiHandle::BeginFrame() const noexcept
+void D3D11RenderBackend::SetPipeline(RenderPipelineHandle pipeline)
 {
-    ImGui_ImplDX11_NewFrame();
-    ImGui_ImplWin32_NewFrame();
-    ImGui::NewFrame();
+    const D3D11Pipeline& p{ m_resources->Pipeline(pipeline) };
+    ID3D11Buffer* cbufs[]{ m_resources->SceneCB(), m_resources->ObjectCB() };
+
+    m_d3d_ctx->IASetPrimitiveTopology(p.topology);
+    m_d3d_ctx->IASetInputLayout(p.input_layout.Get());
+    m_d3d_ctx->VSSetShader(p.vs.Get(), nullptr, 0);
+    m_d3d_ctx->VSSetConstantBuffers(0, std::size(cbufs), cbufs);
+    m_d3d_ctx->PSSetShader(p.ps.Get(), nullptr, 0);
+    m_d3d_ctx->PSSetConstantBuffers(0, std::size(cbufs), cbufs);
+    m_d3d_ctx->RSSetState(p.rs.Get());
 }
-void ImGuiHandle::EndFrame(ID3D11RenderTargetView* rtv) const noexcept
+void D3D11RenderBackend::SetMesh(RenderMeshHandle mesh)
 {
-    ImGui::Render();
-    m_d3d_ctx->OMSetRenderTargets(1, &rtv, nullptr);
-    ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+    const Mesh& m{ m_resources->GetMesh(mesh) };
+    m_d3d_ctx->IASetIndexBuffer(m.Indices(), m.IndexFormat(), 0);
+    m_d3d_ctx->IASetVertexBuffers(0, 1, m.Vertices(), m.Stride(), m.Offset());
+}
+void D3D11RenderBackend::SetObjectConstants(const void* data, std::uint32_t size)
+{
+    SubresourceMap map{ m_d3d_ctx, m_resources->ObjectCB(), 0, D3D11_MAP_WRITE_DISCARD, 0 };
+    std::memcpy(map.Data(), data, size);
+}
+void D3D11RenderBackend::DrawIndexed(std::uint32_t index_count, std::uint32_t start_index, std::int32_t base_vertex)
+{
+    m_d3d_ctx->DrawIndexed(index_count, start_index, base_vertex);
 }
 
-namespace ImGuiEx
+// records a command list on a deferred context so that it can be built off the main thread and executed later
+class D3D11DeferredSlice
 {
-    bool DragFloat3(const char* label, DirectX::XMFLOAT3& v, float v_speed = 1.0f, float v_min = 0.0f, float v_max = 0.0f, const char* format = "%.3f", ImGuiSliderFlags flags = 0)
+public:
+    D3D11DeferredSlice(ID3D11Device* d3d_dev, const D3D11RenderResources* resources);
+    ~D3D11DeferredSlice() = default;
+    D3D11DeferredSlice(const D3D11DeferredSlice&) = delete;
+    D3D11DeferredSlice(D3D11DeferredSlice&&) noexcept = delete;
+    D3D11DeferredSlice& operator=(const D3D11DeferredSlice&) = delete;
+    D3D11DeferredSlice& operator=(D3D11DeferredSlice&&) noexcept = delete;
+public:
+    // replay the recorded commands into the deferred context and close them into a d3d11 command list
+    void Finish(ID3D11RenderTargetView* rtv, ID3D11DepthStencilView* dsv, const D3D11_VIEWPORT& viewport);
+public:
+    RenderCommandList& Commands() noexcept { return m_commands; }
+    ID3D11CommandList* CommandList() const noexcept { return m_command_list.Get(); }
+    const RenderReplayStats& Stats() const noexcept { return m_stats; }
+private:
+    wrl::ComPtr<ID3D11DeviceContext> m_deferred_ctx;
+    D3D11RenderBackend m_backend;
+    RenderCommandList m_commands;
+    wrl::ComPtr<ID3D11CommandList> m_command_list;
+    RenderReplayStats m_stats;
+};
+
+D3D11DeferredSlice::D3D11DeferredSlice(ID3D11Device* d3d_dev, const D3D11RenderResources* resources)
+    : m_deferred_ctx{ CreateD3D11DeferredContext(d3d_dev) }
+    , m_backend{ resources, m_deferred_ctx.Get() }
+    , m_commands{}
+    , m_command_list{}
+    , m_stats{}
+{
+}
+void D3D11DeferredSlice::Finish(ID3D11RenderTargetView* rtv, ID3D11DepthStencilView* dsv, const D3D11_VIEWPORT& viewport)
+{
+    m_backend.BeginPass(rtv, dsv, viewport);
+    m_stats = m_commands.Replay(m_backend);
+    CheckHR(m_deferred_ctx->FinishCommandList(false, m_command_list.ReleaseAndGetAddressOf()));
+}
+
+// ---------- Shader Compilation ----------
+
+// serves the includes of a ShaderSource from memory, so that the compiler reads exactly the sources that were hashed
+class D3DShaderSourceInclude : public ID3DInclude
+{
+public:
+    explicit D3DShaderSourceInclude(const ShaderSource* source);
+public:
+    HRESULT __stdcall Open(D3D_INCLUDE_TYPE type, LPCSTR file_name, LPCVOID parent_data, LPCVOID* data, UINT* bytes) override;
+    HRESULT __stdcall Close(LPCVOID data) override;
+private:
+    const ShaderSource* m_source;
+};
+
+D3DShaderSourceInclude::D3DShaderSourceInclude(const ShaderSource* source)
+    : m_source{ source }
+{
+}
+HRESULT __stdcall D3DShaderSourceInclude::Open(D3D_INCLUDE_TYPE, LPCSTR file_name, LPCVOID parent_data, LPCVOID* data, UINT* bytes)
+{
+    // includes are relative to the including file, which the compiler identifies by the text it got from a previous Open
+    const std::filesystem::path* parent_path{ &m_source->files.front().path };
+    for (const ShaderSourceFile& file : m_source->files)
     {
-        float buf[3]{ v.x, v.y, v.z };
-        bool res{ ImGui::DragFloat3(label, buf, v_speed, v_min, v_max, format, flags) };
-        v.x = buf[0];
-        v.y = buf[1];
-        v.z = buf[2];
-        return res;
+        if (file.text.data() == parent_data)
+        {
+            parent_path = &file.path;
+        }
     }
-    bool ColorEdit3(const char* label, DirectX::XMFLOAT3& col, ImGuiColorEditFlags flags = 0)
+
+    std::filesystem::path path{ (parent_path->parent_path() / file_name).lexically_normal() };
+    for (const ShaderSourceFile& file : m_source->files)
     {
-        float buf[3]{ col.x, col.y, col.z };
-        bool res{ ImGui::ColorEdit3(label, buf, flags) };
-        col.x = buf[0];
-        col.y = buf[1];
-        col.z = buf[2];
-        return res;
+        if (file.path == path)
+        {
+            *data = file.text.data();
+            *bytes = static_cast<UINT>(file.text.size());
+            return S_OK;
+        }
     }
+    return E_FAIL;
+}
+HRESULT __stdcall D3DShaderSourceInclude::Close(LPCVOID)
+{
+    return S_OK;
 }
 
-// ---------- Entry Point ----------
-
-static void Entry()
+// runtime counterpart of the FxCompile build step, for shader hot reload; runs on the reload thread
+static ShaderCompileResult CompileHLSL(const ShaderCompileRequest& request)
 {
-    // make process DPI aware
-    Check(SetProcessDpiAwarenessContext(DPI_AWARENESS_CONTEXT_SYSTEM_AWARE));
+    const ShaderSourceFile& main_file{ request.source->files.front() };
+    D3DShaderSourceInclude include{ request.source };
 
-    // register win32 window class
-    RegisterWin32WindowClass();
+    UINT flags{ D3DCOMPILE_ENABLE_STRICTNESS | D3DCOMPILE_WARNINGS_ARE_ERRORS }; // warnings are errors at build time too
+#if defined(_DEBUG)
+    flags |= D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
+#else
+    flags |= D3DCOMPILE_OPTIMIZATION_LEVEL3;
+#endif
 
-    // create win32 window
-    HWND window{ CreateWin32Window() };
+    std::vector<D3D_SHADER_MACRO> macros{};
+    for (const ShaderDefine& define : request.defines)
+    {
+        macros.push_back({ define.name.c_str(), define.value.c_str() });
+    }
+    macros.push_back({ nullptr, nullptr }); // terminator
 
-    // setup dxgi info queue
-    SetupDXGIInforQueue();
+    wrl::ComPtr<ID3DBlob> code{};
+    wrl::ComPtr<ID3DBlob> errors{};
+    std::string source_name{ main_file.path.string() };
+    HRESULT hr{ D3DCompile(main_file.text.data(), main_file.text.size(), source_name.c_str(), macros.data(), &include, request.entry_point, request.target, flags, 0, code.GetAddressOf(), errors.GetAddressOf()) };
 
-    // create d3d11 device
-    wrl::ComPtr<ID3D11Device> d3d_dev{ CreateD3D11Device() };
+    ShaderCompileResult result{};
+    result.success = SUCCEEDED(hr) && code;
+    if (errors)
+    {
+        result.log.assign(static_cast<const char*>(errors->GetBufferPointer()), errors->GetBufferSize());
+    }
+    if (result.success)
+    {
+        auto begin{ static_cast<const std::uint8_t*>(code->GetBufferPointer()) };
+        result.bytecode.assign(begin, begin + code->GetBufferSize());
+    }
+    return result;
+}
 
-    // setup d3d11 info queue
-    SetupD3D11InfoQueue(d3d_dev.Get());
+static_assert(static_cast<std::uint32_t>(BrdfModel::Lambert) == BRDF_MODEL_LAMBERT);
+static_assert(static_cast<std::uint32_t>(BrdfModel::BlinnPhong) == BRDF_MODEL_BLINN_PHONG);
+static_assert(static_cast<std::uint32_t>(BrdfModel::GGX) == BRDF_MODEL_GGX);
+static_assert(static_cast<std::uint32_t>(ShadingFeature::Fresnel) == SHADING_FEATURE_FRESNEL);
+static_assert(static_cast<std::uint32_t>(ShadingFeature::Ambient) == SHADING_FEATURE_AMBIENT);
+
+/*
+    pipelines of one pixel shader source, one per shading permutation, each compiled with BRDF_MODEL and SHADING_FEATURES defined
+    the default permutation starts from the bytecode built with the project; the others are compiled by the reload thread
+    the first time they are requested, so only the permutations actually used are ever built, and the cache keeps them across runs
+*/
+class ShadingPipelines
+{
+public:
+    // desc.ps_bytecode is the built-in bytecode of the default permutation; desc.vs_bytecode and desc.input_elements must outlive this
+    ShadingPipelines(ShaderHotReload* reload, D3D11PipelineStateCache* pipeline_states, std::filesystem::path path, const D3D11PipelineDesc& desc);
+    ~ShadingPipelines() = default;
+    ShadingPipelines(const ShadingPipelines&) = delete;
+    ShadingPipelines(ShadingPipelines&&) noexcept = delete;
+    ShadingPipelines& operator=(const ShadingPipelines&) = delete;
+    ShadingPipelines& operator=(ShadingPipelines&&) noexcept = delete;
+public:
+    // empty until the variant is built; requests it on first use
+    std::optional<RenderPipelineHandle> Find(ShadingPermutationKey key);
+    // acquires the pipelines of the bytecode the reload thread published since the previous call
+    void ApplyReloads();
+private:
+    struct Variant
+    {
+        std::optional<ShaderProgramHandle> program; // not requested yet when empty
+        std::optional<RenderPipelineHandle> pipeline;
+    };
+private:
+    ShaderHotReload* m_reload;
+    D3D11PipelineStateCache* m_pipeline_states;
+    std::filesystem::path m_path;
+    D3D11PipelineDesc m_desc;
+    std::array<Variant, SHADING_PERMUTATION_COUNT> m_variants;
+};
 
-    // get d3d11 immediate device context
-    wrl::ComPtr<ID3D11DeviceContext> d3d_ctx{};
-    d3d_dev->GetImmediateContext(d3d_ctx.ReleaseAndGetAddressOf());
+ShadingPipelines::ShadingPipelines(ShaderHotReload* reload, D3D11PipelineStateCache* pipeline_states, std::filesystem::path path, const D3D11PipelineDesc& desc)
+    : m_reload{ reload }
+    , m_pipeline_states{ pipeline_states }
+    , m_path{ std::move(path) }
+    , m_desc{ desc }
+    , m_variants{}
+{
+    Variant& variant{ m_variants[SHADING_DEFAULT_PERMUTATION] };
+    variant.pipeline = m_pipeline_states->Acquire(m_desc);
+    variant.program = m_reload->AddShader(m_path, "main", "ps_5_0", {}, m_desc.ps_bytecode);
+    m_desc.ps_bytecode = {}; // replaced by the bytecode of each variant
+}
+std::optional<RenderPipelineHandle> ShadingPipelines::Find(ShadingPermutationKey key)
+{
+    Variant& variant{ m_variants.at(key) };
+    if (!variant.program)
+    {
+        std::vector<ShaderDefine> defines{};
+        defines.push_back({ "BRDF_MODEL", std::to_string(static_cast<std::uint32_t>(ShadingPermutationModel(key))) });
+        defines.push_back({ "SHADING_FEATURES", std::to_string(ShadingPermutationFeatures(key)) });
+        variant.program = m_reload->AddShader(m_path, "main", "ps_5_0", std::move(defines), {});
+    }
+    return variant.pipeline;
+}
+void ShadingPipelines::ApplyReloads()
+{
+    for (const ShaderReload& reload : m_reload->TakeReloads())
+    {
+        auto variant{ std::find_if(m_variants.begin(), m_variants.end(), [&](const Variant& v) { return v.program == reload.program; }) };
+        if (variant != m_variants.end())
+        {
+            // permutations that compile to the same bytecode share their pixel shader and pipeline
+            D3D11PipelineDesc desc{ m_desc };
+            desc.ps_bytecode = *reload.bytecode;
+            variant->pipeline = m_pipeline_states->Acquire(desc);
+        }
+    }
+}
 
-    // create swap chain
-    wrl::ComPtr<IDXGISwapChain1> swap_chain{ CreateDXGISwapChain(d3d_dev.Get(), window) }; // TODO: it will be used
+// ---------- Tonemapping ----------
 
-    // create framebuffer
-    Framebuffer framebuffer{ d3d_dev.Get(), swap_chain.Get() };
+struct TonemapSettings
+{
+    TonemapOperator tonemap_operator;
+    bool auto_exposure;
+    float exposure_ev; // manual exposure, or exposure compensation when auto exposure is enabled
+    float adaptation_speed; // how fast the average luminance converges, per second
+    float min_log_luminance;
+    float log_luminance_range;
+};
 
-    // initialize ImGui
-    ImGuiHandle imgui_handle{ window, d3d_dev.Get(), d3d_ctx.Get() };
+// the CPU reference (Tonemap.h) run on a readback of one frame, against what the GPU computed for it
+struct TonemapComparison
+{
+    std::uint32_t pixel_count;
+    bool auto_exposure; // the histogram and the average luminance were compared too
+    std::uint32_t histogram_mismatches; // pixels the CPU reference binned differently
+    float gpu_average_luminance; // adapted
+    float cpu_average_luminance;
+    std::uint32_t max_channel_difference; // between the back buffer and the CPU reference, in 8 bit steps
+    std::uint32_t pixels_over_tolerance; // with a channel differing by more than TONEMAP_COMPARISON_TOLERANCE
+};
 
-    // shaders
-    wrl::ComPtr<ID3D11VertexShader> vs{};
-    CheckHR(d3d_dev->CreateVertexShader(VS_bytes, sizeof(VS_bytes), nullptr, vs.ReleaseAndGetAddressOf()));
-    wrl::ComPtr<ID3D11PixelShader> ps{};
-    CheckHR(d3d_dev->CreatePixelShader(PS_bytes, sizeof(PS_bytes), nullptr, ps.ReleaseAndGetAddressOf()));
+// the CPU reference approximates log2 and exp2, which may round a channel to the neighbouring step
+constexpr std::uint32_t TONEMAP_COMPARISON_TOLERANCE{ 1 };
 
-    // input layout
-    wrl::ComPtr<ID3D11InputLayout> input_layout{};
-    {
-        D3D11_INPUT_ELEMENT_DESC desc[]
-        {
-            { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-        };
-        CheckHR(d3d_dev->CreateInputLayout(desc, std::size(desc), VS_bytes, sizeof(VS_bytes), input_layout.ReleaseAndGetAddressOf()));
-    }
+// resolves the HDR scene color into the back buffer, optionally driving exposure from a GPU luminance histogram
+class TonemapPass
+{
+public:
+    TonemapPass(ID3D11Device* d3d_dev);
+    ~TonemapPass() = default;
+    TonemapPass(const TonemapPass&) = delete;
+    TonemapPass(TonemapPass&&) noexcept = delete;
+    TonemapPass& operator=(const TonemapPass&) = delete;
+    TonemapPass& operator=(TonemapPass&&) noexcept = delete;
+public:
+    // comparison, when not null, receives the frame checked against the CPU reference; this stalls on readbacks
+    void Render(ID3D11DeviceContext* d3d_ctx, const Framebuffer& framebuffer, const D3D11_VIEWPORT& viewport, const TonemapSettings& settings, float delta_time, TonemapComparison* comparison = nullptr);
+private:
+    wrl::ComPtr<ID3D11VertexShader> m_fullscreen_vs;
+    wrl::ComPtr<ID3D11PixelShader> m_tonemap_ps;
+    wrl::ComPtr<ID3D11ComputeShader> m_histogram_cs;
+    wrl::ComPtr<ID3D11ComputeShader> m_exposure_cs;
+    wrl::ComPtr<ID3D11Buffer> m_cb_tonemap;
+    wrl::ComPtr<ID3D11Buffer> m_histogram;
+    wrl::ComPtr<ID3D11UnorderedAccessView> m_histogram_uav;
+    wrl::ComPtr<ID3D11Buffer> m_average_luminance;
+    wrl::ComPtr<ID3D11UnorderedAccessView> m_average_luminance_uav;
+    wrl::ComPtr<ID3D11ShaderResourceView> m_average_luminance_srv;
+};
 
-    // default rasterizer state
-    wrl::ComPtr<ID3D11RasterizerState> rs_default{};
-    {
-        D3D11_RASTERIZER_DESC desc{};
-        desc.FillMode = D3D11_FILL_SOLID;
-        desc.CullMode = D3D11_CULL_BACK;
-        desc.FrontCounterClockwise = false;
-        desc.DepthBias = 0;
-        desc.DepthBiasClamp = 0.0f;
-        desc.SlopeScaledDepthBias = 0.0f;
-        desc.DepthClipEnable = true;
-        desc.ScissorEnable = false;
-        desc.MultisampleEnable = false;
-        desc.AntialiasedLineEnable = false;
-        CheckHR(d3d_dev->CreateRasterizerState(&desc, rs_default.ReleaseAndGetAddressOf()));
-    }
+TonemapPass::TonemapPass(ID3D11Device* d3d_dev)
+    : m_fullscreen_vs{}
+    , m_tonemap_ps{}
+    , m_histogram_cs{}
+    , m_exposure_cs{}
+    , m_cb_tonemap{}
+    , m_histogram{}
+    , m_histogram_uav{}
+    , m_average_luminance{}
+    , m_average_luminance_uav{}
+    , m_average_luminance_srv{}
+{
+    // shaders
+    CheckHR(d3d_dev->CreateVertexShader(FullscreenVS_bytes, sizeof(FullscreenVS_bytes), nullptr, m_fullscreen_vs.ReleaseAndGetAddressOf()));
+    CheckHR(d3d_dev->CreatePixelShader(TonemapPS_bytes, sizeof(TonemapPS_bytes), nullptr, m_tonemap_ps.ReleaseAndGetAddressOf()));
+    CheckHR(d3d_dev->CreateComputeShader(HistogramCS_bytes, sizeof(HistogramCS_bytes), nullptr, m_histogram_cs.ReleaseAndGetAddressOf()));
+    CheckHR(d3d_dev->CreateComputeShader(ExposureCS_bytes, sizeof(ExposureCS_bytes), nullptr, m_exposure_cs.ReleaseAndGetAddressOf()));
 
-    // scene constant buffer
-    wrl::ComPtr<ID3D11Buffer> cb_scene{};
+    // tonemap constant buffer
     {
         D3D11_BUFFER_DESC desc{};
-        desc.ByteWidth = sizeof(SceneConstants);
+        desc.ByteWidth = sizeof(TonemapConstants);
         desc.Usage = D3D11_USAGE_DYNAMIC;
         desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
         desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-        CheckHR(d3d_dev->CreateBuffer(&desc, nullptr, cb_scene.ReleaseAndGetAddressOf()));
+        CheckHR(d3d_dev->CreateBuffer(&desc, nullptr, m_cb_tonemap.ReleaseAndGetAddressOf()));
     }
 
-    // object constant buffer
-    wrl::ComPtr<ID3D11Buffer> cb_object{};
+    // luminance histogram; cleared by the exposure shader after every use
     {
+        UINT zeros[EXPOSURE_HISTOGRAM_BINS]{};
+
         D3D11_BUFFER_DESC desc{};
-        desc.ByteWidth = sizeof(ObjectConstants);
-        desc.Usage = D3D11_USAGE_DYNAMIC;
-        desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-        CheckHR(d3d_dev->CreateBuffer(&desc, nullptr, cb_object.ReleaseAndGetAddressOf()));
+        desc.ByteWidth = sizeof(zeros);
+        desc.Usage = D3D11_USAGE_DEFAULT;
+        desc.BindFlags = D3D11_BIND_UNORDERED_ACCESS;
+        desc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_ALLOW_RAW_VIEWS;
+        D3D11_SUBRESOURCE_DATA data{};
+        data.pSysMem = zeros;
+        CheckHR(d3d_dev->CreateBuffer(&desc, &data, m_histogram.ReleaseAndGetAddressOf()));
+
+        D3D11_UNORDERED_ACCESS_VIEW_DESC uav_desc{};
+        uav_desc.Format = DXGI_FORMAT_R32_TYPELESS;
+        uav_desc.ViewDimension = D3D11_UAV_DIMENSION_BUFFER;
+        uav_desc.Buffer.NumElements = EXPOSURE_HISTOGRAM_BINS;
+        uav_desc.Buffer.Flags = D3D11_BUFFER_UAV_FLAG_RAW;
+        CheckHR(d3d_dev->CreateUnorderedAccessView(m_histogram.Get(), &uav_desc, m_histogram_uav.ReleaseAndGetAddressOf()));
     }
 
-    // cube mesh
-    Mesh cube{ Mesh::Cube(d3d_dev.Get()) };
+    // adapted average luminance
+    {
+        float initial_luminance{ 1.0f };
 
-    // camera
-    float camera_fov_deg{ 45.0f };
-    dx::XMFLOAT3 camera_position{ 2.0f, 2.0f, -5.0f };
-    dx::XMFLOAT3 camera_target{};
-    float camera_near{ 0.1f };
-    float camera_far{ 100.0f };
+        D3D11_BUFFER_DESC desc{};
+        desc.ByteWidth = sizeof(initial_luminance);
+        desc.Usage = D3D11_USAGE_DEFAULT;
+        desc.BindFlags = D3D11_BIND_UNORDERED_ACCESS | D3D11_BIND_SHADER_RESOURCE;
+        desc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+        desc.StructureByteStride = sizeof(initial_luminance);
+        D3D11_SUBRESOURCE_DATA data{};
+        data.pSysMem = &initial_luminance;
+        CheckHR(d3d_dev->CreateBuffer(&desc, &data, m_average_luminance.ReleaseAndGetAddressOf()));
+
+        D3D11_UNORDERED_ACCESS_VIEW_DESC uav_desc{};
+        uav_desc.Format = DXGI_FORMAT_UNKNOWN;
+        uav_desc.ViewDimension = D3D11_UAV_DIMENSION_BUFFER;
+        uav_desc.Buffer.NumElements = 1;
+        CheckHR(d3d_dev->CreateUnorderedAccessView(m_average_luminance.Get(), &uav_desc, m_average_luminance_uav.ReleaseAndGetAddressOf()));
+
+        D3D11_SHADER_RESOURCE_VIEW_DESC srv_desc{};
+        srv_desc.Format = DXGI_FORMAT_UNKNOWN;
+        srv_desc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+        srv_desc.Buffer.NumElements = 1;
+        CheckHR(d3d_dev->CreateShaderResourceView(m_average_luminance.Get(), &srv_desc, m_average_luminance_srv.ReleaseAndGetAddressOf()));
+    }
+}
+// copies the top-left width x height region of a texture into a new staging texture
+static wrl::ComPtr<ID3D11Texture2D> ReadbackTexture(ID3D11DeviceContext* d3d_ctx, ID3D11Texture2D* texture, UINT width, UINT height)
+{
+    wrl::ComPtr<ID3D11Device> d3d_dev{};
+    d3d_ctx->GetDevice(d3d_dev.ReleaseAndGetAddressOf());
 
-    // sphere
-    dx::XMFLOAT3 sphere_position{};
-    dx::XMFLOAT3 sphere_color{ 1.0f, 0.0f, 0.0f };
+    D3D11_TEXTURE2D_DESC desc{};
+    texture->GetDesc(&desc);
+    desc.Width = width;
+    desc.Height = height;
+    desc.MipLevels = 1;
+    desc.ArraySize = 1;
+    desc.Usage = D3D11_USAGE_STAGING;
+    desc.BindFlags = 0;
+    desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+    desc.MiscFlags = 0;
+    wrl::ComPtr<ID3D11Texture2D> staging{};
+    CheckHR(d3d_dev->CreateTexture2D(&desc, nullptr, staging.ReleaseAndGetAddressOf()));
+
+    D3D11_BOX box{ 0, 0, 0, width, height, 1 };
+    d3d_ctx->CopySubresourceRegion(staging.Get(), 0, 0, 0, 0, texture, 0, &box);
+    return staging;
+}
 
-    // light
-    dx::XMFLOAT3 light_position{ 2.0f, 1.0f, 2.0f };
-    dx::XMFLOAT3 light_color{ 1.0f, 1.0f, 1.0f };
+// copies a buffer into a new staging buffer
+static wrl::ComPtr<ID3D11Buffer> ReadbackBuffer(ID3D11DeviceContext* d3d_ctx, ID3D11Buffer* buffer)
+{
+    wrl::ComPtr<ID3D11Device> d3d_dev{};
+    d3d_ctx->GetDevice(d3d_dev.ReleaseAndGetAddressOf());
+
+    D3D11_BUFFER_DESC desc{};
+    buffer->GetDesc(&desc);
+    desc.Usage = D3D11_USAGE_STAGING;
+    desc.BindFlags = 0;
+    desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+    desc.MiscFlags = 0;
+    desc.StructureByteStride = 0;
+    wrl::ComPtr<ID3D11Buffer> staging{};
+    CheckHR(d3d_dev->CreateBuffer(&desc, nullptr, staging.ReleaseAndGetAddressOf()));
+
+    d3d_ctx->CopyResource(staging.Get(), buffer);
+    return staging;
+}
 
-    // main application loop
+void TonemapPass::Render(ID3D11DeviceContext* d3d_ctx, const Framebuffer& framebuffer, const D3D11_VIEWPORT& viewport, const TonemapSettings& settings, float delta_time, TonemapComparison* comparison)
+{
+    auto width{ static_cast<UINT>(viewport.Width) };
+    auto height{ static_cast<UINT>(viewport.Height) };
+    float adaptation{ 1.0f - std::exp(-delta_time * settings.adaptation_speed) };
+
+    // readbacks for the comparison; the histogram is cleared by the exposure shader, so it is copied in between
+    wrl::ComPtr<ID3D11Buffer> previous_luminance_readback{};
+    wrl::ComPtr<ID3D11Buffer> histogram_readback{};
+    if (comparison && settings.auto_exposure)
     {
-        MSG msg{};
+        previous_luminance_readback = ReadbackBuffer(d3d_ctx, m_average_luminance.Get());
+    }
+
+    // upload tonemap constants
+    {
+        SubresourceMap map{ d3d_ctx, m_cb_tonemap.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0 };
+        auto constants{ static_cast<TonemapConstants*>(map.Data()) };
+        constants->tonemap_operator = static_cast<UINT>(settings.tonemap_operator);
+        constants->auto_exposure = settings.auto_exposure ? 1 : 0;
+        constants->exposure_ev = settings.exposure_ev;
+        constants->adaptation = adaptation;
+        constants->min_log_luminance = settings.min_log_luminance;
+        constants->log_luminance_range = settings.log_luminance_range;
+        constants->width = width;
+        constants->height = height;
+    }
+
+    ID3D11Buffer* cbufs[]{ m_cb_tonemap.Get() };
+
+    // build the luminance histogram and adapt the average luminance
+    if (settings.auto_exposure)
+    {
+        constexpr UINT HISTOGRAM_GROUP_SIZE{ 16 }; // must match GROUP_SIZE in HistogramCS.hlsl
+
+        ID3D11ShaderResourceView* srvs[]{ framebuffer.SceneColorSRV() };
+        ID3D11UnorderedAccessView* uavs[]{ m_histogram_uav.Get(), m_average_luminance_uav.Get() };
+        d3d_ctx->CSSetConstantBuffers(0, std::size(cbufs), cbufs);
+        d3d_ctx->CSSetShaderResources(0, std::size(srvs), srvs);
+        d3d_ctx->CSSetUnorderedAccessViews(0, std::size(uavs), uavs, nullptr);
+
+        d3d_ctx->CSSetShader(m_histogram_cs.Get(), nullptr, 0);
+        d3d_ctx->Dispatch((width + HISTOGRAM_GROUP_SIZE - 1) / HISTOGRAM_GROUP_SIZE, (height + HISTOGRAM_GROUP_SIZE - 1) / HISTOGRAM_GROUP_SIZE, 1);
+        if (comparison)
+        {
+            histogram_readback = ReadbackBuffer(d3d_ctx, m_histogram.Get());
+        }
+
+        d3d_ctx->CSSetShader(m_exposure_cs.Get(), nullptr, 0);
+        d3d_ctx->Dispatch(1, 1, 1);
+
+        // unbind, the average luminance is read by the tonemap pixel shader next
+        ID3D11ShaderResourceView* null_srvs[1]{};
+        ID3D11UnorderedAccessView* null_uavs[2]{};
+        d3d_ctx->CSSetShaderResources(0, std::size(null_srvs), null_srvs);
+        d3d_ctx->CSSetUnorderedAccessViews(0, std::size(null_uavs), null_uavs, nullptr);
+    }
+
+    // tonemap into the back buffer
+    {
+        ID3D11RenderTargetView* rtv{ framebuffer.BackBufferRTV() };
+        ID3D11ShaderResourceView* srvs[]{ framebuffer.SceneColorSRV(), m_average_luminance_srv.Get() };
+
+        d3d_ctx->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+        d3d_ctx->IASetInputLayout(nullptr);
+        d3d_ctx->VSSetShader(m_fullscreen_vs.Get(), nullptr, 0);
+        d3d_ctx->PSSetShader(m_tonemap_ps.Get(), nullptr, 0);
+        d3d_ctx->PSSetConstantBuffers(0, std::size(cbufs), cbufs);
+        d3d_ctx->PSSetShaderResources(0, std::size(srvs), srvs);
+        d3d_ctx->RSSetState(nullptr);
+        d3d_ctx->RSSetViewports(1, &viewport);
+        d3d_ctx->OMSetRenderTargets(1, &rtv, nullptr);
+        d3d_ctx->Draw(3, 0);
+
+        // unbind, the scene color is a render target again next frame
+        ID3D11ShaderResourceView* null_srvs[2]{};
+        d3d_ctx->PSSetShaderResources(0, std::size(null_srvs), null_srvs);
+    }
+
+    if (!comparison)
+    {
+        return;
+    }
+
+    // run the CPU reference on the scene color the GPU tonemapped
+    *comparison = {};
+    comparison->pixel_count = width * height;
+    comparison->auto_exposure = settings.auto_exposure;
+    std::vector<float> scene_color(static_cast<std::size_t>(width) * height * 4);
+    {
+        wrl::ComPtr<ID3D11Texture2D> readback{ ReadbackTexture(d3d_ctx, framebuffer.SceneColor(), width, height) };
+        SubresourceMap map{ d3d_ctx, readback.Get(), 0, D3D11_MAP_READ, 0 };
+        for (UINT y{}; y < height; y++)
+        {
+            auto row{ reinterpret_cast<const dx::PackedVector::HALF*>(static_cast<const std::uint8_t*>(map.Data()) + static_cast<std::size_t>(y) * map.RowPitch()) };
+            for (UINT x{}; x < width * 4; x++)
+            {
+                scene_color[(static_cast<std::size_t>(y) * width) * 4 + x] = dx::PackedVector::XMConvertHalfToFloat(row[x]);
+            }
+        }
+    }
+
+    float average_luminance{ 1.0f };
+    if (settings.auto_exposure)
+    {
+        std::uint32_t gpu_histogram[EXPOSURE_HISTOGRAM_BIN_COUNT]{};
+        {
+            SubresourceMap map{ d3d_ctx, histogram_readback.Get(), 0, D3D11_MAP_READ, 0 };
+            std::memcpy(gpu_histogram, map.Data(), sizeof(gpu_histogram));
+        }
+        float previous_luminance{};
+        {
+            SubresourceMap map{ d3d_ctx, previous_luminance_readback.Get(), 0, D3D11_MAP_READ, 0 };
+            std::memcpy(&previous_luminance, map.Data(), sizeof(previous_luminance));
+        }
+        {
+            wrl::ComPtr<ID3D11Buffer> readback{ ReadbackBuffer(d3d_ctx, m_average_luminance.Get()) };
+            SubresourceMap map{ d3d_ctx, readback.Get(), 0, D3D11_MAP_READ, 0 };
+            std::memcpy(&average_luminance, map.Data(), sizeof(average_luminance));
+        }
+
+        std::uint32_t cpu_histogram[EXPOSURE_HISTOGRAM_BIN_COUNT]{};
+        AccumulateLuminanceHistogram(scene_color.data(), comparison->pixel_count, settings.min_log_luminance, settings.log_luminance_range, cpu_histogram);
+        std::uint32_t bin_differences{};
+        for (std::uint32_t bin{}; bin < EXPOSURE_HISTOGRAM_BIN_COUNT; bin++)
+        {
+            bin_differences += std::max(cpu_histogram[bin], gpu_histogram[bin]) - std::min(cpu_histogram[bin], gpu_histogram[bin]);
+        }
+        comparison->histogram_mismatches = bin_differences / 2; // a misbinned pixel is missing from one bin and extra in another
+        comparison->gpu_average_luminance = average_luminance;
+        float current_luminance{ AverageLuminanceFromHistogram(cpu_histogram, settings.min_log_luminance, settings.log_luminance_range, previous_luminance) };
+        comparison->cpu_average_luminance = AdaptLuminance(previous_luminance, current_luminance, adaptation);
+    }
+
+    // tonemap with the exposure the GPU used, so that histogram differences don't show up twice
+    std::vector<std::uint8_t> reference(static_cast<std::size_t>(comparison->pixel_count) * 4);
+    TonemapToSRGB8(scene_color.data(), comparison->pixel_count, settings.tonemap_operator, ComputeExposure(settings.auto_exposure, average_luminance, settings.exposure_ev), reference.data());
+    {
+        wrl::ComPtr<ID3D11Texture2D> readback{ ReadbackTexture(d3d_ctx, framebuffer.BackBuffer(), width, height) };
+        SubresourceMap map{ d3d_ctx, readback.Get(), 0, D3D11_MAP_READ, 0 };
+        for (UINT y{}; y < height; y++)
+        {
+            const std::uint8_t* row{ static_cast<const std::uint8_t*>(map.Data()) + static_cast<std::size_t>(y) * map.RowPitch() };
+            for (UINT x{}; x < width; x++)
+            {
+                const std::uint8_t* expected{ reference.data() + (static_cast<std::size_t>(y) * width + x) * 4 };
+                std::uint32_t difference{};
+                for (UINT channel{}; channel < 3; channel++)
+                {
+                    std::uint32_t actual{ row[x * 4 + channel] };
+                    difference = std::max(difference, std::max<std::uint32_t>(actual, expected[channel]) - std::min<std::uint32_t>(actual, expected[channel]));
+                }
+                comparison->max_channel_difference = std::max(comparison->max_channel_difference, difference);
+                comparison->pixels_over_tolerance += difference > TONEMAP_COMPARISON_TOLERANCE ? 1 : 0;
+            }
+        }
+    }
+}
+
+// ---------- Frame Pacing ----------
+
+using Win32Handle = wrl::Wrappers::HandleT<wrl::Wrappers::HandleTraits::HANDLENullTraits>;
+
+// QueryPerformanceCounter and a high resolution waitable timer; Sleep alone is only as precise as the system timer period
+class Win32FrameClock : public FrameClock
+{
+public:
+    Win32FrameClock();
+    ~Win32FrameClock() override = default;
+    Win32FrameClock(const Win32FrameClock&) = delete;
+    Win32FrameClock(Win32FrameClock&&) noexcept = delete;
+    Win32FrameClock& operator=(const Win32FrameClock&) = delete;
+    Win32FrameClock& operator=(Win32FrameClock&&) noexcept = delete;
+public:
+    std::int64_t NowNanoseconds() override;
+    void SleepNanoseconds(std::int64_t duration) override;
+    void SpinOnce() override;
+private:
+    std::int64_t m_frequency;
+    Win32Handle m_timer;
+};
+
+Win32FrameClock::Win32FrameClock()
+    : m_frequency{}
+    , m_timer{}
+{
+    LARGE_INTEGER frequency{};
+    Check(QueryPerformanceFrequency(&frequency));
+    m_frequency = frequency.QuadPart;
+
+    // high resolution timers are available since Windows 10 1803; fall back to a regular timer
+    m_timer.Attach(CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS));
+    if (!m_timer.IsValid())
+    {
+        m_timer.Attach(CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS));
+    }
+    Check(m_timer.IsValid());
+}
+std::int64_t Win32FrameClock::NowNanoseconds()
+{
+    LARGE_INTEGER counter{};
+    QueryPerformanceCounter(&counter);
+
+    // split into seconds and remainder to avoid overflowing the multiplication
+    std::int64_t seconds{ counter.QuadPart / m_frequency };
+    std::int64_t remainder{ counter.QuadPart % m_frequency };
+    return seconds * 1'000'000'000 + remainder * 1'000'000'000 / m_frequency;
+}
+void Win32FrameClock::SleepNanoseconds(std::int64_t duration)
+{
+    LARGE_INTEGER due_time{};
+    due_time.QuadPart = -(duration / 100); // negative means relative, in 100 ns units
+    Check(SetWaitableTimerEx(m_timer.Get(), &due_time, 0, nullptr, nullptr, nullptr, 0));
+    Check(WaitForSingleObject(m_timer.Get(), INFINITE) == WAIT_OBJECT_0);
+}
+void Win32FrameClock::SpinOnce()
+{
+    SwitchToThread(); // lets another ready thread on this processor run, if any
+}
+
+// ---------- Font Atlas Cache ----------
+
+// read-only mapping of a whole file; empty when the file is missing or empty
+class Win32MappedFile
+{
+public:
+    explicit Win32MappedFile(const char* path);
+    ~Win32MappedFile();
+    Win32MappedFile(const Win32MappedFile&) = delete;
+    Win32MappedFile(Win32MappedFile&&) noexcept = delete;
+    Win32MappedFile& operator=(const Win32MappedFile&) = delete;
+    Win32MappedFile& operator=(Win32MappedFile&&) noexcept = delete;
+public:
+    std::span<const std::uint8_t> Data() const noexcept;
+private:
+    wrl::Wrappers::FileHandle m_file;
+    Win32Handle m_mapping;
+    const std::uint8_t* m_view;
+    std::size_t m_size;
+};
+
+Win32MappedFile::Win32MappedFile(const char* path)
+    : m_file{ CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr) }
+    , m_mapping{}
+    , m_view{}
+    , m_size{}
+{
+    // an empty file cannot be mapped
+    LARGE_INTEGER size{};
+    if (!m_file.IsValid() || !GetFileSizeEx(m_file.Get(), &size) || size.QuadPart == 0)
+    {
+        return;
+    }
+    m_mapping.Attach(CreateFileMappingA(m_file.Get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+    if (!m_mapping.IsValid())
+    {
+        return;
+    }
+    m_view = static_cast<const std::uint8_t*>(MapViewOfFile(m_mapping.Get(), FILE_MAP_READ, 0, 0, 0));
+    m_size = m_view ? static_cast<std::size_t>(size.QuadPart) : 0;
+}
+Win32MappedFile::~Win32MappedFile()
+{
+    if (m_view)
+    {
+        UnmapViewOfFile(m_view);
+    }
+}
+std::span<const std::uint8_t> Win32MappedFile::Data() const noexcept
+{
+    return { m_view, m_size };
+}
+
+struct FontAtlasCacheStartup
+{
+    FontAtlasCacheStatus status;
+    std::size_t file_bytes;
+    double load_ms; // mapping the file and restoring the atlas
+};
+
+// ---------- ImGui Utilities ----------
+
+class ImGuiHandle
+{
+public:
+    // font_atlas_cache_path: baked fonts are restored from this file at startup and saved back to it at shutdown
+    ImGuiHandle(HWND hwnd, ID3D11Device* d3d_dev, ID3D11DeviceContext* d3d_ctx, ImGuiAllocator* allocator, const char* font_atlas_cache_path);
+    ~ImGuiHandle();
+    ImGuiHandle(const ImGuiHandle&) = delete;
+    ImGuiHandle(ImGuiHandle&) noexcept = delete;
+    ImGuiHandle& operator=(const ImGuiHandle&) = delete;
+    ImGuiHandle& operator=(ImGuiHandle&) noexcept = delete;
+public:
+    void BeginFrame() const noexcept;
+    // ends the frame; the returned draw data may be extended before DrawFrame
+    ImDrawData* EndFrame() const noexcept;
+    void DrawFrame(ID3D11RenderTargetView* rtv, ImDrawData* draw_data) const noexcept;
+    const FontAtlasCacheStartup& FontAtlasCache() const noexcept;
+private:
+    ID3D11DeviceContext* m_d3d_ctx;
+    const char* m_font_atlas_cache_path;
+    FontAtlasCacheStartup m_font_atlas_cache;
+};
+
+ImGuiHandle::ImGuiHandle(HWND hwnd, ID3D11Device* d3d_dev, ID3D11DeviceContext* d3d_ctx, ImGuiAllocator* allocator, const char* font_atlas_cache_path)
+    : m_d3d_ctx{ d3d_ctx }
+    , m_font_atlas_cache_path{ font_atlas_cache_path }
+    , m_font_atlas_cache{}
+{
+    // route every ImGui allocation through the allocator; must happen before the context allocates anything
+    ImGui::SetAllocatorFunctions(ImGuiAllocator::ImGuiAlloc, ImGuiAllocator::ImGuiFree, allocator);
+
+    // Make process DPI aware and obtain main monitor scale
+    //ImGui_ImplWin32_EnableDpiAwareness();
+    //float main_scale = ImGui_ImplWin32_GetDpiScaleForMonitor(::MonitorFromPoint(POINT{ 0, 0 }, MONITOR_DEFAULTTOPRIMARY));
+
+    // Setup Dear ImGui context
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO(); (void)io;
+    //io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;     // Enable Keyboard Controls
+    //io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
+
+    // Setup Dear ImGui style
+    ImGui::StyleColorsDark();
+    //ImGui::StyleColorsLight();
+
+    // Setup scaling
+    //ImGuiStyle& style = ImGui::GetStyle();
+    //style.ScaleAllSizes(main_scale);        // Bake a fixed style scale. (until we have a solution for dynamic style scaling, changing this requires resetting Style + calling this again)
+    //style.FontScaleDpi = main_scale;        // Set initial font scale. (using io.ConfigDpiScaleFonts=true makes this unnecessary. We leave both here for documentation purpose)
+
+    // Setup Platform/Renderer backends
+    ImGui_ImplWin32_Init(hwnd);
+    ImGui_ImplDX11_Init(d3d_dev, m_d3d_ctx);
+
+    // Load Fonts
+    // - If no fonts are loaded, dear imgui will use the default font. You can also load multiple fonts and use ImGui::PushFont()/PopFont() to select them.
+    // - AddFontFromFileTTF() will return the ImFont* so you can store it if you need to select the font among multiple.
+    // - If the file cannot be loaded, the function will return a nullptr. Please handle those errors in your application (e.g. use an assertion, or display an error and quit).
+    // - Use '#define IMGUI_ENABLE_FREETYPE' in your imconfig file to use Freetype for higher quality font rendering.
+    // - Read 'docs/FONTS.md' for more instructions and details.
+    // - Remember that in C/C++ if you want to include a backslash \ in a string literal you need to write a double backslash \\ !
+    //style.FontSizeBase = 20.0f;
+    //io.Fonts->AddFontDefault();
+    //io.Fonts->AddFontFromFileTTF("c:\\Windows\\Fonts\\segoeui.ttf");
+    //io.Fonts->AddFontFromFileTTF("../../misc/fonts/DroidSans.ttf");
+    //io.Fonts->AddFontFromFileTTF("../../misc/fonts/Roboto-Medium.ttf");
+    //io.Fonts->AddFontFromFileTTF("../../misc/fonts/Cousine-Regular.ttf");
+    //ImFont* font = io.Fonts->AddFontFromFileTTF("c:\\Windows\\Fonts\\ArialUni.ttf");
+    //IM_ASSERT(font != nullptr);
+    io.Fonts->AddFontDefault();
+
+    // restore the fonts baked by the previous run; fonts must be added first and nothing baked yet
+    auto cache_begin{ std::chrono::steady_clock::now() };
+    {
+        Win32MappedFile cache_file{ m_font_atlas_cache_path };
+        m_font_atlas_cache.status = LoadFontAtlasCache(io.Fonts, cache_file.Data());
+        m_font_atlas_cache.file_bytes = cache_file.Data().size();
+    }
+    auto cache_end{ std::chrono::steady_clock::now() };
+    m_font_atlas_cache.load_ms = std::chrono::duration<double, std::milli>(cache_end - cache_begin).count();
+}
+ImGuiHandle::~ImGuiHandle()
+{
+    // save every glyph baked so far for the next run; failing to write the cache only costs startup time
+    std::vector<std::uint8_t> cache{ SaveFontAtlasCache(ImGui::GetIO().Fonts) };
+    std::ofstream cache_file{ m_font_atlas_cache_path, std::ios::binary };
+    cache_file.write(reinterpret_cast<const char*>(cache.data()), static_cast<std::streamsize>(cache.size()));
+
+    ImGui_ImplDX11_Shutdown();
+    ImGui_ImplWin32_Shutdown();
+    ImGui::DestroyContext();
+}
+void ImGuiHandle::BeginFrame() const noexcept
+{
+    ImGui_ImplDX11_NewFrame();
+    ImGui_ImplWin32_NewFrame();
+    ImGui::NewFrame();
+}
+ImDrawData* ImGuiHandle::EndFrame() const noexcept
+{
+    ImGui::Render();
+    return ImGui::GetDrawData();
+}
+void ImGuiHandle::DrawFrame(ID3D11RenderTargetView* rtv, ImDrawData* draw_data) const noexcept
+{
+    m_d3d_ctx->OMSetRenderTargets(1, &rtv, nullptr);
+    ImGui_ImplDX11_RenderDrawData(draw_data);
+}
+const FontAtlasCacheStartup& ImGuiHandle::FontAtlasCache() const noexcept
+{
+    return m_font_atlas_cache;
+}
+
+// rasterizes the ImGui draw data on the cpu; ui captures and ui rasterization timings do not depend on the gpu
+class ImGuiSoftwareCapture
+{
+public:
+    explicit ImGuiSoftwareCapture(JobSystem* job_system);
+    ~ImGuiSoftwareCapture() = default;
+    ImGuiSoftwareCapture(const ImGuiSoftwareCapture&) = delete;
+    ImGuiSoftwareCapture(ImGuiSoftwareCapture&&) noexcept = delete;
+    ImGuiSoftwareCapture& operator=(const ImGuiSoftwareCapture&) = delete;
+    ImGuiSoftwareCapture& operator=(ImGuiSoftwareCapture&&) noexcept = delete;
+public:
+    void Capture(ImDrawData* draw_data);
+    void SaveTGA(const char* path) const;
+    float LastCaptureMs() const noexcept { return m_last_capture_ms; }
+private:
+    static void ParallelFor(void* user_data, int job_count, ImGui_ImplSoftware_JobFn job, void* job_data);
+private:
+    JobSystem* m_job_system;
+    std::vector<std::uint8_t> m_pixels;
+    int m_width;
+    int m_height;
+    float m_last_capture_ms;
+};
+
+ImGuiSoftwareCapture::ImGuiSoftwareCapture(JobSystem* job_system)
+    : m_job_system{ job_system }
+    , m_pixels{}
+    , m_width{}
+    , m_height{}
+    , m_last_capture_ms{}
+{
+}
+void ImGuiSoftwareCapture::Capture(ImDrawData* draw_data)
+{
+    auto begin{ std::chrono::steady_clock::now() };
+
+    m_width = static_cast<int>(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    m_height = static_cast<int>(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    m_pixels.assign(static_cast<std::size_t>(m_width) * m_height * 4, 0);
+    for (std::size_t i{ 3 }; i < m_pixels.size(); i += 4)
+    {
+        m_pixels[i] = 255; // opaque black background
+    }
+
+    ImGui_ImplSoftware_Image target{ m_pixels.data(), m_width, m_height, m_width * 4 };
+    ImGui_ImplSoftware_RenderDrawData(draw_data, &target, &ImGuiSoftwareCapture::ParallelFor, m_job_system);
+
+    auto end{ std::chrono::steady_clock::now() };
+    m_last_capture_ms = std::chrono::duration<float, std::milli>(end - begin).count();
+}
+void ImGuiSoftwareCapture::SaveTGA(const char* path) const
+{
+    // uncompressed 32 bit true color, top-left origin
+    std::uint8_t header[18]{};
+    header[2] = 2; // uncompressed true color
+    header[12] = static_cast<std::uint8_t>(m_width & 0xFF);
+    header[13] = static_cast<std::uint8_t>(m_width >> 8);
+    header[14] = static_cast<std::uint8_t>(m_height & 0xFF);
+    header[15] = static_cast<std::uint8_t>(m_height >> 8);
+    header[16] = 32; // bits per pixel
+    header[17] = 0x28; // 8 alpha bits, top-left origin
+
+    std::vector<std::uint8_t> bgra(m_pixels);
+    for (std::size_t i{}; i < bgra.size(); i += 4)
+    {
+        std::swap(bgra[i + 0], bgra[i + 2]);
+    }
+
+    std::ofstream file{ path, std::ios::binary };
+    Check(file);
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(bgra.data()), static_cast<std::streamsize>(bgra.size()));
+    Check(file);
+}
+void ImGuiSoftwareCapture::ParallelFor(void* user_data, int job_count, ImGui_ImplSoftware_JobFn job, void* job_data)
+{
+    auto job_system{ static_cast<JobSystem*>(user_data) };
+    job_system->ParallelFor(static_cast<std::uint32_t>(job_count), [&](std::uint32_t, std::uint32_t slice) { job(job_data, static_cast<int>(slice)); });
+}
+
+namespace ImGuiEx
+{
+    bool DragFloat3(const char* label, DirectX::XMFLOAT3& v, float v_speed = 1.0f, float v_min = 0.0f, float v_max = 0.0f, const char* format = "%.3f", ImGuiSliderFlags flags = 0)
+    {
+        float buf[3]{ v.x, v.y, v.z };
+        bool res{ ImGui::DragFloat3(label, buf, v_speed, v_min, v_max, format, flags) };
+        v.x = buf[0];
+        v.y = buf[1];
+        v.z = buf[2];
+        return res;
+    }
+    bool ColorEdit3(const char* label, DirectX::XMFLOAT3& col, ImGuiColorEditFlags flags = 0)
+    {
+        float buf[3]{ col.x, col.y, col.z };
+        bool res{ ImGui::ColorEdit3(label, buf, flags) };
+        col.x = buf[0];
+        col.y = buf[1];
+        col.z = buf[2];
+        return res;
+    }
+}
+
+// ---------- Scene ----------
+
+struct SceneSphere
+{
+    dx::XMFLOAT3 position;
+    dx::XMFLOAT3 color;
+    float radius;
+    bool emissive; // drawn with its color as is, e.g. the light
+};
+
+// camera data needed to cull and sort scene objects
+struct SceneView
+{
+    dx::XMFLOAT4X4 view;
+    dx::BoundingFrustum frustum; // world space
+    float near_z;
+    float far_z;
+};
+
+// cull a range of spheres against the view frustum and record the visible ones as impostors drawn with a unit cube
+static void RecordSceneSpheres(RenderCommandList& commands, LinearAllocator& scratch, std::span<const SceneSphere> spheres, const SceneView& scene_view, UINT index_count)
+{
+    // frustum cull into a scratch index list
+    auto visible{ scratch.AllocateArray<std::uint32_t>(spheres.size()) };
+    std::size_t visible_count{};
+    for (std::size_t i{}; i < spheres.size(); i++)
+    {
+        dx::BoundingSphere bounds{ spheres[i].position, spheres[i].radius };
+        if (scene_view.frustum.Intersects(bounds))
+        {
+            visible[visible_count++] = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    // record visible spheres
+    dx::XMMATRIX view{ dx::XMLoadFloat4x4(&scene_view.view) };
+    for (std::size_t i{}; i < visible_count; i++)
+    {
+        const SceneSphere& sphere{ spheres[visible[i]] };
+        float diameter{ sphere.radius * 2.0f }; // the local box geometry has unit size
+
+        // build model matrix
+        dx::XMMATRIX model{};
+        {
+            dx::XMVECTOR scaling{ dx::XMVectorSet(diameter, diameter, diameter, 0.0f) };
+            dx::XMVECTOR origin{ dx::XMVectorZero() };
+            dx::XMVECTOR rotation{ dx::XMQuaternionIdentity() };
+            dx::XMVECTOR translation{ dx::XMLoadFloat3(&sphere.position) };
+            model = dx::XMMatrixAffineTransformation(scaling, origin, rotation, translation);
+        }
+
+        // object constants
+        ObjectConstants constants{};
+        dx::XMStoreFloat4x4(&constants.model, model);
+        constants.color = sphere.color;
+        constants.emissive = sphere.emissive ? 1.0f : 0.0f;
+        constants.position = sphere.position;
+        constants.radius = sphere.radius;
+
+        // normalized view depth used as sort key
+        float view_z{ dx::XMVectorGetZ(dx::XMVector3Transform(dx::XMLoadFloat3(&sphere.position), view)) };
+        float depth01{ (view_z - scene_view.near_z) / (scene_view.far_z - scene_view.near_z) };
+
+        commands.DrawIndexed(depth01, &constants, sizeof(constants), index_count);
+    }
+}
+
+// ---------- Entry Point ----------
+
+static void Entry()
+{
+    // ImGui allocator, installed when ImGui is initialized below; declared first so that it outlives the context
+    // and every object owning ImGui containers, which free through it when they are destroyed
+    ImGuiAllocator imgui_allocator{};
+
+    // make process DPI aware
+    Check(SetProcessDpiAwarenessContext(DPI_AWARENESS_CONTEXT_SYSTEM_AWARE));
+
+    // register win32 window class
+    RegisterWin32WindowClass();
+
+    // create win32 window
+    HWND window{ CreateWin32Window() };
+
+    // setup dxgi info queue
+    SetupDXGIInforQueue();
+
+    // create d3d11 device
+    wrl::ComPtr<ID3D11Device> d3d_dev{ CreateD3D11Device() };
+
+    // setup d3d11 info queue
+    SetupD3D11InfoQueue(d3d_dev.Get());
+
+    // get d3d11 immediate device context
+    wrl::ComPtr<ID3D11DeviceContext> d3d_ctx{};
+    d3d_dev->GetImmediateContext(d3d_ctx.ReleaseAndGetAddressOf());
+
+    // framebuffer size buckets; the scene is rendered into the top-left viewport sub-rectangle of the framebuffer
+    constexpr std::uint32_t FRAMEBUFFER_BUCKET_GRANULARITY{ 256 };
+    constexpr double FRAMEBUFFER_SHRINK_DELAY_SECONDS{ 0.5 };
+    auto app_start{ std::chrono::steady_clock::now() };
+    ResizeBucketPolicy framebuffer_sizing{ GetWindowClientExtent(window), FRAMEBUFFER_BUCKET_GRANULARITY, FRAMEBUFFER_SHRINK_DELAY_SECONDS };
+
+    // create swap chain
+    wrl::ComPtr<IDXGISwapChain1> swap_chain{ CreateDXGISwapChain(d3d_dev.Get(), window, framebuffer_sizing.Allocation()) };
+
+    // create framebuffer
+    Framebuffer framebuffer{ d3d_dev.Get(), swap_chain.Get() };
+
+    // frame pacing
+    wrl::ComPtr<IDXGISwapChain2> swap_chain2{};
+    CheckHR(swap_chain.As(&swap_chain2));
+    Win32Handle frame_latency_waitable{ swap_chain2->GetFrameLatencyWaitableObject() };
+    Check(frame_latency_waitable.IsValid());
+    Win32FrameClock frame_clock{};
+    FrameLimiter frame_limiter{ &frame_clock, 2'000'000 }; // spin through the last 2 ms before the deadline
+    FrameTimeStats frame_time_stats{ 240 };
+    FramePacingMode frame_pacing_mode{ FramePacingMode::VSync };
+    std::optional<FramePacingMode> applied_frame_pacing_mode{};
+    int frame_target_fps{ 60 };
+    std::int64_t frame_begin_ns{ frame_clock.NowNanoseconds() };
+
+    // material library and its thumbnails, rendered on background threads with the cpu reference shading
+    // declared before ImGui: the renderer backend destroys the thumbnail atlas when it shuts down
+    constexpr std::uint32_t MATERIAL_THUMBNAIL_SIZE{ 64 };
+    constexpr std::size_t MATERIAL_THUMBNAIL_BUDGET{ 16 << 20 };
+    std::vector<Material> materials{ GenerateMaterials(10'000, 1) };
+    ThumbnailCache material_thumbnails{ MATERIAL_THUMBNAIL_SIZE, MATERIAL_THUMBNAIL_BUDGET, std::max(JobSystem::DefaultWorkerCount() / 2, 1u), [&materials](std::uint32_t item, std::span<std::uint32_t> rgba)
+    {
+        RenderMaterialThumbnail(materials[item], MATERIAL_THUMBNAIL_SIZE, rgba);
+    } };
+    int selected_material{ -1 };
+    float material_browser_ms{};
+
+    // initialize ImGui
+    // startup is measured from here to the end of the first ImGui frame, which bakes the glyphs it uses unless the cache had them
+    auto imgui_start{ std::chrono::steady_clock::now() };
+    std::optional<double> imgui_startup_ms{};
+    ImGuiHandle imgui_handle{ window, d3d_dev.Get(), d3d_ctx.Get(), &imgui_allocator, "imgui_font_atlas.cache" };
+    bool imgui_allocation_overlay{};
+
+    // ImGui window and table settings, saved incrementally to a binary file instead of imgui.ini
+    // imgui.ini is read once, when the binary file is missing or unreadable, and the binary file is created from it
+    const char* settings_path{ "imgui_settings.bin" };
+    ImGui::GetIO().IniFilename = nullptr;
+    SettingsStore settings_store{ settings_path };
+    bool settings_loaded{};
+    {
+        Win32MappedFile settings_file{ settings_path };
+        settings_loaded = settings_store.Load(settings_file.Data());
+    }
+    if (!settings_loaded)
+    {
+        ImGui::LoadIniSettingsFromDisk("imgui.ini");
+        settings_store.Save(true);
+    }
+    std::vector<SettingsStoreBenchmarkResult> settings_store_results{};
+
+    // tonemapping
+    TonemapPass tonemap_pass{ d3d_dev.Get() };
+    TonemapSettings tonemap_settings{};
+    tonemap_settings.tonemap_operator = TonemapOperator::ACES;
+    tonemap_settings.auto_exposure = false;
+    tonemap_settings.exposure_ev = 0.0f;
+    tonemap_settings.adaptation_speed = 2.0f;
+    tonemap_settings.min_log_luminance = -10.0f;
+    tonemap_settings.log_luminance_range = 14.0f;
+    bool tonemap_comparison_requested{};
+    std::optional<TonemapComparison> tonemap_comparison{};
+
+    // scene constant buffer
+    wrl::ComPtr<ID3D11Buffer> cb_scene{};
+    {
+        D3D11_BUFFER_DESC desc{};
+        desc.ByteWidth = sizeof(SceneConstants);
+        desc.Usage = D3D11_USAGE_DYNAMIC;
+        desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        CheckHR(d3d_dev->CreateBuffer(&desc, nullptr, cb_scene.ReleaseAndGetAddressOf()));
+    }
+
+    // object constant buffer
+    wrl::ComPtr<ID3D11Buffer> cb_object{};
+    {
+        D3D11_BUFFER_DESC desc{};
+        desc.ByteWidth = sizeof(ObjectConstants);
+        desc.Usage = D3D11_USAGE_DYNAMIC;
+        desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+        CheckHR(d3d_dev->CreateBuffer(&desc, nullptr, cb_object.ReleaseAndGetAddressOf()));
+    }
+
+    // cube mesh
+    Mesh cube{ Mesh::Cube(d3d_dev.Get()) };
+
+    // render command resources; pipelines are created through the state cache, which shares the states of identical descriptions
+    D3D11RenderResources render_resources{ cb_scene.Get(), cb_object.Get() };
+    D3D11PipelineStateCache pipeline_states{ d3d_dev.Get(), &render_resources };
+    RenderMeshHandle cube_mesh{ render_resources.AddMesh(&cube) };
+
+    // sphere pipeline
+    D3D11_INPUT_ELEMENT_DESC sphere_input_elements[]
+    {
+        { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+    };
+    D3D11PipelineDesc sphere_pipeline_desc{};
+    {
+        sphere_pipeline_desc.vs_bytecode = { VS_bytes, sizeof(VS_bytes) };
+        sphere_pipeline_desc.ps_bytecode = { PS_bytes, sizeof(PS_bytes) };
+        sphere_pipeline_desc.input_elements = sphere_input_elements;
+        sphere_pipeline_desc.rasterizer.FillMode = D3D11_FILL_SOLID;
+        sphere_pipeline_desc.rasterizer.CullMode = D3D11_CULL_BACK;
+        sphere_pipeline_desc.rasterizer.FrontCounterClockwise = false;
+        sphere_pipeline_desc.rasterizer.DepthBias = 0;
+        sphere_pipeline_desc.rasterizer.DepthBiasClamp = 0.0f;
+        sphere_pipeline_desc.rasterizer.SlopeScaledDepthBias = 0.0f;
+        sphere_pipeline_desc.rasterizer.DepthClipEnable = true;
+        sphere_pipeline_desc.rasterizer.ScissorEnable = false;
+        sphere_pipeline_desc.rasterizer.MultisampleEnable = false;
+        sphere_pipeline_desc.rasterizer.AntialiasedLineEnable = false;
+        sphere_pipeline_desc.topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+    }
+
+    // shader hot reload: PS.hlsl is rebuilt in the background when it or one of its includes is saved
+    // sources are read from the project directory, next to this file; compiled shaders are cached in the working directory
+    ShaderBytecodeCache shader_cache{ "shader_cache" };
+    ShaderHotReload shader_reload{ CompileHLSL, &shader_cache, std::chrono::milliseconds{ 250 } };
+    ShadingPipelines sphere_pipelines{ &shader_reload, &pipeline_states, std::filesystem::path{ __FILE__ }.parent_path() / "PS.hlsl", sphere_pipeline_desc };
+    RenderPipelineHandle sphere_pipeline{ pipeline_states.Acquire(sphere_pipeline_desc) }; // the default permutation, already created above
+
+    // job system used to record the scene in parallel
+    constexpr std::size_t SCRATCH_BYTES_PER_WORKER{ 1 << 20 };
+    JobSystem job_system{ JobSystem::DefaultWorkerCount(), SCRATCH_BYTES_PER_WORKER };
+
+    // scene recording slices; each one is recorded by a worker into its own deferred context and submitted in order
+    std::vector<std::unique_ptr<D3D11DeferredSlice>> scene_slices{};
+    for (std::uint32_t i{}; i < job_system.WorkerCount(); i++)
+    {
+        scene_slices.emplace_back(std::make_unique<D3D11DeferredSlice>(d3d_dev.Get(), &render_resources));
+    }
+
+    // cpu rasterization of the ui
+    ImGuiSoftwareCapture ui_capture{ &job_system };
+    bool ui_capture_requested{};
+    bool ui_capture_every_frame{};
+    bool ui_buffer_streaming{ true };
+
+    // plot overlays built on the workers
+    ParallelDrawLists plot_draw_lists{ &job_system };
+    bool plot_overlays{};
+    bool plot_overlays_on_workers{ true };
+    int plot_overlay_count{ 16 };
+    int plot_overlay_points{ 2048 };
+    std::optional<DrawListBenchmarkResult> plot_benchmark_result{};
+
+    // ImDrawList tessellation benchmark; results of the last run
+    std::vector<TessellationBenchmarkResult> tessellation_results{};
+
+    // large series plotting benchmark; results of the last run
+    std::vector<PlotBenchmarkResult> large_plot_results{};
+
+    // id hashing benchmark; results of the last run
+    std::vector<IdHashBenchmarkResult> id_hash_results{};
+
+    // ImGuiStorage benchmark; results of the last run
+    std::vector<StorageBenchmarkResult> storage_results{};
+
+    // ImGuiTextFilter benchmark; results of the last run
+    std::vector<TextFilterBenchmarkResult> text_filter_results{};
+
+    // large document editor and its benchmark; results of the last run
+    ImGuiTextDocument large_document{};
+    int large_document_mb{ 10 };
+    std::vector<TextDocumentBenchmarkResult> text_document_results{};
+
+    // measured BRDF statistics in a data-backed table, and its benchmark; results of the last run
+    std::vector<BrdfStatistics> brdf_statistics{};
+    ImGuiTableData brdf_statistics_table{};
+    std::uint64_t brdf_statistics_version{};
+    int brdf_statistics_rows{ 100'000 };
+    float brdf_statistics_ms{};
+    std::vector<DataTableBenchmarkResult> data_table_results{};
+
+    // cold font atlas build benchmark; result of the last run
+    char font_bake_path[MAX_PATH]{ "C:\\Windows\\Fonts\\msyh.ttc" };
+    std::optional<FontBakeBenchmarkResult> font_bake_result{};
+    std::optional<FontAtlasCacheBenchmarkResult> font_cache_result{};
+    std::vector<AtlasPackingBenchmarkResult> atlas_packing_results{};
+
+    // scene render commands; recorded only when the scene changes and replayed every frame
+    std::vector<SceneSphere> scene_spheres{};
+    int scene_slice_count{ static_cast<int>(scene_slices.size()) };
+    RenderReplayStats scene_replay_stats{};
+    float scene_record_ms{};
+    float scene_submit_ms{};
+    bool scene_dirty{ true };
+
+    // camera
+    float camera_fov_deg{ 45.0f };
+    dx::XMFLOAT3 camera_position{ 2.0f, 2.0f, -5.0f };
+    dx::XMFLOAT3 camera_target{};
+    float camera_near{ 0.1f };
+    float camera_far{ 100.0f };
+
+    // sphere
+    dx::XMFLOAT3 sphere_position{};
+    dx::XMFLOAT3 sphere_color{ 1.0f, 0.0f, 0.0f };
+
+    // light
+    dx::XMFLOAT3 light_position{ 2.0f, 1.0f, 2.0f };
+    dx::XMFLOAT3 light_color{ 1.0f, 1.0f, 1.0f };
+
+    // shading; the permutation selects the pixel shader variant, roughness is a scene constant
+    BrdfModel shading_model{ ShadingPermutationModel(SHADING_DEFAULT_PERMUTATION) };
+    ShadingFeatures shading_features{ ShadingPermutationFeatures(SHADING_DEFAULT_PERMUTATION) };
+    float shading_roughness{ 0.4f };
+    std::vector<ShadingBenchmarkResult> shading_results{};
+
+    // sphere field
+    int sphere_field_size{ 16 }; // spheres per side
+    float sphere_field_spacing{ 0.75f };
+
+    // main application loop
+    {
+        MSG msg{};
         while (msg.message != WM_QUIT)
         {
             if (PeekMessageA(&msg, nullptr, 0, 0, PM_REMOVE))
@@ -667,30 +1967,72 @@ static void Entry()
                 TranslateMessage(&msg);
                 DispatchMessageA(&msg);
             }
+            else if (IsIconic(window))
+            {
+                WaitMessage(); // nothing is visible while minimized; sleep until the next message instead of spinning
+                frame_begin_ns = frame_clock.NowNanoseconds(); // do not count the time spent minimized as a frame
+            }
             else
             {
-                // handle resize event
-                if (s_did_resize)
+                // frame pacing
+                {
+                    if (applied_frame_pacing_mode != frame_pacing_mode)
+                    {
+                        // a single queued frame keeps input-to-photon latency low; otherwise allow the cpu to run one frame ahead
+                        CheckHR(swap_chain2->SetMaximumFrameLatency(frame_pacing_mode == FramePacingMode::LowLatency ? 1 : 2));
+                        frame_limiter.Reset();
+                        frame_time_stats.Clear();
+                        applied_frame_pacing_mode = frame_pacing_mode;
+                    }
+
+                    // wait until the swap chain can accept another frame before sampling input; the object is waited on
+                    // in every mode so that its count stays in sync with the present queue
+                    WaitForSingleObjectEx(frame_latency_waitable.Get(), 1000, true);
+
+                    std::int64_t frame_end_ns{ frame_clock.NowNanoseconds() };
+                    frame_time_stats.AddFrame(static_cast<double>(frame_end_ns - frame_begin_ns) / 1e6);
+                    frame_begin_ns = frame_end_ns;
+                }
+
+                // handle resize event; the framebuffer is reallocated only when the window leaves its size bucket
                 {
-                    d3d_ctx->ClearState(); // clear state (some resources may be implicitly referenced by the context)
-                    framebuffer = {}; // destroy framebuffer
-                    CheckHR(swap_chain->ResizeBuffers(0, 0, 0, DXGI_FORMAT_UNKNOWN, 0)); // resize swap chain
-                    framebuffer = { d3d_dev.Get(), swap_chain.Get() }; // create new frame buffer
+                    double now_seconds{ std::chrono::duration<double>(std::chrono::steady_clock::now() - app_start).count() };
+
+                    if (s_did_resize)
+                    {
+                        framebuffer_sizing.RequestResize(GetWindowClientExtent(window), now_seconds);
+                        scene_dirty = true; // recorded command lists reference the old viewport
+
+                        s_did_resize = false; // resize event handled
+                    }
 
-                    s_did_resize = false; // resize event handled
+                    if (framebuffer_sizing.Update(now_seconds))
+                    {
+                        Extent2D allocation{ framebuffer_sizing.Allocation() };
+                        d3d_ctx->ClearState(); // clear state (some resources may be implicitly referenced by the context)
+                        framebuffer = {}; // destroy framebuffer
+                        CheckHR(swap_chain->ResizeBuffers(0, allocation.width, allocation.height, DXGI_FORMAT_UNKNOWN, SWAP_CHAIN_FLAGS)); // resize swap chain
+                        framebuffer = { d3d_dev.Get(), swap_chain.Get() }; // create new frame buffer
+                        scene_dirty = true; // recorded command lists reference the old framebuffer
+                    }
                 }
 
-                // fetch window size
-                float window_w{};
-                float window_h{};
+                // swap in the shaders rebuilt since the previous frame; the render loop never waits for a compile
+                // a permutation selected for the first time keeps the previous shader on screen until it is built
                 {
-                    RECT rect{};
-                    Check(GetClientRect(window, &rect)); // the right and bottom members contain the width and height of the window
-                    constexpr LONG MIN_WINDOW_DIMENSION{ 8 };
-                    window_w = static_cast<float>(std::max(rect.right, MIN_WINDOW_DIMENSION)); // sanitize window size; having size 0 may yield to problems
-                    window_h = static_cast<float>(std::max(rect.bottom, MIN_WINDOW_DIMENSION)); // sanitize window size; having size 0 may yield to problems
+                    sphere_pipelines.ApplyReloads();
+                    std::optional<RenderPipelineHandle> pipeline{ sphere_pipelines.Find(MakeShadingPermutationKey(shading_model, shading_features)) };
+                    if (pipeline && *pipeline != sphere_pipeline)
+                    {
+                        sphere_pipeline = *pipeline;
+                        scene_dirty = true; // recorded command lists bind the previous pipeline
+                    }
                 }
 
+                // fetch window size
+                float window_w{ static_cast<float>(framebuffer_sizing.Viewport().width) };
+                float window_h{ static_cast<float>(framebuffer_sizing.Viewport().height) };
+
                 // render scene
                 {
                     // configure viewport
@@ -702,165 +2044,933 @@ static void Entry()
                     viewport.MinDepth = 0.0f;
                     viewport.MaxDepth = 1.0f;
 
-                    // clear back buffer
+                    // clear scene color
                     {
                         float clear_color[4]{ 0.2f, 0.3f, 0.3f, 1.0f };
-                        d3d_ctx->ClearRenderTargetView(framebuffer.BackBufferRTV(), clear_color);
+                        d3d_ctx->ClearRenderTargetView(framebuffer.SceneColorRTV(), clear_color);
                         d3d_ctx->ClearDepthStencilView(framebuffer.DSV(), D3D11_CLEAR_DEPTH, 1.0f, 0);
                     }
 
-                    // prepare pipeline for drawing
+                    // compute view matrix
+                    dx::XMMATRIX view{};
+                    {
+                        dx::XMVECTOR eye{ dx::XMLoadFloat3(&camera_position) };
+                        dx::XMVECTOR target{ dx::XMLoadFloat3(&camera_target) };
+                        dx::XMVECTOR up{ dx::XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f) };
+                        view = dx::XMMatrixLookAtLH(eye, target, up);
+                    }
+
+                    // compute projection matrix
+                    dx::XMMATRIX projection{};
                     {
-                        ID3D11RenderTargetView* rtv{ framebuffer.BackBufferRTV() };
-                        ID3D11Buffer* cbufs[]{ cb_scene.Get(), cb_object.Get() };
-
-                        d3d_ctx->ClearState();
-
-                        d3d_ctx->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-                        d3d_ctx->IASetInputLayout(input_layout.Get());
-                        d3d_ctx->VSSetShader(vs.Get(), nullptr, 0);
-                        d3d_ctx->VSSetConstantBuffers(0, std::size(cbufs), cbufs);
-                        d3d_ctx->PSSetShader(ps.Get(), nullptr, 0);
-                        d3d_ctx->PSSetConstantBuffers(0, std::size(cbufs), cbufs);
-                        d3d_ctx->RSSetState(rs_default.Get());
-                        d3d_ctx->RSSetViewports(1, &viewport);
-                        d3d_ctx->OMSetRenderTargets(1, &rtv, framebuffer.DSV());
+                        float fov_rad{ dx::XMConvertToRadians(camera_fov_deg) };
+                        float aspect{ window_w / window_h };
+                        projection = dx::XMMatrixPerspectiveFovLH(fov_rad, aspect, camera_near, camera_far);
                     }
 
                     // upload scene constants
                     {
-                        // compute view matrix
-                        dx::XMMATRIX view{};
+                        SubresourceMap map{ d3d_ctx.Get(), cb_scene.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0 };
+                        auto constants{ static_cast<SceneConstants*>(map.Data()) };
+                        dx::XMStoreFloat4x4(&constants->view, view);
+                        dx::XMStoreFloat4x4(&constants->projection, projection);
+                        constants->world_eye = camera_position;
+                        constants->roughness = shading_roughness;
+                        constants->light_position = light_position;
+                        constants->light_color = light_color;
+                    }
+
+                    // record scene commands
+                    if (scene_dirty)
+                    {
+                        auto record_begin{ std::chrono::steady_clock::now() };
+
+                        // gather scene objects
+                        scene_spheres.clear();
+                        scene_spheres.push_back({ sphere_position, sphere_color, 0.5f, false }); // sphere
+                        scene_spheres.push_back({ light_position, light_color, 0.25f, true }); // light
+                        for (int z{}; z < sphere_field_size; z++)
                         {
-                            dx::XMVECTOR eye{ dx::XMLoadFloat3(&camera_position) };
-                            dx::XMVECTOR target{ dx::XMLoadFloat3(&camera_target) };
-                            dx::XMVECTOR up{ dx::XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f) };
-                            view = dx::XMMatrixLookAtLH(eye, target, up);
+                            for (int x{}; x < sphere_field_size; x++)
+                            {
+                                float u{ static_cast<float>(x) / static_cast<float>(std::max(sphere_field_size - 1, 1)) };
+                                float v{ static_cast<float>(z) / static_cast<float>(std::max(sphere_field_size - 1, 1)) };
+                                float half_extent{ 0.5f * sphere_field_spacing * static_cast<float>(sphere_field_size - 1) };
+
+                                SceneSphere sphere{};
+                                sphere.position = { static_cast<float>(x) * sphere_field_spacing - half_extent, -1.0f, static_cast<float>(z) * sphere_field_spacing - half_extent };
+                                sphere.color = { u, 0.5f, v };
+                                sphere.radius = 0.25f;
+                                scene_spheres.push_back(sphere);
+                            }
                         }
 
-                        // compute projection matrix
-                        dx::XMMATRIX projection{};
+                        // camera data
+                        SceneView scene_view{};
+                        dx::XMStoreFloat4x4(&scene_view.view, view);
+                        dx::BoundingFrustum view_frustum{ projection };
+                        view_frustum.Transform(scene_view.frustum, dx::XMMatrixInverse(nullptr, view));
+                        scene_view.near_z = camera_near;
+                        scene_view.far_z = camera_far;
+
+                        // record slices in parallel
+                        auto slice_count{ static_cast<std::uint32_t>(scene_slice_count) };
+                        job_system.ParallelFor(slice_count, [&](std::uint32_t worker, std::uint32_t slice)
                         {
-                            float fov_rad{ dx::XMConvertToRadians(camera_fov_deg) };
-                            float aspect{ window_w / window_h };
-                            projection = dx::XMMatrixPerspectiveFovLH(fov_rad, aspect, camera_near, camera_far);
+                            std::size_t begin{ scene_spheres.size() * slice / slice_count };
+                            std::size_t end{ scene_spheres.size() * (slice + 1) / slice_count };
+
+                            D3D11DeferredSlice& scene_slice{ *scene_slices[slice] };
+                            RenderCommandList& commands{ scene_slice.Commands() };
+                            commands.Reset();
+                            commands.SetPipeline(sphere_pipeline);
+                            commands.SetMesh(cube_mesh);
+                            RecordSceneSpheres(commands, job_system.Allocator(worker), { scene_spheres.data() + begin, end - begin }, scene_view, cube.IndexCount());
+                            commands.Sort();
+                            scene_slice.Finish(framebuffer.SceneColorRTV(), framebuffer.DSV(), viewport);
+                        });
+
+                        // aggregate slice stats
+                        scene_replay_stats = {};
+                        for (std::uint32_t slice{}; slice < slice_count; slice++)
+                        {
+                            const RenderReplayStats& stats{ scene_slices[slice]->Stats() };
+                            scene_replay_stats.draws += stats.draws;
+                            scene_replay_stats.pipeline_binds += stats.pipeline_binds;
+                            scene_replay_stats.mesh_binds += stats.mesh_binds;
+                            scene_replay_stats.redundant_binds_skipped += stats.redundant_binds_skipped;
                         }
 
-                        // upload
+                        auto record_end{ std::chrono::steady_clock::now() };
+                        scene_record_ms = std::chrono::duration<float, std::milli>(record_end - record_begin).count();
+                        scene_dirty = false;
+                    }
+
+                    // submit recorded slices in order; costs one call per slice regardless of the scene size
+                    {
+                        auto submit_begin{ std::chrono::steady_clock::now() };
+
+                        for (int slice{}; slice < scene_slice_count; slice++)
                         {
-                            SubresourceMap map{ d3d_ctx.Get(), cb_scene.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0 };
-                            auto constants{ static_cast<SceneConstants*>(map.Data()) };
-                            dx::XMStoreFloat4x4(&constants->view, view);
-                            dx::XMStoreFloat4x4(&constants->projection, projection);
-                            constants->world_eye = camera_position;
+                            d3d_ctx->ExecuteCommandList(scene_slices[slice]->CommandList(), false);
                         }
+
+                        auto submit_end{ std::chrono::steady_clock::now() };
+                        scene_submit_ms = std::chrono::duration<float, std::milli>(submit_end - submit_begin).count();
                     }
 
-                    // render sphere
+                    // tonemap scene color into the back buffer
+                    TonemapComparison comparison{};
+                    tonemap_pass.Render(d3d_ctx.Get(), framebuffer, viewport, tonemap_settings, ImGui::GetIO().DeltaTime, tonemap_comparison_requested ? &comparison : nullptr);
+                    if (tonemap_comparison_requested)
                     {
-                        // upload object constants
-                        {
-                            constexpr float RADIUS{ 0.5f }; // sphere radius (given by local box geometry)
-                            constexpr float DIAMETER{ RADIUS * 2.0f }; // sphere diameter
+                        tonemap_comparison = comparison;
+                        tonemap_comparison_requested = false;
+                    }
+                }
 
-                            // build model matrix
-                            dx::XMMATRIX model{};
+                // render ImGui
+                imgui_allocator.NewFrame();
+                imgui_handle.BeginFrame();
+                material_thumbnails.BeginFrame();
+                {
+                    ImGui::Begin("BRDFs");
+                    {
+                        if (ImGui::CollapsingHeader("Camera", ImGuiTreeNodeFlags_DefaultOpen))
+                        {
+                            scene_dirty |= ImGuiEx::DragFloat3("Position##Camera", camera_position, 0.01f);
+                            scene_dirty |= ImGuiEx::DragFloat3("Target", camera_target, 0.01f);
+                        }
+                        if (ImGui::CollapsingHeader("Sphere", ImGuiTreeNodeFlags_DefaultOpen))
+                        {
+                            scene_dirty |= ImGuiEx::DragFloat3("Position##Sphere", sphere_position, 0.01f);
+                            scene_dirty |= ImGuiEx::ColorEdit3("Color##Sphere", sphere_color);
+                        }
+                        if (ImGui::CollapsingHeader("Light", ImGuiTreeNodeFlags_DefaultOpen))
+                        {
+                            scene_dirty |= ImGuiEx::DragFloat3("Position##Light", light_position, 0.01f);
+                            scene_dirty |= ImGuiEx::ColorEdit3("Color##Light", light_color);
+                        }
+                        if (ImGui::CollapsingHeader("Shading", ImGuiTreeNodeFlags_DefaultOpen))
+                        {
+                            auto model{ static_cast<int>(shading_model) };
+                            const char* models[]{ BrdfModelName(BrdfModel::Lambert), BrdfModelName(BrdfModel::BlinnPhong), BrdfModelName(BrdfModel::GGX) };
+                            if (ImGui::Combo("BRDF", &model, models, static_cast<int>(std::size(models))))
                             {
-                                dx::XMVECTOR scaling{ dx::XMVectorSet(DIAMETER, DIAMETER, DIAMETER, 0.0f) };
-                                dx::XMVECTOR origin{ dx::XMVectorZero() };
-                                dx::XMVECTOR rotation{ dx::XMQuaternionIdentity() };
-                                dx::XMVECTOR translation{ dx::XMLoadFloat3(&sphere_position) };
-                                model = dx::XMMatrixAffineTransformation(scaling, origin, rotation, translation);
+                                shading_model = static_cast<BrdfModel>(model);
                             }
+                            ImGui::CheckboxFlags("Fresnel", &shading_features, static_cast<ShadingFeatures>(ShadingFeature::Fresnel));
+                            ImGui::CheckboxFlags("Ambient", &shading_features, static_cast<ShadingFeatures>(ShadingFeature::Ambient));
+                            ImGui::SliderFloat("Roughness", &shading_roughness, 0.0f, 1.0f);
 
-                            // upload
+                            // the same shading on the cpu, with the permutation branched on per pixel or resolved at compile time
+                            if (ImGui::Button("Run benchmark##Shading"))
                             {
-                                SubresourceMap map{ d3d_ctx.Get(), cb_object.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0 };
-                                auto constants{ static_cast<ObjectConstants*>(map.Data()) };
-                                dx::XMStoreFloat4x4(&constants->model, model);
-                                constants->color = sphere_color;
-                                constants->position = sphere_position;
-                                constants->radius = RADIUS;
+                                shading_results = RunShadingBenchmark(512, 5);
+                            }
+                            if (!shading_results.empty() && ImGui::BeginTable("ShadingResults", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+                            {
+                                ImGui::TableSetupColumn("BRDF");
+                                ImGui::TableSetupColumn("Features");
+                                ImGui::TableSetupColumn("Dynamic ms");
+                                ImGui::TableSetupColumn("Specialized ms");
+                                ImGui::TableSetupColumn("Mismatches");
+                                ImGui::TableHeadersRow();
+                                for (const ShadingBenchmarkResult& result : shading_results)
+                                {
+                                    ShadingFeatures features{ ShadingPermutationFeatures(result.key) };
+                                    ImGui::TableNextRow();
+                                    ImGui::TableNextColumn();
+                                    ImGui::TextUnformatted(BrdfModelName(ShadingPermutationModel(result.key)));
+                                    ImGui::TableNextColumn();
+                                    ImGui::Text("%s%s", HasShadingFeature(features, ShadingFeature::Fresnel) ? "F" : "-", HasShadingFeature(features, ShadingFeature::Ambient) ? "A" : "-");
+                                    ImGui::TableNextColumn();
+                                    ImGui::Text("%.3f", result.dynamic_ms);
+                                    ImGui::TableNextColumn();
+                                    ImGui::Text("%.3f", result.specialized_ms);
+                                    ImGui::TableNextColumn();
+                                    ImGui::Text("%u", result.mismatches);
+                                }
+                                ImGui::EndTable();
                             }
                         }
+                        if (ImGui::CollapsingHeader("Materials"))
+                        {
+                            // selecting a material applies it to the sphere
+                            auto browser_begin{ std::chrono::steady_clock::now() };
+                            if (MaterialBrowser("MaterialBrowser", materials, &material_thumbnails, ImVec2{ 0.0f, 320.0f }, &selected_material))
+                            {
+                                const Material& material{ materials[static_cast<std::size_t>(selected_material)] };
+                                sphere_color = { material.albedo.x, material.albedo.y, material.albedo.z };
+                                shading_model = material.model;
+                                shading_features = material.features;
+                                shading_roughness = material.roughness;
+                                scene_dirty = true;
+                            }
+                            auto browser_end{ std::chrono::steady_clock::now() };
+                            material_browser_ms = std::chrono::duration<float, std::milli>(browser_end - browser_begin).count();
+
+                            ThumbnailCacheStats stats{ material_thumbnails.Stats() };
+                            ImGui::Text("Materials: %zu", materials.size());
+                            ImGui::Text("Browser: %.3f ms", material_browser_ms);
+                            ImGui::Text("Thumbnails: %u / %u resident (%zu KB atlas)", stats.resident, stats.capacity, stats.memory_bytes / 1024);
+                            ImGui::Text("Queued: %u, rendering: %u", stats.queued, stats.rendering);
+                            ImGui::Text("Rendered: %u, evicted: %u, discarded: %u", stats.rendered, stats.evicted, stats.discarded);
+                        }
+                        if (ImGui::CollapsingHeader("Tonemapping"))
+                        {
+                            const char* operators[]{ "Reinhard", "ACES", "AgX" };
+                            auto tonemap_operator{ static_cast<int>(tonemap_settings.tonemap_operator) };
+                            if (ImGui::Combo("Operator", &tonemap_operator, operators, static_cast<int>(std::size(operators))))
+                            {
+                                tonemap_settings.tonemap_operator = static_cast<TonemapOperator>(tonemap_operator);
+                            }
+                            ImGui::Checkbox("Auto exposure", &tonemap_settings.auto_exposure);
+                            // same ID under both labels, so that toggling auto exposure doesn't interrupt a drag
+                            ImGui::SliderFloat(tonemap_settings.auto_exposure ? "Compensation (EV)###exposure_ev" : "Exposure (EV)###exposure_ev", &tonemap_settings.exposure_ev, -8.0f, 8.0f);
+                            if (tonemap_settings.auto_exposure)
+                            {
+                                ImGui::SliderFloat("Adaptation speed", &tonemap_settings.adaptation_speed, 0.1f, 10.0f);
+                                ImGui::SliderFloat("Min log luminance", &tonemap_settings.min_log_luminance, -16.0f, 0.0f);
+                                ImGui::SliderFloat("Log luminance range", &tonemap_settings.log_luminance_range, 1.0f, 32.0f);
+                            }
+                            if (ImGui::Button("Compare with CPU reference"))
+                            {
+                                tonemap_comparison_requested = true;
+                            }
+                            if (tonemap_comparison)
+                            {
+                                const TonemapComparison& result{ *tonemap_comparison };
+                                ImGui::Text("%u pixels", result.pixel_count);
+                                ImGui::Text("Max channel difference: %u", result.max_channel_difference);
+                                ImGui::Text("Pixels over tolerance (%u): %u", TONEMAP_COMPARISON_TOLERANCE, result.pixels_over_tolerance);
+                                if (result.auto_exposure)
+                                {
+                                    ImGui::Text("Histogram mismatches: %u", result.histogram_mismatches);
+                                    ImGui::Text("Average luminance: GPU %.5f, CPU %.5f", result.gpu_average_luminance, result.cpu_average_luminance);
+                                }
+                            }
+                        }
+                        if (ImGui::CollapsingHeader("Sphere Field"))
+                        {
+                            scene_dirty |= ImGui::SliderInt("Size##SphereField", &sphere_field_size, 0, 256);
+                            scene_dirty |= ImGui::DragFloat("Spacing##SphereField", &sphere_field_spacing, 0.01f, 0.1f, 10.0f);
+                        }
+                        if (ImGui::CollapsingHeader("Render Commands"))
+                        {
+                            scene_dirty |= ImGui::SliderInt("Recording slices", &scene_slice_count, 1, static_cast<int>(scene_slices.size()));
+                            ImGui::Text("Workers: %u", job_system.WorkerCount());
+                            ImGui::Text("Draws: %u", scene_replay_stats.draws);
+                            ImGui::Text("Pipeline binds: %u", scene_replay_stats.pipeline_binds);
+                            ImGui::Text("Mesh binds: %u", scene_replay_stats.mesh_binds);
+                            ImGui::Text("Redundant binds skipped: %u", scene_replay_stats.redundant_binds_skipped);
+                            ImGui::Text("Last record + sort: %.3f ms", scene_record_ms);
+                            ImGui::Text("Submit: %.3f ms", scene_submit_ms);
+                        }
+                        if (ImGui::CollapsingHeader("Shader Hot Reload"))
+                        {
+                            ImGui::Text("Cached shaders: %zu", shader_cache.EntryCount());
+                            std::vector<ShaderReloadStatus> statuses{};
+                            for (ShaderProgramHandle program{}; program < shader_reload.ProgramCount(); program++)
+                            {
+                                statuses.push_back(shader_reload.Status(program));
+                            }
+                            if (ImGui::BeginTable("ShaderPrograms", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+                            {
+                                ImGui::TableSetupColumn("File");
+                                ImGui::TableSetupColumn("Defines");
+                                ImGui::TableSetupColumn("State");
+                                ImGui::TableSetupColumn("Key");
+                                ImGui::TableSetupColumn("Reloads");
+                                ImGui::TableSetupColumn("Compile ms");
+                                ImGui::TableHeadersRow();
+                                for (const ShaderReloadStatus& status : statuses)
+                                {
+                                    ImGui::TableNextRow();
+                                    ImGui::TableNextColumn();
+                                    ImGui::Text("%s (%u files)", status.path.filename().string().c_str(), status.file_count);
+                                    ImGui::TableNextColumn();
+                                    ImGui::TextUnformatted(status.defines.empty() ? "-" : status.defines.c_str());
+                                    ImGui::TableNextColumn();
+                                    ImGui::TextUnformatted(ShaderReloadStateName(status.state));
+                                    ImGui::TableNextColumn();
+                                    ImGui::Text("%016llx", static_cast<unsigned long long>(status.key));
+                                    ImGui::TableNextColumn();
+                                    ImGui::Text("%u", status.reload_count);
+                                    ImGui::TableNextColumn();
+                                    ImGui::Text("%.1f", status.compile_ms);
+                                }
+                                ImGui::EndTable();
+                            }
+                            for (const ShaderReloadStatus& status : statuses)
+                            {
+                                if (!status.log.empty())
+                                {
+                                    ImGui::TextWrapped("%s", status.log.c_str());
+                                }
+                            }
+                        }
+                        if (ImGui::CollapsingHeader("Pipeline States"))
+                        {
+                            if (ImGui::BeginTable("PipelineStates", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+                            {
+                                ImGui::TableSetupColumn("Object");
+                                ImGui::TableSetupColumn("Created");
+                                ImGui::TableSetupColumn("Hits");
+                                ImGui::TableSetupColumn("Misses");
+                                ImGui::TableHeadersRow();
+                                for (std::uint32_t kind{}; kind < static_cast<std::uint32_t>(PipelineObjectKind::Count); kind++)
+                                {
+                                    PipelineCacheStats stats{ pipeline_states.Stats(static_cast<PipelineObjectKind>(kind)) };
+                                    ImGui::TableNextRow();
+                                    ImGui::TableNextColumn();
+                                    ImGui::TextUnformatted(PipelineObjectKindName(static_cast<PipelineObjectKind>(kind)));
+                                    ImGui::TableNextColumn();
+                                    ImGui::Text("%u", stats.objects);
+                                    ImGui::TableNextColumn();
+                                    ImGui::Text("%u", stats.hits);
+                                    ImGui::TableNextColumn();
+                                    ImGui::Text("%u", stats.misses);
+                                }
+                                ImGui::EndTable();
+                            }
 
-                        // set pipeline state
-                        d3d_ctx->IASetIndexBuffer(cube.Indices(), cube.IndexFormat(), 0);
-                        d3d_ctx->IASetVertexBuffers(0, 1, cube.Vertices(), cube.Stride(), cube.Offset());
-
-                        // draw
-                        d3d_ctx->DrawIndexed(cube.IndexCount(), 0, 0);
-                    }
+                            // bytecode persisted in the shader cache directory, keyed by the hash of the sources
+                            ShaderBytecodeCacheStats bytecode_stats{ shader_cache.Stats() };
+                            ImGui::Text("Bytecode memory hits: %u", bytecode_stats.memory_hits);
+                            ImGui::Text("Bytecode disk hits: %u", bytecode_stats.disk_hits);
+                            ImGui::Text("Bytecode misses: %u", bytecode_stats.misses);
+                            ImGui::Text("Bytecode stores: %u", bytecode_stats.stores);
+                        }
+                        if (ImGui::CollapsingHeader("Framebuffer"))
+                        {
+                            Extent2D viewport{ framebuffer_sizing.Viewport() };
+                            Extent2D allocation{ framebuffer_sizing.Allocation() };
+                            ImGui::Text("Viewport: %u x %u", viewport.width, viewport.height);
+                            ImGui::Text("Allocation: %u x %u", allocation.width, allocation.height);
+                            ImGui::Text("Resize requests: %u", framebuffer_sizing.ResizeRequests());
+                            ImGui::Text("Reallocations: %u", framebuffer_sizing.Reallocations());
+                        }
+                        if (ImGui::CollapsingHeader("Frame Pacing"))
+                        {
+                            const char* modes[]{ "Uncapped", "VSync", "Fixed rate", "Low latency" };
+                            auto mode{ static_cast<int>(frame_pacing_mode) };
+                            if (ImGui::Combo("Mode", &mode, modes, static_cast<int>(std::size(modes))))
+                            {
+                                frame_pacing_mode = static_cast<FramePacingMode>(mode);
+                            }
+                            if (frame_pacing_mode == FramePacingMode::FixedRate)
+                            {
+                                ImGui::SliderInt("Target FPS", &frame_target_fps, 10, 480);
+                            }
 
-                    // render light
-                    {
-                        // upload object constants
+                            FrameTimeSummary summary{ frame_time_stats.Summary() };
+                            ImGui::Text("Frames: %u", summary.frame_count);
+                            ImGui::Text("Average: %.3f ms (%.1f FPS)", summary.average_ms, summary.average_ms > 0.0 ? 1000.0 / summary.average_ms : 0.0);
+                            ImGui::Text("P50: %.3f ms", summary.p50_ms);
+                            ImGui::Text("P99: %.3f ms", summary.p99_ms);
+                            ImGui::Text("Min / Max: %.3f / %.3f ms", summary.min_ms, summary.max_ms);
+                            ImGui::Text("Jitter: %.3f ms", summary.jitter_ms);
+                        }
+                        if (ImGui::CollapsingHeader("UI Rendering"))
                         {
-                            constexpr float RADIUS{ 0.25f }; // light sphere radius (given by local box geometry)
-                            constexpr float DIAMETER{ RADIUS * 2.0f }; // light sphere diameter
+                            ui_capture_requested |= ImGui::Button("Save ui_capture.tga");
+                            ImGui::Checkbox("Rasterize every frame", &ui_capture_every_frame);
+                            ImGui::Text("CPU rasterization: %.3f ms", ui_capture.LastCaptureMs());
 
-                            // build model matrix
-                            dx::XMMATRIX model{};
+                            if (ImGui::Checkbox("Stream DX11 buffers", &ui_buffer_streaming))
+                            {
+                                ImGui_ImplDX11_SetBufferStreaming(ui_buffer_streaming);
+                            }
+                            ImGui_ImplDX11_BufferStreamingStats streaming_stats{};
+                            ImGui_ImplDX11_GetBufferStreamingStats(&streaming_stats);
+                            ImGui::Text("Vertex / index capacity: %d / %d", streaming_stats.VertexCapacity, streaming_stats.IndexCapacity);
+                            ImGui::Text("Grows: %d", streaming_stats.GrowCount);
+                            ImGui::Text("Discard / no-overwrite maps: %d / %d", streaming_stats.DiscardCount, streaming_stats.NoOverwriteCount);
+                        }
+                        if (ImGui::CollapsingHeader("Parallel Draw Lists"))
+                        {
+                            ImGui::Checkbox("Plot overlays", &plot_overlays);
+                            ImGui::Checkbox("Build on workers", &plot_overlays_on_workers);
+                            ImGui::SliderInt("Panels", &plot_overlay_count, 1, 256);
+                            ImGui::SliderInt("Points per curve", &plot_overlay_points, 2, 65536, "%d", ImGuiSliderFlags_Logarithmic);
+                            ImGui::Text("Build: %.3f ms", plot_draw_lists.LastBuildMs());
+                            ImGui::Text("Vertices: %llu", static_cast<unsigned long long>(plot_draw_lists.VertexCount()));
+                            if (ImGui::Button("Run benchmark##ParallelDrawLists"))
+                            {
+                                plot_benchmark_result = RunDrawListBenchmark(&plot_draw_lists, static_cast<std::uint32_t>(plot_overlay_count), static_cast<std::uint32_t>(plot_overlay_points), 8);
+                            }
+                            if (plot_benchmark_result)
+                            {
+                                const DrawListBenchmarkResult& result{ *plot_benchmark_result };
+                                ImGui::Text("%u panels x %u points, %llu vertices", result.panel_count, result.points_per_panel, static_cast<unsigned long long>(result.vertex_count));
+                                ImGui::Text("Serial: %.3f ms", result.serial_ms);
+                                ImGui::Text("%u workers: %.3f ms (%.2fx)", result.worker_count, result.parallel_ms, result.serial_ms / result.parallel_ms);
+                            }
+                        }
+                        if (ImGui::CollapsingHeader("Tessellation"))
+                        {
+                            ImGui::Text("SIMD backend: %s", TessellationBackendName());
+                            if (ImGui::Button("Run benchmark##Tessellation"))
+                            {
+                                const std::uint32_t point_counts[]{ 1'000, 10'000, 100'000, 1'000'000 };
+                                tessellation_results = RunTessellationBenchmark(point_counts, 5, 1);
+                            }
+                            if (!tessellation_results.empty() && ImGui::BeginTable("TessellationResults", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+                            {
+                                ImGui::TableSetupColumn("Shape");
+                                ImGui::TableSetupColumn("Points");
+                                ImGui::TableSetupColumn("Scalar (ms)");
+                                ImGui::TableSetupColumn("SIMD (ms)");
+                                ImGui::TableSetupColumn("Speedup");
+                                ImGui::TableSetupColumn("Mismatches");
+                                ImGui::TableHeadersRow();
+                                for (const TessellationBenchmarkResult& result : tessellation_results)
+                                {
+                                    ImGui::TableNextRow();
+                                    ImGui::TableNextColumn(); ImGui::TextUnformatted(TessellationShapeName(result.shape));
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", result.point_count);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.3f", result.scalar_ms);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.3f", result.simd_ms);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.2fx", result.scalar_ms / result.simd_ms);
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", result.mismatches);
+                                }
+                                ImGui::EndTable();
+                            }
+                        }
+                        if (ImGui::CollapsingHeader("Large Series Plots"))
+                        {
+                            if (ImGui::Button("Run benchmark##LargeSeriesPlots"))
+                            {
+                                const std::uint32_t sample_counts[]{ 1'000'000, 10'000'000 };
+                                large_plot_results = RunPlotBenchmark(sample_counts, 5, 1);
+                            }
+                            if (!large_plot_results.empty() && ImGui::BeginTable("LargeSeriesPlotResults", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+                            {
+                                ImGui::TableSetupColumn("Path");
+                                ImGui::TableSetupColumn("Samples");
+                                ImGui::TableSetupColumn("Plot (ms)");
+                                ImGui::TableSetupColumn("Speedup");
+                                ImGui::TableSetupColumn("Mismatches");
+                                ImGui::TableHeadersRow();
+                                double getter_ms{};
+                                for (const PlotBenchmarkResult& result : large_plot_results)
+                                {
+                                    if (result.path == PlotSeriesPath::Getter)
+                                    {
+                                        getter_ms = result.plot_ms;
+                                    }
+                                    ImGui::TableNextRow();
+                                    ImGui::TableNextColumn(); ImGui::TextUnformatted(PlotSeriesPathName(result.path));
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", result.sample_count);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.3f", result.plot_ms);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.2fx", getter_ms / result.plot_ms);
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", result.mismatches);
+                                }
+                                ImGui::EndTable();
+                            }
+                        }
+                        if (ImGui::CollapsingHeader("Text Filter"))
+                        {
+                            if (ImGui::Button("Run benchmark##TextFilter"))
+                            {
+                                text_filter_results = RunTextFilterBenchmark(100'000, 5, 1);
+                            }
+                            if (!text_filter_results.empty() && ImGui::BeginTable("TextFilterResults", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+                            {
+                                ImGui::TableSetupColumn("Query");
+                                ImGui::TableSetupColumn("Passed");
+                                ImGui::TableSetupColumn("Reference (ms)");
+                                ImGui::TableSetupColumn("PassFilter (ms)");
+                                ImGui::TableSetupColumn("Index (ms)");
+                                ImGui::TableSetupColumn("Mismatches");
+                                ImGui::TableHeadersRow();
+                                for (const TextFilterBenchmarkResult& result : text_filter_results)
+                                {
+                                    ImGui::TableNextRow();
+                                    ImGui::TableNextColumn(); ImGui::Text("\"%s\"%s", result.query, result.narrowed ? " (typed)" : "");
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", result.passed);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.3f", result.reference_ms);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.3f", result.pass_filter_ms);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.3f", result.index_ms);
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", result.mismatches);
+                                }
+                                ImGui::EndTable();
+                            }
+                        }
+                        if (ImGui::CollapsingHeader("Large Document"))
+                        {
+                            ImGui::SliderInt("Size (MB)##LargeDocument", &large_document_mb, 1, 32);
+                            ImGui::SameLine();
+                            if (ImGui::Button("Generate##LargeDocument"))
                             {
-                                dx::XMVECTOR scaling{ dx::XMVectorSet(DIAMETER, DIAMETER, DIAMETER, 0.0f) };
-                                dx::XMVECTOR origin{ dx::XMVectorZero() };
-                                dx::XMVECTOR rotation{ dx::XMQuaternionIdentity() };
-                                dx::XMVECTOR translation{ dx::XMLoadFloat3(&light_position) };
-                                model = dx::XMMatrixAffineTransformation(scaling, origin, rotation, translation);
+                                std::string source{ GenerateShaderSource(static_cast<std::uint32_t>(large_document_mb) << 20, 1) };
+                                large_document.SetText(source.data(), source.data() + source.size());
                             }
+                            ImGui::Text("%d bytes, %d lines, %d pieces", large_document.GetLength(), large_document.GetLineCount(), large_document.Pieces.Size);
+                            ImGui::InputTextLarge("##LargeDocument", &large_document, ImVec2(-FLT_MIN, ImGui::GetTextLineHeight() * 20.0f), ImGuiInputTextFlags_AllowTabInput);
 
-                            // upload
+                            if (ImGui::Button("Run benchmark##LargeDocument"))
+                            {
+                                const std::uint32_t document_sizes[]{ 1u << 20, 10u << 20 };
+                                text_document_results = RunTextDocumentBenchmark(document_sizes, 1'000, 1);
+                            }
+                            if (!text_document_results.empty() && ImGui::BeginTable("TextDocumentResults", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
                             {
-                                SubresourceMap map{ d3d_ctx.Get(), cb_object.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0 };
-                                auto constants{ static_cast<ObjectConstants*>(map.Data()) };
-                                dx::XMStoreFloat4x4(&constants->model, model);
-                                constants->color = light_color;
-                                constants->position = light_position;
-                                constants->radius = RADIUS;
+                                ImGui::TableSetupColumn("Edit");
+                                ImGui::TableSetupColumn("Size (MB)");
+                                ImGui::TableSetupColumn("Document mean (us)");
+                                ImGui::TableSetupColumn("Document max (us)");
+                                ImGui::TableSetupColumn("Flat mean (us)");
+                                ImGui::TableSetupColumn("Flat max (us)");
+                                ImGui::TableSetupColumn("Mismatches");
+                                ImGui::TableHeadersRow();
+                                for (const TextDocumentBenchmarkResult& result : text_document_results)
+                                {
+                                    ImGui::TableNextRow();
+                                    ImGui::TableNextColumn(); ImGui::TextUnformatted(TextEditName(result.edit));
+                                    ImGui::TableNextColumn(); ImGui::Text("%.1f", static_cast<double>(result.document_bytes) / (1 << 20));
+                                    ImGui::TableNextColumn(); ImGui::Text("%.2f", result.document_mean_us);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.2f", result.document_max_us);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.1f", result.flat_mean_us);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.1f", result.flat_max_us);
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", result.mismatches);
+                                }
+                                ImGui::EndTable();
                             }
                         }
+                        if (ImGui::CollapsingHeader("Large Table"))
+                        {
+                            ImGui::SliderInt("Rows##LargeTable", &brdf_statistics_rows, 1'000, 1'000'000, "%d", ImGuiSliderFlags_Logarithmic);
+                            ImGui::SameLine();
+                            if (ImGui::Button("Generate##LargeTable"))
+                            {
+                                brdf_statistics = GenerateBrdfStatistics(static_cast<std::uint32_t>(brdf_statistics_rows), static_cast<std::uint32_t>(brdf_statistics_version));
+                                brdf_statistics_version++;
+
+                                // outliers show a second line
+                                float row_height{ ImGui::GetTextLineHeight() + ImGui::GetStyle().CellPadding.y * 2.0f };
+                                brdf_statistics_table.SetRowsCount(static_cast<int>(brdf_statistics.size()), row_height);
+                                for (std::size_t row{}; row < brdf_statistics.size(); row++)
+                                {
+                                    if (brdf_statistics[row].outlier)
+                                    {
+                                        brdf_statistics_table.SetRowHeight(static_cast<int>(row), row_height + ImGui::GetTextLineHeightWithSpacing());
+                                    }
+                                }
+                            }
+                            ImGui::Text("%d rows, sorted %d times, %.3f ms", brdf_statistics_table.RowsCount, brdf_statistics_table.SortCount, brdf_statistics_ms);
 
-                        // set pipeline state
-                        d3d_ctx->IASetIndexBuffer(cube.Indices(), cube.IndexFormat(), 0);
-                        d3d_ctx->IASetVertexBuffers(0, 1, cube.Vertices(), cube.Stride(), cube.Offset());
+                            auto table_begin{ std::chrono::steady_clock::now() };
+                            ImGuiTableFlags table_flags{ ImGuiTableFlags_ScrollY | ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti | ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable };
+                            if (!brdf_statistics.empty() && ImGui::BeginTable("BrdfStatistics", static_cast<int>(BrdfStatisticsColumn::Count), table_flags, ImVec2(0.0f, ImGui::GetTextLineHeightWithSpacing() * 20.0f)))
+                            {
+                                ImGui::TableSetupScrollFreeze(0, 1);
+                                for (std::uint32_t column{}; column < static_cast<std::uint32_t>(BrdfStatisticsColumn::Count); column++)
+                                {
+                                    ImGui::TableSetupColumn(BrdfStatisticsColumnName(static_cast<BrdfStatisticsColumn>(column)), ImGuiTableColumnFlags_None, 0.0f, column);
+                                }
+                                ImGui::TableHeadersRow();
+
+                                // sorts only when the sort specs or the statistics changed
+                                brdf_statistics_table.Sort(ImGui::TableGetSortSpecs(), brdf_statistics_version, CompareBrdfStatistics, &brdf_statistics);
+                                ImGui::TableDataBeginRows(&brdf_statistics_table);
+                                for (int display_row{ brdf_statistics_table.DisplayStart }; display_row < brdf_statistics_table.DisplayEnd; display_row++)
+                                {
+                                    ImGui::TableDataNextRow(&brdf_statistics_table, display_row);
+                                    const BrdfStatistics& statistics{ brdf_statistics[static_cast<std::size_t>(brdf_statistics_table.Order[display_row])] };
+                                    ImGui::TableNextColumn(); ImGui::Text("Material %u", statistics.material);
+                                    if (statistics.outlier)
+                                    {
+                                        ImGui::TextDisabled("outlier");
+                                    }
+                                    ImGui::TableNextColumn(); ImGui::TextUnformatted(BrdfModelName(statistics.model));
+                                    ImGui::TableNextColumn(); ImGui::Text("%.3f", statistics.roughness);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.2e", statistics.mean_error);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.2e", statistics.max_error);
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", statistics.samples);
+                                }
+                                ImGui::TableDataEndRows(&brdf_statistics_table);
+                                ImGui::EndTable();
+                            }
+                            brdf_statistics_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - table_begin).count();
 
-                        // draw
-                        d3d_ctx->DrawIndexed(cube.IndexCount(), 0, 0);
+                            if (ImGui::Button("Run benchmark##LargeTable"))
+                            {
+                                const std::uint32_t row_counts[]{ 100'000, 1'000'000 };
+                                data_table_results = RunDataTableBenchmark(row_counts, 3, 1);
+                            }
+                            if (!data_table_results.empty() && ImGui::BeginTable("DataTableResults", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+                            {
+                                ImGui::TableSetupColumn("Rows");
+                                ImGui::TableSetupColumn("Sort (ms)");
+                                ImGui::TableSetupColumn("std::stable_sort (ms)");
+                                ImGui::TableSetupColumn("Frame (us)");
+                                ImGui::TableSetupColumn("Linear frame (us)");
+                                ImGui::TableSetupColumn("Height update (us)");
+                                ImGui::TableSetupColumn("Mismatches");
+                                ImGui::TableHeadersRow();
+                                for (const DataTableBenchmarkResult& result : data_table_results)
+                                {
+                                    ImGui::TableNextRow();
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", result.row_count);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.2f", result.sort_ms);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.2f", result.std_sort_ms);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.3f", result.frame_us);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.1f", result.linear_frame_us);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.3f", result.height_update_us);
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", result.mismatches);
+                                }
+                                ImGui::EndTable();
+                            }
+                        }
+                        if (ImGui::CollapsingHeader("Text Layout Cache"))
+                        {
+                            ImGui::CheckboxFlags("Cache text layouts", &ImGui::GetIO().Fonts->Flags, ImFontAtlasFlags_TextLayoutCache);
+                            ImFontTextLayoutCacheStats stats{ ImGui::GetIO().Fonts->GetTextLayoutCacheStats() };
+                            int lookups{ stats.Hits + stats.Misses };
+                            ImGui::Text("Hits / misses: %d / %d (%.1f%%)", stats.Hits, stats.Misses, lookups > 0 ? 100.0f * static_cast<float>(stats.Hits) / static_cast<float>(lookups) : 0.0f);
+                            ImGui::Text("Bytes laid out by misses: %d", stats.MissedBytes);
+                            ImGui::Text("Glyphs copied: %d", stats.GlyphsCopied);
+                            ImGui::Text("Insertions / evictions: %d / %d", stats.Insertions, stats.Evictions);
+                            ImGui::Text("Layouts: %d, %d KB", stats.Layouts, stats.MemoryBytes / 1024);
+                            ImGui::Text("Invalidations: %d", stats.Invalidations);
+                        }
+                        if (ImGui::CollapsingHeader("Font Baking"))
+                        {
+                            ImGui::InputText("Font file", font_bake_path, sizeof(font_bake_path));
+                            if (ImGui::Button("Run benchmark##FontBaking"))
+                            {
+                                const float sizes[]{ 13.0f, 16.0f, 20.0f, 26.0f };
+                                font_bake_result = RunFontBakeBenchmark(&job_system, font_bake_path, sizes, ImGui::GetIO().Fonts->GetGlyphRangesChineseSimplifiedCommon(), 3);
+                            }
+                            if (font_bake_result)
+                            {
+                                const FontBakeBenchmarkResult& result{ *font_bake_result };
+                                if (!result.font_file_loaded)
+                                {
+                                    ImGui::TextUnformatted("Font file not found, used the default font");
+                                }
+                                ImGui::Text("%u glyphs at 4 sizes, %dx%d texture", result.glyph_count, result.texture_width, result.texture_height);
+                                ImGui::Text("Serial: %.2f ms", result.serial_ms);
+                                ImGui::Text("%u workers: %.2f ms (%.2fx)", result.worker_count, result.parallel_ms, result.serial_ms / result.parallel_ms);
+                                ImGui::Text("Atlases identical: %s", result.identical ? "yes" : "NO");
+                            }
+                        }
+                        if (ImGui::CollapsingHeader("Font Atlas Cache"))
+                        {
+                            const FontAtlasCacheStartup& startup{ imgui_handle.FontAtlasCache() };
+                            ImGui::Text("Cache at startup: %s, %zu KB", FontAtlasCacheStatusName(startup.status), startup.file_bytes / 1024);
+                            ImGui::Text("Cache load: %.2f ms", startup.load_ms);
+                            ImGui::Text("Startup to first ImGui frame: %.2f ms", imgui_startup_ms.value_or(0.0));
+                            ImGui::InputText("Font file##FontAtlasCache", font_bake_path, sizeof(font_bake_path));
+                            if (ImGui::Button("Run benchmark##FontAtlasCache"))
+                            {
+                                const float sizes[]{ 13.0f, 16.0f, 20.0f, 26.0f };
+                                font_cache_result = RunFontAtlasCacheBenchmark(font_bake_path, sizes, ImGui::GetIO().Fonts->GetGlyphRangesChineseSimplifiedCommon(), 3);
+                            }
+                            if (font_cache_result)
+                            {
+                                const FontAtlasCacheBenchmarkResult& result{ *font_cache_result };
+                                if (!result.font_file_loaded)
+                                {
+                                    ImGui::TextUnformatted("Font file not found, used the default font");
+                                }
+                                ImGui::Text("%u glyphs at 4 sizes, %zu KB cache", result.glyph_count, result.cache_bytes / 1024);
+                                ImGui::Text("Bake: %.2f ms", result.bake_ms);
+                                ImGui::Text("Load cache: %.2f ms (%.2fx)", result.load_ms, result.bake_ms / result.load_ms);
+                                ImGui::Text("Atlases identical: %s", result.identical ? "yes" : "NO");
+                            }
+                        }
+                        if (ImGui::CollapsingHeader("Atlas Packing"))
+                        {
+                            ImGui::CheckboxFlags("Pack with MaxRects", &ImGui::GetIO().Fonts->Flags, ImFontAtlasFlags_PackMaxRects);
+                            if (ImGui::Button("Run benchmark##AtlasPacking"))
+                            {
+                                atlas_packing_results = RunAtlasPackingBenchmark(20'000, 20'000, 3, 1);
+                            }
+                            if (!atlas_packing_results.empty() && ImGui::BeginTable("AtlasPackingResults", 10, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+                            {
+                                ImGui::TableSetupColumn("Glyphs");
+                                ImGui::TableSetupColumn("Packer");
+                                ImGui::TableSetupColumn("Fill (us)");
+                                ImGui::TableSetupColumn("Fill efficiency");
+                                ImGui::TableSetupColumn("Fill textures");
+                                ImGui::TableSetupColumn("Churn (us)");
+                                ImGui::TableSetupColumn("Churn efficiency");
+                                ImGui::TableSetupColumn("Churn textures");
+                                ImGui::TableSetupColumn("Texture");
+                                ImGui::TableSetupColumn("Mismatches");
+                                ImGui::TableHeadersRow();
+                                for (const AtlasPackingBenchmarkResult& result : atlas_packing_results)
+                                {
+                                    ImGui::TableNextRow();
+                                    ImGui::TableNextColumn(); ImGui::Text("%s", GlyphSizeDistributionName(result.distribution));
+                                    ImGui::TableNextColumn(); ImGui::TextUnformatted(result.max_rects ? "MaxRects" : "Skyline");
+                                    ImGui::TableNextColumn(); ImGui::Text("%.2f", result.fill_us);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.1f%%", result.fill_efficiency * 100.0f);
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", result.fill_textures);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.2f", result.churn_us);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.1f%%", result.churn_efficiency * 100.0f);
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", result.churn_textures);
+                                    ImGui::TableNextColumn(); ImGui::Text("%dx%d", result.texture_width, result.texture_height);
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", result.mismatches);
+                                }
+                                ImGui::EndTable();
+                            }
+                        }
+                        if (ImGui::CollapsingHeader("Settings Store"))
+                        {
+                            SettingsStoreStats stats{ settings_store.Stats() };
+                            ImGui::Text("Entries: %u", stats.entries);
+                            ImGui::Text("File: %llu KB, latest records %llu KB", stats.file_bytes / 1024, stats.live_bytes / 1024);
+                            ImGui::Text("Load: %.3f ms", stats.load_ms);
+                            ImGui::Text("Saves: %u, last %.3f ms", stats.saves, stats.last_save_ms);
+                            ImGui::Text("Records written: %u, pending %u", stats.records_written, stats.pending);
+                            ImGui::Text("Compactions: %u", stats.compactions);
+                            if (ImGui::Button("Run benchmark##SettingsStore"))
+                            {
+                                const std::uint32_t entry_counts[]{ 1'000, 10'000, 30'000 };
+                                settings_store_results = RunSettingsStoreBenchmark(entry_counts, 3, 1);
+                            }
+                            if (!settings_store_results.empty() && ImGui::BeginTable("SettingsStoreResults", 8, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+                            {
+                                ImGui::TableSetupColumn("Entries");
+                                ImGui::TableSetupColumn("imgui.ini (KB)");
+                                ImGui::TableSetupColumn("Records (KB)");
+                                ImGui::TableSetupColumn("imgui.ini load (ms)");
+                                ImGui::TableSetupColumn("Records load (ms)");
+                                ImGui::TableSetupColumn("imgui.ini save (ms)");
+                                ImGui::TableSetupColumn("Records save (ms)");
+                                ImGui::TableSetupColumn("Mismatches");
+                                ImGui::TableHeadersRow();
+                                for (const SettingsStoreBenchmarkResult& result : settings_store_results)
+                                {
+                                    ImGui::TableNextRow();
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", result.entry_count);
+                                    ImGui::TableNextColumn(); ImGui::Text("%zu", result.ini_bytes / 1024);
+                                    ImGui::TableNextColumn(); ImGui::Text("%zu", result.records_bytes / 1024);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.2f", result.ini_load_ms);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.2f", result.records_load_ms);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.2f", result.ini_save_ms);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.4f", result.records_save_ms);
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", result.mismatches);
+                                }
+                                ImGui::EndTable();
+                            }
+                        }
+                        if (ImGui::CollapsingHeader("ID Hashing"))
+                        {
+                            if (ImGui::Button("Run benchmark"))
+                            {
+                                IdHashBenchmark id_hash_benchmark{ 4096, 1 };
+                                id_hash_results = id_hash_benchmark.Run(32);
+                            }
+                            for (const IdHashBackend& backend : IdHashBackends())
+                            {
+                                if (!backend.available)
+                                {
+                                    ImGui::Text("%s: not supported by this CPU, uses the table", backend.name);
+                                }
+                            }
+                            if (!id_hash_results.empty() && ImGui::BeginTable("IdHashResults", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+                            {
+                                ImGui::TableSetupColumn("Backend");
+                                ImGui::TableSetupColumn("Labels");
+                                ImGui::TableSetupColumn("ns / label");
+                                ImGui::TableSetupColumn("GB/s");
+                                ImGui::TableSetupColumn("Collisions");
+                                ImGui::TableHeadersRow();
+                                for (const IdHashBenchmarkResult& result : id_hash_results)
+                                {
+                                    ImGui::TableNextRow();
+                                    ImGui::TableNextColumn(); ImGui::TextUnformatted(result.backend);
+                                    ImGui::TableNextColumn(); ImGui::TextUnformatted(IdLabelSetName(result.label_set));
+                                    ImGui::TableNextColumn(); ImGui::Text("%.2f", result.ns_per_label);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.2f", result.gb_per_second);
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", result.collisions);
+                                }
+                                ImGui::EndTable();
+                            }
+                        }
+                        if (ImGui::CollapsingHeader("ImGui Storage"))
+                        {
+                            if (ImGui::Button("Run benchmark (a few seconds)"))
+                            {
+                                const std::uint32_t key_counts[]{ 10'000, 100'000, 1'000'000 };
+                                storage_results = RunStorageBenchmark(key_counts, 100'000, 1);
+                            }
+                            if (!storage_results.empty() && ImGui::BeginTable("StorageResults", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+                            {
+                                ImGui::TableSetupColumn("Keys");
+                                ImGui::TableSetupColumn("Mode");
+                                ImGui::TableSetupColumn("Insert (ms)");
+                                ImGui::TableSetupColumn("Lookup (ns)");
+                                ImGui::TableSetupColumn("Memory (KB)");
+                                ImGui::TableHeadersRow();
+                                for (const StorageBenchmarkResult& result : storage_results)
+                                {
+                                    ImGui::TableNextRow();
+                                    ImGui::TableNextColumn(); ImGui::Text("%u", result.key_count);
+                                    ImGui::TableNextColumn(); ImGui::TextUnformatted(result.hash_mode ? "Hash" : "Sorted");
+                                    ImGui::TableNextColumn(); ImGui::Text(result.incremental_insert ? "%.2f" : "%.2f (bulk)", result.insert_ms);
+                                    ImGui::TableNextColumn(); ImGui::Text("%.1f", result.lookup_ns);
+                                    ImGui::TableNextColumn(); ImGui::Text("%zu", result.bytes / 1024);
+                                }
+                                ImGui::EndTable();
+                            }
+                        }
+                        if (ImGui::CollapsingHeader("ImGui Memory"))
+                        {
+                            ImGui::Checkbox("Allocation overlay", &imgui_allocation_overlay);
+                        }
                     }
-                }
+                    ImGui::End();
+                    material_thumbnails.EndFrame();
 
-                // render ImGui
-                imgui_handle.BeginFrame();
-                {
-                    ImGui::Begin("BRDFs");
+                    // plot overlays; the lists are built here but merged after ImGui::Render, on top of every window
+                    if (plot_overlays)
                     {
-                        if (ImGui::CollapsingHeader("Camera", ImGuiTreeNodeFlags_DefaultOpen))
+                        ParallelDrawLists::PrepareText("Roughness 0123456789.");
+
+                        const ImGuiViewport* main_viewport{ ImGui::GetMainViewport() };
+                        auto columns{ std::max(1u, static_cast<std::uint32_t>(main_viewport->WorkSize.x / 160.0f)) };
+                        ImVec2 origin{ main_viewport->WorkPos.x + 10.0f, main_viewport->WorkPos.y + 10.0f };
+                        auto point_count{ static_cast<std::uint32_t>(plot_overlay_points) };
+                        plot_draw_lists.Build(static_cast<std::uint32_t>(plot_overlay_count), [=](ImDrawList* draw_list, std::uint32_t panel)
                         {
-                            ImGuiEx::DragFloat3("Position##Camera", camera_position, 0.01f);
-                            ImGuiEx::DragFloat3("Target", camera_target, 0.01f);
-                        }
-                        if (ImGui::CollapsingHeader("Sphere", ImGuiTreeNodeFlags_DefaultOpen))
+                            float x{ origin.x + static_cast<float>(panel % columns) * 160.0f };
+                            float y{ origin.y + static_cast<float>(panel / columns) * 110.0f };
+                            DrawPlotPanel(draw_list, panel, x, y, 150.0f, 100.0f, point_count);
+                        }, !plot_overlays_on_workers);
+                    }
+                    else
+                    {
+                        plot_draw_lists.Build(0, {});
+                    }
+
+                    if (imgui_allocation_overlay)
+                    {
+                        ImGuiAllocatorStats stats{ imgui_allocator.Stats() };
+
+                        // frame-local text; only the formatting runs in the arena scope, window creation must not land in the arena
+                        ImGuiTextBuffer text{};
                         {
-                            ImGuiEx::DragFloat3("Position##Sphere", sphere_position, 0.01f);
-                            ImGuiEx::ColorEdit3("Color##Sphere", sphere_color);
+                            ImGuiAllocatorArenaScope arena_scope{};
+                            text.appendf("Allocations / frees: %u / %u\n", stats.last_frame.allocations, stats.last_frame.frees);
+                            text.appendf("Heap allocations: %u\n", stats.last_frame.heap_allocations);
+                            text.appendf("Arena allocations: %u (%u pages)\n", stats.last_frame.arena_allocations, stats.arena_pages);
+                            text.appendf("Bytes allocated: %zu\n", stats.last_frame.bytes_allocated);
+                            text.appendf("Live: %.1f KB (peak %.1f KB)\n", static_cast<double>(stats.live_bytes) / 1024.0, static_cast<double>(stats.peak_live_bytes) / 1024.0);
+                            text.appendf("Reserved: %.1f KB", static_cast<double>(stats.reserved_bytes) / 1024.0);
                         }
-                        if (ImGui::CollapsingHeader("Light", ImGuiTreeNodeFlags_DefaultOpen))
+
+                        const ImGuiViewport* main_viewport{ ImGui::GetMainViewport() };
+                        ImGui::SetNextWindowPos(ImVec2{ main_viewport->WorkPos.x + main_viewport->WorkSize.x - 10.0f, main_viewport->WorkPos.y + 10.0f }, ImGuiCond_Always, ImVec2{ 1.0f, 0.0f });
+                        ImGui::SetNextWindowBgAlpha(0.35f);
+                        ImGuiWindowFlags overlay_flags{ ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoMove };
+                        if (ImGui::Begin("ImGui Allocations", &imgui_allocation_overlay, overlay_flags))
                         {
-                            ImGuiEx::DragFloat3("Position##Light", light_position, 0.01f);
-                            ImGuiEx::ColorEdit3("Color##Light", light_color);
+                            ImGui::TextUnformatted(text.begin(), text.end());
                         }
+                        ImGui::End();
+                    }
+                }
+                ImDrawData* ui_draw_data{ imgui_handle.EndFrame() };
+                if (ImGui::GetIO().WantSaveIniSettings)
+                {
+                    // settings changed io.IniSavingRate seconds ago; the file is written on the store thread
+                    settings_store.Save();
+                    ImGui::GetIO().WantSaveIniSettings = false;
+                }
+                if (!imgui_startup_ms)
+                {
+                    imgui_startup_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - imgui_start).count();
+                }
+                plot_draw_lists.Merge(ui_draw_data);
+                imgui_handle.DrawFrame(framebuffer.BackBufferRTV(), ui_draw_data);
+
+                // rasterize the ui on the cpu
+                if (ui_capture_requested || ui_capture_every_frame)
+                {
+                    ui_capture.Capture(ui_draw_data);
+                    if (ui_capture_requested)
+                    {
+                        ui_capture.SaveTGA("ui_capture.tga");
+                        ui_capture_requested = false;
                     }
-                    ImGui::End();
                 }
-                imgui_handle.EndFrame(framebuffer.BackBufferRTV());
 
                 // present
                 {
-                    CheckHR(swap_chain->Present(1, 0)); // present with vsync
+                    switch (frame_pacing_mode)
+                    {
+                    case FramePacingMode::Uncapped:
+                    {
+                        CheckHR(swap_chain->Present(0, 0)); // present without vsync
+                    } break;
+                    case FramePacingMode::VSync:
+                    case FramePacingMode::LowLatency:
+                    {
+                        CheckHR(swap_chain->Present(1, 0)); // present with vsync
+                    } break;
+                    case FramePacingMode::FixedRate:
+                    {
+                        frame_limiter.Wait(static_cast<double>(frame_target_fps));
+                        CheckHR(swap_chain->Present(0, 0)); // present without vsync; the limiter paces the frames
+                    } break;
+                    default:
+                    {
+                        Unreachable();
+                    } break;
+                    }
                 }
             }
         }
     }
+
+    // settings changed since the last autosave; the store writes them before it is destroyed
+    settings_store.Save();
 }
 
 // ---------- Main ----------
@@ -0,0 +1,440 @@
+#include <MaterialBrowser.h>
+
+#include <Assertions.h>
+
+#include <imgui_internal.h> // for RegisterUserTexture
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+// ---------- Materials ----------
+
+std::vector<Material> GenerateMaterials(std::uint32_t count, std::uint32_t seed)
+{
+    const char* finishes[]{ "Polished", "Brushed", "Matte", "Glazed", "Worn", "Lacquered", "Satin", "Rough" };
+    const char* substances[]{ "Ceramic", "Plastic", "Rubber", "Clay", "Marble", "Paint", "Enamel", "Resin", "Jade", "Chalk" };
+
+    std::mt19937 rng{ seed };
+    std::uniform_real_distribution<float> channel{ 0.05f, 0.95f };
+    std::uniform_real_distribution<float> roughness{ 0.05f, 1.0f };
+    std::uniform_int_distribution<std::uint32_t> model{ 0, static_cast<std::uint32_t>(BrdfModel::Count) - 1 };
+    std::uniform_int_distribution<std::uint32_t> features{ 0, (1u << SHADING_FEATURE_BITS) - 1 };
+
+    std::vector<Material> materials(count);
+    for (std::uint32_t i{}; i < count; i++)
+    {
+        char name[64]{};
+        std::snprintf(name, sizeof(name), "%s %s %05u", finishes[i % std::size(finishes)], substances[(i / std::size(finishes)) % std::size(substances)], i);
+
+        Material& material{ materials[i] };
+        material.name = name;
+        material.albedo = { channel(rng), channel(rng), channel(rng) };
+        material.roughness = roughness(rng);
+        material.model = static_cast<BrdfModel>(model(rng));
+        material.features = features(rng);
+    }
+    return materials;
+}
+
+void RenderMaterialThumbnail(const Material& material, std::uint32_t size, std::span<std::uint32_t> rgba)
+{
+    Check(rgba.size() >= static_cast<std::size_t>(size) * size);
+
+    ReferenceSphereView view{};
+    view.width = size;
+    view.height = size;
+    view.light_direction = { -0.5f, 0.6f, -0.6f };
+    view.albedo = material.albedo;
+    view.light_color = { 1.0f, 1.0f, 1.0f };
+    view.roughness = material.roughness;
+
+    std::vector<float> rgb(static_cast<std::size_t>(size) * size * 3);
+    RenderReferenceSphere(MakeShadingPermutationKey(material.model, material.features), view, rgb, false);
+
+    // same sphere coverage as the reference renderer
+    for (std::uint32_t y{}; y < size; y++)
+    {
+        for (std::uint32_t x{}; x < size; x++)
+        {
+            float u{ (static_cast<float>(x) + 0.5f) / static_cast<float>(size) * 2.0f - 1.0f };
+            float v{ 1.0f - (static_cast<float>(y) + 0.5f) / static_cast<float>(size) * 2.0f };
+            std::size_t pixel{ static_cast<std::size_t>(y) * size + x };
+            if (u * u + v * v >= 1.0f)
+            {
+                rgba[pixel] = 0;
+                continue;
+            }
+
+            // Reinhard, then gamma 2.2 for the non-sRGB ui pipeline
+            auto encode{ [](float c) { return static_cast<int>(std::pow(c / (1.0f + c), 1.0f / 2.2f) * 255.0f + 0.5f); } };
+            rgba[pixel] = IM_COL32(encode(rgb[pixel * 3 + 0]), encode(rgb[pixel * 3 + 1]), encode(rgb[pixel * 3 + 2]), 255);
+        }
+    }
+}
+
+// ---------- Thumbnail Cache ----------
+
+ThumbnailCache::ThumbnailCache(std::uint32_t thumbnail_size, std::size_t memory_budget, std::uint32_t worker_count, ThumbnailRenderFunction render)
+    : m_thumbnail_size{ thumbnail_size }
+    , m_atlas_columns{}
+    , m_render{ std::move(render) }
+    , m_pixels{}
+    , m_texture{}
+    , m_registered{}
+    , m_frame{}
+    , m_slots{}
+    , m_free_slots{}
+    , m_lru_head{ NO_SLOT }
+    , m_lru_tail{ NO_SLOT }
+    , m_resident{}
+    , m_frame_requests{}
+    , m_mutex{}
+    , m_wake_cv{}
+    , m_queue{}
+    , m_in_flight{}
+    , m_finished{}
+    , m_stats{}
+    , m_quit{}
+    , m_threads{}
+{
+    Check(m_thumbnail_size > 0);
+    Check(worker_count > 0);
+    Check(m_render);
+
+    // square-ish atlas of as many thumbnails as the budget holds
+    std::size_t thumbnail_bytes{ static_cast<std::size_t>(m_thumbnail_size) * m_thumbnail_size * sizeof(std::uint32_t) };
+    auto capacity{ static_cast<std::uint32_t>(std::max<std::size_t>(memory_budget / thumbnail_bytes, 1)) };
+    m_atlas_columns = static_cast<std::uint32_t>(std::ceil(std::sqrt(static_cast<double>(capacity))));
+    std::uint32_t atlas_rows{ (capacity + m_atlas_columns - 1) / m_atlas_columns };
+    std::uint32_t width{ m_atlas_columns * m_thumbnail_size };
+    std::uint32_t height{ atlas_rows * m_thumbnail_size };
+    Check(width <= 16384 && height <= 16384); // largest D3D11 texture
+
+    // pixels stay owned by the cache, so that the texture never frees them through the ImGui allocator
+    m_pixels.resize(static_cast<std::size_t>(width) * height);
+    m_texture.Format = ImTextureFormat_RGBA32;
+    m_texture.Width = static_cast<int>(width);
+    m_texture.Height = static_cast<int>(height);
+    m_texture.BytesPerPixel = 4;
+    m_texture.Pixels = reinterpret_cast<unsigned char*>(m_pixels.data());
+    m_texture.UsedRect = { 0, 0, static_cast<unsigned short>(width), static_cast<unsigned short>(height) };
+    m_texture.UpdateRect = { static_cast<unsigned short>(~0), static_cast<unsigned short>(~0), 0, 0 };
+    m_texture.RefCount = 1;
+    m_texture.UseColors = true;
+    m_texture.SetStatus(ImTextureStatus_WantCreate);
+
+    m_slots.resize(capacity);
+    for (std::uint32_t slot{ capacity }; slot > 0; slot--)
+    {
+        m_free_slots.push_back(slot - 1);
+    }
+    m_stats.capacity = capacity;
+    m_stats.memory_bytes = m_pixels.size() * sizeof(std::uint32_t);
+
+    for (std::uint32_t i{}; i < worker_count; i++)
+    {
+        m_threads.emplace_back([this]() { WorkerMain(); });
+    }
+}
+ThumbnailCache::~ThumbnailCache()
+{
+    {
+        std::lock_guard lock{ m_mutex };
+        m_quit = true;
+    }
+    m_wake_cv.notify_all();
+    for (std::thread& thread : m_threads)
+    {
+        thread.join();
+    }
+
+    if (m_registered && ImGui::GetCurrentContext() != nullptr)
+    {
+        ImGui::UnregisterUserTexture(&m_texture);
+    }
+    m_texture.Pixels = nullptr; // owned by m_pixels
+    m_texture.Updates.clear(); // allocated with IM_ALLOC; released here, while the ImGui allocator is alive, rather than by ~ImVector
+}
+void ThumbnailCache::BeginFrame()
+{
+    m_frame++;
+    if (!m_registered)
+    {
+        ImGui::RegisterUserTexture(&m_texture);
+        m_registered = true;
+    }
+    if (m_texture.Status == ImTextureStatus_OK)
+    {
+        // the backend uploaded the previous updates
+        m_texture.Updates.resize(0);
+        m_texture.UpdateRect = { static_cast<unsigned short>(~0), static_cast<unsigned short>(~0), 0, 0 };
+    }
+
+    std::vector<FinishedThumbnail> finished{};
+    {
+        std::lock_guard lock{ m_mutex };
+        finished.swap(m_finished);
+        for (const FinishedThumbnail& thumbnail : finished)
+        {
+            m_in_flight.erase(thumbnail.item);
+        }
+    }
+    for (const FinishedThumbnail& thumbnail : finished)
+    {
+        Insert(thumbnail.item, thumbnail.pixels);
+    }
+}
+bool ThumbnailCache::Request(std::uint32_t item, float priority, ImVec2* uv0, ImVec2* uv1)
+{
+    auto it{ m_resident.find(item) };
+    if (it == m_resident.end())
+    {
+        m_frame_requests.push_back({ item, priority });
+        return false;
+    }
+
+    std::uint32_t slot{ it->second };
+    m_slots[slot].last_frame = m_frame;
+    Unlink(slot);
+    PushFront(slot);
+
+    auto x{ static_cast<float>(slot % m_atlas_columns * m_thumbnail_size) };
+    auto y{ static_cast<float>(slot / m_atlas_columns * m_thumbnail_size) };
+    auto extent{ static_cast<float>(m_thumbnail_size) };
+    ImVec2 texel{ 1.0f / static_cast<float>(m_texture.Width), 1.0f / static_cast<float>(m_texture.Height) };
+    *uv0 = ImVec2{ x * texel.x, y * texel.y };
+    *uv1 = ImVec2{ (x + extent) * texel.x, (y + extent) * texel.y };
+    return true;
+}
+void ThumbnailCache::Prefetch(std::uint32_t item, float priority)
+{
+    if (!m_resident.contains(item))
+    {
+        m_frame_requests.push_back({ item, priority });
+    }
+}
+void ThumbnailCache::EndFrame()
+{
+    std::sort(m_frame_requests.begin(), m_frame_requests.end(), [](const QueuedRequest& a, const QueuedRequest& b) { return a.priority > b.priority; });
+    {
+        std::lock_guard lock{ m_mutex };
+        m_queue.clear();
+        for (const QueuedRequest& request : m_frame_requests)
+        {
+            if (!m_in_flight.contains(request.item))
+            {
+                m_queue.push_back(request);
+            }
+        }
+        m_stats.queued = static_cast<std::uint32_t>(m_queue.size());
+    }
+    m_frame_requests.clear();
+    m_wake_cv.notify_all();
+}
+ThumbnailCacheStats ThumbnailCache::Stats()
+{
+    std::lock_guard lock{ m_mutex };
+    ThumbnailCacheStats stats{ m_stats };
+    stats.resident = static_cast<std::uint32_t>(m_resident.size());
+    stats.rendering = static_cast<std::uint32_t>(m_in_flight.size());
+    return stats;
+}
+void ThumbnailCache::WorkerMain()
+{
+    for (;;)
+    {
+        std::uint32_t item{};
+        {
+            std::unique_lock lock{ m_mutex };
+            m_wake_cv.wait(lock, [this]() { return m_quit || !m_queue.empty(); });
+            if (m_quit)
+            {
+                return;
+            }
+            item = m_queue.back().item;
+            m_queue.pop_back();
+            m_in_flight.insert(item);
+        }
+
+        std::vector<std::uint32_t> pixels(static_cast<std::size_t>(m_thumbnail_size) * m_thumbnail_size);
+        m_render(item, pixels);
+
+        std::lock_guard lock{ m_mutex };
+        m_finished.push_back({ item, std::move(pixels) });
+        m_stats.rendered++;
+    }
+}
+void ThumbnailCache::Insert(std::uint32_t item, std::span<const std::uint32_t> pixels)
+{
+    if (m_resident.contains(item))
+    {
+        return;
+    }
+
+    std::uint32_t slot{ NO_SLOT };
+    if (!m_free_slots.empty())
+    {
+        slot = m_free_slots.back();
+        m_free_slots.pop_back();
+    }
+    else if (m_slots[m_lru_tail].last_frame + 1 < m_frame)
+    {
+        // the least recently used thumbnail was not shown last frame
+        slot = m_lru_tail;
+        Unlink(slot);
+        m_resident.erase(m_slots[slot].item);
+        std::lock_guard lock{ m_mutex };
+        m_stats.evicted++;
+    }
+    else
+    {
+        // every thumbnail is on screen; the budget is too small for the view
+        std::lock_guard lock{ m_mutex };
+        m_stats.discarded++;
+        return;
+    }
+
+    m_slots[slot].item = item;
+    m_slots[slot].last_frame = m_frame;
+    PushFront(slot);
+    m_resident.emplace(item, slot);
+
+    // copy into the atlas and queue the upload of the region
+    std::uint32_t x{ slot % m_atlas_columns * m_thumbnail_size };
+    std::uint32_t y{ slot / m_atlas_columns * m_thumbnail_size };
+    for (std::uint32_t row{}; row < m_thumbnail_size; row++)
+    {
+        std::uint32_t* dst{ m_pixels.data() + static_cast<std::size_t>(y + row) * static_cast<std::size_t>(m_texture.Width) + x };
+        std::memcpy(dst, pixels.data() + static_cast<std::size_t>(row) * m_thumbnail_size, m_thumbnail_size * sizeof(std::uint32_t));
+    }
+    if (m_texture.Status == ImTextureStatus_OK || m_texture.Status == ImTextureStatus_WantUpdates)
+    {
+        ImTextureRect rect{ static_cast<unsigned short>(x), static_cast<unsigned short>(y), static_cast<unsigned short>(m_thumbnail_size), static_cast<unsigned short>(m_thumbnail_size) };
+        int x1{ std::max(m_texture.UpdateRect.w == 0 ? 0 : m_texture.UpdateRect.x + m_texture.UpdateRect.w, rect.x + rect.w) };
+        int y1{ std::max(m_texture.UpdateRect.h == 0 ? 0 : m_texture.UpdateRect.y + m_texture.UpdateRect.h, rect.y + rect.h) };
+        m_texture.UpdateRect.x = std::min(m_texture.UpdateRect.x, rect.x);
+        m_texture.UpdateRect.y = std::min(m_texture.UpdateRect.y, rect.y);
+        m_texture.UpdateRect.w = static_cast<unsigned short>(x1 - m_texture.UpdateRect.x);
+        m_texture.UpdateRect.h = static_cast<unsigned short>(y1 - m_texture.UpdateRect.y);
+        m_texture.Updates.push_back(rect);
+        m_texture.SetStatus(ImTextureStatus_WantUpdates);
+    }
+}
+void ThumbnailCache::Unlink(std::uint32_t slot)
+{
+    Slot& s{ m_slots[slot] };
+    (s.prev != NO_SLOT ? m_slots[s.prev].next : m_lru_head) = s.next;
+    (s.next != NO_SLOT ? m_slots[s.next].prev : m_lru_tail) = s.prev;
+    s.prev = NO_SLOT;
+    s.next = NO_SLOT;
+}
+void ThumbnailCache::PushFront(std::uint32_t slot)
+{
+    Slot& s{ m_slots[slot] };
+    s.prev = NO_SLOT;
+    s.next = m_lru_head;
+    (m_lru_head != NO_SLOT ? m_slots[m_lru_head].prev : m_lru_tail) = slot;
+    m_lru_head = slot;
+}
+
+// ---------- Material Browser ----------
+
+static constexpr int PREFETCH_ROWS{ 4 };
+static constexpr float PREFETCH_PRIORITY{ 1e6f }; // after every visible thumbnail
+
+bool MaterialBrowser(const char* str_id, std::span<const Material> materials, ThumbnailCache* thumbnails, ImVec2 size, int* selected)
+{
+    bool changed{};
+    if (!ImGui::BeginChild(str_id, size, ImGuiChildFlags_Borders))
+    {
+        ImGui::EndChild();
+        return changed;
+    }
+
+    const ImGuiStyle& style{ ImGui::GetStyle() };
+    auto cell{ static_cast<float>(thumbnails->ThumbnailSize()) };
+    ImVec2 cell_size{ cell, cell + ImGui::GetTextLineHeight() + style.ItemInnerSpacing.y };
+    int columns{ std::max(1, static_cast<int>((ImGui::GetContentRegionAvail().x + style.ItemSpacing.x) / (cell_size.x + style.ItemSpacing.x))) };
+    auto item_count{ static_cast<int>(materials.size()) };
+    int row_count{ (item_count + columns - 1) / columns };
+
+    ImDrawList* draw_list{ ImGui::GetWindowDrawList() };
+    ImU32 placeholder_col{ ImGui::GetColorU32(ImGuiCol_FrameBg) };
+
+    ImGuiListClipper clipper{};
+    clipper.Begin(row_count, cell_size.y + style.ItemSpacing.y);
+    int first_row{ row_count };
+    int last_row{ -1 };
+    while (clipper.Step())
+    {
+        for (int row{ clipper.DisplayStart }; row < clipper.DisplayEnd; row++)
+        {
+            first_row = std::min(first_row, row);
+            last_row = std::max(last_row, row);
+            for (int column{}; column < columns; column++)
+            {
+                int index{ row * columns + column };
+                if (index >= item_count)
+                {
+                    break;
+                }
+                if (column > 0)
+                {
+                    ImGui::SameLine();
+                }
+
+                const Material& material{ materials[static_cast<std::size_t>(index)] };
+                ImGui::PushID(index);
+                ImVec2 pos{ ImGui::GetCursorScreenPos() };
+                if (ImGui::Selectable("##material", *selected == index, ImGuiSelectableFlags_None, cell_size))
+                {
+                    changed = *selected != index;
+                    *selected = index;
+                }
+                if (ImGui::IsItemHovered())
+                {
+                    ImGui::SetTooltip("%s\n%s, roughness %.2f", material.name.c_str(), BrdfModelName(material.model), material.roughness);
+                }
+                ImGui::PopID();
+
+                // visible rows first, top left to bottom right
+                ImVec2 uv0{};
+                ImVec2 uv1{};
+                ImVec2 image_max{ pos.x + cell, pos.y + cell };
+                if (thumbnails->Request(static_cast<std::uint32_t>(index), static_cast<float>((row - clipper.DisplayStart) * columns + column), &uv0, &uv1))
+                {
+                    draw_list->AddImage(thumbnails->Texture(), pos, image_max, uv0, uv1);
+                }
+                else
+                {
+                    draw_list->AddRectFilled(pos, image_max, placeholder_col, cell * 0.5f);
+                }
+                ImVec2 text_pos{ pos.x, image_max.y + style.ItemInnerSpacing.y };
+                ImGui::RenderTextEllipsis(draw_list, text_pos, ImVec2{ pos.x + cell, text_pos.y + ImGui::GetTextLineHeight() }, pos.x + cell, material.name.c_str(), nullptr, nullptr);
+            }
+        }
+    }
+    clipper.End();
+
+    // rows about to scroll into view, nearest first
+    for (int distance{ 1 }; distance <= PREFETCH_ROWS && last_row >= 0; distance++)
+    {
+        for (int row : { last_row + distance, first_row - distance })
+        {
+            for (int column{}; row >= 0 && row < row_count && column < columns; column++)
+            {
+                int index{ row * columns + column };
+                if (index < item_count)
+                {
+                    thumbnails->Prefetch(static_cast<std::uint32_t>(index), PREFETCH_PRIORITY + static_cast<float>(distance * columns + column));
+                }
+            }
+        }
+    }
+
+    ImGui::EndChild();
+    return changed;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <Shading.h>
+
+#include <imgui.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// ---------- Materials ----------
+
+struct Material
+{
+    std::string name;
+    ShadingVector albedo;
+    float roughness;
+    BrdfModel model;
+    ShadingFeatures features;
+};
+
+// a library of varied materials with unique names
+std::vector<Material> GenerateMaterials(std::uint32_t count, std::uint32_t seed);
+
+// material on the reference sphere as size * size RGBA8 pixels, tonemapped, transparent around the sphere
+void RenderMaterialThumbnail(const Material& material, std::uint32_t size, std::span<std::uint32_t> rgba);
+
+// ---------- Thumbnail Cache ----------
+
+// (item, size * size RGBA8 pixels to fill); runs on a worker thread
+using ThumbnailRenderFunction = std::function<void(std::uint32_t, std::span<std::uint32_t>)>;
+
+struct ThumbnailCacheStats
+{
+    std::uint32_t capacity; // thumbnails the atlas holds
+    std::uint32_t resident;
+    std::uint32_t queued; // requested last frame and not resident or rendering
+    std::uint32_t rendering; // taken by a worker and not yet in the atlas
+    std::uint32_t rendered; // total
+    std::uint32_t evicted; // total; least recently used thumbnails replaced by new ones
+    std::uint32_t discarded; // total; finished while every slot was on screen
+    std::size_t memory_bytes; // atlas pixels
+};
+
+/*
+    thumbnails rendered on background threads into an atlas texture, evicted least recently used first
+    the UI thread requests the thumbnails it shows every frame, each with a priority; the queue is replaced by the requests
+    of the latest frame, so items scrolled away are never rendered and the workers always pick the most important visible item
+    memory_budget bounds the atlas and should hold a few screens of thumbnails; a thumbnail shown in the previous frame is never evicted
+    the atlas is an ImGui user texture updated in place, so any renderer backend with ImGuiBackendFlags_RendererHasTextures shows it;
+    the backend destroys it at shutdown, so the cache must outlive the ImGui context
+*/
+class ThumbnailCache
+{
+public:
+    ThumbnailCache(std::uint32_t thumbnail_size, std::size_t memory_budget, std::uint32_t worker_count, ThumbnailRenderFunction render);
+    ~ThumbnailCache();
+    ThumbnailCache(const ThumbnailCache&) = delete;
+    ThumbnailCache(ThumbnailCache&&) noexcept = delete;
+    ThumbnailCache& operator=(const ThumbnailCache&) = delete;
+    ThumbnailCache& operator=(ThumbnailCache&&) noexcept = delete;
+public:
+    // moves finished thumbnails into the atlas; call once per frame, inside the ImGui frame, before any Request
+    void BeginFrame();
+    // true with the atlas region of item when it is resident; otherwise queues it for this frame, lower priority first
+    bool Request(std::uint32_t item, float priority, ImVec2* uv0, ImVec2* uv1);
+    // queues item like Request when it is not resident; a resident item is left where it is in the eviction order, as it is not shown
+    void Prefetch(std::uint32_t item, float priority);
+    // hands the requests of the frame to the workers, dropping the previous ones
+    void EndFrame();
+    ImTextureRef Texture() { return m_texture.GetTexRef(); }
+    std::uint32_t ThumbnailSize() const noexcept { return m_thumbnail_size; }
+    ThumbnailCacheStats Stats();
+private:
+    static constexpr std::uint32_t NO_SLOT{ 0xFFFFFFFF };
+    struct Slot
+    {
+        std::uint32_t item;
+        std::uint64_t last_frame; // last frame it was requested
+        std::uint32_t prev; // toward the most recently used
+        std::uint32_t next; // toward the least recently used
+    };
+    struct QueuedRequest
+    {
+        std::uint32_t item;
+        float priority;
+    };
+    struct FinishedThumbnail
+    {
+        std::uint32_t item;
+        std::vector<std::uint32_t> pixels;
+    };
+    void WorkerMain();
+    void Insert(std::uint32_t item, std::span<const std::uint32_t> pixels);
+    void Unlink(std::uint32_t slot);
+    void PushFront(std::uint32_t slot);
+private:
+    std::uint32_t m_thumbnail_size;
+    std::uint32_t m_atlas_columns;
+    ThumbnailRenderFunction m_render;
+
+    // UI thread only
+    std::vector<std::uint32_t> m_pixels; // atlas storage, referenced by m_texture
+    ImTextureData m_texture;
+    bool m_registered;
+    std::uint64_t m_frame;
+    std::vector<Slot> m_slots;
+    std::vector<std::uint32_t> m_free_slots;
+    std::uint32_t m_lru_head;
+    std::uint32_t m_lru_tail;
+    std::unordered_map<std::uint32_t, std::uint32_t> m_resident; // item -> slot
+    std::vector<QueuedRequest> m_frame_requests;
+
+    // shared with the workers
+    std::mutex m_mutex;
+    std::condition_variable m_wake_cv;
+    std::vector<QueuedRequest> m_queue; // sorted by decreasing priority value, so that the next item is at the back
+    std::unordered_set<std::uint32_t> m_in_flight; // taken by a worker, until BeginFrame moves it into the atlas
+    std::vector<FinishedThumbnail> m_finished;
+    ThumbnailCacheStats m_stats;
+    bool m_quit;
+    std::vector<std::thread> m_threads;
+};
+
+// ---------- Material Browser ----------
+
+/*
+    grid of material thumbnails filling a child window of the given size; ImGuiListClipper limits layout to the visible rows,
+    so the cost of a frame depends on the window size and not on the number of materials
+    visible thumbnails are requested top to bottom, then PREFETCH_ROWS rows below and above at a lower priority
+    returns true when the selection changed
+*/
+bool MaterialBrowser(const char* str_id, std::span<const Material> materials, ThumbnailCache* thumbnails, ImVec2 size, int* selected);
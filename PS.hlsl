@@ -1,4 +1,5 @@
 #include "Commons.hlsli"
+#include "Shading.hlsli"
 
 struct PSOutput
 {
@@ -56,6 +57,14 @@ PSOutput main(VSOutput input)
 
         // write computed depth
         output.depth = p_ndc.z;
+
+        if (cb_object.emissive == 0)
+        {
+            float3 n = (p_world - center) / radius;
+            float3 v = -direction;
+            float3 l = normalize(cb_scene.light_position - p_world);
+            output.color.rgb = Shade(n, v, l, cb_object.color, cb_scene.light_color, cb_scene.roughness);
+        }
     }
     
     return output;
@@ -0,0 +1,212 @@
+#include <ParallelDrawLists.h>
+
+#include <Assertions.h>
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <numbers>
+
+// ---------- Parallel Draw Lists ----------
+
+ParallelDrawLists::ParallelDrawLists(JobSystem* job_system)
+    : m_job_system{ job_system }
+    , m_entries{}
+    , m_built_count{}
+    , m_last_build_ms{}
+{
+    Check(job_system);
+}
+ParallelDrawLists::~ParallelDrawLists()
+{
+    for (Entry& entry : m_entries)
+    {
+        entry.draw_list.reset();
+        ImFontAtlasRemoveDrawListSharedData(entry.shared_data->FontAtlas, entry.shared_data.get());
+    }
+}
+void ParallelDrawLists::Build(std::uint32_t job_count, const DrawListJob& job, bool serial)
+{
+    auto build_begin{ std::chrono::steady_clock::now() };
+
+    const ImDrawListSharedData* context_data{ ImGui::GetDrawListSharedData() };
+    Check(context_data->FontAtlas);
+
+    // resolve the baked font text is drawn with now: ImFont::GetFontBaked() then returns ImFont::LastBaked on the workers without
+    // writing anything. Resolving another size there would write LastBaked and ImFontBaked::LastUsedFrame from several threads
+    ImFont* font{ context_data->Font };
+    const ImFontBaked* baked{ font ? font->GetFontBaked(context_data->FontSize) : nullptr };
+
+    while (m_entries.size() < job_count)
+    {
+        Entry entry{};
+        entry.shared_data = std::make_unique<ImDrawListSharedData>();
+        entry.shared_data->FontAtlas = context_data->FontAtlas;
+        ImFontAtlasAddDrawListSharedData(context_data->FontAtlas, entry.shared_data.get()); // atlas texture changes patch our lists too
+        entry.draw_list = std::make_unique<ImDrawList>(entry.shared_data.get());
+        entry.draw_list->_OwnerName = "ParallelDrawLists";
+        m_entries.emplace_back(std::move(entry));
+    }
+
+    // everything but the scratch buffer mirrors the context, which may have changed since the last frame
+    for (std::uint32_t i{}; i < job_count; i++)
+    {
+        ImDrawListSharedData* data{ m_entries[i].shared_data.get() };
+        Check(data->FontAtlas == context_data->FontAtlas);
+        data->TexUvWhitePixel = context_data->TexUvWhitePixel;
+        data->TexUvLines = context_data->TexUvLines;
+        data->Font = context_data->Font;
+        data->FontSize = context_data->FontSize;
+        data->FontScale = context_data->FontScale;
+        data->CurveTessellationTol = context_data->CurveTessellationTol;
+        data->SetCircleTessellationMaxError(context_data->CircleSegmentMaxError);
+        data->InitialFringeScale = context_data->InitialFringeScale;
+        data->InitialFlags = context_data->InitialFlags | ImDrawListFlags_NoTextLayoutCache; // the layout cache is not thread safe
+        data->ClipRectFullscreen = context_data->ClipRectFullscreen;
+        data->Context = context_data->Context;
+
+        ImDrawList* draw_list{ m_entries[i].draw_list.get() };
+        draw_list->_ResetForNewFrame();
+        draw_list->PushClipRectFullScreen();
+        draw_list->PushTexture(context_data->FontAtlas->TexRef);
+    }
+
+    if (serial)
+    {
+        for (std::uint32_t i{}; i < job_count; i++)
+        {
+            job(m_entries[i].draw_list.get(), i);
+        }
+    }
+    else if (job_count > 0)
+    {
+        m_job_system->ParallelFor(job_count, [this, &job](std::uint32_t, std::uint32_t slice)
+        {
+            job(m_entries[slice].draw_list.get(), slice);
+        });
+    }
+    m_built_count = job_count;
+    Check(!font || font->LastBaked == baked); // a job drew text at another font or size than the current one
+
+    auto build_end{ std::chrono::steady_clock::now() };
+    m_last_build_ms = std::chrono::duration<float, std::milli>(build_end - build_begin).count();
+}
+void ParallelDrawLists::Merge(ImDrawData* draw_data) const
+{
+    Check(draw_data);
+    for (std::uint32_t i{}; i < m_built_count; i++)
+    {
+        draw_data->AddDrawList(m_entries[i].draw_list.get());
+    }
+}
+std::uint64_t ParallelDrawLists::VertexCount() const
+{
+    std::uint64_t vertex_count{};
+    for (std::uint32_t i{}; i < m_built_count; i++)
+    {
+        vertex_count += static_cast<std::uint64_t>(m_entries[i].draw_list->VtxBuffer.Size);
+    }
+    return vertex_count;
+}
+void ParallelDrawLists::PrepareText(const char* text)
+{
+    ImFontBaked* baked{ ImGui::GetFontBaked() };
+    const char* text_end{ text + std::strlen(text) };
+    while (text < text_end)
+    {
+        unsigned int c{};
+        text += ImTextCharFromUtf8(&c, text, text_end);
+        baked->FindGlyph(static_cast<ImWchar>(c));
+    }
+}
+
+// ---------- Benchmark ----------
+
+void DrawPlotPanel(ImDrawList* draw_list, std::uint32_t panel_index, float x, float y, float width, float height, std::uint32_t point_count)
+{
+    Check(point_count >= 2);
+
+    // scratch points, reused by every panel the thread draws
+    thread_local std::vector<ImVec2> points{};
+    points.resize(point_count);
+
+    ImVec2 p_min{ x, y };
+    ImVec2 p_max{ x + width, y + height };
+    draw_list->AddRectFilled(p_min, p_max, IM_COL32(20, 20, 24, 220), 4.0f);
+    draw_list->AddRect(p_min, p_max, IM_COL32(90, 90, 100, 255), 4.0f);
+
+    // a different roughness per panel
+    float golden{ static_cast<float>(panel_index) * 0.618034f };
+    float roughness{ 0.05f + 0.9f * (golden - std::floor(golden)) };
+
+    float plot_x{ x + 8.0f };
+    float plot_w{ width - 16.0f };
+    float base_y{ y + height - 8.0f };
+    float plot_h{ height - 28.0f };
+
+    // hemisphere, flattened by roughness
+    float center_x{ x + width * 0.5f };
+    for (std::uint32_t i{}; i < point_count; i++)
+    {
+        float angle{ std::numbers::pi_v<float> * static_cast<float>(i) / static_cast<float>(point_count - 1) };
+        points[i] = ImVec2{ center_x + std::cos(angle) * plot_w * 0.5f, base_y - std::sin(angle) * plot_h * (1.0f - 0.5f * roughness) };
+    }
+    draw_list->AddConvexPolyFilled(points.data(), static_cast<int>(point_count), IM_COL32(70, 110, 160, 120));
+
+    // GGX normal distribution over the half angle, normalized by its peak
+    float alpha{ roughness * roughness };
+    float alpha2{ alpha * alpha };
+    for (std::uint32_t i{}; i < point_count; i++)
+    {
+        float t{ static_cast<float>(i) / static_cast<float>(point_count - 1) };
+        float cos_theta{ std::cos(t * std::numbers::pi_v<float> * 0.5f) };
+        float denom{ cos_theta * cos_theta * (alpha2 - 1.0f) + 1.0f };
+        float d_over_peak{ alpha2 * alpha2 / (denom * denom) };
+        points[i] = ImVec2{ plot_x + t * plot_w, base_y - d_over_peak * plot_h };
+    }
+    draw_list->AddPolyline(points.data(), static_cast<int>(point_count), IM_COL32(255, 190, 80, 255), ImDrawFlags_None, 1.5f);
+
+    char label[32]{};
+    std::snprintf(label, sizeof(label), "Roughness %.2f", roughness);
+    draw_list->AddText(ImVec2{ x + 6.0f, y + 4.0f }, IM_COL32(255, 255, 255, 255), label);
+}
+
+DrawListBenchmarkResult RunDrawListBenchmark(ParallelDrawLists* draw_lists, std::uint32_t panel_count, std::uint32_t points_per_panel, std::uint32_t repetitions)
+{
+    Check(draw_lists);
+    Check(repetitions > 0);
+
+    ParallelDrawLists::PrepareText("Roughness 0123456789.");
+
+    DrawListJob job{ [points_per_panel](ImDrawList* draw_list, std::uint32_t panel)
+    {
+        float x{ static_cast<float>(panel % 8) * 160.0f };
+        float y{ static_cast<float>(panel / 8) * 110.0f };
+        DrawPlotPanel(draw_list, panel, x, y, 150.0f, 100.0f, points_per_panel);
+    } };
+
+    DrawListBenchmarkResult result{};
+    result.panel_count = panel_count;
+    result.points_per_panel = points_per_panel;
+    result.worker_count = draw_lists->WorkerCount();
+    result.serial_ms = std::numeric_limits<double>::max();
+    result.parallel_ms = std::numeric_limits<double>::max();
+    for (std::uint32_t repetition{}; repetition < repetitions; repetition++)
+    {
+        draw_lists->Build(panel_count, job, true);
+        result.serial_ms = std::min(result.serial_ms, static_cast<double>(draw_lists->LastBuildMs()));
+        draw_lists->Build(panel_count, job, false);
+        result.parallel_ms = std::min(result.parallel_ms, static_cast<double>(draw_lists->LastBuildMs()));
+    }
+    result.vertex_count = draw_lists->VertexCount();
+
+    // leave nothing to merge into this frame
+    draw_lists->Build(0, job);
+    return result;
+}
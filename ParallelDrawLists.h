@@ -0,0 +1,81 @@
+#pragma once
+
+#include <JobSystem.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+struct ImDrawData;
+struct ImDrawList;
+struct ImDrawListSharedData;
+
+// ---------- Parallel Draw Lists ----------
+
+// job(draw_list, job_index) fills one draw list, possibly on a worker thread
+using DrawListJob = std::function<void(ImDrawList*, std::uint32_t)>;
+
+/*
+    builds independent ImDrawLists on the job system and merges them into the ImGui draw data
+    - each list owns a copy of the context ImDrawListSharedData, whose scratch buffer the tessellators write into
+    - jobs may tessellate freely (AddPolyline, AddConvexPolyFilled, paths, ...) and draw text whose glyphs are already loaded,
+      at the current font and font size only; call PrepareText on the main thread for any text a job draws, loading glyphs
+      mutates the font atlas, and Build resolves the baked font of the current size before dispatch so that workers only read it
+    - lists bypass the font atlas text layout cache, which only the main thread may use
+    - lists are merged in job order whatever the order workers finish in, so the output is deterministic
+    - lists are drawn after every ImGui window
+    lists keep their buffers across frames, so workers only allocate while a list grows; ImGui::MemAlloc then counts
+    io.MetricsActiveAllocations from several threads, which may skew that debug counter
+*/
+class ParallelDrawLists
+{
+public:
+    explicit ParallelDrawLists(JobSystem* job_system);
+    ~ParallelDrawLists();
+    ParallelDrawLists(const ParallelDrawLists&) = delete;
+    ParallelDrawLists(ParallelDrawLists&&) noexcept = delete;
+    ParallelDrawLists& operator=(const ParallelDrawLists&) = delete;
+    ParallelDrawLists& operator=(ParallelDrawLists&&) noexcept = delete;
+public:
+    // main thread, between ImGui::NewFrame() and ImGui::Render(); blocks until every job is done
+    // serial runs every job on the calling thread, for comparison
+    void Build(std::uint32_t job_count, const DrawListJob& job, bool serial = false);
+    // main thread, after ImGui::Render(); appends the lists of the last Build
+    void Merge(ImDrawData* draw_data) const;
+    // main thread; loads the glyphs of text at the current font and font size
+    static void PrepareText(const char* text);
+    float LastBuildMs() const noexcept { return m_last_build_ms; }
+    std::uint32_t WorkerCount() const noexcept { return m_job_system->WorkerCount(); }
+    // vertices of the lists of the last Build
+    std::uint64_t VertexCount() const;
+private:
+    struct Entry
+    {
+        std::unique_ptr<ImDrawListSharedData> shared_data;
+        std::unique_ptr<ImDrawList> draw_list;
+    };
+private:
+    JobSystem* m_job_system;
+    std::vector<Entry> m_entries;
+    std::uint32_t m_built_count;
+    float m_last_build_ms;
+};
+
+// ---------- Benchmark ----------
+
+struct DrawListBenchmarkResult
+{
+    std::uint32_t panel_count;
+    std::uint32_t points_per_panel;
+    std::uint32_t worker_count;
+    double serial_ms; // fastest repetition
+    double parallel_ms; // fastest repetition
+    std::uint64_t vertex_count;
+};
+
+// plot panels of the kind the BRDFs UI draws: a filled lobe, an anti-aliased curve and text labels per panel
+void DrawPlotPanel(ImDrawList* draw_list, std::uint32_t panel_index, float x, float y, float width, float height, std::uint32_t point_count);
+
+// builds panel_count plot panels serially, then in parallel; requires an ImGui frame in progress
+DrawListBenchmarkResult RunDrawListBenchmark(ParallelDrawLists* draw_lists, std::uint32_t panel_count, std::uint32_t points_per_panel, std::uint32_t repetitions);
@@ -0,0 +1,46 @@
+#include <PipelineState.h>
+
+#include <Assertions.h>
+#include <ShaderHotReload.h> // for HashShaderBytes
+
+// ---------- Pipeline State Keys ----------
+
+PipelineStateHasher::PipelineStateHasher()
+    : m_hash{ SHADER_HASH_SEED }
+{
+}
+PipelineStateHasher& PipelineStateHasher::Bytes(std::span<const std::uint8_t> bytes)
+{
+    std::uint64_t size{ bytes.size() };
+    m_hash = HashShaderBytes({ reinterpret_cast<const std::uint8_t*>(&size), sizeof(size) }, m_hash);
+    m_hash = HashShaderBytes(bytes, m_hash);
+    return *this;
+}
+PipelineStateHasher& PipelineStateHasher::String(std::string_view text)
+{
+    return Bytes({ reinterpret_cast<const std::uint8_t*>(text.data()), text.size() });
+}
+
+// ---------- Pipeline State Cache ----------
+
+const char* PipelineObjectKindName(PipelineObjectKind kind)
+{
+    switch (kind)
+    {
+    case PipelineObjectKind::VertexShader: return "Vertex shader";
+    case PipelineObjectKind::PixelShader: return "Pixel shader";
+    case PipelineObjectKind::InputLayout: return "Input layout";
+    case PipelineObjectKind::RasterizerState: return "Rasterizer state";
+    case PipelineObjectKind::Pipeline: return "Pipeline";
+    default: Unreachable();
+    }
+}
+
+PipelineStateCache::PipelineStateCache()
+    : m_tables{}
+{
+}
+PipelineCacheStats PipelineStateCache::Stats(PipelineObjectKind kind) const
+{
+    return m_tables.at(static_cast<std::size_t>(kind)).stats;
+}
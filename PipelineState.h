@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+// ---------- Pipeline State Keys ----------
+
+using PipelineStateKey = std::uint64_t;
+
+/*
+    hashes a state description field by field into a PipelineStateKey
+    every field is hashed with its length, so that different splits of the same bytes give different keys
+    Value hashes the object representation: structs must be free of padding or value-initialized, and must not hold pointers
+*/
+class PipelineStateHasher
+{
+public:
+    PipelineStateHasher();
+public:
+    PipelineStateHasher& Bytes(std::span<const std::uint8_t> bytes);
+    PipelineStateHasher& String(std::string_view text);
+    template <typename T>
+    PipelineStateHasher& Value(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T> && !std::is_pointer_v<T>);
+        return Bytes({ reinterpret_cast<const std::uint8_t*>(&value), sizeof(T) });
+    }
+    PipelineStateKey Key() const noexcept { return m_hash; }
+private:
+    std::uint64_t m_hash;
+};
+
+// ---------- Pipeline State Cache ----------
+
+enum class PipelineObjectKind : std::uint32_t
+{
+    VertexShader = 0,
+    PixelShader = 1,
+    InputLayout = 2,
+    RasterizerState = 3,
+    Pipeline = 4, // the combination of the others
+    Count,
+};
+
+const char* PipelineObjectKindName(PipelineObjectKind kind);
+
+using PipelineObjectId = std::uint32_t;
+
+struct PipelineCacheStats
+{
+    std::uint32_t objects; // distinct keys, each created once
+    std::uint32_t hits; // requests served by an existing object
+    std::uint32_t misses; // requests that created an object
+};
+
+/*
+    deduplicates pipeline objects by the key of their description: create runs once per distinct key and kind,
+    and every later request for that key gets the id it returned
+    the objects themselves live in the tables of the caller, so the cache needs no device and runs headless
+*/
+class PipelineStateCache
+{
+public:
+    PipelineStateCache();
+    ~PipelineStateCache() = default;
+    PipelineStateCache(const PipelineStateCache&) = delete;
+    PipelineStateCache(PipelineStateCache&&) noexcept = delete;
+    PipelineStateCache& operator=(const PipelineStateCache&) = delete;
+    PipelineStateCache& operator=(PipelineStateCache&&) noexcept = delete;
+public:
+    // create() -> PipelineObjectId; when it throws, nothing is recorded and the next request for key retries
+    template <typename CreateFunction>
+    PipelineObjectId Acquire(PipelineObjectKind kind, PipelineStateKey key, CreateFunction&& create)
+    {
+        Table& table{ m_tables.at(static_cast<std::size_t>(kind)) };
+        auto it{ table.ids.find(key) };
+        if (it != table.ids.end())
+        {
+            table.stats.hits++;
+            return it->second;
+        }
+
+        PipelineObjectId id{ create() };
+        table.ids.emplace(key, id);
+        table.stats.objects = static_cast<std::uint32_t>(table.ids.size());
+        table.stats.misses++;
+        return id;
+    }
+    PipelineCacheStats Stats(PipelineObjectKind kind) const;
+private:
+    struct Table
+    {
+        std::unordered_map<PipelineStateKey, PipelineObjectId> ids;
+        PipelineCacheStats stats;
+    };
+private:
+    std::array<Table, static_cast<std::size_t>(PipelineObjectKind::Count)> m_tables;
+};
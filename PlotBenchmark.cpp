@@ -0,0 +1,125 @@
+#include <PlotBenchmark.h>
+
+#include <Assertions.h>
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <random>
+
+// ---------- Plot Benchmark ----------
+
+static constexpr ImVec2 PLOT_SIZE{ 1024.0f, 64.0f };
+
+const char* PlotSeriesPathName(PlotSeriesPath path)
+{
+    switch (path)
+    {
+    case PlotSeriesPath::Getter: return "Getter";
+    case PlotSeriesPath::Array: return "Array";
+    case PlotSeriesPath::RingSeries: return "Ring series";
+    default: Unreachable();
+    }
+}
+
+static void PushSamples(ImGuiPlotRingSeries* series, std::uint32_t sample_count, std::mt19937& rng)
+{
+    std::normal_distribution<float> noise{ 0.0f, 1.0f };
+    std::uniform_int_distribution<std::uint32_t> event{ 0, 9'999 };
+
+    // a third more than the capacity, so the oldest values are overwritten and the series wraps around
+    std::uint32_t push_count{ sample_count + sample_count / 3 };
+    for (std::uint32_t i{}; i < push_count; i++)
+    {
+        std::uint32_t e{ event(rng) };
+        float v{ e == 0 ? std::numeric_limits<float>::quiet_NaN() : noise(rng) + (e < 4 ? 40.0f : 0.0f) };
+        series->Push(v);
+    }
+}
+
+static float GetSample(void* data, int idx)
+{
+    return static_cast<const float*>(data)[idx];
+}
+
+static double Plot(PlotSeriesPath path, const ImGuiPlotRingSeries& series, ImVec2 cursor)
+{
+    ImGui::SetCursorScreenPos(cursor);
+    auto begin{ std::chrono::steady_clock::now() };
+    switch (path)
+    {
+    case PlotSeriesPath::Getter: { ImGui::PlotLines("##Plot", &GetSample, series.Values.Data, series.Count, series.Head, nullptr, FLT_MAX, FLT_MAX, PLOT_SIZE); } break;
+    case PlotSeriesPath::Array: { ImGui::PlotLines("##Plot", series.Values.Data, series.Count, series.Head, nullptr, FLT_MAX, FLT_MAX, PLOT_SIZE); } break;
+    case PlotSeriesPath::RingSeries: { ImGui::PlotRingSeries(ImGuiPlotType_Lines, "##Plot", &series, nullptr, FLT_MAX, FLT_MAX, PLOT_SIZE); } break;
+    default: { Unreachable(); } break;
+    }
+    auto end{ std::chrono::steady_clock::now() };
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+static std::uint32_t CountMismatches(std::span<const ImDrawVert> a, std::span<const ImDrawVert> b)
+{
+    if (a.size() != b.size())
+    {
+        return std::numeric_limits<std::uint32_t>::max();
+    }
+
+    std::uint32_t mismatches{};
+    for (std::size_t i{}; i < a.size(); i++)
+    {
+        mismatches += std::memcmp(&a[i], &b[i], sizeof(ImDrawVert)) != 0 ? 1 : 0;
+    }
+    return mismatches;
+}
+
+std::vector<PlotBenchmarkResult> RunPlotBenchmark(std::span<const std::uint32_t> sample_counts, std::uint32_t repetitions, std::uint32_t seed)
+{
+    Check(repetitions > 0);
+
+    std::mt19937 rng{ seed };
+    ImDrawList* draw_list{ ImGui::GetWindowDrawList() };
+    ImVec2 cursor{ ImGui::GetCursorScreenPos() };
+
+    std::vector<PlotBenchmarkResult> results{};
+    for (std::uint32_t sample_count : sample_counts)
+    {
+        ImGuiPlotRingSeries series{};
+        series.Init(static_cast<int>(sample_count));
+        PushSamples(&series, sample_count, rng);
+
+        std::vector<ImDrawVert> getter_vertices{};
+        for (std::uint32_t path_index{}; path_index < static_cast<std::uint32_t>(PlotSeriesPath::Count); path_index++)
+        {
+            auto path{ static_cast<PlotSeriesPath>(path_index) };
+            ImGui::PushID(static_cast<int>(path_index));
+
+            PlotBenchmarkResult result{};
+            result.path = path;
+            result.sample_count = sample_count;
+            result.plot_ms = std::numeric_limits<double>::max();
+            std::span<const ImDrawVert> vertices{};
+            for (std::uint32_t repetition{}; repetition < repetitions; repetition++)
+            {
+                ImGui::PushID(static_cast<int>(repetition));
+                int vertex_begin{ draw_list->VtxBuffer.Size };
+                result.plot_ms = std::min(result.plot_ms, Plot(path, series, cursor));
+                vertices = std::span<const ImDrawVert>{ draw_list->VtxBuffer.Data + vertex_begin, draw_list->VtxBuffer.Data + draw_list->VtxBuffer.Size };
+                ImGui::PopID();
+            }
+            if (path == PlotSeriesPath::Getter)
+            {
+                getter_vertices.assign(vertices.begin(), vertices.end());
+            }
+            result.mismatches = CountMismatches(getter_vertices, vertices);
+            results.emplace_back(result);
+
+            ImGui::PopID();
+        }
+    }
+    return results;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// ---------- Plot Benchmark ----------
+
+enum class PlotSeriesPath : std::uint32_t
+{
+    Getter = 0, // PlotLines with a value getter callback, read once per value
+    Array = 1, // PlotLines with a float array, scanned with ImMinMaxFloats
+    RingSeries = 2, // ImGuiPlotRingSeries, mostly read from its block summaries
+    Count,
+};
+
+const char* PlotSeriesPathName(PlotSeriesPath path);
+
+struct PlotBenchmarkResult
+{
+    PlotSeriesPath path;
+    std::uint32_t sample_count;
+    double plot_ms; // fastest repetition
+    std::uint32_t mismatches; // vertices that differ from the getter path, expected to be 0
+};
+
+/*
+    plots sample_count noisy samples with sparse spikes and NaN gaps through each path and compares the vertices they emit
+    the ring series is pushed past its capacity so every path plots data that wraps around
+    plots are 1024 pixels wide and drawn into the current window, which requires an ImGui frame in progress
+*/
+std::vector<PlotBenchmarkResult> RunPlotBenchmark(std::span<const std::uint32_t> sample_counts, std::uint32_t repetitions, std::uint32_t seed);
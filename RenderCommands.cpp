@@ -0,0 +1,206 @@
+#include <RenderCommands.h>
+
+#include <Assertions.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+
+// ---------- Sort Keys ----------
+
+std::uint64_t RenderSortKey::Make(std::uint16_t pipeline, std::uint32_t material, float depth01) noexcept
+{
+    constexpr std::uint32_t MAX_DEPTH{ (1u << DEPTH_BITS) - 1 };
+    constexpr std::uint32_t MAX_MATERIAL{ (1u << MATERIAL_BITS) - 1 };
+
+    float depth{ std::clamp(depth01, 0.0f, 1.0f) };
+    auto quantized_depth{ static_cast<std::uint64_t>(depth * static_cast<float>(MAX_DEPTH)) };
+
+    std::uint64_t key{};
+    key |= static_cast<std::uint64_t>(pipeline) << (MATERIAL_BITS + DEPTH_BITS);
+    key |= static_cast<std::uint64_t>(std::min(material, MAX_MATERIAL)) << DEPTH_BITS;
+    key |= quantized_depth;
+    return key;
+}
+
+// ---------- Render Command List ----------
+
+RenderCommandList::RenderCommandList()
+    : m_arena{}
+    , m_entries{}
+    , m_scratch{}
+    , m_pipeline{}
+    , m_mesh{}
+    , m_material{}
+    , m_sorted{ true }
+{
+}
+void RenderCommandList::Reset() noexcept
+{
+    m_arena.clear();
+    m_entries.clear();
+    m_pipeline = {};
+    m_mesh = {};
+    m_material = {};
+    m_sorted = true;
+}
+void RenderCommandList::DrawIndexed(float depth01, const void* constants, std::uint32_t constants_size, std::uint32_t index_count, std::uint32_t start_index, std::int32_t base_vertex)
+{
+    std::uint32_t packet_offset{ Allocate(sizeof(RenderDrawPacket)) };
+    std::uint32_t constants_offset{ constants_size > 0 ? Allocate(constants_size) : 0 };
+
+    RenderDrawPacket packet{};
+    packet.pipeline = m_pipeline;
+    packet.mesh = m_mesh;
+    packet.material = m_material;
+    packet.constants_offset = constants_offset;
+    packet.constants_size = constants_size;
+    packet.index_count = index_count;
+    packet.start_index = start_index;
+    packet.base_vertex = base_vertex;
+
+    std::memcpy(m_arena.data() + packet_offset, &packet, sizeof(packet));
+    if (constants_size > 0)
+    {
+        std::memcpy(m_arena.data() + constants_offset, constants, constants_size);
+    }
+
+    m_entries.push_back({ RenderSortKey::Make(m_pipeline, m_material, depth01), packet_offset });
+    m_sorted = false;
+}
+void RenderCommandList::Sort()
+{
+    if (m_sorted || m_entries.empty())
+    {
+        m_sorted = true;
+        return;
+    }
+
+    /*
+        LSD radix sort over the 8 bytes of the key
+        a pass is skipped when every key shares the same digit, which is the common case for the high pipeline/material bytes
+    */
+    m_scratch.resize(m_entries.size());
+    RenderSortEntry* src{ m_entries.data() };
+    RenderSortEntry* dst{ m_scratch.data() };
+    std::size_t count{ m_entries.size() };
+
+    for (std::uint32_t shift{}; shift < 64; shift += 8)
+    {
+        std::array<std::size_t, 256> histogram{};
+        for (std::size_t i{}; i < count; i++)
+        {
+            histogram[(src[i].key >> shift) & 0xFF]++;
+        }
+
+        // all keys share the same digit: this pass would not reorder anything
+        if (histogram[(src[0].key >> shift) & 0xFF] == count)
+        {
+            continue;
+        }
+
+        std::size_t offset{};
+        for (std::size_t& bucket : histogram)
+        {
+            std::size_t bucket_count{ bucket };
+            bucket = offset;
+            offset += bucket_count;
+        }
+
+        for (std::size_t i{}; i < count; i++)
+        {
+            dst[histogram[(src[i].key >> shift) & 0xFF]++] = src[i];
+        }
+
+        std::swap(src, dst);
+    }
+
+    // the sorted result may have ended up in the scratch buffer
+    if (src != m_entries.data())
+    {
+        m_entries.swap(m_scratch);
+    }
+
+    m_sorted = true;
+}
+void RenderCommandList::Append(const RenderCommandList& other)
+{
+    if (other.m_entries.empty())
+    {
+        return;
+    }
+
+    std::uint32_t base{ Allocate(other.m_arena.size()) };
+    std::memcpy(m_arena.data() + base, other.m_arena.data(), other.m_arena.size());
+
+    // rebase packet and constant offsets into this arena
+    m_entries.reserve(m_entries.size() + other.m_entries.size());
+    for (const RenderSortEntry& entry : other.m_entries)
+    {
+        std::byte* packet_ptr{ m_arena.data() + base + entry.packet_offset };
+        RenderDrawPacket packet{};
+        std::memcpy(&packet, packet_ptr, sizeof(packet));
+        packet.constants_offset += base;
+        std::memcpy(packet_ptr, &packet, sizeof(packet));
+
+        m_entries.push_back({ entry.key, base + entry.packet_offset });
+    }
+
+    m_sorted = false;
+}
+RenderReplayStats RenderCommandList::Replay(RenderBackend& backend) const
+{
+    constexpr std::uint32_t NONE{ std::numeric_limits<std::uint32_t>::max() };
+
+    RenderReplayStats stats{};
+    std::uint32_t bound_pipeline{ NONE };
+    std::uint32_t bound_mesh{ NONE };
+
+    for (const RenderSortEntry& entry : m_entries)
+    {
+        RenderDrawPacket packet{};
+        std::memcpy(&packet, m_arena.data() + entry.packet_offset, sizeof(packet));
+
+        if (packet.pipeline != bound_pipeline)
+        {
+            backend.SetPipeline(packet.pipeline);
+            bound_pipeline = packet.pipeline;
+            stats.pipeline_binds++;
+        }
+        else
+        {
+            stats.redundant_binds_skipped++;
+        }
+
+        if (packet.mesh != bound_mesh)
+        {
+            backend.SetMesh(packet.mesh);
+            bound_mesh = packet.mesh;
+            stats.mesh_binds++;
+        }
+        else
+        {
+            stats.redundant_binds_skipped++;
+        }
+
+        if (packet.constants_size > 0)
+        {
+            backend.SetObjectConstants(m_arena.data() + packet.constants_offset, packet.constants_size);
+        }
+
+        backend.DrawIndexed(packet.index_count, packet.start_index, packet.base_vertex);
+        stats.draws++;
+    }
+
+    return stats;
+}
+std::uint32_t RenderCommandList::Allocate(std::size_t size)
+{
+    constexpr std::size_t ALIGNMENT{ 16 };
+
+    std::size_t offset{ (m_arena.size() + ALIGNMENT - 1) & ~(ALIGNMENT - 1) };
+    Check(offset + size <= std::numeric_limits<std::uint32_t>::max());
+    m_arena.resize(offset + size);
+    return static_cast<std::uint32_t>(offset);
+}
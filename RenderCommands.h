@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ---------- Sort Keys ----------
+
+/*
+    64-bit draw sort key, most significant bits first:
+    [63..48] pipeline  (16 bits)
+    [47..24] material  (24 bits)
+    [23.. 0] depth     (24 bits, front to back)
+    sorting by key groups draws by pipeline, then by material, then front to back within each group
+*/
+struct RenderSortKey
+{
+    static constexpr std::uint32_t PIPELINE_BITS{ 16 };
+    static constexpr std::uint32_t MATERIAL_BITS{ 24 };
+    static constexpr std::uint32_t DEPTH_BITS{ 24 };
+
+    static std::uint64_t Make(std::uint16_t pipeline, std::uint32_t material, float depth01) noexcept;
+    static std::uint16_t Pipeline(std::uint64_t key) noexcept { return static_cast<std::uint16_t>(key >> (MATERIAL_BITS + DEPTH_BITS)); }
+    static std::uint32_t Material(std::uint64_t key) noexcept { return static_cast<std::uint32_t>(key >> DEPTH_BITS) & ((1u << MATERIAL_BITS) - 1); }
+    static std::uint32_t Depth(std::uint64_t key) noexcept { return static_cast<std::uint32_t>(key) & ((1u << DEPTH_BITS) - 1); }
+};
+
+// ---------- Render Commands ----------
+
+using RenderPipelineHandle = std::uint16_t;
+using RenderMeshHandle = std::uint16_t;
+
+// a single self-contained draw; all the state it needs is captured at record time so draws can be freely reordered
+struct RenderDrawPacket
+{
+    RenderPipelineHandle pipeline;
+    RenderMeshHandle mesh;
+    std::uint32_t material;
+    std::uint32_t constants_offset; // byte offset of the object constants inside the arena
+    std::uint32_t constants_size; // byte size of the object constants
+    std::uint32_t index_count;
+    std::uint32_t start_index;
+    std::int32_t base_vertex;
+};
+
+struct RenderSortEntry
+{
+    std::uint64_t key;
+    std::uint32_t packet_offset; // byte offset of the draw packet inside the arena
+};
+
+// interface implemented by the graphics API that executes a command list (e.g. D3D11)
+class RenderBackend
+{
+public:
+    virtual ~RenderBackend() = default;
+public:
+    virtual void SetPipeline(RenderPipelineHandle pipeline) = 0;
+    virtual void SetMesh(RenderMeshHandle mesh) = 0;
+    virtual void SetObjectConstants(const void* data, std::uint32_t size) = 0;
+    virtual void DrawIndexed(std::uint32_t index_count, std::uint32_t start_index, std::int32_t base_vertex) = 0;
+};
+
+struct RenderReplayStats
+{
+    std::uint32_t draws;
+    std::uint32_t pipeline_binds;
+    std::uint32_t mesh_binds;
+    std::uint32_t redundant_binds_skipped;
+};
+
+class RenderCommandList
+{
+public:
+    RenderCommandList();
+    ~RenderCommandList() = default;
+    RenderCommandList(const RenderCommandList&) = delete;
+    RenderCommandList(RenderCommandList&&) noexcept = default;
+    RenderCommandList& operator=(const RenderCommandList&) = delete;
+    RenderCommandList& operator=(RenderCommandList&&) noexcept = default;
+public:
+    // drop every recorded command while keeping the arena memory around for the next recording
+    void Reset() noexcept;
+
+    // recording state; captured by every following Draw call
+    void SetPipeline(RenderPipelineHandle pipeline) noexcept { m_pipeline = pipeline; }
+    void SetMaterial(std::uint32_t material) noexcept { m_material = material; }
+    void SetMesh(RenderMeshHandle mesh) noexcept { m_mesh = mesh; }
+
+    // record a draw; depth01 is the normalized view depth used for sorting, constants are copied into the arena
+    void DrawIndexed(float depth01, const void* constants, std::uint32_t constants_size, std::uint32_t index_count, std::uint32_t start_index = 0, std::int32_t base_vertex = 0);
+
+    // sort recorded draws by key (stable)
+    void Sort();
+
+    // append the commands of another list, keeping their relative order
+    void Append(const RenderCommandList& other);
+
+    // execute the sorted draws on a backend, skipping state changes that match the currently bound state
+    RenderReplayStats Replay(RenderBackend& backend) const;
+public:
+    std::size_t DrawCount() const noexcept { return m_entries.size(); }
+    std::size_t ArenaSize() const noexcept { return m_arena.size(); }
+    bool IsSorted() const noexcept { return m_sorted; }
+private:
+    std::uint32_t Allocate(std::size_t size);
+private:
+    std::vector<std::byte> m_arena; // contiguous storage for draw packets and their constants
+    std::vector<RenderSortEntry> m_entries;
+    std::vector<RenderSortEntry> m_scratch; // radix sort ping-pong buffer
+    RenderPipelineHandle m_pipeline;
+    RenderMeshHandle m_mesh;
+    std::uint32_t m_material;
+    bool m_sorted;
+};
@@ -0,0 +1,499 @@
+#include <SettingsStore.h>
+
+#include <Assertions.h>
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+
+// ---------- Settings Store ----------
+
+// below this size, replaced records are not worth a rewrite
+static constexpr std::uint64_t COMPACTION_MIN_BYTES{ 64 * 1024 };
+
+static std::span<const std::uint8_t> EncodedBytes(const ImVector<char>& encoded)
+{
+    return { reinterpret_cast<const std::uint8_t*>(encoded.Data), static_cast<std::size_t>(encoded.Size) };
+}
+
+SettingsStore::SettingsStore(std::filesystem::path path)
+    : m_path{ std::move(path) }
+    , m_header{}
+    , m_dirty_windows{}
+    , m_dirty_tables{}
+    , m_encoded{}
+    , m_records{}
+    , m_file_bytes{}
+    , m_live_bytes{}
+    , m_file_checked{}
+    , m_mutex{}
+    , m_wake_cv{}
+    , m_idle_cv{}
+    , m_loaded{}
+    , m_batches{}
+    , m_writing{}
+    , m_stats{}
+    , m_quit{}
+    , m_thread{}
+{
+    ImGui::SaveSettingsRecordsHeader(&m_encoded);
+    std::span<const std::uint8_t> header{ EncodedBytes(m_encoded) };
+    m_header.assign(header.begin(), header.end());
+
+    m_thread = std::thread{ [this]() { ThreadMain(); } };
+}
+SettingsStore::~SettingsStore()
+{
+    {
+        std::lock_guard lock{ m_mutex };
+        m_quit = true;
+    }
+    m_wake_cv.notify_all();
+    m_thread.join();
+}
+bool SettingsStore::Load(std::span<const std::uint8_t> data)
+{
+    auto begin{ std::chrono::steady_clock::now() };
+    std::size_t valid_size{ ImGui::LoadSettingsRecords(data.data(), data.size()) };
+    {
+        // the writer thread indexes the records; data may be a mapping released after this call
+        std::lock_guard lock{ m_mutex };
+        m_loaded.assign(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(valid_size));
+        m_stats.file_bytes = valid_size;
+        m_stats.load_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    }
+    m_wake_cv.notify_one();
+    return valid_size > 0;
+}
+void SettingsStore::Save(bool all)
+{
+    auto begin{ std::chrono::steady_clock::now() };
+    ImGuiContext& g{ *ImGui::GetCurrentContext() };
+    if (all)
+    {
+        // windows of this session update their entries first
+        for (ImGuiWindow* window : g.Windows)
+        {
+            ImGui::MarkIniSettingsDirty(window);
+        }
+    }
+    ImGui::GatherDirtySettings(&m_dirty_windows, &m_dirty_tables);
+
+    m_encoded.resize(0);
+    std::uint32_t record_count{};
+    if (all)
+    {
+        for (ImGuiWindowSettings* settings{ g.SettingsWindows.begin() }; settings != nullptr; settings = g.SettingsWindows.next_chunk(settings))
+        {
+            if (!settings->WantDelete)
+            {
+                ImGui::SaveWindowSettingsRecord(settings, &m_encoded);
+                record_count++;
+            }
+        }
+        for (ImGuiTableSettings* settings{ g.SettingsTables.begin() }; settings != nullptr; settings = g.SettingsTables.next_chunk(settings))
+        {
+            if (settings->ID != 0)
+            {
+                ImGui::SaveTableSettingsRecord(settings, &m_encoded);
+                record_count++;
+            }
+        }
+    }
+    else
+    {
+        for (ImGuiWindowSettings* settings : m_dirty_windows)
+        {
+            ImGui::SaveWindowSettingsRecord(settings, &m_encoded);
+            record_count++;
+        }
+        for (ImGuiTableSettings* settings : m_dirty_tables)
+        {
+            ImGui::SaveTableSettingsRecord(settings, &m_encoded);
+            record_count++;
+        }
+        if (record_count == 0)
+        {
+            return;
+        }
+    }
+
+    std::span<const std::uint8_t> records{ EncodedBytes(m_encoded) };
+    Batch batch{ { records.begin(), records.end() }, record_count, all };
+    auto end{ std::chrono::steady_clock::now() };
+    {
+        std::lock_guard lock{ m_mutex };
+        m_batches.emplace_back(std::move(batch));
+        m_stats.saves++;
+        m_stats.pending += record_count;
+        m_stats.last_save_ms = std::chrono::duration<double, std::milli>(end - begin).count();
+    }
+    m_wake_cv.notify_one();
+}
+void SettingsStore::Flush()
+{
+    std::unique_lock lock{ m_mutex };
+    m_idle_cv.wait(lock, [&]() { return m_loaded.empty() && m_batches.empty() && !m_writing; });
+}
+SettingsStoreStats SettingsStore::Stats()
+{
+    std::lock_guard lock{ m_mutex };
+    return m_stats;
+}
+void SettingsStore::ThreadMain()
+{
+    std::vector<std::uint8_t> loaded{};
+    std::vector<Batch> batches{};
+    std::unique_lock lock{ m_mutex };
+    while (true)
+    {
+        // the batches handed over before quitting are still written
+        m_wake_cv.wait(lock, [&]() { return m_quit || !m_loaded.empty() || !m_batches.empty(); });
+        if (m_loaded.empty() && m_batches.empty())
+        {
+            break;
+        }
+        loaded.swap(m_loaded);
+        batches.swap(m_batches);
+        m_writing = true;
+        lock.unlock();
+
+        if (!loaded.empty())
+        {
+            // the header was checked by ImGui::LoadSettingsRecords, which also found where the valid records end
+            m_file_bytes = loaded.size();
+            AddRecords(std::span{ loaded }.subspan(m_header.size()));
+            loaded.clear();
+        }
+        std::uint32_t records_written{};
+        std::uint32_t compactions{};
+        for (const Batch& batch : batches)
+        {
+            compactions += WriteBatch(batch) ? 1 : 0;
+            records_written += batch.record_count;
+        }
+        batches.clear();
+
+        lock.lock();
+        m_writing = false;
+        m_stats.entries = static_cast<std::uint32_t>(m_records.size());
+        m_stats.file_bytes = m_file_bytes;
+        m_stats.live_bytes = m_live_bytes;
+        m_stats.records_written += records_written;
+        m_stats.compactions += compactions;
+        m_stats.pending -= records_written;
+        m_idle_cv.notify_all();
+    }
+}
+bool SettingsStore::WriteBatch(const Batch& batch)
+{
+    if (batch.replace_all)
+    {
+        m_records.clear();
+        m_live_bytes = 0;
+    }
+    AddRecords(batch.records);
+
+    bool rewrite{ batch.replace_all || m_file_bytes == 0 };
+    if (!rewrite && !m_file_checked)
+    {
+        // cut the records after a torn write, so that the new records follow the valid ones
+        std::error_code ec{};
+        if (std::filesystem::file_size(m_path, ec) != m_file_bytes)
+        {
+            std::filesystem::resize_file(m_path, m_file_bytes, ec);
+        }
+        rewrite = static_cast<bool>(ec);
+    }
+    if (!rewrite)
+    {
+        std::ofstream file{ m_path, std::ios::binary | std::ios::app };
+        file.write(reinterpret_cast<const char*>(batch.records.data()), static_cast<std::streamsize>(batch.records.size()));
+        file.flush();
+        m_file_bytes += batch.records.size();
+        rewrite = !file;
+    }
+    m_file_checked = true;
+
+    // the file stays at most about twice the size of the live records
+    if (rewrite || (m_file_bytes > COMPACTION_MIN_BYTES && m_file_bytes > 2 * m_live_bytes))
+    {
+        return Rewrite();
+    }
+    return false;
+}
+void SettingsStore::AddRecords(std::span<const std::uint8_t> records)
+{
+    // records were checked when loaded, or just encoded
+    for (std::size_t offset{}; offset < records.size(); )
+    {
+        Check(records.size() - offset >= sizeof(ImGuiSettingsRecordHeader));
+        ImGuiSettingsRecordHeader header{};
+        std::memcpy(&header, records.data() + offset, sizeof(header));
+        std::size_t size{ sizeof(header) + header.PayloadSize };
+        Check(records.size() - offset >= size);
+
+        std::vector<std::uint8_t>& record{ m_records[static_cast<std::uint64_t>(header.Type) << 32 | header.ID] };
+        m_live_bytes -= record.size();
+        record.assign(records.begin() + static_cast<std::ptrdiff_t>(offset), records.begin() + static_cast<std::ptrdiff_t>(offset + size));
+        m_live_bytes += size;
+        offset += size;
+    }
+}
+bool SettingsStore::Rewrite()
+{
+    // write then rename, so that a rewrite interrupted by a crash leaves the previous file
+    std::filesystem::path temp_path{ m_path };
+    temp_path += ".tmp";
+    {
+        std::ofstream file{ temp_path, std::ios::binary | std::ios::trunc };
+        file.write(reinterpret_cast<const char*>(m_header.data()), static_cast<std::streamsize>(m_header.size()));
+        for (const auto& [key, record] : m_records)
+        {
+            file.write(reinterpret_cast<const char*>(record.data()), static_cast<std::streamsize>(record.size()));
+        }
+        file.flush();
+        if (!file)
+        {
+            m_file_checked = false;
+            return false;
+        }
+    }
+    std::error_code ec{};
+    std::filesystem::rename(temp_path, m_path, ec);
+    if (ec)
+    {
+        m_file_checked = false;
+        return false;
+    }
+    m_file_bytes = m_header.size() + m_live_bytes;
+    return true;
+}
+
+// ---------- Settings Store Benchmark ----------
+
+static ImGuiContext* CreateBenchmarkContext()
+{
+    // the context builds its own fonts on its first frame, with no renderer backend
+    ImGuiContext* context{ ImGui::CreateContext() };
+    ImGui::SetCurrentContext(context);
+    ImGuiIO& io{ ImGui::GetIO() };
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2{ 1280.0f, 720.0f };
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+    return context;
+}
+
+// settings imgui.ini restores exactly: integer widths, weights with 4 decimals, no column user ids, every column saved
+static void GenerateSettings(std::uint32_t entry_count, std::mt19937& rng)
+{
+    std::uniform_int_distribution<int> position{ -200, 2000 };
+    std::uniform_int_distribution<int> size{ 50, 1000 };
+    std::uniform_int_distribution<std::uint32_t> one_in_eight{ 0, 7 };
+    std::uniform_int_distribution<int> column_count{ 1, 12 };
+    std::uniform_int_distribution<int> width{ 20, 400 };
+    std::uniform_int_distribution<int> weight{ 1, 32 };
+
+    char name[32];
+    for (std::uint32_t i{}; i < entry_count - entry_count / 2; i++)
+    {
+        std::snprintf(name, sizeof(name), "Window %u", i);
+        ImGuiWindowSettings* settings{ ImGui::CreateNewWindowSettings(name) };
+        settings->Pos = ImVec2ih{ static_cast<short>(position(rng)), static_cast<short>(position(rng)) };
+        settings->Size = ImVec2ih{ static_cast<short>(size(rng)), static_cast<short>(size(rng)) };
+        settings->Collapsed = one_in_eight(rng) == 0;
+    }
+    for (std::uint32_t i{}; i < entry_count / 2; i++)
+    {
+        std::snprintf(name, sizeof(name), "Table %u", i);
+        int columns{ column_count(rng) };
+        ImGuiTableSettings* settings{ ImGui::TableSettingsCreate(ImHashStr(name), columns) };
+        settings->SaveFlags = ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Sortable | ImGuiTableFlags_Hideable;
+        settings->RefScale = 1.0f;
+
+        std::vector<int> display_order(static_cast<std::size_t>(columns));
+        std::iota(display_order.begin(), display_order.end(), 0);
+        std::shuffle(display_order.begin(), display_order.end(), rng);
+        int sort_column{ static_cast<int>(rng() % static_cast<std::uint32_t>(columns)) };
+        ImGuiTableColumnSettings* column{ settings->GetColumnSettings() };
+        for (int n{}; n < columns; n++, column++)
+        {
+            column->Index = static_cast<ImGuiTableColumnIdx>(n);
+            column->DisplayOrder = static_cast<ImGuiTableColumnIdx>(display_order[static_cast<std::size_t>(n)]);
+            column->IsStretch = static_cast<ImU8>(one_in_eight(rng) < 2 ? 1 : 0);
+            column->WidthOrWeight = column->IsStretch ? static_cast<float>(weight(rng)) / 8.0f : static_cast<float>(width(rng));
+            column->IsEnabled = static_cast<ImS8>(one_in_eight(rng) == 0 ? 0 : 1);
+            column->SortOrder = static_cast<ImGuiTableColumnIdx>(n == sort_column ? 0 : -1);
+            column->SortDirection = n != sort_column ? ImGuiSortDirection_None : one_in_eight(rng) < 4 ? ImGuiSortDirection_Ascending : ImGuiSortDirection_Descending;
+        }
+    }
+}
+
+static bool SameColumnSettings(ImGuiTableColumnSettings* a, ImGuiTableColumnSettings* b)
+{
+    return a->WidthOrWeight == b->WidthOrWeight && a->UserID == b->UserID && a->Index == b->Index && a->DisplayOrder == b->DisplayOrder
+        && a->SortOrder == b->SortOrder && a->SortDirection == b->SortDirection && a->IsEnabled == b->IsEnabled && a->IsStretch == b->IsStretch;
+}
+
+static std::uint32_t CountMismatches(ImGuiContext* expected_context, ImGuiContext* context)
+{
+    ImGuiContext& e{ *expected_context };
+    ImGuiContext& g{ *context };
+
+    // lookups by id through ImGui are linear; index one side instead
+    std::unordered_map<ImGuiID, ImGuiWindowSettings*> windows{};
+    std::unordered_map<ImGuiID, ImGuiTableSettings*> tables{};
+    for (ImGuiWindowSettings* settings{ g.SettingsWindows.begin() }; settings != nullptr; settings = g.SettingsWindows.next_chunk(settings))
+    {
+        windows[settings->ID] = settings;
+    }
+    for (ImGuiTableSettings* settings{ g.SettingsTables.begin() }; settings != nullptr; settings = g.SettingsTables.next_chunk(settings))
+    {
+        tables[settings->ID] = settings;
+    }
+
+    std::uint32_t mismatches{};
+    std::size_t expected_windows{};
+    for (ImGuiWindowSettings* a{ e.SettingsWindows.begin() }; a != nullptr; a = e.SettingsWindows.next_chunk(a), expected_windows++)
+    {
+        auto it{ windows.find(a->ID) };
+        ImGuiWindowSettings* b{ it != windows.end() ? it->second : nullptr };
+        bool same{ b && std::strcmp(a->GetName(), b->GetName()) == 0 && a->Pos.x == b->Pos.x && a->Pos.y == b->Pos.y
+            && a->Size.x == b->Size.x && a->Size.y == b->Size.y && a->Collapsed == b->Collapsed && a->IsChild == b->IsChild };
+        mismatches += same ? 0 : 1;
+    }
+    std::size_t expected_tables{};
+    for (ImGuiTableSettings* a{ e.SettingsTables.begin() }; a != nullptr; a = e.SettingsTables.next_chunk(a), expected_tables++)
+    {
+        auto it{ tables.find(a->ID) };
+        ImGuiTableSettings* b{ it != tables.end() ? it->second : nullptr };
+        bool same{ b && a->ColumnsCount == b->ColumnsCount && a->SaveFlags == b->SaveFlags && a->RefScale == b->RefScale };
+        for (int n{}; same && n < a->ColumnsCount; n++)
+        {
+            same = SameColumnSettings(a->GetColumnSettings() + n, b->GetColumnSettings() + n);
+        }
+        mismatches += same ? 0 : 1;
+    }
+    mismatches += windows.size() != expected_windows || tables.size() != expected_tables ? 1 : 0;
+    return mismatches;
+}
+
+std::vector<SettingsStoreBenchmarkResult> RunSettingsStoreBenchmark(std::span<const std::uint32_t> entry_counts, std::uint32_t repetitions, std::uint32_t seed)
+{
+    Check(repetitions > 0);
+
+    ImGuiContext* previous_context{ ImGui::GetCurrentContext() };
+    std::mt19937 rng{ seed };
+    std::vector<SettingsStoreBenchmarkResult> results{};
+    for (std::uint32_t entry_count : entry_counts)
+    {
+        // the same settings as imgui.ini text and as records
+        ImGuiContext* source_context{ CreateBenchmarkContext() };
+        GenerateSettings(entry_count, rng);
+        std::size_t ini_size{};
+        const char* ini_data{ ImGui::SaveIniSettingsToMemory(&ini_size) };
+        std::string ini{ ini_data, ini_size };
+        ImVector<char> records{};
+        ImGui::SaveSettingsRecordsHeader(&records);
+        for (ImGuiWindowSettings* settings{ source_context->SettingsWindows.begin() }; settings != nullptr; settings = source_context->SettingsWindows.next_chunk(settings))
+        {
+            ImGui::SaveWindowSettingsRecord(settings, &records);
+        }
+        for (ImGuiTableSettings* settings{ source_context->SettingsTables.begin() }; settings != nullptr; settings = source_context->SettingsTables.next_chunk(settings))
+        {
+            ImGui::SaveTableSettingsRecord(settings, &records);
+        }
+
+        SettingsStoreBenchmarkResult result{};
+        result.entry_count = entry_count;
+        result.ini_bytes = ini.size();
+        result.records_bytes = static_cast<std::size_t>(records.Size);
+        result.ini_load_ms = std::numeric_limits<double>::max();
+        result.records_load_ms = std::numeric_limits<double>::max();
+        result.ini_save_ms = std::numeric_limits<double>::max();
+        result.records_save_ms = std::numeric_limits<double>::max();
+
+        ImGuiContext* ini_context{};
+        ImGuiContext* records_context{};
+        for (std::uint32_t repetition{}; repetition < repetitions; repetition++)
+        {
+            if (ini_context)
+            {
+                ImGui::DestroyContext(ini_context);
+                ImGui::DestroyContext(records_context);
+            }
+
+            ini_context = CreateBenchmarkContext();
+            auto ini_begin{ std::chrono::steady_clock::now() };
+            ImGui::LoadIniSettingsFromMemory(ini.data(), ini.size());
+            auto ini_end{ std::chrono::steady_clock::now() };
+            result.ini_load_ms = std::min(result.ini_load_ms, std::chrono::duration<double, std::milli>(ini_end - ini_begin).count());
+
+            records_context = CreateBenchmarkContext();
+            auto records_begin{ std::chrono::steady_clock::now() };
+            std::size_t valid_size{ ImGui::LoadSettingsRecords(records.Data, static_cast<std::size_t>(records.Size)) };
+            auto records_end{ std::chrono::steady_clock::now() };
+            result.records_load_ms = std::min(result.records_load_ms, std::chrono::duration<double, std::milli>(records_end - records_begin).count());
+            result.mismatches += valid_size != static_cast<std::size_t>(records.Size) ? 1 : 0;
+        }
+        result.mismatches += CountMismatches(source_context, ini_context);
+        result.mismatches += CountMismatches(ini_context, records_context);
+
+        // move one window, then save as the imgui.ini autosave and as SettingsStore::Save would
+        ImGui::SetCurrentContext(records_context);
+        ImVector<ImGuiWindowSettings*> dirty_windows{};
+        ImVector<ImGuiTableSettings*> dirty_tables{};
+        ImVector<char> dirty_records{};
+        ImGui::NewFrame(); // creates the implicit debug window, which saves its settings once
+        ImGui::EndFrame();
+        ImGui::GatherDirtySettings(&dirty_windows, &dirty_tables);
+        for (std::uint32_t repetition{}; repetition < repetitions; repetition++)
+        {
+            ImGui::NewFrame();
+            ImGui::SetNextWindowPos(ImVec2{ 100.0f + static_cast<float>(repetition), 100.0f });
+            ImGui::Begin("Window 0");
+            ImGui::End();
+            ImGui::EndFrame();
+
+            auto ini_begin{ std::chrono::steady_clock::now() };
+            ImGui::SaveIniSettingsToMemory();
+            auto ini_end{ std::chrono::steady_clock::now() };
+            result.ini_save_ms = std::min(result.ini_save_ms, std::chrono::duration<double, std::milli>(ini_end - ini_begin).count());
+
+            auto records_begin{ std::chrono::steady_clock::now() };
+            ImGui::GatherDirtySettings(&dirty_windows, &dirty_tables);
+            dirty_records.resize(0);
+            for (ImGuiWindowSettings* settings : dirty_windows)
+            {
+                ImGui::SaveWindowSettingsRecord(settings, &dirty_records);
+            }
+            for (ImGuiTableSettings* settings : dirty_tables)
+            {
+                ImGui::SaveTableSettingsRecord(settings, &dirty_records);
+            }
+            auto records_end{ std::chrono::steady_clock::now() };
+            result.records_save_ms = std::min(result.records_save_ms, std::chrono::duration<double, std::milli>(records_end - records_begin).count());
+            result.mismatches += dirty_windows.Size == 1 && dirty_tables.Size == 0 ? 0 : 1;
+        }
+
+        ImGui::DestroyContext(records_context);
+        ImGui::DestroyContext(ini_context);
+        ImGui::DestroyContext(source_context);
+        results.emplace_back(result);
+    }
+    ImGui::SetCurrentContext(previous_context);
+    return results;
+}
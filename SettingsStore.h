@@ -0,0 +1,116 @@
+#pragma once
+
+#include <imgui.h>
+#include <imgui_internal.h> // for ImGuiWindowSettings, ImGuiTableSettings
+
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// ---------- Settings Store ----------
+
+struct SettingsStoreStats
+{
+    std::uint32_t entries; // windows and tables with settings in the file
+    std::uint64_t file_bytes;
+    std::uint64_t live_bytes; // latest record of each entry; the rest of the file is replaced records, dropped by compaction
+    std::uint32_t saves; // Save calls that found changes
+    std::uint32_t records_written; // total
+    std::uint32_t compactions; // total; the file rewritten with the latest record of each entry
+    std::uint32_t pending; // records handed to the writer thread and not written yet
+    double load_ms; // restoring the settings from the file contents
+    double last_save_ms; // gathering and encoding the changes on the UI thread, for the latest Save that found changes
+};
+
+/*
+    ImGui window and table settings in a binary file of records, replacing imgui.ini
+    a save encodes only the windows and tables changed since the previous one and appends them to the file on a background thread,
+    so its cost on the UI thread follows the number of changes and not the number of entries; the latest record of an entry wins
+    at load, which keeps one record per entry in a single sort instead of one settings lookup per entry
+    the file is rewritten with only the latest records once replaced records take more than half of it;
+    records after a torn write (e.g. a crash while appending) are dropped, keeping the settings of the previous saves
+    ImGui::ClearWindowSettings() and the like are not recorded: entries are never removed from the file
+*/
+class SettingsStore
+{
+public:
+    explicit SettingsStore(std::filesystem::path path);
+    ~SettingsStore(); // writes the pending records
+    SettingsStore(const SettingsStore&) = delete;
+    SettingsStore(SettingsStore&&) noexcept = delete;
+    SettingsStore& operator=(const SettingsStore&) = delete;
+    SettingsStore& operator=(SettingsStore&&) noexcept = delete;
+public:
+    /*
+        restores the settings from the contents of the file (e.g. mapped); call once, after creating the ImGui context and before the first frame
+        false when data is not a settings file, e.g. empty when the file is missing; the first save then creates the file
+    */
+    bool Load(std::span<const std::uint8_t> data);
+    // hands the settings changed since the previous call to the writer thread; all writes every entry instead and rewrites the file
+    void Save(bool all = false);
+    // waits until the writer thread wrote everything handed to it
+    void Flush();
+    SettingsStoreStats Stats();
+private:
+    struct Batch
+    {
+        std::vector<std::uint8_t> records;
+        std::uint32_t record_count;
+        bool replace_all; // records are every entry
+    };
+    void ThreadMain();
+    // true when the file was rewritten
+    bool WriteBatch(const Batch& batch);
+    void AddRecords(std::span<const std::uint8_t> records);
+    bool Rewrite();
+private:
+    std::filesystem::path m_path;
+    std::vector<std::uint8_t> m_header; // start of the file
+
+    // UI thread only
+    ImVector<ImGuiWindowSettings*> m_dirty_windows;
+    ImVector<ImGuiTableSettings*> m_dirty_tables;
+    ImVector<char> m_encoded;
+
+    // writer thread only
+    std::unordered_map<std::uint64_t, std::vector<std::uint8_t>> m_records; // (type << 32 | id) -> latest record
+    std::uint64_t m_file_bytes;
+    std::uint64_t m_live_bytes;
+    bool m_file_checked; // the torn end of the file was cut, or the file created
+
+    // shared with the writer thread
+    std::mutex m_mutex;
+    std::condition_variable m_wake_cv;
+    std::condition_variable m_idle_cv;
+    std::vector<std::uint8_t> m_loaded; // valid part of the file contents given to Load, indexed by the writer thread before its first write
+    std::vector<Batch> m_batches;
+    bool m_writing;
+    SettingsStoreStats m_stats;
+    bool m_quit;
+    std::thread m_thread; // last, started once the members above are constructed
+};
+
+// ---------- Settings Store Benchmark ----------
+
+struct SettingsStoreBenchmarkResult
+{
+    std::uint32_t entry_count; // windows and tables, half each
+    std::size_t ini_bytes;
+    std::size_t records_bytes;
+    double ini_load_ms; // ImGui::LoadIniSettingsFromMemory
+    double records_load_ms; // ImGui::LoadSettingsRecords
+    double ini_save_ms; // ImGui::SaveIniSettingsToMemory after moving one window, as the imgui.ini autosave does
+    double records_save_ms; // the changed entries gathered and encoded after moving one window, as SettingsStore::Save does
+    std::uint32_t mismatches; // entries restored differently from the records than from imgui.ini, expected to be 0
+};
+
+/*
+    generated window and table settings of each entry count, loaded and saved in temporary ImGui contexts
+    times are the minimum over the repetitions; the current ImGui context is restored
+*/
+std::vector<SettingsStoreBenchmarkResult> RunSettingsStoreBenchmark(std::span<const std::uint32_t> entry_counts, std::uint32_t repetitions, std::uint32_t seed);
@@ -0,0 +1,420 @@
+#include <ShaderHotReload.h>
+
+#include <Assertions.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <system_error>
+#include <utility>
+
+// ---------- Shader Sources ----------
+
+std::uint64_t HashShaderBytes(std::span<const std::uint8_t> bytes, std::uint64_t seed)
+{
+    std::uint64_t hash{ seed };
+    for (std::uint8_t byte : bytes)
+    {
+        hash ^= byte;
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+static std::uint64_t HashShaderText(std::string_view text, std::uint64_t seed)
+{
+    return HashShaderBytes({ reinterpret_cast<const std::uint8_t*>(text.data()), text.size() }, seed);
+}
+
+static std::optional<std::string> ReadTextFile(const std::filesystem::path& path)
+{
+    std::ifstream file{ path, std::ios::binary };
+    if (!file)
+    {
+        return std::nullopt;
+    }
+    return std::string{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+}
+
+// names of the #include "name" directives of text; <name> includes are system headers and are not followed
+static std::vector<std::string> FindQuotedIncludes(const std::string& text)
+{
+    std::vector<std::string> includes{};
+    for (std::size_t line_begin{}; line_begin < text.size(); )
+    {
+        std::size_t line_end{ text.find('\n', line_begin) };
+        line_end = line_end == std::string::npos ? text.size() : line_end;
+
+        std::size_t p{ text.find_first_not_of(" \t", line_begin) };
+        if (p < line_end && text[p] == '#')
+        {
+            p = text.find_first_not_of(" \t", p + 1);
+            if (p < line_end && text.compare(p, 7, "include") == 0)
+            {
+                std::size_t name_begin{ text.find('"', p + 7) };
+                std::size_t name_end{ name_begin < line_end ? text.find('"', name_begin + 1) : std::string::npos };
+                if (name_end < line_end)
+                {
+                    includes.emplace_back(text.substr(name_begin + 1, name_end - name_begin - 1));
+                }
+            }
+        }
+        line_begin = line_end + 1;
+    }
+    return includes;
+}
+
+bool LoadShaderSource(const std::filesystem::path& path, ShaderSource* source, std::string* error)
+{
+    source->files.clear();
+    source->hash = SHADER_HASH_SEED;
+
+    std::vector<std::filesystem::path> pending{ path.lexically_normal() };
+    while (!pending.empty())
+    {
+        std::filesystem::path file_path{ std::move(pending.back()) };
+        pending.pop_back();
+        if (std::any_of(source->files.begin(), source->files.end(), [&](const ShaderSourceFile& file) { return file.path == file_path; }))
+        {
+            continue; // included twice, e.g. behind an include guard
+        }
+
+        std::optional<std::string> text{ ReadTextFile(file_path) };
+        if (!text)
+        {
+            *error = "cannot read " + file_path.string();
+            source->files.push_back({ std::move(file_path), {} });
+            return false;
+        }
+        std::vector<std::string> includes{ FindQuotedIncludes(*text) };
+        for (auto it{ includes.rbegin() }; it != includes.rend(); it++)
+        {
+            pending.emplace_back((file_path.parent_path() / *it).lexically_normal());
+        }
+
+        // the path takes part in the hash: moving an include changes which file the compiler reads
+        source->hash = HashShaderText(file_path.generic_string(), source->hash);
+        source->hash = HashShaderText(*text, source->hash);
+        source->files.push_back({ std::move(file_path), std::move(*text) });
+    }
+    return true;
+}
+
+// ---------- File Watcher ----------
+
+void ShaderFileWatcher::Watch(std::span<const ShaderSourceFile> files)
+{
+    m_files.clear();
+    for (const ShaderSourceFile& file : files)
+    {
+        // a file saved after it was read but before this stat would become the reference state and never be reloaded;
+        // reading it again after the stat tells whether the state describes the text that was read
+        FileState state{ Stat(file.path) };
+        std::optional<std::string> text{ ReadTextFile(file.path) };
+        state.stale = text ? *text != file.text : state.exists || !file.text.empty();
+        m_files.emplace_back(std::move(state));
+    }
+}
+bool ShaderFileWatcher::Poll()
+{
+    bool changed{};
+    for (FileState& file : m_files)
+    {
+        FileState state{ Stat(file.path) };
+        if (state != file)
+        {
+            file = std::move(state);
+            changed = true;
+        }
+    }
+    return changed;
+}
+ShaderFileWatcher::FileState ShaderFileWatcher::Stat(const std::filesystem::path& path)
+{
+    // error codes rather than exceptions: a file being saved may briefly be missing or locked
+    std::error_code ec{};
+    FileState state{ path, {}, 0, false, false };
+    state.write_time = std::filesystem::last_write_time(path, ec);
+    if (!ec)
+    {
+        state.size = std::filesystem::file_size(path, ec);
+        state.exists = !ec;
+    }
+    if (!state.exists)
+    {
+        state.write_time = {};
+        state.size = 0;
+    }
+    return state;
+}
+
+// ---------- Bytecode Cache ----------
+
+ShaderBytecodeCache::ShaderBytecodeCache(std::filesystem::path directory)
+    : m_directory{ std::move(directory) }
+    , m_mutex{}
+    , m_entries{}
+    , m_stats{}
+{
+    if (!m_directory.empty())
+    {
+        std::error_code ec{};
+        std::filesystem::create_directories(m_directory, ec);
+    }
+}
+ShaderBytecode ShaderBytecodeCache::Find(std::uint64_t key)
+{
+    {
+        std::lock_guard lock{ m_mutex };
+        auto it{ m_entries.find(key) };
+        if (it != m_entries.end())
+        {
+            m_stats.memory_hits++;
+            return it->second;
+        }
+    }
+
+    std::shared_ptr<std::vector<std::uint8_t>> bytecode{};
+    if (!m_directory.empty())
+    {
+        std::ifstream file{ FilePath(key), std::ios::binary };
+        if (file)
+        {
+            bytecode = std::make_shared<std::vector<std::uint8_t>>(std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{});
+        }
+    }
+
+    std::lock_guard lock{ m_mutex };
+    if (!bytecode || bytecode->empty())
+    {
+        m_stats.misses++;
+        return nullptr;
+    }
+    m_stats.disk_hits++;
+    return m_entries.try_emplace(key, std::move(bytecode)).first->second;
+}
+ShaderBytecode ShaderBytecodeCache::Store(std::uint64_t key, std::span<const std::uint8_t> bytecode)
+{
+    auto entry{ std::make_shared<const std::vector<std::uint8_t>>(bytecode.begin(), bytecode.end()) };
+    if (!m_directory.empty())
+    {
+        // write then rename, so that a run interrupted while writing never leaves a truncated entry
+        std::filesystem::path path{ FilePath(key) };
+        std::filesystem::path temp_path{ path };
+        temp_path += ".tmp";
+        {
+            std::ofstream file{ temp_path, std::ios::binary };
+            file.write(reinterpret_cast<const char*>(bytecode.data()), static_cast<std::streamsize>(bytecode.size()));
+        }
+        std::error_code ec{};
+        std::filesystem::rename(temp_path, path, ec);
+    }
+
+    std::lock_guard lock{ m_mutex };
+    m_entries.insert_or_assign(key, entry);
+    m_stats.stores++;
+    return entry;
+}
+std::size_t ShaderBytecodeCache::EntryCount()
+{
+    std::lock_guard lock{ m_mutex };
+    return m_entries.size();
+}
+ShaderBytecodeCacheStats ShaderBytecodeCache::Stats()
+{
+    std::lock_guard lock{ m_mutex };
+    return m_stats;
+}
+std::filesystem::path ShaderBytecodeCache::FilePath(std::uint64_t key) const
+{
+    char name[32]{};
+    std::snprintf(name, sizeof(name), "%016llx.cso", static_cast<unsigned long long>(key));
+    return m_directory / name;
+}
+
+// ---------- Hot Reload ----------
+
+const char* ShaderReloadStateName(ShaderReloadState state)
+{
+    switch (state)
+    {
+    case ShaderReloadState::Watching: return "Watching";
+    case ShaderReloadState::Compiled: return "Compiled";
+    case ShaderReloadState::Cached: return "Cached";
+    case ShaderReloadState::Failed: return "Failed";
+    default: Unreachable();
+    }
+}
+
+ShaderHotReload::ShaderHotReload(ShaderCompileFunction compile, ShaderBytecodeCache* cache, std::chrono::milliseconds poll_interval)
+    : m_compile{ std::move(compile) }
+    , m_cache{ cache }
+    , m_poll_interval{ poll_interval }
+    , m_mutex{}
+    , m_wake_cv{}
+    , m_programs{}
+    , m_reloads{}
+    , m_quit{}
+    , m_thread{}
+{
+    Check(m_compile);
+    Check(m_cache);
+
+    m_thread = std::thread{ [this]() { ThreadMain(); } };
+}
+ShaderHotReload::~ShaderHotReload()
+{
+    {
+        std::lock_guard lock{ m_mutex };
+        m_quit = true;
+    }
+    m_wake_cv.notify_all();
+    m_thread.join();
+}
+ShaderProgramHandle ShaderHotReload::AddShader(std::filesystem::path path, std::string entry_point, std::string target, std::vector<ShaderDefine> defines, std::span<const std::uint8_t> built_in_bytecode)
+{
+    auto program{ std::make_unique<Program>() };
+    program->path = std::move(path);
+    program->entry_point = std::move(entry_point);
+    program->target = std::move(target);
+    program->defines = std::move(defines);
+    program->built_in_bytecode.assign(built_in_bytecode.begin(), built_in_bytecode.end());
+    program->key = 0;
+    program->loaded = false;
+    program->status = {};
+    program->status.path = program->path;
+    for (const ShaderDefine& define : program->defines)
+    {
+        program->status.defines += (program->status.defines.empty() ? "" : " ") + define.name + "=" + define.value;
+    }
+    program->status.state = ShaderReloadState::Watching;
+
+    ShaderProgramHandle handle{};
+    {
+        std::lock_guard lock{ m_mutex };
+        handle = static_cast<ShaderProgramHandle>(m_programs.size());
+        m_programs.emplace_back(std::move(program));
+    }
+    m_wake_cv.notify_all(); // read the sources now rather than after a poll interval
+    return handle;
+}
+std::vector<ShaderReload> ShaderHotReload::TakeReloads()
+{
+    std::lock_guard lock{ m_mutex };
+    return std::exchange(m_reloads, {});
+}
+ShaderReloadStatus ShaderHotReload::Status(ShaderProgramHandle program)
+{
+    std::lock_guard lock{ m_mutex };
+    return m_programs.at(program)->status;
+}
+std::uint32_t ShaderHotReload::ProgramCount()
+{
+    std::lock_guard lock{ m_mutex };
+    return static_cast<std::uint32_t>(m_programs.size());
+}
+void ShaderHotReload::ThreadMain()
+{
+    std::vector<Program*> programs{};
+    std::unique_lock lock{ m_mutex };
+    while (!m_quit)
+    {
+        // programs are never removed and are heap allocated, so they stay valid while the lock is released
+        programs.clear();
+        for (const std::unique_ptr<Program>& program : m_programs)
+        {
+            programs.emplace_back(program.get());
+        }
+
+        lock.unlock();
+        for (std::size_t i{}; i < programs.size(); i++)
+        {
+            UpdateProgram(static_cast<ShaderProgramHandle>(i), *programs[i]);
+        }
+        lock.lock();
+
+        std::size_t program_count{ programs.size() };
+        m_wake_cv.wait_for(lock, m_poll_interval, [&]() { return m_quit || m_programs.size() != program_count; });
+    }
+}
+void ShaderHotReload::UpdateProgram(ShaderProgramHandle handle, Program& program)
+{
+    if (program.loaded && !program.watcher.Poll())
+    {
+        return;
+    }
+    bool first_load{ !program.loaded };
+    program.loaded = true;
+    std::vector<std::uint8_t> built_in_bytecode{ std::exchange(program.built_in_bytecode, {}) };
+
+    ShaderSource source{};
+    std::string error{};
+    bool source_loaded{ LoadShaderSource(program.path, &source, &error) };
+    program.watcher.Watch(source.files);
+    if (!source_loaded)
+    {
+        std::lock_guard lock{ m_mutex };
+        program.status.state = ShaderReloadState::Failed;
+        program.status.file_count = static_cast<std::uint32_t>(source.files.size());
+        program.status.log = std::move(error);
+        return;
+    }
+
+    std::uint64_t key{ HashShaderText(program.entry_point, source.hash) };
+    key = HashShaderText(program.target, key);
+    for (const ShaderDefine& define : program.defines)
+    {
+        key = HashShaderText(define.name, key);
+        key = HashShaderText(define.value, key);
+    }
+    if (!first_load && key == program.key)
+    {
+        return; // saved without changes
+    }
+    program.key = key;
+
+    ShaderReloadState state{ ShaderReloadState::Cached };
+    double compile_ms{};
+    std::string log{};
+    ShaderBytecode bytecode{ m_cache->Find(key) };
+    if (!bytecode)
+    {
+        ShaderCompileRequest request{ &source, program.entry_point.c_str(), program.target.c_str(), program.defines };
+        auto begin{ std::chrono::steady_clock::now() };
+        ShaderCompileResult result{ m_compile(request) };
+        auto end{ std::chrono::steady_clock::now() };
+        compile_ms = std::chrono::duration<double, std::milli>(end - begin).count();
+        log = std::move(result.log);
+        if (result.success && !result.bytecode.empty())
+        {
+            bytecode = m_cache->Store(key, result.bytecode);
+            state = ShaderReloadState::Compiled;
+        }
+        else
+        {
+            state = ShaderReloadState::Failed;
+        }
+    }
+
+    // the sources may have been edited since the built-in bytecode was compiled, so it is never cached under key;
+    // when the bytecode of the sources on disk matches it, there is nothing to publish
+    if (first_load && bytecode && std::ranges::equal(*bytecode, built_in_bytecode))
+    {
+        state = ShaderReloadState::Watching;
+        bytecode = nullptr;
+    }
+
+    std::lock_guard lock{ m_mutex };
+    program.status.state = state;
+    program.status.key = key;
+    program.status.file_count = static_cast<std::uint32_t>(source.files.size());
+    program.status.compile_ms = compile_ms;
+    program.status.log = std::move(log);
+    if (bytecode)
+    {
+        program.status.reload_count++;
+        m_reloads.push_back({ handle, std::move(bytecode) });
+    }
+}
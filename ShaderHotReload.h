@@ -0,0 +1,217 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// ---------- Shader Sources ----------
+
+// 64-bit FNV-1a; chain calls through seed to hash several buffers
+inline constexpr std::uint64_t SHADER_HASH_SEED{ 0xCBF29CE484222325ull };
+std::uint64_t HashShaderBytes(std::span<const std::uint8_t> bytes, std::uint64_t seed);
+
+struct ShaderSourceFile
+{
+    std::filesystem::path path;
+    std::string text;
+};
+
+struct ShaderSource
+{
+    std::vector<ShaderSourceFile> files; // main file first, then every file it includes, directly or not, each once
+    std::uint64_t hash; // paths and contents of files
+};
+
+/*
+    reads path and the files it includes with #include "name", relative to the including file
+    returns false and names the missing file in error when one of them cannot be read; files then ends with that file, with no text,
+    so that watching files notices when it appears
+*/
+bool LoadShaderSource(const std::filesystem::path& path, ShaderSource* source, std::string* error);
+
+// ---------- File Watcher ----------
+
+// polls the write time and size of a set of files; no OS notifications, so it behaves the same on every platform
+class ShaderFileWatcher
+{
+public:
+    // replace the watched files; their current state is the reference for the next Poll, which reports a file whose
+    // contents no longer match its text, e.g. saved while it was being loaded
+    void Watch(std::span<const ShaderSourceFile> files);
+    // true when a watched file was modified, created or deleted since Watch or the previous Poll
+    bool Poll();
+private:
+    struct FileState
+    {
+        std::filesystem::path path;
+        std::filesystem::file_time_type write_time;
+        std::uintmax_t size;
+        bool exists;
+        bool stale; // changed between reading and Watch; never true after Stat, so the next Poll reports the file
+        bool operator==(const FileState&) const = default;
+    };
+    static FileState Stat(const std::filesystem::path& path);
+private:
+    std::vector<FileState> m_files;
+};
+
+// ---------- Bytecode Cache ----------
+
+using ShaderBytecode = std::shared_ptr<const std::vector<std::uint8_t>>;
+
+struct ShaderBytecodeCacheStats
+{
+    std::uint32_t memory_hits; // Find served from memory
+    std::uint32_t disk_hits; // Find served from a file written by this or an earlier run
+    std::uint32_t misses; // Find with no entry, usually followed by a compile
+    std::uint32_t stores;
+};
+
+/*
+    compiled shaders keyed by the hash of their sources, entry point and target
+    kept in memory, and on disk as one <key>.cso file per entry when directory is not empty; thread safe
+*/
+class ShaderBytecodeCache
+{
+public:
+    explicit ShaderBytecodeCache(std::filesystem::path directory);
+    ~ShaderBytecodeCache() = default;
+    ShaderBytecodeCache(const ShaderBytecodeCache&) = delete;
+    ShaderBytecodeCache(ShaderBytecodeCache&&) noexcept = delete;
+    ShaderBytecodeCache& operator=(const ShaderBytecodeCache&) = delete;
+    ShaderBytecodeCache& operator=(ShaderBytecodeCache&&) noexcept = delete;
+public:
+    // nullptr when key is neither in memory nor on disk
+    ShaderBytecode Find(std::uint64_t key);
+    // failing to write the file only costs a compile in a later run
+    ShaderBytecode Store(std::uint64_t key, std::span<const std::uint8_t> bytecode);
+    std::size_t EntryCount();
+    ShaderBytecodeCacheStats Stats();
+private:
+    std::filesystem::path FilePath(std::uint64_t key) const;
+private:
+    std::filesystem::path m_directory;
+    std::mutex m_mutex;
+    std::unordered_map<std::uint64_t, ShaderBytecode> m_entries;
+    ShaderBytecodeCacheStats m_stats;
+};
+
+// ---------- Hot Reload ----------
+
+// preprocessor definition passed to the compiler, e.g. a permutation setting
+struct ShaderDefine
+{
+    std::string name;
+    std::string value;
+};
+
+struct ShaderCompileRequest
+{
+    const ShaderSource* source;
+    const char* entry_point;
+    const char* target; // e.g. "ps_5_0"
+    std::span<const ShaderDefine> defines;
+};
+
+struct ShaderCompileResult
+{
+    bool success;
+    std::vector<std::uint8_t> bytecode;
+    std::string log; // errors and warnings
+};
+
+// compiles HLSL (D3DCompile on Windows, or a stub in tests); includes must be served from request.source, which was hashed
+using ShaderCompileFunction = std::function<ShaderCompileResult(const ShaderCompileRequest&)>;
+
+using ShaderProgramHandle = std::uint32_t;
+
+enum class ShaderReloadState : std::uint32_t
+{
+    Watching = 0, // sources unchanged since AddShader, or not read yet, or built to the built-in bytecode
+    Compiled = 1, // last change was compiled
+    Cached = 2, // last change was found in the cache, e.g. an edit that was undone
+    Failed = 3, // last change failed to load or compile; the previous bytecode stays in use
+    Count,
+};
+
+const char* ShaderReloadStateName(ShaderReloadState state);
+
+struct ShaderReloadStatus
+{
+    std::filesystem::path path;
+    std::string defines; // "NAME=VALUE NAME=VALUE"
+    ShaderReloadState state;
+    std::uint64_t key; // cache key of the sources last seen
+    std::uint32_t reload_count; // new bytecode published
+    std::uint32_t file_count; // main file and includes
+    double compile_ms; // last compile
+    std::string log;
+};
+
+struct ShaderReload
+{
+    ShaderProgramHandle program;
+    ShaderBytecode bytecode;
+};
+
+/*
+    watches the sources of the registered shaders and rebuilds them on a background thread when they change
+    bytecode comes from the cache when the same sources were built before, otherwise from compile
+    the render loop takes the new bytecode at a frame boundary and creates the shader objects, so it never waits for a compile
+*/
+class ShaderHotReload
+{
+public:
+    ShaderHotReload(ShaderCompileFunction compile, ShaderBytecodeCache* cache, std::chrono::milliseconds poll_interval);
+    ~ShaderHotReload();
+    ShaderHotReload(const ShaderHotReload&) = delete;
+    ShaderHotReload(ShaderHotReload&&) noexcept = delete;
+    ShaderHotReload& operator=(const ShaderHotReload&) = delete;
+    ShaderHotReload& operator=(ShaderHotReload&&) noexcept = delete;
+public:
+    /*
+        built_in_bytecode is what the caller renders with until the first reload (e.g. compiled at build time)
+        the shader is built as soon as the reload thread reads its sources, from the cache when possible; the result is published
+        only when it differs from built_in_bytecode, i.e. when the sources were edited since it was compiled
+        built_in_bytecode is never cached, since the sources it was compiled from are unknown
+    */
+    ShaderProgramHandle AddShader(std::filesystem::path path, std::string entry_point, std::string target, std::vector<ShaderDefine> defines, std::span<const std::uint8_t> built_in_bytecode);
+    // bytecode published since the previous call, oldest first; a program may appear several times
+    std::vector<ShaderReload> TakeReloads();
+    ShaderReloadStatus Status(ShaderProgramHandle program);
+    std::uint32_t ProgramCount();
+private:
+    struct Program
+    {
+        std::filesystem::path path;
+        std::string entry_point;
+        std::string target;
+        std::vector<ShaderDefine> defines;
+        std::vector<std::uint8_t> built_in_bytecode; // released after the first load
+        ShaderFileWatcher watcher; // reload thread only
+        std::uint64_t key; // reload thread only
+        bool loaded; // reload thread only
+        ShaderReloadStatus status;
+    };
+    void ThreadMain();
+    void UpdateProgram(ShaderProgramHandle handle, Program& program);
+private:
+    ShaderCompileFunction m_compile;
+    ShaderBytecodeCache* m_cache;
+    std::chrono::milliseconds m_poll_interval;
+    std::mutex m_mutex;
+    std::condition_variable m_wake_cv;
+    std::vector<std::unique_ptr<Program>> m_programs;
+    std::vector<ShaderReload> m_reloads;
+    bool m_quit;
+    std::thread m_thread; // last, started once the members above are constructed
+};
@@ -0,0 +1,167 @@
+#include <Shading.h>
+
+#include <Assertions.h>
+
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+// ---------- Shading Permutations ----------
+
+const char* BrdfModelName(BrdfModel model)
+{
+    switch (model)
+    {
+    case BrdfModel::Lambert: return "Lambert";
+    case BrdfModel::BlinnPhong: return "Blinn-Phong";
+    case BrdfModel::GGX: return "GGX";
+    default: Unreachable();
+    }
+}
+
+// ---------- CPU Shading ----------
+
+// not Shade<>() with runtime values: written as a single function would be, testing the model and features at every pixel
+ShadingVector ShadeDynamic(ShadingPermutationKey key, const ShadingInputs& in) noexcept
+{
+    BrdfModel model{ ShadingPermutationModel(key) };
+    ShadingFeatures features{ ShadingPermutationFeatures(key) };
+
+    ShadingAngles a{};
+    a.n_dot_l = std::clamp(Dot(in.n, in.l), 0.0f, 1.0f);
+    a.n_dot_v = std::clamp(Dot(in.n, in.v), 1e-4f, 1.0f);
+    a.alpha = std::max(in.roughness * in.roughness, SHADING_MIN_ALPHA);
+
+    ShadingVector color{ in.albedo * a.n_dot_l };
+    if (model != BrdfModel::Lambert)
+    {
+        ShadingVector h{ Normalize(in.v + in.l) };
+        a.n_dot_h = std::clamp(Dot(in.n, h), 0.0f, 1.0f);
+        a.v_dot_h = std::clamp(Dot(in.v, h), 0.0f, 1.0f);
+
+        float fresnel{ SHADING_F0 };
+        if (HasShadingFeature(features, ShadingFeature::Fresnel))
+        {
+            fresnel = SHADING_F0 + (1.0f - SHADING_F0) * std::pow(1.0f - a.v_dot_h, 5.0f);
+        }
+        float brdf{ model == BrdfModel::BlinnPhong ? Brdf<BrdfModel::BlinnPhong>::Specular(a) : Brdf<BrdfModel::GGX>::Specular(a) };
+        float specular{ brdf * fresnel * std::numbers::pi_v<float> * a.n_dot_l };
+        color = color + ShadingVector{ specular, specular, specular };
+    }
+    color = color * in.light_color;
+    if (HasShadingFeature(features, ShadingFeature::Ambient))
+    {
+        color = color + in.albedo * SHADING_AMBIENT;
+    }
+    return color;
+}
+
+// ---------- Reference Renderer ----------
+
+template <typename ShadeFunction>
+static void RenderSpherePixels(const ReferenceSphereView& view, std::span<float> rgb, ShadeFunction&& shade)
+{
+    ShadingInputs in{};
+    in.v = { 0.0f, 0.0f, -1.0f };
+    in.l = Normalize(view.light_direction);
+    in.albedo = view.albedo;
+    in.light_color = view.light_color;
+    in.roughness = view.roughness;
+
+    for (std::uint32_t y{}; y < view.height; y++)
+    {
+        for (std::uint32_t x{}; x < view.width; x++)
+        {
+            float u{ (static_cast<float>(x) + 0.5f) / static_cast<float>(view.width) * 2.0f - 1.0f };
+            float v{ 1.0f - (static_cast<float>(y) + 0.5f) / static_cast<float>(view.height) * 2.0f };
+            float z2{ 1.0f - u * u - v * v };
+
+            ShadingVector color{};
+            if (z2 > 0.0f)
+            {
+                in.n = { u, v, -std::sqrt(z2) };
+                color = shade(in);
+            }
+            float* pixel{ rgb.data() + (static_cast<std::size_t>(y) * view.width + x) * 3 };
+            pixel[0] = color.x;
+            pixel[1] = color.y;
+            pixel[2] = color.z;
+        }
+    }
+}
+
+template <ShadingPermutationKey Key>
+static void RenderSpherePermutation(const ReferenceSphereView& view, std::span<float> rgb)
+{
+    RenderSpherePixels(view, rgb, [](const ShadingInputs& in) { return Shade<ShadingPermutationModel(Key), ShadingPermutationFeatures(Key)>(in); });
+}
+
+using RenderSphereFunction = void (*)(const ReferenceSphereView&, std::span<float>);
+
+template <std::size_t... Keys>
+static constexpr std::array<RenderSphereFunction, sizeof...(Keys)> MakeRenderSphereTable(std::index_sequence<Keys...>)
+{
+    return { &RenderSpherePermutation<static_cast<ShadingPermutationKey>(Keys)>... };
+}
+
+static constexpr std::array<RenderSphereFunction, SHADING_PERMUTATION_COUNT> RENDER_SPHERE_PERMUTATIONS{ MakeRenderSphereTable(std::make_index_sequence<SHADING_PERMUTATION_COUNT>{}) };
+
+void RenderReferenceSphere(ShadingPermutationKey key, const ReferenceSphereView& view, std::span<float> rgb, bool dynamic)
+{
+    Check(key < SHADING_PERMUTATION_COUNT);
+    Check(rgb.size() >= static_cast<std::size_t>(view.width) * view.height * 3);
+
+    if (dynamic)
+    {
+        RenderSpherePixels(view, rgb, [key](const ShadingInputs& in) { return ShadeDynamic(key, in); });
+    }
+    else
+    {
+        RENDER_SPHERE_PERMUTATIONS[key](view, rgb);
+    }
+}
+
+// ---------- Shading Benchmark ----------
+
+std::vector<ShadingBenchmarkResult> RunShadingBenchmark(std::uint32_t size, std::uint32_t repetitions)
+{
+    Check(repetitions > 0);
+
+    ReferenceSphereView view{};
+    view.width = size;
+    view.height = size;
+    view.light_direction = { -0.5f, 0.6f, -0.6f };
+    view.albedo = { 0.8f, 0.2f, 0.1f };
+    view.light_color = { 1.0f, 1.0f, 1.0f };
+    view.roughness = 0.4f;
+
+    std::vector<float> dynamic_rgb(static_cast<std::size_t>(size) * size * 3);
+    std::vector<float> specialized_rgb(dynamic_rgb.size());
+    std::vector<ShadingBenchmarkResult> results{};
+    for (ShadingPermutationKey key{}; key < SHADING_PERMUTATION_COUNT; key++)
+    {
+        ShadingBenchmarkResult result{};
+        result.key = key;
+        result.pixel_count = size * size;
+        result.dynamic_ms = std::numeric_limits<double>::max();
+        result.specialized_ms = std::numeric_limits<double>::max();
+        for (std::uint32_t repetition{}; repetition < repetitions; repetition++)
+        {
+            auto begin{ std::chrono::steady_clock::now() };
+            RenderReferenceSphere(key, view, dynamic_rgb, true);
+            auto middle{ std::chrono::steady_clock::now() };
+            RenderReferenceSphere(key, view, specialized_rgb, false);
+            auto end{ std::chrono::steady_clock::now() };
+            result.dynamic_ms = std::min(result.dynamic_ms, std::chrono::duration<double, std::milli>(middle - begin).count());
+            result.specialized_ms = std::min(result.specialized_ms, std::chrono::duration<double, std::milli>(end - middle).count());
+        }
+        for (std::size_t i{}; i < dynamic_rgb.size(); i += 3)
+        {
+            result.mismatches += std::memcmp(&dynamic_rgb[i], &specialized_rgb[i], sizeof(float) * 3) != 0 ? 1 : 0;
+        }
+        results.emplace_back(result);
+    }
+    return results;
+}
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <vector>
+
+// ---------- Shading Permutations ----------
+
+// values must match the BRDF_MODEL_* defines of ConstantBuffers.hlsli
+enum class BrdfModel : std::uint32_t
+{
+    Lambert = 0, // diffuse only
+    BlinnPhong = 1, // normalized Blinn-Phong specular, exponent derived from roughness
+    GGX = 2, // GGX distribution with height-correlated Smith visibility
+    Count,
+};
+
+// bits of ShadingFeatures; values must match the SHADING_FEATURE_* defines of ConstantBuffers.hlsli
+enum class ShadingFeature : std::uint32_t
+{
+    Fresnel = 1 << 0, // Schlick Fresnel on the specular lobe, constant F0 otherwise
+    Ambient = 1 << 1, // constant ambient term
+};
+
+using ShadingFeatures = std::uint32_t;
+
+inline constexpr std::uint32_t SHADING_FEATURE_BITS{ 2 };
+
+constexpr bool HasShadingFeature(ShadingFeatures features, ShadingFeature feature) noexcept
+{
+    return (features & static_cast<std::uint32_t>(feature)) != 0;
+}
+
+/*
+    one shader variant per BRDF model and feature combination, compiled with BRDF_MODEL and SHADING_FEATURES defined
+    the key packs both: [model][features, SHADING_FEATURE_BITS bits], so that keys are dense and index flat tables
+*/
+using ShadingPermutationKey = std::uint32_t;
+
+inline constexpr std::uint32_t SHADING_PERMUTATION_COUNT{ static_cast<std::uint32_t>(BrdfModel::Count) << SHADING_FEATURE_BITS };
+
+constexpr ShadingPermutationKey MakeShadingPermutationKey(BrdfModel model, ShadingFeatures features) noexcept
+{
+    return (static_cast<std::uint32_t>(model) << SHADING_FEATURE_BITS) | features;
+}
+constexpr BrdfModel ShadingPermutationModel(ShadingPermutationKey key) noexcept
+{
+    return static_cast<BrdfModel>(key >> SHADING_FEATURE_BITS);
+}
+constexpr ShadingFeatures ShadingPermutationFeatures(ShadingPermutationKey key) noexcept
+{
+    return key & ((1u << SHADING_FEATURE_BITS) - 1);
+}
+
+// permutation of the shaders built with the project, compiled without BRDF_MODEL and SHADING_FEATURES; see Shading.hlsli
+inline constexpr ShadingPermutationKey SHADING_DEFAULT_PERMUTATION{ MakeShadingPermutationKey(BrdfModel::GGX, static_cast<ShadingFeatures>(ShadingFeature::Fresnel) | static_cast<ShadingFeatures>(ShadingFeature::Ambient)) };
+
+const char* BrdfModelName(BrdfModel model);
+
+// ---------- CPU Shading ----------
+
+// mirrors Shading.hlsli operation for operation, so both sides shade the same
+struct ShadingVector
+{
+    float x;
+    float y;
+    float z;
+};
+
+inline ShadingVector operator+(ShadingVector a, ShadingVector b) noexcept { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+inline ShadingVector operator*(ShadingVector a, ShadingVector b) noexcept { return { a.x * b.x, a.y * b.y, a.z * b.z }; }
+inline ShadingVector operator*(ShadingVector a, float s) noexcept { return { a.x * s, a.y * s, a.z * s }; }
+inline float Dot(ShadingVector a, ShadingVector b) noexcept { return a.x * b.x + a.y * b.y + a.z * b.z; }
+inline ShadingVector Normalize(ShadingVector v) noexcept { return v * (1.0f / std::sqrt(Dot(v, v))); }
+
+// unit vectors in the same space
+struct ShadingInputs
+{
+    ShadingVector n; // surface normal
+    ShadingVector v; // toward the eye
+    ShadingVector l; // toward the light
+    ShadingVector albedo;
+    ShadingVector light_color;
+    float roughness; // perceptual, squared into alpha
+};
+
+inline constexpr float SHADING_F0{ 0.04f }; // dielectric specular reflectance at normal incidence
+inline constexpr float SHADING_AMBIENT{ 0.03f };
+inline constexpr float SHADING_MIN_ALPHA{ 0.002f }; // keeps the specular peak finite for a perfectly smooth surface
+
+struct ShadingAngles
+{
+    float n_dot_l;
+    float n_dot_v;
+    float n_dot_h;
+    float v_dot_h;
+    float alpha;
+};
+
+// specular BRDF of a model, without Fresnel; specialized per model so that shading has no branch on it
+template <BrdfModel Model>
+struct Brdf;
+
+template <>
+struct Brdf<BrdfModel::Lambert>
+{
+    static constexpr bool HAS_SPECULAR{ false };
+    static float Specular(const ShadingAngles&) noexcept { return 0.0f; }
+};
+
+template <>
+struct Brdf<BrdfModel::BlinnPhong>
+{
+    static constexpr bool HAS_SPECULAR{ true };
+    static float Specular(const ShadingAngles& a) noexcept
+    {
+        float shininess{ std::max(2.0f / (a.alpha * a.alpha) - 2.0f, 1.0f) };
+        return (shininess + 8.0f) / (8.0f * std::numbers::pi_v<float>) * std::pow(a.n_dot_h, shininess);
+    }
+};
+
+template <>
+struct Brdf<BrdfModel::GGX>
+{
+    static constexpr bool HAS_SPECULAR{ true };
+    static float Specular(const ShadingAngles& a) noexcept
+    {
+        float alpha2{ a.alpha * a.alpha };
+        float d_denominator{ a.n_dot_h * a.n_dot_h * (alpha2 - 1.0f) + 1.0f };
+        float d{ alpha2 / (std::numbers::pi_v<float> * d_denominator * d_denominator) };
+        float smith_v{ a.n_dot_l * std::sqrt(a.n_dot_v * a.n_dot_v * (1.0f - alpha2) + alpha2) };
+        float smith_l{ a.n_dot_v * std::sqrt(a.n_dot_l * a.n_dot_l * (1.0f - alpha2) + alpha2) };
+        float vis{ 0.5f / std::max(smith_v + smith_l, 1e-6f) };
+        return d * vis;
+    }
+};
+
+// outgoing radiance toward the eye from one light of irradiance pi * light_color at normal incidence
+template <BrdfModel Model, ShadingFeatures Features>
+ShadingVector Shade(const ShadingInputs& in) noexcept
+{
+    ShadingAngles a{};
+    a.n_dot_l = std::clamp(Dot(in.n, in.l), 0.0f, 1.0f);
+    a.n_dot_v = std::clamp(Dot(in.n, in.v), 1e-4f, 1.0f);
+    a.alpha = std::max(in.roughness * in.roughness, SHADING_MIN_ALPHA);
+
+    ShadingVector color{ in.albedo * a.n_dot_l };
+    if constexpr (Brdf<Model>::HAS_SPECULAR)
+    {
+        ShadingVector h{ Normalize(in.v + in.l) };
+        a.n_dot_h = std::clamp(Dot(in.n, h), 0.0f, 1.0f);
+        a.v_dot_h = std::clamp(Dot(in.v, h), 0.0f, 1.0f);
+
+        float fresnel{ SHADING_F0 };
+        if constexpr (HasShadingFeature(Features, ShadingFeature::Fresnel))
+        {
+            fresnel = SHADING_F0 + (1.0f - SHADING_F0) * std::pow(1.0f - a.v_dot_h, 5.0f);
+        }
+        float specular{ Brdf<Model>::Specular(a) * fresnel * std::numbers::pi_v<float> * a.n_dot_l };
+        color = color + ShadingVector{ specular, specular, specular };
+    }
+    color = color * in.light_color;
+    if constexpr (HasShadingFeature(Features, ShadingFeature::Ambient))
+    {
+        color = color + in.albedo * SHADING_AMBIENT;
+    }
+    return color;
+}
+
+// same shading, with the model and features read per call; what a single shader branching on them would do
+ShadingVector ShadeDynamic(ShadingPermutationKey key, const ShadingInputs& in) noexcept;
+
+// ---------- Reference Renderer ----------
+
+struct ReferenceSphereView
+{
+    std::uint32_t width;
+    std::uint32_t height;
+    ShadingVector light_direction; // toward the light
+    ShadingVector albedo;
+    ShadingVector light_color;
+    float roughness;
+};
+
+/*
+    ray traces a unit sphere seen orthographically along +z into rgb (width * height * 3 floats, black background)
+    the permutation is resolved once per image: every key has its own instantiation of the pixel loop
+    dynamic shades through ShadeDynamic instead, for comparison
+*/
+void RenderReferenceSphere(ShadingPermutationKey key, const ReferenceSphereView& view, std::span<float> rgb, bool dynamic);
+
+// ---------- Shading Benchmark ----------
+
+struct ShadingBenchmarkResult
+{
+    ShadingPermutationKey key;
+    std::uint32_t pixel_count;
+    double dynamic_ms; // ShadeDynamic per pixel; fastest repetition
+    double specialized_ms; // Shade<Model, Features> per pixel; fastest repetition
+    std::uint32_t mismatches; // pixels that differ between the two, expected to be 0
+};
+
+// renders the reference sphere with every permutation, both ways
+std::vector<ShadingBenchmarkResult> RunShadingBenchmark(std::uint32_t size, std::uint32_t repetitions);
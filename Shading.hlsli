@@ -0,0 +1,66 @@
+#ifndef __SHADING__
+#define __SHADING__
+
+#include "ConstantBuffers.hlsli"
+
+// mirrored on the CPU by Shading.h; keep the two in sync
+
+// permutation compiled when the defines are not given, which is the one built with the project
+#ifndef BRDF_MODEL
+#define BRDF_MODEL BRDF_MODEL_GGX
+#endif
+#ifndef SHADING_FEATURES
+#define SHADING_FEATURES (SHADING_FEATURE_FRESNEL | SHADING_FEATURE_AMBIENT)
+#endif
+
+static const float PI = 3.14159265f;
+static const float SHADING_F0 = 0.04f; // dielectric specular reflectance at normal incidence
+static const float SHADING_AMBIENT = 0.03f;
+static const float SHADING_MIN_ALPHA = 0.002f; // keeps the specular peak finite for a perfectly smooth surface
+
+float SpecularBrdf(float n_dot_l, float n_dot_v, float n_dot_h, float alpha)
+{
+#if BRDF_MODEL == BRDF_MODEL_BLINN_PHONG
+    float shininess = max(2.0f / (alpha * alpha) - 2.0f, 1.0f);
+    return (shininess + 8.0f) / (8.0f * PI) * pow(n_dot_h, shininess);
+#elif BRDF_MODEL == BRDF_MODEL_GGX
+    float alpha2 = alpha * alpha;
+    float d_denominator = n_dot_h * n_dot_h * (alpha2 - 1.0f) + 1.0f;
+    float d = alpha2 / (PI * d_denominator * d_denominator);
+    float smith_v = n_dot_l * sqrt(n_dot_v * n_dot_v * (1.0f - alpha2) + alpha2);
+    float smith_l = n_dot_v * sqrt(n_dot_l * n_dot_l * (1.0f - alpha2) + alpha2);
+    float vis = 0.5f / max(smith_v + smith_l, 1e-6f);
+    return d * vis;
+#else
+    return 0.0f;
+#endif
+}
+
+// outgoing radiance toward v from one light of irradiance PI * light_color at normal incidence
+float3 Shade(float3 n, float3 v, float3 l, float3 albedo, float3 light_color, float roughness)
+{
+    float n_dot_l = saturate(dot(n, l));
+    float n_dot_v = clamp(dot(n, v), 1e-4f, 1.0f);
+    float alpha = max(roughness * roughness, SHADING_MIN_ALPHA);
+
+    float3 color = albedo * n_dot_l;
+#if BRDF_MODEL != BRDF_MODEL_LAMBERT
+    float3 h = normalize(v + l);
+    float n_dot_h = saturate(dot(n, h));
+    float v_dot_h = saturate(dot(v, h));
+
+#if SHADING_FEATURES & SHADING_FEATURE_FRESNEL
+    float fresnel = SHADING_F0 + (1.0f - SHADING_F0) * pow(saturate(1.0f - v_dot_h), 5.0f);
+#else
+    float fresnel = SHADING_F0;
+#endif
+    color += SpecularBrdf(n_dot_l, n_dot_v, n_dot_h, alpha) * fresnel * PI * n_dot_l;
+#endif
+    color *= light_color;
+#if SHADING_FEATURES & SHADING_FEATURE_AMBIENT
+    color += albedo * SHADING_AMBIENT;
+#endif
+    return color;
+}
+
+#endif
@@ -0,0 +1,96 @@
+#include <StorageBenchmark.h>
+
+#include <Assertions.h>
+
+#include <imgui.h>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <random>
+
+// ---------- Storage Benchmark ----------
+
+static StorageBenchmarkResult MeasureStorage(const std::vector<ImGuiID>& keys, const std::vector<ImGuiID>& lookups, bool hash_mode, bool incremental_insert)
+{
+    ImGuiStorage storage{};
+    storage.SetHashMode(hash_mode);
+
+    auto insert_begin{ std::chrono::steady_clock::now() };
+    if (incremental_insert)
+    {
+        for (ImGuiID key : keys)
+        {
+            storage.SetInt(key, static_cast<int>(key));
+        }
+    }
+    else
+    {
+        storage.Data.reserve(static_cast<int>(keys.size()));
+        for (ImGuiID key : keys)
+        {
+            storage.Data.push_back(ImGuiStoragePair{ key, static_cast<int>(key) });
+        }
+        storage.BuildSortByKey();
+    }
+    auto insert_end{ std::chrono::steady_clock::now() };
+
+    double best_ns{ std::numeric_limits<double>::max() };
+    int sink{};
+    for (int repetition{}; repetition < 3; repetition++)
+    {
+        auto begin{ std::chrono::steady_clock::now() };
+        for (ImGuiID key : lookups)
+        {
+            sink += storage.GetInt(key, -1);
+        }
+        auto end{ std::chrono::steady_clock::now() };
+        best_ns = std::min(best_ns, std::chrono::duration<double, std::nano>(end - begin).count());
+    }
+    // keep the lookups from being optimized away
+    volatile int keep{ sink };
+    (void)keep;
+
+    Check(storage.Data.Size == static_cast<int>(keys.size()));
+
+    StorageBenchmarkResult result{};
+    result.key_count = static_cast<std::uint32_t>(keys.size());
+    result.hash_mode = hash_mode;
+    result.incremental_insert = incremental_insert;
+    result.insert_ms = std::chrono::duration<double, std::milli>(insert_end - insert_begin).count();
+    result.lookup_ns = best_ns / static_cast<double>(lookups.size());
+    result.bytes = static_cast<std::size_t>(storage.Data.size_in_bytes() + storage.HashSlots.size_in_bytes());
+    return result;
+}
+
+std::vector<StorageBenchmarkResult> RunStorageBenchmark(std::span<const std::uint32_t> key_counts, std::uint32_t sorted_insert_limit, std::uint32_t seed)
+{
+    std::mt19937 rng{ seed };
+
+    std::vector<StorageBenchmarkResult> results{};
+    for (std::uint32_t key_count : key_counts)
+    {
+        Check(key_count > 0);
+
+        // distinct random keys
+        std::vector<ImGuiID> keys{};
+        keys.reserve(key_count);
+        while (keys.size() < key_count)
+        {
+            keys.emplace_back(static_cast<ImGuiID>(rng()));
+            if (keys.size() == key_count)
+            {
+                std::sort(keys.begin(), keys.end());
+                keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+            }
+        }
+        std::shuffle(keys.begin(), keys.end(), rng);
+
+        std::vector<ImGuiID> lookups{ keys };
+        std::shuffle(lookups.begin(), lookups.end(), rng);
+
+        results.emplace_back(MeasureStorage(keys, lookups, false, key_count <= sorted_insert_limit));
+        results.emplace_back(MeasureStorage(keys, lookups, true, true));
+    }
+    return results;
+}
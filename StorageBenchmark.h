@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// ---------- Storage Benchmark ----------
+
+struct StorageBenchmarkResult
+{
+    std::uint32_t key_count;
+    bool hash_mode;
+    bool incremental_insert; // false when sorted insertion was too slow to measure and the storage was built with BuildSortByKey() instead
+    double insert_ms; // all keys
+    double lookup_ns; // per lookup, fastest repetition
+    std::size_t bytes; // pairs and hash index
+};
+
+/*
+    compares ImGuiStorage sorted mode (binary search, memmove insertions) and hash mode
+    keys are random like the ids ImGui derives from labels, inserted one at a time with SetInt() and looked up in a different random order
+    sorted insertion is quadratic; above sorted_insert_limit keys it is replaced by a bulk build
+*/
+std::vector<StorageBenchmarkResult> RunStorageBenchmark(std::span<const std::uint32_t> key_counts, std::uint32_t sorted_insert_limit, std::uint32_t seed);
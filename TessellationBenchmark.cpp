@@ -0,0 +1,145 @@
+#include <TessellationBenchmark.h>
+
+#include <Assertions.h>
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numbers>
+#include <random>
+
+// ---------- Tessellation Benchmark ----------
+
+static constexpr std::uint32_t POINTS_PER_CALL{ 8192 };
+
+const char* TessellationShapeName(TessellationShape shape)
+{
+    switch (shape)
+    {
+    case TessellationShape::ThinLine: return "Thin line";
+    case TessellationShape::ThickLine: return "Thick line";
+    case TessellationShape::TexturedLine: return "Textured line";
+    case TessellationShape::ConvexFill: return "Convex fill";
+    default: Unreachable();
+    }
+}
+
+const char* TessellationBackendName()
+{
+    return ImDrawListGetTessellationBackendName();
+}
+
+static std::vector<ImVec2> GenerateShapePoints(TessellationShape shape, std::uint32_t point_count, std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> jitter{ -2.0f, 2.0f };
+    std::uniform_int_distribution<std::uint32_t> repeat{ 0, 63 };
+
+    std::vector<ImVec2> points(point_count);
+    for (std::uint32_t i{}; i < point_count; i++)
+    {
+        std::uint32_t call_point{ i % POINTS_PER_CALL };
+        auto t{ static_cast<float>(call_point) / static_cast<float>(POINTS_PER_CALL) };
+        if (shape == TessellationShape::ConvexFill)
+        {
+            float angle{ 2.0f * std::numbers::pi_v<float> * t };
+            points[i] = ImVec2{ 400.0f + 300.0f * std::cos(angle), 400.0f + 300.0f * std::sin(angle) };
+        }
+        else if (call_point > 0 && repeat(rng) == 0)
+        {
+            points[i] = points[i - 1]; // zero-length segment
+        }
+        else
+        {
+            points[i] = ImVec2{ 20.0f + 1200.0f * t, 400.0f + 200.0f * std::sin(40.0f * t) + jitter(rng) };
+        }
+    }
+    return points;
+}
+
+static double Tessellate(ImDrawList* draw_list, TessellationShape shape, const std::vector<ImVec2>& points, bool simd)
+{
+    draw_list->_ResetForNewFrame();
+    draw_list->PushClipRectFullScreen();
+    draw_list->PushTexture(draw_list->_Data->FontAtlas->TexRef);
+
+    ImDrawListFlags flags{ ImDrawListFlags_AllowVtxOffset };
+    flags |= shape == TessellationShape::ConvexFill ? ImDrawListFlags_AntiAliasedFill : ImDrawListFlags_AntiAliasedLines;
+    flags |= shape == TessellationShape::TexturedLine ? ImDrawListFlags_AntiAliasedLinesUseTex : ImDrawListFlags_None;
+    flags |= simd ? ImDrawListFlags_None : ImDrawListFlags_NoSimdTessellation;
+    draw_list->Flags = flags;
+
+    ImU32 col{ IM_COL32(255, 190, 80, 255) };
+    auto begin{ std::chrono::steady_clock::now() };
+    for (std::size_t first{}, call{}; first < points.size(); first += POINTS_PER_CALL, call++)
+    {
+        auto count{ static_cast<int>(std::min<std::size_t>(POINTS_PER_CALL, points.size() - first)) };
+        ImDrawFlags closed{ call % 2 == 1 ? ImDrawFlags_Closed : ImDrawFlags_None };
+        switch (shape)
+        {
+        case TessellationShape::ThinLine: { draw_list->AddPolyline(points.data() + first, count, col, closed, 1.0f); } break;
+        case TessellationShape::ThickLine: { draw_list->AddPolyline(points.data() + first, count, col, closed, 3.5f); } break;
+        case TessellationShape::TexturedLine: { draw_list->AddPolyline(points.data() + first, count, col, closed, 2.0f); } break;
+        case TessellationShape::ConvexFill: { draw_list->AddConvexPolyFilled(points.data() + first, count, col); } break;
+        default: { Unreachable(); } break;
+        }
+    }
+    auto end{ std::chrono::steady_clock::now() };
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+static std::uint32_t CountMismatches(const ImDrawList& a, const ImDrawList& b)
+{
+    if (a.VtxBuffer.Size != b.VtxBuffer.Size || a.IdxBuffer.Size != b.IdxBuffer.Size)
+    {
+        return std::numeric_limits<std::uint32_t>::max();
+    }
+
+    std::uint32_t mismatches{};
+    for (int i{}; i < a.VtxBuffer.Size; i++)
+    {
+        mismatches += std::memcmp(&a.VtxBuffer[i], &b.VtxBuffer[i], sizeof(ImDrawVert)) != 0 ? 1 : 0;
+    }
+    for (int i{}; i < a.IdxBuffer.Size; i++)
+    {
+        mismatches += a.IdxBuffer[i] != b.IdxBuffer[i] ? 1 : 0;
+    }
+    return mismatches;
+}
+
+std::vector<TessellationBenchmarkResult> RunTessellationBenchmark(std::span<const std::uint32_t> point_counts, std::uint32_t repetitions, std::uint32_t seed)
+{
+    Check(repetitions > 0);
+
+    std::mt19937 rng{ seed };
+    ImDrawList scalar_list{ ImGui::GetDrawListSharedData() };
+    ImDrawList simd_list{ ImGui::GetDrawListSharedData() };
+
+    std::vector<TessellationBenchmarkResult> results{};
+    for (std::uint32_t point_count : point_counts)
+    {
+        for (std::uint32_t shape_index{}; shape_index < static_cast<std::uint32_t>(TessellationShape::Count); shape_index++)
+        {
+            auto shape{ static_cast<TessellationShape>(shape_index) };
+            std::vector<ImVec2> points{ GenerateShapePoints(shape, point_count, rng) };
+
+            TessellationBenchmarkResult result{};
+            result.shape = shape;
+            result.point_count = point_count;
+            result.scalar_ms = std::numeric_limits<double>::max();
+            result.simd_ms = std::numeric_limits<double>::max();
+            for (std::uint32_t repetition{}; repetition < repetitions; repetition++)
+            {
+                result.scalar_ms = std::min(result.scalar_ms, Tessellate(&scalar_list, shape, points, false));
+                result.simd_ms = std::min(result.simd_ms, Tessellate(&simd_list, shape, points, true));
+            }
+            result.mismatches = CountMismatches(scalar_list, simd_list);
+            results.emplace_back(result);
+        }
+    }
+    return results;
+}
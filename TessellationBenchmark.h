@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// ---------- Tessellation Benchmark ----------
+
+enum class TessellationShape : std::uint32_t
+{
+    ThinLine = 0, // AddPolyline, 1 px anti-aliased
+    ThickLine = 1, // AddPolyline, 3.5 px anti-aliased
+    TexturedLine = 2, // AddPolyline, 2 px anti-aliased through the baked line texture
+    ConvexFill = 3, // AddConvexPolyFilled, anti-aliased
+    Count,
+};
+
+const char* TessellationShapeName(TessellationShape shape);
+
+// instruction set of the ImDrawList SIMD tessellation, "Scalar" when it is not compiled in
+const char* TessellationBackendName();
+
+struct TessellationBenchmarkResult
+{
+    TessellationShape shape;
+    std::uint32_t point_count;
+    double scalar_ms; // fastest repetition
+    double simd_ms; // fastest repetition
+    std::uint32_t mismatches; // vertices and indices that differ between the two paths, expected to be 0
+};
+
+/*
+    tessellates point_count points per shape with the scalar and the SIMD ImDrawList paths and compares their output
+    lines are noisy curves with some zero-length segments, fills are circles; half the lines are closed
+    points are submitted in calls of at most 8192 points, which keeps every call under the 64K vertices 16-bit indices can address
+    requires an ImGui frame in progress
+*/
+std::vector<TessellationBenchmarkResult> RunTessellationBenchmark(std::span<const std::uint32_t> point_counts, std::uint32_t repetitions, std::uint32_t seed);
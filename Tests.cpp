@@ -0,0 +1,962 @@
+#include <Assertions.h>
+#include <FramebufferSizing.h>
+#include <FramePacing.h>
+#include <ImGuiAllocator.h>
+#include <PipelineState.h>
+#include <ShaderHotReload.h>
+
+#include <imgui.h>
+#include <imgui_impl_software.h>
+#include <imgui_impl_streaming.h>
+#include <imgui_internal.h> // for ImTextureData
+
+#include <array> // for std::size
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <stdexcept>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*
+    platform independent unit tests, built by Tests.vcxproj
+    every test throws through Check on failure; the exit code is the number of failed tests
+*/
+
+// ---------- Framebuffer Sizing ----------
+
+static void TestRoundUpToBucket()
+{
+    Check(RoundUpToBucket(0, 256) == 256); // never 0, the framebuffer can't be empty
+    Check(RoundUpToBucket(1, 256) == 256);
+    Check(RoundUpToBucket(255, 256) == 256);
+    Check(RoundUpToBucket(256, 256) == 256);
+    Check(RoundUpToBucket(257, 256) == 512);
+    Check(RoundUpToBucket(512, 256) == 512);
+    Check(RoundUpToBucket(513, 256) == 768);
+    Check(RoundUpToBucket(0, 1) == 1);
+    Check(RoundUpToBucket(7, 1) == 7);
+    Check(RoundUpToBucket(7, 3) == 9);
+}
+
+static void TestResizeBucketPolicyBuckets()
+{
+    ResizeBucketPolicy policy{ { 800, 600 }, 256, 0.5 };
+    Check(policy.Allocation() == (Extent2D{ 1024, 768 }));
+    Check(policy.Viewport() == (Extent2D{ 800, 600 }));
+    Check(policy.Bucket({ 0, 0 }) == (Extent2D{ 256, 256 }));
+    Check(policy.Bucket({ 256, 512 }) == (Extent2D{ 256, 512 }));
+    Check(policy.Bucket({ 257, 513 }) == (Extent2D{ 512, 768 }));
+    Check(!policy.Update(0.0));
+    Check(policy.Reallocations() == 0);
+}
+
+static void TestResizeBucketPolicyGrowsImmediately()
+{
+    ResizeBucketPolicy policy{ { 800, 600 }, 256, 0.5 };
+
+    // within the bucket: only the viewport changes
+    policy.RequestResize({ 1024, 768 }, 1.0);
+    Check(!policy.Update(1.0));
+    Check(policy.Allocation() == (Extent2D{ 1024, 768 }));
+
+    // one past the bucket, in a single dimension: only that dimension grows, in the same frame
+    policy.RequestResize({ 1025, 700 }, 1.1);
+    Check(policy.Update(1.1));
+    Check(policy.Allocation() == (Extent2D{ 1280, 768 }));
+    Check(!policy.Update(1.1));
+
+    // growing one dimension while the other shrinks keeps the larger allocation until the delay passes
+    policy.RequestResize({ 1400, 300 }, 1.2);
+    Check(policy.Update(1.2));
+    Check(policy.Allocation() == (Extent2D{ 1536, 768 }));
+    Check(policy.Reallocations() == 2);
+    Check(policy.ResizeRequests() == 3);
+}
+
+static void TestResizeBucketPolicyShrinksAfterDelay()
+{
+    ResizeBucketPolicy policy{ { 1000, 1000 }, 256, 0.5 };
+
+    policy.RequestResize({ 500, 500 }, 1.0);
+    Check(!policy.Update(1.0));
+    Check(!policy.Update(1.49));
+    Check(policy.Allocation() == (Extent2D{ 1024, 1024 }));
+    Check(policy.Update(1.5));
+    Check(policy.Allocation() == (Extent2D{ 512, 512 }));
+    Check(!policy.Update(2.0));
+    Check(policy.Reallocations() == 1);
+}
+
+static void TestResizeBucketPolicyShrinkTimerResets()
+{
+    ResizeBucketPolicy policy{ { 1000, 1000 }, 256, 0.5 };
+
+    // a burst of requests: each one restarts the delay
+    policy.RequestResize({ 500, 500 }, 1.0);
+    Check(!policy.Update(1.0));
+    policy.RequestResize({ 450, 450 }, 1.4);
+    Check(!policy.Update(1.5));
+    Check(!policy.Update(1.89));
+    Check(policy.Update(1.9));
+    Check(policy.Allocation() == (Extent2D{ 512, 512 }));
+
+    // shrinking, then growing back into the allocation before the delay: nothing to do, and the timer restarts
+    policy.RequestResize({ 200, 200 }, 3.0);
+    Check(!policy.Update(3.2));
+    policy.RequestResize({ 500, 500 }, 3.3);
+    Check(!policy.Update(3.3));
+    policy.RequestResize({ 200, 200 }, 3.4);
+    Check(!policy.Update(3.6)); // 0.6 s after the first shrink request, but only 0.2 s after the last one
+    Check(policy.Allocation() == (Extent2D{ 512, 512 }));
+    Check(policy.Update(3.9));
+    Check(policy.Allocation() == (Extent2D{ 256, 256 }));
+    Check(policy.Reallocations() == 2);
+}
+
+// ---------- Frame Pacing ----------
+
+// time only moves when the limiter sleeps or spins, or when a test simulates work
+class MockFrameClock : public FrameClock
+{
+public:
+    explicit MockFrameClock(std::int64_t spin_step) : m_now{}, m_spin_step{ spin_step }, m_oversleep{}, m_slept{}, m_sleep_count{}, m_spin_count{} {}
+public:
+    std::int64_t NowNanoseconds() override { return m_now; }
+    void SleepNanoseconds(std::int64_t duration) override
+    {
+        Check(duration > 0);
+        m_now += duration + m_oversleep;
+        m_slept += duration;
+        m_sleep_count++;
+    }
+    void SpinOnce() override
+    {
+        m_now += m_spin_step;
+        m_spin_count++;
+    }
+public:
+    void Advance(std::int64_t duration) { m_now += duration; }
+    void SetOversleep(std::int64_t oversleep) { m_oversleep = oversleep; }
+    // requested sleep time, sleeps and spins since the previous call
+    std::int64_t TakeSlept() { return std::exchange(m_slept, 0); }
+    std::uint32_t TakeSleepCount() { return std::exchange(m_sleep_count, 0); }
+    std::uint32_t TakeSpinCount() { return std::exchange(m_spin_count, 0); }
+private:
+    std::int64_t m_now;
+    std::int64_t m_spin_step;
+    std::int64_t m_oversleep;
+    std::int64_t m_slept;
+    std::uint32_t m_sleep_count;
+    std::uint32_t m_spin_count;
+};
+
+constexpr std::int64_t MS{ 1'000'000 };
+
+static void TestFrameLimiterDeadlineCarryOver()
+{
+    MockFrameClock clock{ 1'000 };
+    FrameLimiter limiter{ &clock, 2 * MS };
+
+    // the first frame starts pacing; each following frame ends on a multiple of the 10 ms period
+    limiter.Wait(100.0);
+    Check(clock.NowNanoseconds() == 0);
+    for (std::int64_t frame{ 1 }; frame <= 5; frame++)
+    {
+        clock.Advance(3 * MS); // work
+        limiter.Wait(100.0);
+        Check(clock.NowNanoseconds() == frame * 10 * MS);
+    }
+
+    // a frame that overruns its deadline by less than a period does not move the following deadlines
+    clock.Advance(14 * MS);
+    limiter.Wait(100.0);
+    Check(clock.NowNanoseconds() == 64 * MS);
+    clock.Advance(3 * MS);
+    limiter.Wait(100.0);
+    Check(clock.NowNanoseconds() == 70 * MS);
+
+    // neither does oversleeping, as long as the spin threshold absorbs it
+    clock.SetOversleep(MS);
+    clock.Advance(3 * MS);
+    limiter.Wait(100.0);
+    Check(clock.NowNanoseconds() == 80 * MS);
+}
+
+static void TestFrameLimiterCatchUpReset()
+{
+    MockFrameClock clock{ 1'000 };
+    FrameLimiter limiter{ &clock, 2 * MS };
+    limiter.Wait(100.0);
+    clock.Advance(3 * MS);
+    limiter.Wait(100.0);
+    Check(clock.NowNanoseconds() == 10 * MS); // next deadline at 20 ms
+
+    // more than a period past the deadline: pacing restarts from now instead of rushing the following frames
+    clock.Advance(25 * MS);
+    clock.TakeSleepCount();
+    clock.TakeSpinCount();
+    limiter.Wait(100.0);
+    Check(clock.NowNanoseconds() == 35 * MS);
+    Check(clock.TakeSleepCount() == 0);
+    Check(clock.TakeSpinCount() == 0);
+    clock.Advance(3 * MS);
+    limiter.Wait(100.0);
+    Check(clock.NowNanoseconds() == 45 * MS);
+
+    // Reset restarts pacing the same way
+    clock.Advance(3 * MS);
+    limiter.Reset();
+    limiter.Wait(100.0);
+    Check(clock.NowNanoseconds() == 48 * MS);
+    clock.Advance(3 * MS);
+    limiter.Wait(100.0);
+    Check(clock.NowNanoseconds() == 58 * MS);
+}
+
+static void TestFrameLimiterSpinThreshold()
+{
+    constexpr std::int64_t SPIN_STEP{ 10'000 };
+    MockFrameClock clock{ SPIN_STEP };
+    FrameLimiter limiter{ &clock, 2 * MS };
+    limiter.Wait(100.0);
+
+    // a long wait sleeps until the threshold and spins the rest
+    clock.Advance(3 * MS);
+    limiter.Wait(100.0);
+    Check(clock.NowNanoseconds() == 10 * MS);
+    Check(clock.TakeSleepCount() == 1);
+    Check(clock.TakeSlept() == 5 * MS);
+    Check(clock.TakeSpinCount() == 2 * MS / SPIN_STEP);
+
+    // a wait within the threshold only spins
+    clock.Advance(9 * MS);
+    limiter.Wait(100.0);
+    Check(clock.NowNanoseconds() == 20 * MS);
+    Check(clock.TakeSleepCount() == 0);
+    Check(clock.TakeSpinCount() == MS / SPIN_STEP);
+
+    // with no threshold, the sleep covers the whole wait and there is nothing left to spin
+    MockFrameClock sleep_clock{ SPIN_STEP };
+    FrameLimiter sleep_limiter{ &sleep_clock, 0 };
+    sleep_limiter.Wait(100.0);
+    sleep_clock.Advance(3 * MS);
+    sleep_limiter.Wait(100.0);
+    Check(sleep_clock.NowNanoseconds() == 10 * MS);
+    Check(sleep_clock.TakeSlept() == 7 * MS);
+    Check(sleep_clock.TakeSpinCount() == 0);
+}
+
+// ---------- ImGui Allocator ----------
+
+// marks the textures of a frame as handled, as a renderer backend does
+static void UpdateTexturesHeadless(ImDrawData* draw_data)
+{
+    for (ImTextureData* tex : *draw_data->Textures)
+    {
+        if (tex->Status == ImTextureStatus_WantCreate || tex->Status == ImTextureStatus_WantUpdates)
+        {
+            tex->SetTexID(static_cast<ImTextureID>(tex->UniqueID));
+            tex->SetStatus(ImTextureStatus_OK);
+        }
+        else if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
+        {
+            tex->SetTexID(ImTextureID_Invalid);
+            tex->SetStatus(ImTextureStatus_Destroyed);
+        }
+    }
+}
+
+// a frame of the kind of UI the BRDFs panels build: widgets, formatted text, a clipped table, draw list channels
+static void BuildSteadyFrame(int frame)
+{
+    ImGui::Begin("Panels");
+    if (ImGui::CollapsingHeader("Widgets", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        static float value{ 0.5f };
+        static int choice{};
+        static bool enabled{ true };
+        const char* choices[]{ "Reinhard", "ACES", "AgX" };
+        ImGui::SliderFloat("Value", &value, 0.0f, 1.0f);
+        ImGui::Combo("Choice", &choice, choices, static_cast<int>(std::size(choices)));
+        ImGui::Checkbox("Enabled", &enabled);
+        ImGui::Text("Frame %d: %.3f ms", frame % 100, 16.6f + static_cast<float>(frame % 7));
+        float samples[64]{};
+        for (int i{}; i < 64; i++)
+        {
+            samples[i] = static_cast<float>((i * 7 + frame) % 13);
+        }
+        ImGui::PlotLines("Samples", samples, 64);
+    }
+    if (ImGui::BeginTable("Items", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable, ImVec2{ 0.0f, 200.0f }))
+    {
+        ImGui::TableSetupColumn("Id");
+        ImGui::TableSetupColumn("Name");
+        ImGui::TableSetupColumn("Value");
+        ImGui::TableHeadersRow();
+        ImGuiListClipper clipper{};
+        clipper.Begin(10'000);
+        while (clipper.Step())
+        {
+            for (int row{ clipper.DisplayStart }; row < clipper.DisplayEnd; row++)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::Text("%d", row);
+                ImGui::TableNextColumn(); ImGui::Text("Item %d", row);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", static_cast<float>(row) * 0.5f);
+            }
+        }
+        ImGui::EndTable();
+    }
+    {
+        ImDrawList* draw_list{ ImGui::GetWindowDrawList() };
+        ImVec2 origin{ ImGui::GetCursorScreenPos() };
+        draw_list->ChannelsSplit(2);
+        draw_list->ChannelsSetCurrent(1);
+        draw_list->AddCircleFilled(ImVec2{ origin.x + 20.0f, origin.y + 20.0f }, 10.0f, IM_COL32(255, 0, 0, 255));
+        draw_list->ChannelsSetCurrent(0);
+        draw_list->AddRectFilled(origin, ImVec2{ origin.x + 40.0f, origin.y + 40.0f }, IM_COL32(0, 0, 255, 255));
+        draw_list->ChannelsMerge();
+        ImGui::Dummy(ImVec2{ 40.0f, 40.0f });
+    }
+    ImGui::End();
+
+    // frame-local text formatted in the arena, as the allocation overlay does
+    ImGuiTextBuffer text{};
+    {
+        ImGuiAllocatorArenaScope arena_scope{};
+        text.appendf("Frame %d\n", frame % 100);
+        text.appendf("Allocations: %u", static_cast<unsigned>(frame * 3));
+    }
+    ImGui::Begin("Overlay", nullptr, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings);
+    ImGui::TextUnformatted(text.begin(), text.end());
+    ImGui::End();
+}
+
+static void* MallocWrapper(std::size_t size, void*) { return std::malloc(size); }
+static void FreeWrapper(void* ptr, void*) { std::free(ptr); }
+
+static void TestImGuiAllocatorSteadyFrames()
+{
+    // input repeats every INPUT_PERIOD frames: once warm, buffers have grown to the largest frame and only churn is left
+    constexpr int INPUT_PERIOD{ 120 };
+    constexpr int WARM_UP_FRAMES{ 2 * INPUT_PERIOD };
+    constexpr int STEADY_FRAMES{ 5 * INPUT_PERIOD };
+
+    // the allocator outlives the context
+    ImGuiAllocator allocator{};
+    ImGui::SetAllocatorFunctions(ImGuiAllocator::ImGuiAlloc, ImGuiAllocator::ImGuiFree, &allocator);
+    ImGui::CreateContext();
+    ImGuiIO& io{ ImGui::GetIO() };
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2{ 1280.0f, 720.0f };
+    io.DeltaTime = 1.0f / 60.0f;
+    io.ConfigInputTrickleEventQueue = false; // one mouse move and one wheel event every frame, all applied within the frame
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+
+    std::uint32_t steady_heap_allocations{};
+    std::uint32_t steady_pool_allocations{};
+    std::uint32_t steady_arena_allocations{};
+    for (int frame{}; frame < WARM_UP_FRAMES + STEADY_FRAMES; frame++)
+    {
+        allocator.NewFrame();
+        if (frame > WARM_UP_FRAMES)
+        {
+            // statistics of the previous frame, a steady one
+            ImGuiAllocatorFrameStats stats{ allocator.Stats().last_frame };
+            steady_heap_allocations += stats.heap_allocations;
+            steady_pool_allocations += stats.allocations - stats.arena_allocations;
+            steady_arena_allocations += stats.arena_allocations;
+        }
+
+        // sweep the mouse over the panels, so that hovering and scrolling state changes every frame
+        const int step{ frame % INPUT_PERIOD };
+        io.AddMousePosEvent(static_cast<float>(step * 8), static_cast<float>(step * 5));
+        io.AddMouseWheelEvent(0.0f, step < INPUT_PERIOD / 2 ? -1.0f : 1.0f);
+        ImGui::NewFrame();
+        BuildSteadyFrame(frame);
+        ImGui::Render();
+        UpdateTexturesHeadless(ImGui::GetDrawData());
+    }
+
+    ImGui::DestroyContext();
+    ImGui::SetAllocatorFunctions(MallocWrapper, FreeWrapper);
+
+    std::printf("%d steady frames: %u heap allocations, %u allocations outside the arena\n", STEADY_FRAMES, steady_heap_allocations, steady_pool_allocations);
+    Check(steady_heap_allocations == 0);
+    Check(steady_pool_allocations == 0);
+    Check(steady_arena_allocations > 0); // the overlay text went through the arena
+}
+
+// ---------- Shader Hot Reload ----------
+
+// empty directory under the system temporary directory, removed when the test ends
+class TempDirectory
+{
+public:
+    explicit TempDirectory(const char* name) : m_path{ std::filesystem::temp_directory_path() / "BRDFsTests" / name }
+    {
+        std::filesystem::remove_all(m_path);
+        std::filesystem::create_directories(m_path);
+    }
+    ~TempDirectory()
+    {
+        std::error_code ec{};
+        std::filesystem::remove_all(m_path, ec);
+    }
+    TempDirectory(const TempDirectory&) = delete;
+    TempDirectory(TempDirectory&&) noexcept = delete;
+    TempDirectory& operator=(const TempDirectory&) = delete;
+    TempDirectory& operator=(TempDirectory&&) noexcept = delete;
+public:
+    const std::filesystem::path& Path() const noexcept { return m_path; }
+private:
+    std::filesystem::path m_path;
+};
+
+static void WriteTextFile(const std::filesystem::path& path, const std::string& text)
+{
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream file{ path, std::ios::binary | std::ios::trunc };
+    file << text;
+    Check(file);
+}
+
+// polls condition until it holds, for the reload thread; false after a few seconds
+template<typename Condition>
+static bool WaitUntil(Condition condition)
+{
+    auto deadline{ std::chrono::steady_clock::now() + std::chrono::seconds{ 5 } };
+    while (!condition())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+    }
+    return true;
+}
+
+static std::string BytecodeText(const ShaderBytecode& bytecode)
+{
+    return { bytecode->begin(), bytecode->end() };
+}
+
+static void TestLoadShaderSourceIncludes()
+{
+    TempDirectory directory{ "ShaderIncludes" };
+    const std::filesystem::path& root{ directory.Path() };
+    WriteTextFile(root / "main.hlsl", "#include \"common.hlsli\"\n  #  include \"lighting/brdf.hlsli\"\n#include <system.h>\nmain\n");
+    WriteTextFile(root / "common.hlsli", "common\n");
+    WriteTextFile(root / "lighting" / "brdf.hlsli", "#include \"../common.hlsli\"\nbrdf\n");
+
+    // includes in the order they appear, relative to the including file, each once; <> includes are not followed
+    ShaderSource source{};
+    std::string error{};
+    Check(LoadShaderSource(root / "main.hlsl", &source, &error));
+    Check(source.files.size() == 3);
+    Check(source.files[0].path == (root / "main.hlsl").lexically_normal());
+    Check(source.files[1].path == (root / "common.hlsli").lexically_normal());
+    Check(source.files[2].path == (root / "lighting" / "brdf.hlsli").lexically_normal());
+    Check(source.files[2].text == "#include \"../common.hlsli\"\nbrdf\n");
+
+    // the hash covers the includes
+    std::uint64_t hash{ source.hash };
+    Check(LoadShaderSource(root / "main.hlsl", &source, &error));
+    Check(source.hash == hash);
+    WriteTextFile(root / "common.hlsli", "common changed\n");
+    Check(LoadShaderSource(root / "main.hlsl", &source, &error));
+    Check(source.hash != hash);
+
+    // a missing include is named, and ends the files so that the watcher notices when it appears
+    WriteTextFile(root / "lighting" / "brdf.hlsli", "#include \"missing.hlsli\"\n");
+    Check(!LoadShaderSource(root / "main.hlsl", &source, &error));
+    Check(error.find("missing.hlsli") != std::string::npos);
+    Check(source.files.back().path == (root / "lighting" / "missing.hlsli").lexically_normal());
+    Check(source.files.back().text.empty());
+}
+
+static void TestShaderFileWatcher()
+{
+    TempDirectory directory{ "ShaderWatcher" };
+    std::filesystem::path path{ directory.Path() / "main.hlsl" };
+    WriteTextFile(path, "main\n");
+
+    ShaderFileWatcher watcher{};
+    ShaderSource source{};
+    std::string error{};
+    Check(LoadShaderSource(path, &source, &error));
+    watcher.Watch(source.files);
+    Check(!watcher.Poll());
+
+    // modify; the size changes too, so this does not depend on the write time resolution
+    WriteTextFile(path, "main modified\n");
+    Check(watcher.Poll());
+    Check(!watcher.Poll());
+
+    // delete, then create again
+    std::filesystem::remove(path);
+    Check(watcher.Poll());
+    Check(!watcher.Poll());
+    WriteTextFile(path, "main\n");
+    Check(watcher.Poll());
+    Check(!watcher.Poll());
+
+    // create a file that was missing when the sources were read
+    std::filesystem::path include_path{ directory.Path() / "include.hlsli" };
+    WriteTextFile(path, "#include \"include.hlsli\"\n");
+    Check(!LoadShaderSource(path, &source, &error));
+    watcher.Watch(source.files);
+    Check(!watcher.Poll());
+    WriteTextFile(include_path, "include\n");
+    Check(watcher.Poll());
+
+    // a file saved between reading it and Watch is reported by the next Poll
+    Check(LoadShaderSource(path, &source, &error));
+    WriteTextFile(include_path, "include saved while loading\n");
+    watcher.Watch(source.files);
+    Check(watcher.Poll());
+    Check(!watcher.Poll());
+}
+
+static void TestShaderBytecodeCache()
+{
+    TempDirectory directory{ "ShaderCache" };
+    const std::vector<std::uint8_t> bytecode{ 0x44, 0x58, 0x42, 0x43, 0x01, 0x00, 0xFF };
+    {
+        ShaderBytecodeCache cache{ directory.Path() };
+        Check(!cache.Find(1));
+        ShaderBytecode stored{ cache.Store(1, bytecode) };
+        Check(*stored == bytecode);
+        Check(cache.Find(1) == stored);
+        ShaderBytecodeCacheStats stats{ cache.Stats() };
+        Check(stats.misses == 1 && stats.stores == 1 && stats.memory_hits == 1 && stats.disk_hits == 0);
+    }
+    {
+        // a later run finds the entry on disk, then keeps it in memory
+        ShaderBytecodeCache cache{ directory.Path() };
+        ShaderBytecode found{ cache.Find(1) };
+        Check(found && *found == bytecode);
+        Check(cache.Find(1) == found);
+        Check(!cache.Find(2));
+        ShaderBytecodeCacheStats stats{ cache.Stats() };
+        Check(stats.disk_hits == 1 && stats.memory_hits == 1 && stats.misses == 1 && stats.stores == 0);
+        Check(cache.EntryCount() == 1);
+    }
+    {
+        // without a directory, entries only live in memory
+        ShaderBytecodeCache cache{ {} };
+        cache.Store(1, bytecode);
+        Check(cache.Find(1) && !cache.Find(2));
+        Check(cache.Stats().disk_hits == 0);
+    }
+}
+
+static void TestShaderHotReloadPublishing()
+{
+    TempDirectory directory{ "ShaderHotReload" };
+    std::filesystem::path path{ directory.Path() / "main.hlsl" };
+
+    // stands in for D3DCompile: the bytecode is the text of the main file, and "error" fails to compile
+    std::atomic<std::uint32_t> compile_count{};
+    ShaderCompileFunction compile{ [&](const ShaderCompileRequest& request)
+    {
+        compile_count++;
+        const std::string& text{ request.source->files.front().text };
+        if (text.find("error") != std::string::npos)
+        {
+            return ShaderCompileResult{ false, {}, "error X3000" };
+        }
+        return ShaderCompileResult{ true, { text.begin(), text.end() }, {} };
+    } };
+    const std::string built_in_text{ "built in\n" };
+    const std::vector<std::uint8_t> built_in{ built_in_text.begin(), built_in_text.end() };
+    ShaderBytecodeCache cache{ {} };
+    ShaderHotReload reload{ compile, &cache, std::chrono::milliseconds{ 5 } };
+    auto loaded{ [&](ShaderProgramHandle program) { return WaitUntil([&]() { return reload.Status(program).key != 0; }); } };
+
+    // sources unchanged since the built-in bytecode was compiled: nothing to publish, and the built-in bytecode is not cached
+    WriteTextFile(path, built_in_text);
+    ShaderProgramHandle unchanged{ reload.AddShader(path, "main", "ps_5_0", {}, built_in) };
+    Check(loaded(unchanged));
+    Check(reload.Status(unchanged).state == ShaderReloadState::Watching);
+    Check(reload.TakeReloads().empty());
+    Check(cache.Stats().stores == 1); // compiled from the sources on disk, not copied from the built-in bytecode
+
+    // sources edited since the build: the first load publishes their bytecode
+    std::filesystem::path edited_path{ directory.Path() / "edited.hlsl" };
+    WriteTextFile(edited_path, "edited\n");
+    ShaderProgramHandle edited{ reload.AddShader(edited_path, "main", "ps_5_0", {}, built_in) };
+    Check(loaded(edited));
+    std::vector<ShaderReload> reloads{ reload.TakeReloads() };
+    Check(reloads.size() == 1 && reloads[0].program == edited && BytecodeText(reloads[0].bytecode) == "edited\n");
+    Check(reload.Status(edited).state == ShaderReloadState::Compiled);
+
+    // an edit compiles, a failed edit keeps the previous bytecode, and undoing an edit comes from the cache
+    WriteTextFile(edited_path, "edited again\n");
+    Check(WaitUntil([&]() { return reload.Status(edited).reload_count == 2; }));
+    reloads = reload.TakeReloads();
+    Check(reloads.size() == 1 && BytecodeText(reloads[0].bytecode) == "edited again\n");
+    WriteTextFile(edited_path, "error\n");
+    Check(WaitUntil([&]() { return reload.Status(edited).state == ShaderReloadState::Failed; }));
+    Check(reload.TakeReloads().empty());
+    std::uint32_t compiles{ compile_count };
+    WriteTextFile(edited_path, "edited\n");
+    Check(WaitUntil([&]() { return reload.Status(edited).reload_count == 3; }));
+    Check(reload.Status(edited).state == ShaderReloadState::Cached);
+    Check(compile_count == compiles);
+    reloads = reload.TakeReloads();
+    Check(reloads.size() == 1 && BytecodeText(reloads[0].bytecode) == "edited\n");
+}
+
+// ---------- Pipeline State ----------
+
+static void TestPipelineStateHasher()
+{
+    // fields are length-delimited: the same bytes split differently give different keys
+    Check(PipelineStateHasher{}.String("ab").String("c").Key() != PipelineStateHasher{}.String("a").String("bc").Key());
+    Check(PipelineStateHasher{}.String("abc").Key() != PipelineStateHasher{}.String("ab").String("c").Key());
+    Check(PipelineStateHasher{}.String("").Key() != PipelineStateHasher{}.Key());
+    Check(PipelineStateHasher{}.String("").String("x").Key() != PipelineStateHasher{}.String("x").String("").Key());
+
+    // deterministic, and sensitive to values and their order
+    Check(PipelineStateHasher{}.String("ps_5_0").Value(1u).Key() == PipelineStateHasher{}.String("ps_5_0").Value(1u).Key());
+    Check(PipelineStateHasher{}.Value(1u).Key() != PipelineStateHasher{}.Value(2u).Key());
+    Check(PipelineStateHasher{}.Value(1u).Value(2u).Key() != PipelineStateHasher{}.Value(2u).Value(1u).Key());
+    const std::uint8_t bytes[]{ 'a', 'b' };
+    Check(PipelineStateHasher{}.Bytes(bytes).Key() == PipelineStateHasher{}.String("ab").Key());
+}
+
+static void TestPipelineStateCacheDeduplicates()
+{
+    PipelineStateCache cache{};
+    std::uint32_t creates{};
+    auto create{ [&]() { return static_cast<PipelineObjectId>(creates++); } };
+
+    PipelineStateKey key{ PipelineStateHasher{}.String("VS").Key() };
+    PipelineObjectId id{ cache.Acquire(PipelineObjectKind::VertexShader, key, create) };
+    Check(cache.Acquire(PipelineObjectKind::VertexShader, key, create) == id);
+    Check(cache.Acquire(PipelineObjectKind::VertexShader, key, create) == id);
+    Check(creates == 1);
+
+    // another key, or the same key for another kind of object, is another object
+    PipelineStateKey other_key{ PipelineStateHasher{}.String("PS").Key() };
+    Check(cache.Acquire(PipelineObjectKind::VertexShader, other_key, create) != id);
+    cache.Acquire(PipelineObjectKind::PixelShader, key, create);
+    Check(creates == 3);
+
+    PipelineCacheStats vs_stats{ cache.Stats(PipelineObjectKind::VertexShader) };
+    Check(vs_stats.objects == 2 && vs_stats.hits == 2 && vs_stats.misses == 2);
+    PipelineCacheStats ps_stats{ cache.Stats(PipelineObjectKind::PixelShader) };
+    Check(ps_stats.objects == 1 && ps_stats.hits == 0 && ps_stats.misses == 1);
+    PipelineCacheStats pipeline_stats{ cache.Stats(PipelineObjectKind::Pipeline) };
+    Check(pipeline_stats.objects == 0 && pipeline_stats.hits == 0 && pipeline_stats.misses == 0);
+}
+
+static void TestPipelineStateCacheCreateThrows()
+{
+    PipelineStateCache cache{};
+    PipelineStateKey key{ PipelineStateHasher{}.String("invalid rasterizer state").Key() };
+
+    bool thrown{};
+    try
+    {
+        cache.Acquire(PipelineObjectKind::RasterizerState, key, []() -> PipelineObjectId { throw std::runtime_error{ "E_INVALIDARG" }; });
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    Check(thrown);
+    PipelineCacheStats stats{ cache.Stats(PipelineObjectKind::RasterizerState) };
+    Check(stats.objects == 0 && stats.hits == 0 && stats.misses == 0); // no entry left behind
+
+    // the next request retries, and is then cached
+    std::uint32_t creates{};
+    auto create{ [&]() { creates++; return PipelineObjectId{ 7 }; } };
+    Check(cache.Acquire(PipelineObjectKind::RasterizerState, key, create) == 7);
+    Check(cache.Acquire(PipelineObjectKind::RasterizerState, key, create) == 7);
+    Check(creates == 1);
+    stats = cache.Stats(PipelineObjectKind::RasterizerState);
+    Check(stats.objects == 1 && stats.hits == 1 && stats.misses == 1);
+}
+
+static void TestShaderBytecodeCacheDiskRoundTrip()
+{
+    TempDirectory directory{ "PipelineBytecode" };
+    const std::string source{ "float4 main() : SV_Target { return 1; }" };
+    const std::vector<std::uint8_t> bytecode{ 0x44, 0x58, 0x42, 0x43, 0x00, 0x0A, 0x0D, 0x1A, 0xFF };
+    PipelineStateKey key{ PipelineStateHasher{}.String(source).String("main").String("ps_5_0").Key() };
+    {
+        ShaderBytecodeCache cache{ directory.Path() };
+        cache.Store(key, bytecode);
+    }
+
+    // one complete file per entry, and no temporary file left behind
+    std::uint32_t files{};
+    for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator{ directory.Path() })
+    {
+        Check(entry.path().extension() == ".cso");
+        Check(entry.file_size() == bytecode.size());
+        files++;
+    }
+    Check(files == 1);
+
+    // a later run reads back the same bytes, binary-safe
+    ShaderBytecodeCache cache{ directory.Path() };
+    ShaderBytecode found{ cache.Find(key) };
+    Check(found && *found == bytecode);
+    Check(cache.Stats().disk_hits == 1);
+    Check(!cache.Find(PipelineStateHasher{}.String(source).String("main").String("vs_5_0").Key()));
+}
+
+// ---------- Streaming Ring ----------
+
+static void TestStreamingRingAppends()
+{
+    ImGui_ImplStreamingRing ring{ 64 };
+    Check(ring.EnsureCapacity(10)); // no buffer yet
+    Check(ring.Capacity == 64);
+
+    // a new buffer is discarded, then every allocation appends after the previous one without overwriting
+    ImGui_ImplStreamingAllocation alloc{ ring.Allocate(10) };
+    Check(alloc.Offset == 0 && alloc.Discard);
+    for (int count : { 5, 1, 12, 7 })
+    {
+        int head{ ring.Head };
+        Check(!ring.EnsureCapacity(count));
+        alloc = ring.Allocate(count);
+        Check(alloc.Offset == head && !alloc.Discard);
+        Check(ring.Head == head + count);
+    }
+    Check(ring.DiscardCount == 1 && ring.NoOverwriteCount == 4 && ring.GrowCount == 1);
+}
+
+static void TestStreamingRingWraps()
+{
+    ImGui_ImplStreamingRing ring{ 64 };
+    ring.EnsureCapacity(20);
+    ring.Allocate(20);
+    Check(!ring.Allocate(20).Discard);
+    Check(!ring.Allocate(20).Discard);
+    Check(ring.Head == 60);
+
+    // the next 20 elements do not fit before the end: wrap to the start and discard
+    ImGui_ImplStreamingAllocation alloc{ ring.Allocate(20) };
+    Check(alloc.Offset == 0 && alloc.Discard);
+    Check(ring.Head == 20);
+
+    // an allocation that ends exactly at the end of the buffer still appends
+    alloc = ring.Allocate(44);
+    Check(alloc.Offset == 20 && !alloc.Discard);
+    Check(ring.Allocate(1).Discard);
+    Check(ring.Capacity == 64 && ring.GrowCount == 1 && ring.DiscardCount == 3);
+}
+
+static void TestStreamingRingGrows()
+{
+    ImGui_ImplStreamingRing ring{ 64 };
+    ring.EnsureCapacity(10);
+    ring.Allocate(10);
+
+    // a frame larger than half the buffer recreates it, doubled until two such frames fit
+    Check(ring.EnsureCapacity(100));
+    Check(ring.Capacity == 256 && ring.Head == 0 && ring.GrowCount == 2);
+    ImGui_ImplStreamingAllocation alloc{ ring.Allocate(100) };
+    Check(alloc.Offset == 0 && alloc.Discard);
+    Check(!ring.EnsureCapacity(100));
+    Check(!ring.Allocate(100).Discard);
+
+    // a UI that keeps growing recreates the buffer a logarithmic number of times
+    ImGui_ImplStreamingRing growing{ 64 };
+    for (int count{ 1 }; count <= 100'000; count += 97)
+    {
+        growing.EnsureCapacity(count);
+        Check(growing.Allocate(count).Offset + count <= growing.Capacity);
+    }
+    Check(growing.GrowCount <= 14);
+    Check(growing.Capacity >= 200'000 && growing.Capacity < 400'000);
+
+    // after Reset, e.g. a lost device, a new buffer is created and discarded
+    growing.Reset();
+    Check(growing.EnsureCapacity(1));
+    Check(growing.Allocate(1).Discard);
+}
+
+static void TestStreamingRingZeroSizeFrames()
+{
+    // a frame with nothing to draw still gets a buffer to map
+    ImGui_ImplStreamingRing ring{ 64 };
+    Check(ring.EnsureCapacity(0));
+    Check(ring.Capacity == 64);
+    ImGui_ImplStreamingAllocation alloc{ ring.Allocate(0) };
+    Check(alloc.Offset == 0 && alloc.Discard);
+
+    // and neither moves the head nor discards the frames in flight
+    ring.Allocate(30);
+    Check(!ring.EnsureCapacity(0));
+    alloc = ring.Allocate(0);
+    Check(alloc.Offset == 30 && !alloc.Discard);
+    Check(ring.Head == 30);
+    alloc = ring.Allocate(30);
+    Check(alloc.Offset == 30 && !alloc.Discard);
+}
+
+static void TestStreamingRingOffsetAlignment()
+{
+    // offsets count elements: the backend writes through typed pointers and draws with BaseVertexLocation/StartIndexLocation,
+    // so every frame starts on an element boundary, inside the buffer, and right after the previous frame unless it discards
+    ImGui_ImplStreamingRing vertex_ring{ 8192 };
+    ImGui_ImplStreamingRing index_ring{ 16384 };
+    int vertex_end{};
+    int index_end{};
+    for (int frame{}; frame < 1000; frame++)
+    {
+        int vertex_count{ (frame * 7919) % 6000 };
+        int index_count{ vertex_count * 3 / 2 + frame % 3 };
+        vertex_ring.EnsureCapacity(vertex_count);
+        index_ring.EnsureCapacity(index_count);
+        ImGui_ImplStreamingAllocation vertices{ vertex_ring.Allocate(vertex_count) };
+        ImGui_ImplStreamingAllocation indices{ index_ring.Allocate(index_count) };
+
+        std::size_t vertex_bytes{ static_cast<std::size_t>(vertex_ring.Capacity) * sizeof(ImDrawVert) };
+        std::size_t index_bytes{ static_cast<std::size_t>(index_ring.Capacity) * sizeof(ImDrawIdx) };
+        Check(vertices.Offset >= 0 && (vertices.Offset + static_cast<std::size_t>(vertex_count)) * sizeof(ImDrawVert) <= vertex_bytes);
+        Check(indices.Offset >= 0 && (indices.Offset + static_cast<std::size_t>(index_count)) * sizeof(ImDrawIdx) <= index_bytes);
+        Check(vertices.Discard ? vertices.Offset == 0 : vertices.Offset == vertex_end);
+        Check(indices.Discard ? indices.Offset == 0 : indices.Offset == index_end);
+        vertex_end = vertices.Offset + vertex_count;
+        index_end = indices.Offset + index_count;
+    }
+}
+
+// ---------- Software Capture ----------
+
+static void TestSoftwareCaptureNextToAnotherRenderer()
+{
+    // stands in for the backend data of the renderer the capture runs next to, e.g. ImGui_ImplDX11_Data
+    struct OtherRendererData
+    {
+        void* device;
+        std::array<std::uint32_t, 64> canary;
+    };
+    OtherRendererData other{ &other, {} };
+    other.canary.fill(0xC0FFEEu);
+
+    ImGui::CreateContext();
+    ImGuiIO& io{ ImGui::GetIO() };
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2{ 256.0f, 128.0f };
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendRendererName = "other";
+    io.BackendRendererUserData = &other;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures | ImGuiBackendFlags_RendererHasVtxOffset;
+
+    constexpr int WIDTH{ 256 };
+    constexpr int HEIGHT{ 128 };
+    std::vector<unsigned char> pixels(static_cast<std::size_t>(WIDTH) * HEIGHT * 4);
+    ImGui_ImplSoftware_Image target{ pixels.data(), WIDTH, HEIGHT, WIDTH * 4 };
+    for (int frame{}; frame < 3; frame++)
+    {
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2{ 0.0f, 0.0f });
+        ImGui::Begin("Capture");
+        ImGui::TextUnformatted("captured");
+        ImGui::Image(ImTextureRef{ static_cast<ImTextureID>(0xDEAD0) }, ImVec2{ 16.0f, 16.0f }); // owned by the other renderer
+        ImGui::End();
+        ImGui::Render();
+        ImGui_ImplSoftware_RenderDrawData(ImGui::GetDrawData(), &target);
+
+        // the capture must leave the textures to the other renderer
+        for (ImTextureData* tex : *ImGui::GetDrawData()->Textures)
+        {
+            Check(tex->Status != ImTextureStatus_OK || tex->TexID == static_cast<ImTextureID>(0xBEEF0));
+        }
+        for (ImTextureData* tex : *ImGui::GetDrawData()->Textures)
+        {
+            if (tex->Status == ImTextureStatus_WantCreate || tex->Status == ImTextureStatus_WantUpdates)
+            {
+                tex->SetTexID(static_cast<ImTextureID>(0xBEEF0));
+                tex->SetStatus(ImTextureStatus_OK);
+            }
+        }
+    }
+
+    io.BackendRendererName = nullptr;
+    io.BackendRendererUserData = nullptr;
+    ImGui::DestroyContext();
+
+    Check(other.device == &other);
+    for (std::uint32_t value : other.canary)
+    {
+        Check(value == 0xC0FFEEu);
+    }
+    std::size_t covered{};
+    for (std::size_t i{ 3 }; i < pixels.size(); i += 4)
+    {
+        covered += pixels[i] != 0;
+    }
+    Check(covered > 0); // the window was drawn
+}
+
+// ---------- Main ----------
+
+struct Test
+{
+    const char* name;
+    void (*run)();
+};
+
+int main()
+{
+    const Test tests[]{
+        { "RoundUpToBucket", TestRoundUpToBucket },
+        { "ResizeBucketPolicy buckets", TestResizeBucketPolicyBuckets },
+        { "ResizeBucketPolicy grows immediately", TestResizeBucketPolicyGrowsImmediately },
+        { "ResizeBucketPolicy shrinks after the delay", TestResizeBucketPolicyShrinksAfterDelay },
+        { "ResizeBucketPolicy shrink timer resets", TestResizeBucketPolicyShrinkTimerResets },
+        { "FrameLimiter deadline carry-over", TestFrameLimiterDeadlineCarryOver },
+        { "FrameLimiter catch-up reset", TestFrameLimiterCatchUpReset },
+        { "FrameLimiter spin threshold", TestFrameLimiterSpinThreshold },
+        { "ImGuiAllocator steady frames", TestImGuiAllocatorSteadyFrames },
+        { "LoadShaderSource includes", TestLoadShaderSourceIncludes },
+        { "ShaderFileWatcher", TestShaderFileWatcher },
+        { "ShaderBytecodeCache", TestShaderBytecodeCache },
+        { "ShaderHotReload publishing", TestShaderHotReloadPublishing },
+        { "PipelineStateHasher", TestPipelineStateHasher },
+        { "PipelineStateCache deduplicates", TestPipelineStateCacheDeduplicates },
+        { "PipelineStateCache create throws", TestPipelineStateCacheCreateThrows },
+        { "ShaderBytecodeCache disk round trip", TestShaderBytecodeCacheDiskRoundTrip },
+        { "StreamingRing appends", TestStreamingRingAppends },
+        { "StreamingRing wraps", TestStreamingRingWraps },
+        { "StreamingRing grows", TestStreamingRingGrows },
+        { "StreamingRing zero-size frames", TestStreamingRingZeroSizeFrames },
+        { "StreamingRing offset alignment", TestStreamingRingOffsetAlignment },
+        { "Software capture next to another renderer", TestSoftwareCaptureNextToAnotherRenderer },
+    };
+
+    int failed{};
+    for (const Test& test : tests)
+    {
+        try
+        {
+            test.run();
+            std::printf("[PASS] %s\n", test.name);
+        }
+        catch (const std::exception& e)
+        {
+            std::printf("[FAIL] %s\n%s\n", test.name, e.what());
+            failed++;
+        }
+    }
+    std::printf("%d of %zu tests failed\n", failed, std::size(tests));
+    return failed;
+}
@@ -0,0 +1,168 @@
+#include <TextDocumentBenchmark.h>
+
+#include <Assertions.h>
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <random>
+
+// ---------- Text Document Benchmark ----------
+
+static constexpr std::uint32_t EDITS_PER_JUMP{ 64 };
+
+const char* TextEditName(TextEdit edit)
+{
+    switch (edit)
+    {
+    case TextEdit::Typing: return "Typing";
+    case TextEdit::Backspace: return "Backspace";
+    case TextEdit::NewLine: return "New line";
+    default: Unreachable();
+    }
+}
+
+std::string GenerateShaderSource(std::uint32_t byte_count, std::uint32_t seed)
+{
+    static constexpr std::array<const char*, 8> lines{
+        "    float3 h = normalize(v + l);",
+        "    float n_dot_h = saturate(dot(n, h));",
+        "    float d = D_GGX(n_dot_h, roughness);",
+        "    float3 f = F_Schlick(v_dot_h, f0);",
+        "    float vis = V_SmithGGXCorrelated(n_dot_v, n_dot_l, roughness);",
+        "    // specular lobe",
+        "    color += (d * vis) * f * light_color * n_dot_l;",
+        "",
+    };
+
+    std::mt19937 rng{ seed };
+    std::uniform_int_distribution<std::uint32_t> line_count{ 4, 15 };
+    std::uniform_int_distribution<std::size_t> line_index{ 0, lines.size() - 1 };
+    std::string source{};
+    source.reserve(byte_count + 128);
+    for (std::uint32_t function_index{}; source.size() < byte_count; function_index++)
+    {
+        source += "float3 Shade" + std::to_string(function_index) + "(float3 n, float3 v, float3 l, float roughness, float3 f0)\n{\n";
+        for (std::uint32_t i{}, count{ line_count(rng) }; i < count; i++)
+        {
+            source += lines[line_index(rng)];
+            source += '\n';
+        }
+        source += "    return color;\n}\n\n";
+    }
+    return source;
+}
+
+static std::vector<int> FlatLineStarts(const std::string& text)
+{
+    std::vector<int> line_starts{ 0 };
+    for (const char* p{ text.data() }; (p = static_cast<const char*>(std::memchr(p, '\n', text.data() + text.size() - p))) != nullptr; p++)
+    {
+        line_starts.push_back(static_cast<int>(p - text.data()) + 1);
+    }
+    return line_starts;
+}
+
+static std::uint32_t CountMismatches(ImGuiTextDocument& document, const std::string& flat)
+{
+    ImVector<char> text{};
+    document.GetText(&text);
+    std::vector<int> line_starts{ FlatLineStarts(flat) };
+
+    std::uint32_t mismatches{};
+    for (std::size_t i{}; i < std::max<std::size_t>(flat.size(), static_cast<std::size_t>(document.GetLength())); i++)
+    {
+        mismatches += (i >= flat.size() || i >= static_cast<std::size_t>(document.GetLength()) || flat[i] != text[static_cast<int>(i)]) ? 1 : 0;
+    }
+    for (std::size_t i{}; i < std::max<std::size_t>(line_starts.size(), static_cast<std::size_t>(document.GetLineCount())); i++)
+    {
+        mismatches += (i >= line_starts.size() || i >= static_cast<std::size_t>(document.GetLineCount()) || line_starts[i] != document.GetLineStart(static_cast<int>(i))) ? 1 : 0;
+    }
+    return mismatches;
+}
+
+std::vector<TextDocumentBenchmarkResult> RunTextDocumentBenchmark(std::span<const std::uint32_t> document_sizes, std::uint32_t edit_count, std::uint32_t seed)
+{
+    Check(edit_count > 0);
+
+    std::mt19937 rng{ seed };
+    std::vector<TextDocumentBenchmarkResult> results{};
+    for (std::uint32_t document_size : document_sizes)
+    {
+        std::string source{ GenerateShaderSource(document_size, seed) };
+        Check(!source.empty());
+        for (std::uint32_t edit_index{}; edit_index < static_cast<std::uint32_t>(TextEdit::Count); edit_index++)
+        {
+            auto edit{ static_cast<TextEdit>(edit_index) };
+            ImGuiTextDocument document{};
+            document.SetText(source.data(), source.data() + source.size());
+            std::string flat{ source };
+            std::size_t flat_line_count{ FlatLineStarts(flat).size() };
+
+            TextDocumentBenchmarkResult result{};
+            result.edit = edit;
+            result.document_bytes = static_cast<std::uint32_t>(source.size());
+            double document_total_us{};
+            double flat_total_us{};
+            int cursor{};
+            for (std::uint32_t i{}; i < edit_count; i++)
+            {
+                // backspaces reached the start of the document: jump early
+                if (i % EDITS_PER_JUMP == 0 || cursor < 1)
+                {
+                    if (document.GetLength() == 0)
+                    {
+                        // backspaces drained a small document: start over from the source, untimed
+                        document.SetText(source.data(), source.data() + source.size());
+                        flat = source;
+                    }
+
+                    // jump to the end of a random line, far enough from the start for the backspaces when the document is long enough
+                    std::uniform_int_distribution<int> line_index{ 0, document.GetLineCount() - 1 };
+                    int line_n{ line_index(rng) };
+                    cursor = std::clamp(document.GetLineEnd(line_n), std::min(static_cast<int>(EDITS_PER_JUMP), document.GetLength()), document.GetLength());
+                }
+
+                auto begin{ std::chrono::steady_clock::now() };
+                switch (edit)
+                {
+                case TextEdit::Typing: { document.Insert(cursor, "x"); } break;
+                case TextEdit::Backspace: { document.Delete(cursor - 1, 1); } break;
+                case TextEdit::NewLine: { document.Insert(cursor, "\n"); } break;
+                default: { Unreachable(); } break;
+                }
+                int cursor_after{ edit == TextEdit::Backspace ? cursor - 1 : cursor + 1 };
+                volatile int cursor_line{ document.FindLine(cursor_after) };
+                auto middle{ std::chrono::steady_clock::now() };
+                switch (edit)
+                {
+                case TextEdit::Typing: { flat.insert(flat.begin() + cursor, 'x'); } break;
+                case TextEdit::Backspace: { flat.erase(flat.begin() + cursor - 1); } break;
+                case TextEdit::NewLine: { flat.insert(flat.begin() + cursor, '\n'); } break;
+                default: { Unreachable(); } break;
+                }
+                flat_line_count = static_cast<std::size_t>(std::count(flat.begin(), flat.end(), '\n')) + 1;
+                auto end{ std::chrono::steady_clock::now() };
+                (void)cursor_line;
+
+                double document_us{ std::chrono::duration<double, std::micro>(middle - begin).count() };
+                double flat_us{ std::chrono::duration<double, std::micro>(end - middle).count() };
+                document_total_us += document_us;
+                flat_total_us += flat_us;
+                result.document_max_us = std::max(result.document_max_us, document_us);
+                result.flat_max_us = std::max(result.flat_max_us, flat_us);
+                cursor = cursor_after;
+            }
+            result.document_mean_us = document_total_us / edit_count;
+            result.flat_mean_us = flat_total_us / edit_count;
+            result.mismatches = CountMismatches(document, flat);
+            result.mismatches += flat_line_count != static_cast<std::size_t>(document.GetLineCount()) ? 1 : 0;
+            results.emplace_back(result);
+        }
+    }
+    return results;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+// ---------- Text Document Benchmark ----------
+
+enum class TextEdit : std::uint32_t
+{
+    Typing = 0, // one character inserted after the previous one
+    Backspace = 1, // one character deleted before the cursor
+    NewLine = 2, // '\n' inserted, which adds a line to the index
+    Count,
+};
+
+const char* TextEditName(TextEdit edit);
+
+struct TextDocumentBenchmarkResult
+{
+    TextEdit edit;
+    std::uint32_t document_bytes;
+    double document_mean_us; // ImGuiTextDocument edit and cursor line lookup
+    double document_max_us;
+    double flat_mean_us; // std::string edit and line recount, as InputTextEx() does on its flat buffer
+    double flat_max_us;
+    std::uint32_t mismatches; // bytes and line starts that differ between the two documents after the edits, expected to be 0
+};
+
+// HLSL-like source of about byte_count bytes, to fill large documents
+std::string GenerateShaderSource(std::uint32_t byte_count, std::uint32_t seed);
+
+/*
+    applies edit_count edits of each kind to a generated document of each size, through ImGuiTextDocument and through a flat string
+    the cursor jumps to a random line every 64 edits, in between edits follow each other as when typing
+*/
+std::vector<TextDocumentBenchmarkResult> RunTextDocumentBenchmark(std::span<const std::uint32_t> document_sizes, std::uint32_t edit_count, std::uint32_t seed);
@@ -0,0 +1,175 @@
+#include <TextFilterBenchmark.h>
+
+#include <Assertions.h>
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <limits>
+#include <random>
+#include <string>
+
+// ---------- Text Filter Benchmark ----------
+
+struct TextFilterQuery
+{
+    const char* query;
+    const char* previous; // filtered by the index just before query, nullptr when query is not typed forward
+};
+
+static constexpr std::array<TextFilterQuery, 6> QUERIES{ {
+    { "steel", nullptr },
+    { "rough,-metal", nullptr },
+    { "gold,copper,silver,-worn", nullptr },
+    { "-_1", nullptr },
+    { "pres", "pre" },
+    { "preset", "prese" },
+} };
+
+static std::vector<std::string> GenerateItems(std::uint32_t item_count, std::uint32_t seed)
+{
+    static constexpr std::array<const char*, 6> folders{ "Materials/Metal", "Materials/Dielectric", "Materials/Fabric", "Presets/Lighting", "Presets/Camera", "Materials/Worn" };
+    static constexpr std::array<const char*, 8> adjectives{ "Brushed", "Polished", "Rough", "Worn", "Oxidized", "Satin", "Matte", "Glossy" };
+    static constexpr std::array<const char*, 10> nouns{ "Steel", "Gold", "Copper", "Silver", "Aluminium", "Plastic", "Rubber", "Velvet", "Ceramic", "Marble" };
+
+    std::mt19937 rng{ seed };
+    std::vector<std::string> items{};
+    items.reserve(item_count);
+    for (std::uint32_t i{}; i < item_count; i++)
+    {
+        const char* folder{ folders[rng() % folders.size()] };
+        const char* adjective{ adjectives[rng() % adjectives.size()] };
+        const char* noun{ nouns[rng() % nouns.size()] };
+        items.emplace_back(std::string{ folder } + "/" + adjective + "_" + noun + "_" + std::to_string(rng() % 10'000));
+    }
+    return items;
+}
+
+// ImStristr() and ImGuiTextFilter::PassFilter() before they were vectorized
+static const char* ReferenceStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
+{
+    const char un0{ static_cast<char>(ImToUpper(*needle)) };
+    while (haystack < haystack_end)
+    {
+        if (ImToUpper(*haystack) == un0)
+        {
+            const char* b{ needle + 1 };
+            for (const char* a{ haystack + 1 }; b < needle_end; a++, b++)
+            {
+                if (ImToUpper(*a) != ImToUpper(*b))
+                {
+                    break;
+                }
+            }
+            if (b == needle_end)
+            {
+                return haystack;
+            }
+        }
+        haystack++;
+    }
+    return nullptr;
+}
+
+static bool ReferencePassFilter(const ImGuiTextFilter& filter, const std::string& text)
+{
+    if (filter.Filters.Size == 0)
+    {
+        return true;
+    }
+    const char* text_end{ text.data() + text.size() };
+    for (const ImGuiTextFilter::ImGuiTextRange& f : filter.Filters)
+    {
+        if (f.b == f.e)
+        {
+            continue;
+        }
+        if (f.b[0] == '-')
+        {
+            if (ReferenceStristr(text.data(), text_end, f.b + 1, f.e) != nullptr)
+            {
+                return false;
+            }
+        }
+        else if (ReferenceStristr(text.data(), text_end, f.b, f.e) != nullptr)
+        {
+            return true;
+        }
+    }
+    return filter.CountGrep == 0;
+}
+
+template <typename F>
+static double Time(F&& f)
+{
+    auto begin{ std::chrono::steady_clock::now() };
+    f();
+    auto end{ std::chrono::steady_clock::now() };
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+std::vector<TextFilterBenchmarkResult> RunTextFilterBenchmark(std::uint32_t item_count, std::uint32_t repetitions, std::uint32_t seed)
+{
+    Check(repetitions > 0);
+
+    std::vector<std::string> items{ GenerateItems(item_count, seed) };
+    ImGuiTextFilterIndex index{};
+    for (const std::string& item : items)
+    {
+        index.AddItem(item.data(), item.data() + item.size());
+    }
+
+    std::vector<TextFilterBenchmarkResult> results{};
+    std::vector<bool> reference_passed(items.size());
+    std::vector<bool> pass_filter_passed(items.size());
+    for (const TextFilterQuery& query : QUERIES)
+    {
+        ImGuiTextFilter filter{ query.query };
+        ImGuiTextFilter previous_filter{ query.previous != nullptr ? query.previous : "" };
+
+        TextFilterBenchmarkResult result{};
+        result.query = query.query;
+        result.narrowed = query.previous != nullptr;
+        result.reference_ms = std::numeric_limits<double>::max();
+        result.pass_filter_ms = std::numeric_limits<double>::max();
+        result.index_ms = std::numeric_limits<double>::max();
+        for (std::uint32_t repetition{}; repetition < repetitions; repetition++)
+        {
+            result.reference_ms = std::min(result.reference_ms, Time([&] {
+                for (std::size_t i{}; i < items.size(); i++)
+                {
+                    reference_passed[i] = ReferencePassFilter(filter, items[i]);
+                }
+            }));
+            result.pass_filter_ms = std::min(result.pass_filter_ms, Time([&] {
+                for (std::size_t i{}; i < items.size(); i++)
+                {
+                    pass_filter_passed[i] = filter.PassFilter(items[i].data(), items[i].data() + items[i].size());
+                }
+            }));
+
+            index.ClearFilterResult();
+            if (query.previous != nullptr)
+            {
+                index.Filter(previous_filter);
+            }
+            result.index_ms = std::min(result.index_ms, Time([&] { index.Filter(filter); }));
+        }
+
+        result.passed = static_cast<std::uint32_t>(std::count(reference_passed.begin(), reference_passed.end(), true));
+        std::vector<bool> index_passed(items.size());
+        for (int item_n : index.PassedItems)
+        {
+            index_passed[static_cast<std::size_t>(item_n)] = true;
+        }
+        for (std::size_t i{}; i < items.size(); i++)
+        {
+            result.mismatches += (pass_filter_passed[i] != reference_passed[i] || index_passed[i] != reference_passed[i]) ? 1 : 0;
+        }
+        results.emplace_back(result);
+    }
+    return results;
+}
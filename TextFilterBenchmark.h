@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// ---------- Text Filter Benchmark ----------
+
+struct TextFilterBenchmarkResult
+{
+    const char* query; // ImGuiTextFilter input, e.g. "steel,-brushed"
+    bool narrowed; // typed forward from the previous query, which the index filtered first
+    std::uint32_t passed; // items passing the filter
+    double reference_ms; // per-filter ImStristr byte loop, as PassFilter() did before; fastest repetition
+    double pass_filter_ms; // PassFilter() on every item; fastest repetition
+    double index_ms; // ImGuiTextFilterIndex::Filter(); fastest repetition
+    std::uint32_t mismatches; // items on which PassFilter() or the index disagree with the reference, expected to be 0
+};
+
+/*
+    filters item_count generated material and preset names, e.g. "Materials/Metal/Brushed_Steel_42", with a fixed set of queries
+    covers single terms, several Grep terms, Subtract terms and a term typed one character at a time
+*/
+std::vector<TextFilterBenchmarkResult> RunTextFilterBenchmark(std::uint32_t item_count, std::uint32_t repetitions, std::uint32_t seed);
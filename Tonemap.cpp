@@ -0,0 +1,378 @@
+#include <Tonemap.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <type_traits>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define TONEMAP_SSE2
+#include <emmintrin.h>
+#endif
+
+/*
+    every operation is written once as a template over a lane type:
+    F1 processes a single pixel, F4 processes four pixels with SSE2
+    both lane types evaluate the same expressions in the same order, so the scalar tail matches the vector body bit for bit
+*/
+
+namespace
+{
+    // ---------- Scalar Lane ----------
+
+    struct F1
+    {
+        float v;
+    };
+
+    struct M1
+    {
+        bool v;
+    };
+
+    inline F1 Splat1(float x) noexcept { return { x }; }
+    inline F1 operator+(F1 a, F1 b) noexcept { return { a.v + b.v }; }
+    inline F1 operator-(F1 a, F1 b) noexcept { return { a.v - b.v }; }
+    inline F1 operator*(F1 a, F1 b) noexcept { return { a.v * b.v }; }
+    inline F1 operator/(F1 a, F1 b) noexcept { return { a.v / b.v }; }
+    inline F1 Min(F1 a, F1 b) noexcept { return { a.v < b.v ? a.v : b.v }; }
+    inline F1 Max(F1 a, F1 b) noexcept { return { a.v > b.v ? a.v : b.v }; }
+    inline M1 Less(F1 a, F1 b) noexcept { return { a.v < b.v }; }
+    inline M1 Greater(F1 a, F1 b) noexcept { return { a.v > b.v }; }
+    inline F1 Select(M1 m, F1 a, F1 b) noexcept { return m.v ? a : b; }
+
+    inline F1 Log2Approx(F1 x) noexcept
+    {
+        auto bits{ std::bit_cast<std::uint32_t>(x.v) };
+        auto exponent{ static_cast<float>(static_cast<std::int32_t>((bits >> 23) & 0xFF) - 127) };
+        F1 mantissa{ std::bit_cast<float>((bits & 0x007FFFFFu) | 0x3F800000u) }; // [1, 2)
+
+        // move mantissa to [sqrt(0.5), sqrt(2)) so that the series below converges quickly
+        M1 high{ Greater(mantissa, Splat1(1.41421356f)) };
+        mantissa = Select(high, mantissa * Splat1(0.5f), mantissa);
+        F1 e{ Select(high, Splat1(exponent + 1.0f), Splat1(exponent)) };
+
+        // log2(m) = 2/ln(2) * atanh((m - 1) / (m + 1))
+        F1 t{ (mantissa - Splat1(1.0f)) / (mantissa + Splat1(1.0f)) };
+        F1 t2{ t * t };
+        F1 series{ Splat1(1.0f) + t2 * (Splat1(1.0f / 3.0f) + t2 * (Splat1(1.0f / 5.0f) + t2 * Splat1(1.0f / 7.0f))) };
+        return e + t * Splat1(2.88539008f) * series;
+    }
+
+    inline F1 Exp2Approx(F1 x) noexcept
+    {
+        x = Min(Max(x, Splat1(-126.0f)), Splat1(127.0f));
+        auto i{ static_cast<std::int32_t>(std::lrint(x.v)) }; // round to nearest, like cvtps2dq
+        F1 f{ x - Splat1(static_cast<float>(i)) }; // [-0.5, 0.5]
+
+        // 2^f = e^(f ln2), taylor series up to the 6th power
+        F1 p{ Splat1(1.0f) + f * (Splat1(0.693147181f) + f * (Splat1(0.240226507f) + f * (Splat1(0.0555041087f) + f * (Splat1(0.00961812911f) + f * (Splat1(0.00133335581f) + f * Splat1(0.000154035304f)))))) };
+        F1 scale{ std::bit_cast<float>(static_cast<std::uint32_t>(i + 127) << 23) };
+        return p * scale;
+    }
+
+    inline std::uint32_t TruncateToU32(F1 x) noexcept
+    {
+        return static_cast<std::uint32_t>(static_cast<std::int32_t>(x.v));
+    }
+
+    #if defined(TONEMAP_SSE2)
+
+    // ---------- SSE2 Lane ----------
+
+    struct F4
+    {
+        __m128 v;
+    };
+
+    struct M4
+    {
+        __m128 v;
+    };
+
+    inline F4 Splat4(float x) noexcept { return { _mm_set1_ps(x) }; }
+    inline F4 operator+(F4 a, F4 b) noexcept { return { _mm_add_ps(a.v, b.v) }; }
+    inline F4 operator-(F4 a, F4 b) noexcept { return { _mm_sub_ps(a.v, b.v) }; }
+    inline F4 operator*(F4 a, F4 b) noexcept { return { _mm_mul_ps(a.v, b.v) }; }
+    inline F4 operator/(F4 a, F4 b) noexcept { return { _mm_div_ps(a.v, b.v) }; }
+    inline F4 Min(F4 a, F4 b) noexcept { return { _mm_min_ps(a.v, b.v) }; }
+    inline F4 Max(F4 a, F4 b) noexcept { return { _mm_max_ps(a.v, b.v) }; }
+    inline M4 Less(F4 a, F4 b) noexcept { return { _mm_cmplt_ps(a.v, b.v) }; }
+    inline M4 Greater(F4 a, F4 b) noexcept { return { _mm_cmpgt_ps(a.v, b.v) }; }
+    inline F4 Select(M4 m, F4 a, F4 b) noexcept { return { _mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v)) }; }
+
+    inline F4 Log2Approx(F4 x) noexcept
+    {
+        __m128i bits{ _mm_castps_si128(x.v) };
+        __m128i biased{ _mm_and_si128(_mm_srli_epi32(bits, 23), _mm_set1_epi32(0xFF)) };
+        __m128 exponent{ _mm_cvtepi32_ps(_mm_sub_epi32(biased, _mm_set1_epi32(127))) };
+        F4 mantissa{ _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000))) };
+
+        M4 high{ Greater(mantissa, Splat4(1.41421356f)) };
+        mantissa = Select(high, mantissa * Splat4(0.5f), mantissa);
+        F4 e{ Select(high, F4{ _mm_add_ps(exponent, _mm_set1_ps(1.0f)) }, F4{ exponent }) };
+
+        F4 t{ (mantissa - Splat4(1.0f)) / (mantissa + Splat4(1.0f)) };
+        F4 t2{ t * t };
+        F4 series{ Splat4(1.0f) + t2 * (Splat4(1.0f / 3.0f) + t2 * (Splat4(1.0f / 5.0f) + t2 * Splat4(1.0f / 7.0f))) };
+        return e + t * Splat4(2.88539008f) * series;
+    }
+
+    inline F4 Exp2Approx(F4 x) noexcept
+    {
+        x = Min(Max(x, Splat4(-126.0f)), Splat4(127.0f));
+        __m128i i{ _mm_cvtps_epi32(x.v) };
+        F4 f{ x - F4{ _mm_cvtepi32_ps(i) } };
+
+        F4 p{ Splat4(1.0f) + f * (Splat4(0.693147181f) + f * (Splat4(0.240226507f) + f * (Splat4(0.0555041087f) + f * (Splat4(0.00961812911f) + f * (Splat4(0.00133335581f) + f * Splat4(0.000154035304f)))))) };
+        F4 scale{ _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(i, _mm_set1_epi32(127)), 23)) };
+        return p * scale;
+    }
+
+    #endif
+
+    // ---------- Shared Math ----------
+
+    template <typename F>
+    F Splat(float x) noexcept
+    {
+        if constexpr (std::is_same_v<F, F1>)
+        {
+            return Splat1(x);
+        }
+        #if defined(TONEMAP_SSE2)
+        else
+        {
+            return Splat4(x);
+        }
+        #endif
+    }
+
+    template <typename F>
+    F Saturate(F x) noexcept
+    {
+        return Min(Max(x, Splat<F>(0.0f)), Splat<F>(1.0f));
+    }
+
+    template <typename F>
+    F Pow(F x, float y) noexcept
+    {
+        return Exp2Approx(Splat<F>(y) * Log2Approx(x));
+    }
+
+    template <typename F>
+    F Luminance(F r, F g, F b) noexcept
+    {
+        return r * Splat<F>(0.2126f) + g * Splat<F>(0.7152f) + b * Splat<F>(0.0722f);
+    }
+
+    // histogram bin before the dark pixel test; the caller moves dark pixels to bin 0
+    template <typename F>
+    F HistogramBin(F luminance, float min_log_luminance, float log_luminance_range) noexcept
+    {
+        F log_luminance{ Log2Approx(Max(luminance, Splat<F>(EXPOSURE_MIN_HISTOGRAM_LUMINANCE))) };
+        F t{ Saturate((log_luminance - Splat<F>(min_log_luminance)) / Splat<F>(log_luminance_range)) };
+        return t * Splat<F>(static_cast<float>(EXPOSURE_HISTOGRAM_BIN_COUNT - 2)) + Splat<F>(1.0f);
+    }
+
+    template <typename F>
+    F Reinhard(F x) noexcept
+    {
+        return x / (Splat<F>(1.0f) + x);
+    }
+
+    // Narkowicz fit of the ACES filmic curve
+    template <typename F>
+    F ACES(F x) noexcept
+    {
+        F numerator{ x * (Splat<F>(2.51f) * x + Splat<F>(0.03f)) };
+        F denominator{ x * (Splat<F>(2.43f) * x + Splat<F>(0.59f)) + Splat<F>(0.14f) };
+        return Saturate(numerator / denominator);
+    }
+
+    // 6th order polynomial fit of the default AgX contrast curve
+    template <typename F>
+    F AgXContrast(F x) noexcept
+    {
+        F x2{ x * x };
+        F x4{ x2 * x2 };
+        return Splat<F>(15.5f) * x4 * x2 - Splat<F>(40.14f) * x4 * x + Splat<F>(31.96f) * x4 - Splat<F>(6.868f) * x2 * x + Splat<F>(0.4298f) * x2 + Splat<F>(0.1191f) * x - Splat<F>(0.00232f);
+    }
+
+    template <typename F>
+    void AgX(F& r, F& g, F& b) noexcept
+    {
+        constexpr float MIN_EV{ -12.47393f };
+        constexpr float MAX_EV{ 4.026069f };
+
+        // inset
+        F ir{ r * Splat<F>(0.842479062f) + g * Splat<F>(0.0784336f) + b * Splat<F>(0.0792237451f) };
+        F ig{ r * Splat<F>(0.0423282423f) + g * Splat<F>(0.878468636f) + b * Splat<F>(0.0791661275f) };
+        F ib{ r * Splat<F>(0.0423756549f) + g * Splat<F>(0.0784336f) + b * Splat<F>(0.879142974f) };
+
+        // log encoding and contrast curve
+        auto encode{ [](F x)
+        {
+            F ev{ Log2Approx(Max(x, Splat<F>(1e-10f))) };
+            ev = Min(Max(ev, Splat<F>(MIN_EV)), Splat<F>(MAX_EV));
+            return AgXContrast((ev - Splat<F>(MIN_EV)) / Splat<F>(MAX_EV - MIN_EV));
+        } };
+        ir = encode(ir);
+        ig = encode(ig);
+        ib = encode(ib);
+
+        // outset
+        F or_{ ir * Splat<F>(1.19687901f) + ig * Splat<F>(-0.0980208811f) + ib * Splat<F>(-0.0990297441f) };
+        F og{ ir * Splat<F>(-0.0528968518f) + ig * Splat<F>(1.15190313f) + ib * Splat<F>(-0.0989611768f) };
+        F ob{ ir * Splat<F>(-0.0529716355f) + ig * Splat<F>(-0.0980434501f) + ib * Splat<F>(1.15107367f) };
+
+        // back to linear
+        r = Pow(Max(or_, Splat<F>(0.0f)), 2.2f);
+        g = Pow(Max(og, Splat<F>(0.0f)), 2.2f);
+        b = Pow(Max(ob, Splat<F>(0.0f)), 2.2f);
+    }
+
+    template <typename F>
+    F LinearToSRGB(F x) noexcept
+    {
+        x = Saturate(x);
+        F low{ x * Splat<F>(12.92f) };
+        F high{ Splat<F>(1.055f) * Pow(Max(x, Splat<F>(0.0031308f)), 1.0f / 2.4f) - Splat<F>(0.055f) };
+        return Select(Greater(x, Splat<F>(0.0031308f)), high, low);
+    }
+
+    // expose, tonemap and encode one lane of pixels; the results are scaled to [0, 255.5)
+    template <typename F>
+    void TonemapLane(F& r, F& g, F& b, TonemapOperator op, float exposure) noexcept
+    {
+        r = r * Splat<F>(exposure);
+        g = g * Splat<F>(exposure);
+        b = b * Splat<F>(exposure);
+
+        switch (op)
+        {
+        case TonemapOperator::Reinhard: { r = Reinhard(r); g = Reinhard(g); b = Reinhard(b); } break;
+        case TonemapOperator::ACES: { r = ACES(r); g = ACES(g); b = ACES(b); } break;
+        case TonemapOperator::AgX: { AgX(r, g, b); } break;
+        default: break;
+        }
+
+        r = LinearToSRGB(r) * Splat<F>(255.0f) + Splat<F>(0.5f);
+        g = LinearToSRGB(g) * Splat<F>(255.0f) + Splat<F>(0.5f);
+        b = LinearToSRGB(b) * Splat<F>(255.0f) + Splat<F>(0.5f);
+    }
+}
+
+// ---------- Exposure ----------
+
+void AccumulateLuminanceHistogram(const float* rgba, std::size_t pixel_count, float min_log_luminance, float log_luminance_range, std::uint32_t* histogram)
+{
+    std::size_t i{};
+
+    #if defined(TONEMAP_SSE2)
+    for (; i + 4 <= pixel_count; i += 4)
+    {
+        __m128 p0{ _mm_loadu_ps(rgba + (i + 0) * 4) };
+        __m128 p1{ _mm_loadu_ps(rgba + (i + 1) * 4) };
+        __m128 p2{ _mm_loadu_ps(rgba + (i + 2) * 4) };
+        __m128 p3{ _mm_loadu_ps(rgba + (i + 3) * 4) };
+        _MM_TRANSPOSE4_PS(p0, p1, p2, p3); // p0..p2 now hold the r, g, b channels of the four pixels
+
+        F4 luminance{ Luminance(F4{ p0 }, F4{ p1 }, F4{ p2 }) };
+        F4 bin{ HistogramBin(luminance, min_log_luminance, log_luminance_range) };
+        bin = Select(Less(luminance, Splat4(EXPOSURE_MIN_HISTOGRAM_LUMINANCE)), Splat4(0.0f), bin);
+
+        alignas(16) std::int32_t bins[4]{};
+        _mm_store_si128(reinterpret_cast<__m128i*>(bins), _mm_cvttps_epi32(bin.v));
+        histogram[bins[0]]++;
+        histogram[bins[1]]++;
+        histogram[bins[2]]++;
+        histogram[bins[3]]++;
+    }
+    #endif
+
+    for (; i < pixel_count; i++)
+    {
+        const float* p{ rgba + i * 4 };
+        F1 luminance{ Luminance(F1{ p[0] }, F1{ p[1] }, F1{ p[2] }) };
+        F1 bin{ HistogramBin(luminance, min_log_luminance, log_luminance_range) };
+        bin = Select(Less(luminance, Splat1(EXPOSURE_MIN_HISTOGRAM_LUMINANCE)), Splat1(0.0f), bin);
+        histogram[TruncateToU32(bin)]++;
+    }
+}
+float AverageLuminanceFromHistogram(const std::uint32_t* histogram, float min_log_luminance, float log_luminance_range, float fallback)
+{
+    float weighted_sum{};
+    float lit_count{};
+    for (std::uint32_t bin{ 1 }; bin < EXPOSURE_HISTOGRAM_BIN_COUNT; bin++)
+    {
+        weighted_sum += static_cast<float>(histogram[bin]) * static_cast<float>(bin);
+        lit_count += static_cast<float>(histogram[bin]);
+    }
+
+    if (lit_count == 0.0f)
+    {
+        return fallback;
+    }
+
+    float average_bin{ weighted_sum / lit_count };
+    float average_log_luminance{ (average_bin - 1.0f) / static_cast<float>(EXPOSURE_HISTOGRAM_BIN_COUNT - 2) * log_luminance_range + min_log_luminance };
+    return std::exp2(average_log_luminance);
+}
+float AdaptLuminance(float previous, float current, float adaptation) noexcept
+{
+    return previous + (current - previous) * adaptation;
+}
+float ComputeExposure(bool auto_exposure, float average_luminance, float exposure_ev) noexcept
+{
+    float compensation{ std::exp2(exposure_ev) };
+    return auto_exposure ? EXPOSURE_KEY_VALUE / std::max(average_luminance, 1e-4f) * compensation : compensation;
+}
+
+// ---------- Tonemapping ----------
+
+void TonemapToSRGB8(const float* rgba, std::size_t pixel_count, TonemapOperator op, float exposure, std::uint8_t* rgba8)
+{
+    std::size_t i{};
+
+    #if defined(TONEMAP_SSE2)
+    for (; i + 4 <= pixel_count; i += 4)
+    {
+        __m128 p0{ _mm_loadu_ps(rgba + (i + 0) * 4) };
+        __m128 p1{ _mm_loadu_ps(rgba + (i + 1) * 4) };
+        __m128 p2{ _mm_loadu_ps(rgba + (i + 2) * 4) };
+        __m128 p3{ _mm_loadu_ps(rgba + (i + 3) * 4) };
+        _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+
+        F4 r{ p0 };
+        F4 g{ p1 };
+        F4 b{ p2 };
+        TonemapLane(r, g, b, op, exposure);
+
+        // back to pixel order with opaque alpha, then pack to bytes
+        __m128 a{ _mm_set1_ps(255.5f) };
+        __m128 q0{ r.v };
+        __m128 q1{ g.v };
+        __m128 q2{ b.v };
+        _MM_TRANSPOSE4_PS(q0, q1, q2, a);
+        __m128i lo{ _mm_packs_epi32(_mm_cvttps_epi32(q0), _mm_cvttps_epi32(q1)) };
+        __m128i hi{ _mm_packs_epi32(_mm_cvttps_epi32(q2), _mm_cvttps_epi32(a)) };
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(rgba8 + i * 4), _mm_packus_epi16(lo, hi));
+    }
+    #endif
+
+    for (; i < pixel_count; i++)
+    {
+        const float* p{ rgba + i * 4 };
+        F1 r{ p[0] };
+        F1 g{ p[1] };
+        F1 b{ p[2] };
+        TonemapLane(r, g, b, op, exposure);
+
+        std::uint8_t* out{ rgba8 + i * 4 };
+        out[0] = static_cast<std::uint8_t>(TruncateToU32(r));
+        out[1] = static_cast<std::uint8_t>(TruncateToU32(g));
+        out[2] = static_cast<std::uint8_t>(TruncateToU32(b));
+        out[3] = 255;
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+    CPU reference of the tonemapping pipeline implemented by HistogramCS.hlsl, ExposureCS.hlsl and TonemapPS.hlsl
+    the math mirrors Tonemapping.hlsli so that headless renders match what the GPU presents
+    images are tightly packed RGBA32F (input) and RGBA8 sRGB encoded (output)
+*/
+
+// ---------- Constants ----------
+
+// values match the TONEMAP_OPERATOR_* defines in ConstantBuffers.hlsli
+enum class TonemapOperator : std::uint32_t
+{
+    Reinhard = 0,
+    ACES = 1,
+    AgX = 2,
+};
+
+constexpr std::uint32_t EXPOSURE_HISTOGRAM_BIN_COUNT{ 256 }; // matches EXPOSURE_HISTOGRAM_BINS in ConstantBuffers.hlsli
+constexpr float EXPOSURE_MIN_HISTOGRAM_LUMINANCE{ 0.005f }; // pixels darker than this land in bin 0 and are ignored by the average
+constexpr float EXPOSURE_KEY_VALUE{ 0.18f }; // middle gray the average luminance is mapped to
+
+// ---------- Exposure ----------
+
+// add the luminance of every pixel to a histogram of EXPOSURE_HISTOGRAM_BIN_COUNT bins
+void AccumulateLuminanceHistogram(const float* rgba, std::size_t pixel_count, float min_log_luminance, float log_luminance_range, std::uint32_t* histogram);
+
+// average luminance of the histogram, ignoring bin 0; returns fallback when every pixel is too dark
+float AverageLuminanceFromHistogram(const std::uint32_t* histogram, float min_log_luminance, float log_luminance_range, float fallback);
+
+// move the previous average luminance toward the current one
+float AdaptLuminance(float previous, float current, float adaptation) noexcept;
+
+// exposure multiplier applied before tonemapping
+float ComputeExposure(bool auto_exposure, float average_luminance, float exposure_ev) noexcept;
+
+// ---------- Tonemapping ----------
+
+// expose, tonemap and sRGB encode an image
+void TonemapToSRGB8(const float* rgba, std::size_t pixel_count, TonemapOperator op, float exposure, std::uint8_t* rgba8);
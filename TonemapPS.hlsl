@@ -0,0 +1,12 @@
+#include "Tonemapping.hlsli"
+
+Texture2D<float4> scene_color : register(t0);
+StructuredBuffer<float> average_luminance : register(t1);
+
+float4 main(float4 position : SV_POSITION) : SV_TARGET
+{
+    float3 hdr = scene_color.Load(int3(position.xy, 0)).rgb;
+    float exposure = ComputeExposure(average_luminance[0]);
+    float3 ldr = Tonemap(hdr * exposure, cb_tonemap.tonemap_operator);
+    return float4(LinearToSRGB(ldr), 1.0f);
+}
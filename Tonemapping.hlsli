@@ -0,0 +1,100 @@
+#ifndef __TONEMAPPING__
+#define __TONEMAPPING__
+
+#include "ConstantBuffers.hlsli"
+
+// mirrored on the CPU by Tonemap.cpp; keep the two in sync
+
+static const float EXPOSURE_MIN_HISTOGRAM_LUMINANCE = 0.005f; // pixels darker than this land in bin 0 and are ignored by the average
+static const float EXPOSURE_KEY_VALUE = 0.18f; // middle gray the average luminance is mapped to
+
+cbuffer CBTonemap : register(b0)
+{
+    TonemapConstants cb_tonemap;
+};
+
+float Luminance(float3 color)
+{
+    return dot(color, float3(0.2126f, 0.7152f, 0.0722f));
+}
+
+uint LuminanceToHistogramBin(float luminance)
+{
+    if (luminance < EXPOSURE_MIN_HISTOGRAM_LUMINANCE)
+    {
+        return 0;
+    }
+
+    float log_luminance = log2(max(luminance, EXPOSURE_MIN_HISTOGRAM_LUMINANCE));
+    float t = saturate((log_luminance - cb_tonemap.min_log_luminance) / cb_tonemap.log_luminance_range);
+    return (uint)(t * (EXPOSURE_HISTOGRAM_BINS - 2) + 1.0f);
+}
+
+float ComputeExposure(float average_luminance)
+{
+    float compensation = exp2(cb_tonemap.exposure_ev);
+    return cb_tonemap.auto_exposure ? EXPOSURE_KEY_VALUE / max(average_luminance, 1e-4f) * compensation : compensation;
+}
+
+float3 TonemapReinhard(float3 x)
+{
+    return x / (1.0f + x);
+}
+
+// Narkowicz fit of the ACES filmic curve
+float3 TonemapACES(float3 x)
+{
+    return saturate((x * (2.51f * x + 0.03f)) / (x * (2.43f * x + 0.59f) + 0.14f));
+}
+
+// 6th order polynomial fit of the default AgX contrast curve
+float3 AgXContrast(float3 x)
+{
+    float3 x2 = x * x;
+    float3 x4 = x2 * x2;
+    return 15.5f * x4 * x2 - 40.14f * x4 * x + 31.96f * x4 - 6.868f * x2 * x + 0.4298f * x2 + 0.1191f * x - 0.00232f;
+}
+
+float3 TonemapAgX(float3 x)
+{
+    static const float MIN_EV = -12.47393f;
+    static const float MAX_EV = 4.026069f;
+
+    static const float3x3 INSET = float3x3(
+        0.842479062f, 0.0784336f, 0.0792237451f,
+        0.0423282423f, 0.878468636f, 0.0791661275f,
+        0.0423756549f, 0.0784336f, 0.879142974f
+    );
+    static const float3x3 OUTSET = float3x3(
+        1.19687901f, -0.0980208811f, -0.0990297441f,
+        -0.0528968518f, 1.15190313f, -0.0989611768f,
+        -0.0529716355f, -0.0980434501f, 1.15107367f
+    );
+
+    float3 v = mul(INSET, x);
+    v = clamp(log2(max(v, 1e-10f)), MIN_EV, MAX_EV);
+    v = AgXContrast((v - MIN_EV) / (MAX_EV - MIN_EV));
+    v = mul(OUTSET, v);
+    return pow(max(v, 0.0f), 2.2f); // back to linear
+}
+
+float3 Tonemap(float3 x, uint tonemap_operator)
+{
+    switch (tonemap_operator)
+    {
+    case TONEMAP_OPERATOR_REINHARD: return TonemapReinhard(x);
+    case TONEMAP_OPERATOR_ACES: return TonemapACES(x);
+    case TONEMAP_OPERATOR_AGX: return TonemapAgX(x);
+    default: return x;
+    }
+}
+
+float3 LinearToSRGB(float3 x)
+{
+    x = saturate(x);
+    float3 low = x * 12.92f;
+    float3 high = 1.055f * pow(max(x, 0.0031308f), 1.0f / 2.4f) - 0.055f;
+    return x > 0.0031308f ? high : low;
+}
+
+#endif
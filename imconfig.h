@@ -65,6 +65,20 @@
 //---- Use legacy CRC32-adler tables (used before 1.91.6), in order to preserve old .ini data that you cannot afford to invalidate.
 //#define IMGUI_USE_LEGACY_CRC32_ADLER
 
+//---- Select the hash used for IDs (ImHashData/ImHashStr). Default is CRC32c through a 1KB lookup table, or SSE 4.2 instructions when compiling with SSE 4.2 enabled.
+// - IMGUI_HASH_CRC32C_HW: CRC32c through hardware instructions detected at runtime (x86 SSE 4.2, ARMv8 CRC32), falling back to the table. Same IDs as the default.
+// - IMGUI_HASH_WIDE: xxHash-style hash consuming 8 bytes per step. Produces different IDs: this invalidates data saved in .ini files.
+//#define IMGUI_HASH_CRC32C_HW
+//#define IMGUI_HASH_WIDE
+
+//---- Use ImGuiStorage hash mode for per-window state storage (tree node open states, etc.) and the window map: O(1) instead of O(log N) queries and O(N) insertions.
+// Only worth it with thousands of tree nodes per window, see ImGuiStorage::SetHashMode().
+//#define IMGUI_ENABLE_STORAGE_HASH_MODE
+
+//---- Disable the SIMD tessellation of anti-aliased AddPolyline()/AddConvexPolyFilled() (SSE2, AVX2 when compiling with AVX2 enabled, NEON on ARM64).
+// It produces the same vertices as the scalar code, see ImDrawListFlags_NoSimdTessellation to compare both at runtime.
+//#define IMGUI_DISABLE_SIMD_TESSELLATION
+
 //---- Use 32-bit for ImWchar (default is 16-bit) to support Unicode planes 1-16. (e.g. point beyond 0xFFFF like emoticons, dingbats, symbols, shapes, ancient languages, etc...)
 //#define IMGUI_USE_WCHAR32
 
@@ -2032,6 +2032,79 @@ ImVec2 ImTriangleClosestPoint(const ImVec2& a, const ImVec2& b, const ImVec2& c,
     return proj_ca;
 }
 
+// Used by PlotEx() to decimate large series. The min/max instructions return their second operand when the first one is NaN, so NaN values are skipped as long as the accumulators come second.
+void ImMinMaxFloats(const float* values, int values_count, float* in_out_min, float* in_out_max)
+{
+    float v_min = *in_out_min;
+    float v_max = *in_out_max;
+    int n = 0;
+#if defined(IMGUI_ENABLE_AVX2)
+    if (values_count >= 16)
+    {
+        __m256 min0 = _mm256_set1_ps(v_min), min1 = min0;
+        __m256 max0 = _mm256_set1_ps(v_max), max1 = max0;
+        for (; n + 16 <= values_count; n += 16)
+        {
+            __m256 a = _mm256_loadu_ps(values + n);
+            __m256 b = _mm256_loadu_ps(values + n + 8);
+            min0 = _mm256_min_ps(a, min0); max0 = _mm256_max_ps(a, max0);
+            min1 = _mm256_min_ps(b, min1); max1 = _mm256_max_ps(b, max1);
+        }
+        min0 = _mm256_min_ps(min0, min1);
+        max0 = _mm256_max_ps(max0, max1);
+        __m128 min4 = _mm_min_ps(_mm256_castps256_ps128(min0), _mm256_extractf128_ps(min0, 1));
+        __m128 max4 = _mm_max_ps(_mm256_castps256_ps128(max0), _mm256_extractf128_ps(max0, 1));
+        min4 = _mm_min_ps(min4, _mm_movehl_ps(min4, min4));
+        max4 = _mm_max_ps(max4, _mm_movehl_ps(max4, max4));
+        v_min = _mm_cvtss_f32(_mm_min_ss(min4, _mm_shuffle_ps(min4, min4, 1)));
+        v_max = _mm_cvtss_f32(_mm_max_ss(max4, _mm_shuffle_ps(max4, max4, 1)));
+    }
+#elif defined(IMGUI_ENABLE_SSE)
+    if (values_count >= 8)
+    {
+        __m128 min0 = _mm_set1_ps(v_min), min1 = min0;
+        __m128 max0 = _mm_set1_ps(v_max), max1 = max0;
+        for (; n + 8 <= values_count; n += 8)
+        {
+            __m128 a = _mm_loadu_ps(values + n);
+            __m128 b = _mm_loadu_ps(values + n + 4);
+            min0 = _mm_min_ps(a, min0); max0 = _mm_max_ps(a, max0);
+            min1 = _mm_min_ps(b, min1); max1 = _mm_max_ps(b, max1);
+        }
+        min0 = _mm_min_ps(min0, min1);
+        max0 = _mm_max_ps(max0, max1);
+        min0 = _mm_min_ps(min0, _mm_movehl_ps(min0, min0));
+        max0 = _mm_max_ps(max0, _mm_movehl_ps(max0, max0));
+        v_min = _mm_cvtss_f32(_mm_min_ss(min0, _mm_shuffle_ps(min0, min0, 1)));
+        v_max = _mm_cvtss_f32(_mm_max_ss(max0, _mm_shuffle_ps(max0, max0, 1)));
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    if (values_count >= 8)
+    {
+        // vminnmq/vmaxnmq return the number when only one operand is NaN
+        float32x4_t min0 = vdupq_n_f32(v_min), min1 = min0;
+        float32x4_t max0 = vdupq_n_f32(v_max), max1 = max0;
+        for (; n + 8 <= values_count; n += 8)
+        {
+            float32x4_t a = vld1q_f32(values + n);
+            float32x4_t b = vld1q_f32(values + n + 4);
+            min0 = vminnmq_f32(a, min0); max0 = vmaxnmq_f32(a, max0);
+            min1 = vminnmq_f32(b, min1); max1 = vmaxnmq_f32(b, max1);
+        }
+        v_min = vminnmvq_f32(vminnmq_f32(min0, min1));
+        v_max = vmaxnmvq_f32(vmaxnmq_f32(max0, max1));
+    }
+#endif
+    for (; n < values_count; n++)
+    {
+        const float v = values[n];
+        v_min = (v < v_min) ? v : v_min;
+        v_max = (v > v_max) ? v : v_max;
+    }
+    *in_out_min = v_min;
+    *in_out_max = v_max;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (String, Format, Hash functions)
 //-----------------------------------------------------------------------------
@@ -2116,28 +2189,135 @@ const char* ImStrbol(const char* buf_mid_line, const char* buf_begin) // find be
     return buf_mid_line;
 }
 
+// Case-insensitive substring search, 16 haystack positions at a time when SIMD is available.
+// Each block is filtered by comparing the first and last characters of the needle with (c | 0x20), which folds letters exactly
+// but also lets a few symbols through (e.g. '@' and '`'), so candidate positions are always verified with ImToUpper().
+// The last block is moved back to end on the last position rather than reading past haystack_end: it overlaps positions already rejected.
+#if defined(IMGUI_ENABLE_SSE2) || defined(IMGUI_ENABLE_NEON)
+#define IM_STRISTR_BLOCK_SIZE   16
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>         // _BitScanForward
+static inline int ImStristrLowestBit(ImU32 mask)  { unsigned long n; _BitScanForward(&n, mask); return (int)n; }
+#else
+static inline int ImStristrLowestBit(ImU32 mask)  { return __builtin_ctz(mask); }
+#endif
+
+// Bit n set when haystack[n] may be needle_first and haystack[n + needle_len - 1] may be needle_last. Reads haystack[0 .. needle_len + 14].
+static inline ImU32 ImStristrCandidates(const char* haystack, char needle_first, char needle_last, int needle_len)
+{
+#if defined(IMGUI_ENABLE_SSE2)
+    const __m128i case_bit = _mm_set1_epi8(0x20);
+    const __m128i first = _mm_or_si128(_mm_loadu_si128((const __m128i*)(const void*)haystack), case_bit);
+    const __m128i last = _mm_or_si128(_mm_loadu_si128((const __m128i*)(const void*)(haystack + needle_len - 1)), case_bit);
+    const __m128i eq = _mm_and_si128(_mm_cmpeq_epi8(first, _mm_set1_epi8((char)(needle_first | 0x20))), _mm_cmpeq_epi8(last, _mm_set1_epi8((char)(needle_last | 0x20))));
+    return (ImU32)_mm_movemask_epi8(eq);
+#else
+    static const uint8_t bit_weights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint8x16_t case_bit = vdupq_n_u8(0x20);
+    const uint8x16_t first = vorrq_u8(vld1q_u8((const uint8_t*)haystack), case_bit);
+    const uint8x16_t last = vorrq_u8(vld1q_u8((const uint8_t*)(haystack + needle_len - 1)), case_bit);
+    const uint8x16_t eq = vandq_u8(vceqq_u8(first, vdupq_n_u8((uint8_t)(needle_first | 0x20))), vceqq_u8(last, vdupq_n_u8((uint8_t)(needle_last | 0x20))));
+    const uint8x16_t bits = vandq_u8(eq, vld1q_u8(bit_weights));
+    return (ImU32)vaddv_u8(vget_low_u8(bits)) | ((ImU32)vaddv_u8(vget_high_u8(bits)) << 8);
+#endif
+}
+#endif
+
+static inline bool ImStristrMatches(const char* haystack, const char* needle, int needle_len)
+{
+    for (int n = 0; n < needle_len; n++)
+        if (ImToUpper(haystack[n]) != ImToUpper(needle[n]))
+            return false;
+    return true;
+}
+
 const char* ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
 {
     if (!needle_end)
         needle_end = needle + ImStrlen(needle);
+    if (!haystack_end)
+        haystack_end = haystack + ImStrlen(haystack);
+    const int needle_len = (int)(needle_end - needle);
+    const int haystack_len = (int)(haystack_end - haystack);
+    if (needle_len == 0)
+        return NULL;
 
-    const char un0 = (char)ImToUpper(*needle);
-    while ((!haystack_end && *haystack) || (haystack_end && haystack < haystack_end))
+    const int pos_end = haystack_len - needle_len + 1;
+    int pos = 0;
+#ifdef IM_STRISTR_BLOCK_SIZE
+    for (; pos < pos_end && pos_end >= IM_STRISTR_BLOCK_SIZE; pos += IM_STRISTR_BLOCK_SIZE)
     {
-        if (ImToUpper(*haystack) == un0)
+        pos = ImMin(pos, pos_end - IM_STRISTR_BLOCK_SIZE);
+        for (ImU32 mask = ImStristrCandidates(haystack + pos, needle[0], needle_end[-1], needle_len); mask != 0; mask &= mask - 1)
         {
-            const char* b = needle + 1;
-            for (const char* a = haystack + 1; b < needle_end; a++, b++)
-                if (ImToUpper(*a) != ImToUpper(*b))
-                    break;
-            if (b == needle_end)
-                return haystack;
+            const char* candidate = haystack + pos + ImStristrLowestBit(mask);
+            if (ImStristrMatches(candidate, needle, needle_len))
+                return candidate;
         }
-        haystack++;
     }
+#endif
+    for (; pos < pos_end; pos++)
+        if (ImStristrMatches(haystack + pos, needle, needle_len))
+            return haystack + pos;
     return NULL;
 }
 
+// Find which needles are in haystack, scanning it once for all of them: return the lowest index of a needle found, or -1.
+// Empty needles are never found.
+static int ImStristrFirstOf(const char* haystack, const char* haystack_end, const ImGuiTextFilter::ImGuiTextRange* needles, int needles_count)
+{
+    if (!haystack_end)
+        haystack_end = haystack + ImStrlen(haystack);
+    const int haystack_len = (int)(haystack_end - haystack);
+
+    int needle_first_n = -1;
+    int needle_len_min = INT_MAX;
+    for (int needle_n = 0; needle_n < needles_count; needle_n++)
+        if (!needles[needle_n].empty())
+        {
+            if (needle_first_n == -1)
+                needle_first_n = needle_n;
+            needle_len_min = ImMin(needle_len_min, (int)(needles[needle_n].e - needles[needle_n].b));
+        }
+    if (needle_first_n == -1)
+        return -1;
+
+    int found_n = needles_count; // Needles from found_n onward can't change the result any more
+#ifdef IM_STRISTR_BLOCK_SIZE
+    // Each block of positions is checked for all needles before moving on
+    const int pos_end_max = haystack_len - needle_len_min + 1;
+    for (int pos = 0; pos < pos_end_max && found_n > needle_first_n; pos += IM_STRISTR_BLOCK_SIZE)
+        for (int needle_n = needle_first_n; needle_n < found_n; needle_n++)
+        {
+            const ImGuiTextFilter::ImGuiTextRange& needle = needles[needle_n];
+            const int needle_len = (int)(needle.e - needle.b);
+            const int needle_pos_end = haystack_len - needle_len + 1;
+            if (needle_len == 0 || needle_pos_end < IM_STRISTR_BLOCK_SIZE || pos >= needle_pos_end)
+                continue;
+            const int needle_pos = ImMin(pos, needle_pos_end - IM_STRISTR_BLOCK_SIZE);
+            for (ImU32 mask = ImStristrCandidates(haystack + needle_pos, needle.b[0], needle.e[-1], needle_len); mask != 0; mask &= mask - 1)
+                if (ImStristrMatches(haystack + needle_pos + ImStristrLowestBit(mask), needle.b, needle_len))
+                {
+                    found_n = needle_n;
+                    break;
+                }
+        }
+#endif
+
+    // Needles with less than a block of positions in haystack
+    for (int needle_n = needle_first_n; needle_n < found_n; needle_n++)
+    {
+        const ImGuiTextFilter::ImGuiTextRange& needle = needles[needle_n];
+#ifdef IM_STRISTR_BLOCK_SIZE
+        if (haystack_len - (int)(needle.e - needle.b) + 1 >= IM_STRISTR_BLOCK_SIZE)
+            continue;
+#endif
+        if (!needle.empty() && ImStristr(haystack, haystack_end, needle.b, needle.e) != NULL)
+            found_n = needle_n;
+    }
+    return (found_n < needles_count) ? found_n : -1;
+}
+
 // Trim str by offsetting contents when there's leading data + writing a \0 at the trailing position. We use this in situation where the cost is negligible.
 void ImStrTrimBlanks(char* buf)
 {
@@ -2262,7 +2442,6 @@ void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end,
     }
 }
 
-#ifndef IMGUI_ENABLE_SSE4_2_CRC
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
@@ -2306,13 +2485,17 @@ static const ImU32 GCrc32LookupTable[256] =
     0xF36E6F75,0x0105EC76,0x12551F82,0xE03E9C81,0x34F4F86A,0xC69F7B69,0xD5CF889D,0x27A40B9E,0x79B737BA,0x8BDCB4B9,0x988C474D,0x6AE7C44E,0xBE2DA0A5,0x4C4623A6,0x5F16D052,0xAD7D5351
 #endif
 };
-#endif
 
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
 // FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
 ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
 {
+#if defined(IMGUI_HASH_WIDE)
+    return ImHashDataWide(data_p, data_size, seed);
+#elif defined(IMGUI_HASH_CRC32C_HW)
+    return ImHashDataCrc32cHw(data_p, data_size, seed);
+#else
     ImU32 crc = ~seed;
     const unsigned char* data = (const unsigned char*)data_p;
     const unsigned char *data_end = (const unsigned char*)data_p + data_size;
@@ -2331,6 +2514,7 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
         crc = _mm_crc32_u8(crc, *data++);
     return ~crc;
 #endif
+#endif // #if defined(IMGUI_HASH_WIDE)
 }
 
 // Zero-terminated string hash, with support for ### to reset back to seed value
@@ -2341,6 +2525,11 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
 // FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
 ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
 {
+#if defined(IMGUI_HASH_WIDE)
+    return ImHashStrWide(data_p, data_size, seed);
+#elif defined(IMGUI_HASH_CRC32C_HW)
+    return ImHashStrCrc32cHw(data_p, data_size, seed);
+#else
     seed = ~seed;
     ImU32 crc = seed;
     const unsigned char* data = (const unsigned char*)data_p;
@@ -2375,6 +2564,188 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
         }
     }
     return ~crc;
+#endif // #if defined(IMGUI_HASH_WIDE)
+}
+
+// Alternative hashes, selected with IMGUI_HASH_CRC32C_HW/IMGUI_HASH_WIDE in imconfig.h, but always compiled so they can be compared.
+// - ImHashXXXCrc32Table(): CRC32c (or legacy CRC32) through the lookup table, whatever the build settings.
+// - ImHashXXXCrc32cHw(): CRC32c through the x86 SSE 4.2 or ARMv8 CRC32 instructions, detected at runtime. Same values as the lookup table.
+// - ImHashXXXWide(): 8 bytes per step, no lookup table. Different values (see ImHashWideRound() in imgui_internal.h).
+// Instead of resetting the hash when encountering ###, the string variants look for the last ### first and only hash from there:
+// this gives the same result and lets the hash itself consume several bytes per step.
+ImGuiID ImHashDataCrc32Table(const void* data_p, size_t data_size, ImGuiID seed)
+{
+    ImU32 crc = ~seed;
+    const unsigned char* data = (const unsigned char*)data_p;
+    const unsigned char* data_end = data + data_size;
+    const ImU32* crc32_lut = GCrc32LookupTable;
+    while (data < data_end)
+        crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
+    return ~crc;
+}
+
+// Compute the length of a string when 'data_size' is 0, and skip everything before the last ### (which resets the hash to its seed)
+static const char* ImHashStrSkipToLastTripleHash(const char* data, size_t* p_data_size)
+{
+    size_t data_size = *p_data_size;
+    if (data_size == 0)
+        data_size = strlen(data);
+    const char* data_end = data + data_size;
+    const char* start = data;
+    for (const char* p = data; data_end - p >= 3; p++)
+    {
+        p = (const char*)memchr(p, '#', (size_t)(data_end - p - 2));
+        if (p == NULL)
+            break;
+        if (p[1] == '#' && p[2] == '#')
+            start = p;
+    }
+    *p_data_size = (size_t)(data_end - start);
+    return start;
+}
+
+ImGuiID ImHashStrCrc32Table(const char* data_p, size_t data_size, ImGuiID seed)
+{
+    data_p = ImHashStrSkipToLastTripleHash(data_p, &data_size);
+    return ImHashDataCrc32Table(data_p, data_size, seed);
+}
+
+#if !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(__EMSCRIPTEN__) && (defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__))
+#define IMGUI_HASH_CRC32C_HW_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>         // __cpuid
+#define IMGUI_HASH_CRC32C_HW_TARGET
+#else
+#include <cpuid.h>          // __get_cpuid
+#include <nmmintrin.h>      // _mm_crc32_u8
+#define IMGUI_HASH_CRC32C_HW_TARGET __attribute__((target("sse4.2")))
+#endif
+#elif !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && (defined(_M_ARM64) || defined(__aarch64__))
+#define IMGUI_HASH_CRC32C_HW_ARM64
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>         // __crc32cd
+#define IMGUI_HASH_CRC32C_HW_TARGET
+#else
+#include <arm_acle.h>       // __crc32cd
+#if defined(__clang__)
+#define IMGUI_HASH_CRC32C_HW_TARGET __attribute__((target("crc")))
+#else
+#define IMGUI_HASH_CRC32C_HW_TARGET __attribute__((target("+crc")))
+#endif
+#if defined(__linux__) && !defined(__ARM_FEATURE_CRC32)
+#include <sys/auxv.h>       // getauxval
+#include <asm/hwcap.h>      // HWCAP_CRC32
+#endif
+#endif
+#endif
+
+#if defined(IMGUI_HASH_CRC32C_HW_X86) || defined(IMGUI_HASH_CRC32C_HW_ARM64)
+static bool ImHashCrc32cHwDetect()
+{
+#if defined(IMGUI_ENABLE_SSE4_2) || defined(__ARM_FEATURE_CRC32)
+    return true; // Already required by the build settings
+#elif defined(IMGUI_HASH_CRC32C_HW_X86) && defined(_MSC_VER) && !defined(__clang__)
+    int cpu_info[4];
+    __cpuid(cpu_info, 1);
+    return (cpu_info[2] & (1 << 20)) != 0; // ECX.SSE4_2
+#elif defined(IMGUI_HASH_CRC32C_HW_X86)
+    unsigned int eax, ebx, ecx, edx;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_2) != 0;
+#elif defined(__APPLE__)
+    return true; // All Apple ARM64 CPUs implement CRC32
+#elif defined(_WIN32) && defined(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE)
+    return ::IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE) != 0;
+#elif defined(_WIN32)
+    return true; // Windows on ARM requires ARMv8.1, where CRC32 is mandatory
+#elif defined(__linux__)
+    return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+#else
+    return false;
+#endif
+}
+
+static IMGUI_HASH_CRC32C_HW_TARGET ImU32 ImHashCrc32cHwUpdate(ImU32 crc, const unsigned char* data, size_t data_size)
+{
+    const unsigned char* data_end = data + data_size;
+#if defined(IMGUI_HASH_CRC32C_HW_X86) && (defined(_M_X64) || defined(__x86_64__))
+    for (ImU64 word; data + 8 <= data_end; data += 8)
+    {
+        memcpy(&word, data, 8);
+        crc = (ImU32)_mm_crc32_u64(crc, word);
+    }
+#elif defined(IMGUI_HASH_CRC32C_HW_X86)
+    for (ImU32 word; data + 4 <= data_end; data += 4)
+    {
+        memcpy(&word, data, 4);
+        crc = _mm_crc32_u32(crc, word);
+    }
+#else
+    for (ImU64 word; data + 8 <= data_end; data += 8)
+    {
+        memcpy(&word, data, 8);
+        crc = __crc32cd(crc, word);
+    }
+#endif
+    while (data < data_end)
+#if defined(IMGUI_HASH_CRC32C_HW_X86)
+        crc = _mm_crc32_u8(crc, *data++);
+#else
+        crc = __crc32cb(crc, *data++);
+#endif
+    return crc;
+}
+#endif // #if defined(IMGUI_HASH_CRC32C_HW_X86) || defined(IMGUI_HASH_CRC32C_HW_ARM64)
+
+bool ImHashCrc32cHwAvailable()
+{
+#if defined(IMGUI_HASH_CRC32C_HW_X86) || defined(IMGUI_HASH_CRC32C_HW_ARM64)
+    // IDs are hashed from worker threads too (e.g. parallel draw lists): rely on thread-safe initialization of local statics
+    static const bool available = ImHashCrc32cHwDetect();
+    return available;
+#else
+    return false;
+#endif
+}
+
+ImGuiID ImHashDataCrc32cHw(const void* data_p, size_t data_size, ImGuiID seed)
+{
+#if defined(IMGUI_HASH_CRC32C_HW_X86) || defined(IMGUI_HASH_CRC32C_HW_ARM64)
+    if (ImHashCrc32cHwAvailable())
+        return ~ImHashCrc32cHwUpdate(~seed, (const unsigned char*)data_p, data_size);
+#endif
+    return ImHashDataCrc32Table(data_p, data_size, seed);
+}
+
+ImGuiID ImHashStrCrc32cHw(const char* data_p, size_t data_size, ImGuiID seed)
+{
+    data_p = ImHashStrSkipToLastTripleHash(data_p, &data_size);
+    return ImHashDataCrc32cHw(data_p, data_size, seed);
+}
+
+ImGuiID ImHashDataWide(const void* data_p, size_t data_size, ImGuiID seed)
+{
+    const char* data = (const char*)data_p;
+    const char* data_end = data + data_size;
+    ImU64 h = ImHashWideBegin(data_size, seed);
+    for (; data + 8 <= data_end; data += 8)
+    {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        h = ImHashWideRound(h, ImHashWideLoad(data, 8));
+#else
+        ImU64 word;
+        memcpy(&word, data, 8);
+        h = ImHashWideRound(h, word);
+#endif
+    }
+    if (data < data_end)
+        h = ImHashWideRound(h, ImHashWideLoad(data, (size_t)(data_end - data)));
+    return ImHashWideEnd(h);
+}
+
+ImGuiID ImHashStrWide(const char* data_p, size_t data_size, ImGuiID seed)
+{
+    data_p = ImHashStrSkipToLastTripleHash(data_p, &data_size);
+    return ImHashDataWide(data_p, data_size, seed);
 }
 
 //-----------------------------------------------------------------------------
@@ -2782,18 +3153,155 @@ static int IMGUI_CDECL PairComparerByID(const void* lhs, const void* rhs)
     return (lhs_v > rhs_v ? +1 : lhs_v < rhs_v ? -1 : 0);
 }
 
+// Hash mode: linear probing over a power-of-two table of (key, index) slots.
+// - Slots hold the key next to the index so that probing never touches Data. Keys are remixed since users may store sequential keys.
+// - Removal shifts the following entries of the cluster back instead of leaving tombstones, so lookups never degrade over time.
+static inline ImU32 ImGuiStorage_HashKey(ImGuiID key)
+{
+    key ^= key >> 16;
+    key *= 0x7FEB352D;
+    key ^= key >> 15;
+    key *= 0x846CA68B;
+    key ^= key >> 16;
+    return key;
+}
+
+static void ImGuiStorage_BuildHashIndex(ImGuiStorage* storage, int min_count)
+{
+    int capacity = 16;
+    while (capacity * 3 < min_count * 4)
+        capacity <<= 1;
+    storage->HashSlots.resize(capacity);
+    memset(storage->HashSlots.Data, 0xFF, (size_t)capacity * sizeof(ImGuiStorageHashSlot));
+    const ImU32 mask = (ImU32)capacity - 1;
+    for (int n = 0; n < storage->Data.Size; n++)
+    {
+        const ImGuiID key = storage->Data.Data[n].key;
+        ImU32 i = ImGuiStorage_HashKey(key) & mask;
+        while (storage->HashSlots.Data[i].index != -1)
+            i = (i + 1) & mask;
+        storage->HashSlots.Data[i].key = key;
+        storage->HashSlots.Data[i].index = n;
+    }
+}
+
+// Returns the slot holding 'key', or the empty slot ending its probe sequence. The index must not be empty.
+static inline ImGuiStorageHashSlot* ImGuiStorage_FindHashSlot(const ImGuiStorage* storage, ImGuiID key)
+{
+    const ImU32 mask = (ImU32)storage->HashSlots.Size - 1;
+    ImGuiStorageHashSlot* slots = const_cast<ImGuiStorageHashSlot*>(storage->HashSlots.Data);
+    for (ImU32 i = ImGuiStorage_HashKey(key) & mask; ; i = (i + 1) & mask)
+        if (slots[i].index == -1 || slots[i].key == key)
+            return &slots[i];
+}
+
+static ImGuiStoragePair* ImGuiStorage_Find(const ImGuiStorage* storage, ImGuiID key)
+{
+    ImGuiStoragePair* data = const_cast<ImGuiStoragePair*>(storage->Data.Data);
+    if (storage->HashMode)
+    {
+        if (storage->HashSlots.Size == 0)
+            return NULL;
+        ImGuiStorageHashSlot* slot = ImGuiStorage_FindHashSlot(storage, key);
+        return (slot->index != -1) ? &data[slot->index] : NULL;
+    }
+    ImGuiStoragePair* it = ImLowerBound(data, data + storage->Data.Size, key);
+    return (it != data + storage->Data.Size && it->key == key) ? it : NULL;
+}
+
+// Returns the existing pair for 'pair.key', or inserts 'pair'
+static ImGuiStoragePair* ImGuiStorage_FindOrInsert(ImGuiStorage* storage, const ImGuiStoragePair& pair)
+{
+    if (storage->HashMode)
+    {
+        ImGuiStorageHashSlot* slot = (storage->HashSlots.Size > 0) ? ImGuiStorage_FindHashSlot(storage, pair.key) : NULL;
+        if (slot && slot->index != -1)
+            return &storage->Data.Data[slot->index];
+        if ((storage->Data.Size + 1) * 4 > storage->HashSlots.Size * 3)
+        {
+            ImGuiStorage_BuildHashIndex(storage, storage->Data.Size + 1);
+            slot = ImGuiStorage_FindHashSlot(storage, pair.key);
+        }
+        slot->key = pair.key;
+        slot->index = storage->Data.Size;
+        storage->Data.push_back(pair);
+        return &storage->Data.back();
+    }
+    ImGuiStoragePair* it = ImLowerBound(storage->Data.Data, storage->Data.Data + storage->Data.Size, pair.key);
+    if (it == storage->Data.Data + storage->Data.Size || it->key != pair.key)
+        it = storage->Data.insert(it, pair);
+    return it;
+}
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
     ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+    if (HashMode)
+        ImGuiStorage_BuildHashIndex(this, Data.Size);
+}
+
+void ImGuiStorage::SetHashMode(bool hash_mode)
+{
+    if (HashMode == hash_mode)
+        return;
+    HashMode = hash_mode;
+    if (HashMode)
+    {
+        ImGuiStorage_BuildHashIndex(this, Data.Size);
+    }
+    else
+    {
+        HashSlots.clear();
+        BuildSortByKey();
+    }
+}
+
+void ImGuiStorage::Remove(ImGuiID key)
+{
+    if (!HashMode)
+    {
+        ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
+        if (it != Data.Data + Data.Size && it->key == key)
+            Data.erase(it);
+        return;
+    }
+    if (HashSlots.Size == 0)
+        return;
+    ImGuiStorageHashSlot* slot = ImGuiStorage_FindHashSlot(this, key);
+    if (slot->index == -1)
+        return;
+    const int index = slot->index;
+
+    // Backward shift: move each following entry of the cluster into the hole unless that would put it before its home slot
+    const ImU32 mask = (ImU32)HashSlots.Size - 1;
+    ImU32 hole = (ImU32)(slot - HashSlots.Data);
+    for (ImU32 i = (hole + 1) & mask; HashSlots.Data[i].index != -1; i = (i + 1) & mask)
+    {
+        const ImU32 home = ImGuiStorage_HashKey(HashSlots.Data[i].key) & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask))
+        {
+            HashSlots.Data[hole] = HashSlots.Data[i];
+            hole = i;
+        }
+    }
+    HashSlots.Data[hole].key = (ImGuiID)-1;
+    HashSlots.Data[hole].index = -1;
+
+    // Keep Data dense
+    const int last = Data.Size - 1;
+    if (index != last)
+    {
+        Data.Data[index] = Data.Data[last];
+        ImGuiStorage_FindHashSlot(this, Data.Data[index].key)->index = index;
+    }
+    Data.pop_back();
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return default_val;
-    return it->val_i;
+    ImGuiStoragePair* it = ImGuiStorage_Find(this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -2803,27 +3311,20 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return default_val;
-    return it->val_f;
+    ImGuiStoragePair* it = ImGuiStorage_Find(this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        return NULL;
-    return it->val_p;
+    ImGuiStoragePair* it = ImGuiStorage_Find(this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_i;
+    return &ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, default_val))->val_i;
 }
 
 bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
@@ -2833,28 +3334,17 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_f;
+    return &ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, default_val))->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_p;
+    return &ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, default_val))->val_p;
 }
 
-// FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_i = val;
+    ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, val))->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2864,20 +3354,12 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_f = val;
+    ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, val))->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
-    if (it == Data.Data + Data.Size || it->key != key)
-        Data.insert(it, ImGuiStoragePair(key, val));
-    else
-        it->val_p = val;
+    ImGuiStorage_FindOrInsert(this, ImGuiStoragePair(key, val))->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2894,7 +3376,7 @@ IM_MSVC_RUNTIME_CHECKS_RESTORE
 // Helper: Parse and apply text filters. In format "aaaaa[,bbbb][,ccccc]"
 ImGuiTextFilter::ImGuiTextFilter(const char* default_filter) //-V1077
 {
-    InputBuf[0] = 0;
+    InputBuf[0] = InputBufUpper[0] = 0;
     CountGrep = 0;
     if (default_filter)
     {
@@ -2949,6 +3431,19 @@ void ImGuiTextFilter::Build()
         if (f.b[0] != '-')
             CountGrep += 1;
     }
+
+    // Upper-cased needles, without the '-' prefix, so PassFilter() can look for all of them at once
+    for (int n = 0; InputBuf[n] != 0; n++)
+        InputBufUpper[n] = (char)ImToUpper(InputBuf[n]);
+    InputBufUpper[input_range.e - input_range.b] = 0;
+    FiltersUpper.resize(Filters.Size);
+    for (int filter_n = 0; filter_n < Filters.Size; filter_n++)
+    {
+        const ImGuiTextRange& f = Filters[filter_n];
+        const char* b = InputBufUpper + (f.b - InputBuf) + ((!f.empty() && f.b[0] == '-') ? 1 : 0);
+        const char* e = InputBufUpper + (f.e - InputBuf);
+        FiltersUpper[filter_n] = ImGuiTextRange(b, ImMax(b, e));
+    }
 }
 
 bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
@@ -2959,29 +3454,102 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
     if (text == NULL)
         text = text_end = "";
 
-    for (const ImGuiTextRange& f : Filters)
-    {
-        if (f.b == f.e)
-            continue;
-        if (f.b[0] == '-')
+    // The first filter found in text decides: Subtract filters fail, Grep filters pass
+    const int filter_n = ImStristrFirstOf(text, text_end, FiltersUpper.Data, FiltersUpper.Size);
+    if (filter_n != -1)
+        return Filters[filter_n].b[0] != '-';
+
+    // Implicit * grep
+    if (CountGrep == 0)
+        return true;
+
+    return false;
+}
+
+void ImGuiTextFilterIndex::AddItem(const char* text, const char* text_end)
+{
+    if (!text_end)
+        text_end = text + ImStrlen(text);
+    const int offset = ItemsBuf.Size;
+    ItemsOffsets.push_back(offset);
+    ItemsBuf.resize(offset + (int)(text_end - text) + 1);
+    char* dst = ItemsBuf.Data + offset;
+    for (const char* src = text; src < text_end; src++)
+        *dst++ = (char)ImToUpper(*src);
+    *dst = 0;
+    ClearFilterResult();
+}
+
+// Apply filter to all items, with the same result as calling filter.PassFilter() on each of them.
+// - Each filter is searched through ItemsBuf in one go: a match skips to the next item, so items without a match cost no more than their bytes.
+// - A single Grep filter containing the previous one (e.g. typing "ste" after "st") can only pass a subset of the previous items: only those are searched.
+void ImGuiTextFilterIndex::Filter(const ImGuiTextFilter& filter)
+{
+    const ImGuiTextFilter::ImGuiTextRange* single_term = NULL;
+    int terms_count = 0;
+    for (int filter_n = 0; filter_n < filter.Filters.Size; filter_n++)
+        if (!filter.FiltersUpper[filter_n].empty())
         {
-            // Subtract
-            if (ImStristr(text, text_end, f.b + 1, f.e) != NULL)
-                return false;
+            single_term = (filter.Filters[filter_n].b[0] != '-') ? &filter.FiltersUpper[filter_n] : NULL;
+            terms_count++;
         }
-        else
+    if (terms_count != 1)
+        single_term = NULL;
+
+    const char* buf = ItemsBuf.Data;
+    const char* buf_end = ItemsBuf.Data + ItemsBuf.Size;
+    if (single_term != NULL && LastTerm.Size > 0 && ImStristr(single_term->b, single_term->e, LastTerm.Data, NULL) != NULL)
+    {
+        // Narrow down
+        int passed_count = 0;
+        for (int passed_n = 0; passed_n < PassedItems.Size; passed_n++)
         {
-            // Grep
-            if (ImStristr(text, text_end, f.b, f.e) != NULL)
-                return true;
+            const int item_n = PassedItems.Data[passed_n];
+            const char* item_begin = buf + ItemsOffsets.Data[item_n];
+            const char* item_end = (item_n + 1 < ItemsOffsets.Size) ? buf + ItemsOffsets.Data[item_n + 1] - 1 : buf_end - 1;
+            if (ImStristr(item_begin, item_end, single_term->b, single_term->e) != NULL)
+                PassedItems.Data[passed_count++] = item_n;
         }
+        PassedItems.resize(passed_count);
     }
+    else
+    {
+        ItemsFirstFilter.resize(ItemsOffsets.Size);
+        memset(ItemsFirstFilter.Data, 0xFF, (size_t)ItemsFirstFilter.size_in_bytes()); // -1
+        for (int filter_n = 0; filter_n < filter.FiltersUpper.Size; filter_n++)
+        {
+            const ImGuiTextFilter::ImGuiTextRange& needle = filter.FiltersUpper[filter_n];
+            if (needle.empty())
+                continue;
+            int item_n = 0;
+            for (const char* p = buf; (p = ImStristr(p, buf_end, needle.b, needle.e)) != NULL; )
+            {
+                // Matches are found in ascending order: walk forward to the item containing p
+                const int buf_offset = (int)(p - buf);
+                while (item_n + 1 < ItemsOffsets.Size && ItemsOffsets.Data[item_n + 1] <= buf_offset)
+                    item_n++;
+                if (ItemsFirstFilter.Data[item_n] == -1)
+                    ItemsFirstFilter.Data[item_n] = filter_n;
+                p = (item_n + 1 < ItemsOffsets.Size) ? buf + ItemsOffsets.Data[item_n + 1] : buf_end;
+            }
+        }
 
-    // Implicit * grep
-    if (CountGrep == 0)
-        return true;
+        PassedItems.resize(0);
+        for (int item_n = 0; item_n < ItemsOffsets.Size; item_n++)
+        {
+            const int filter_n = ItemsFirstFilter.Data[item_n];
+            if ((filter_n == -1) ? (filter.CountGrep == 0) : (filter.Filters[filter_n].b[0] != '-'))
+                PassedItems.push_back(item_n);
+        }
+    }
 
-    return false;
+    LastTerm.resize(0);
+    if (single_term != NULL)
+    {
+        LastTerm.resize((int)(single_term->e - single_term->b) + 1);
+        memcpy(LastTerm.Data, single_term->b, (size_t)(single_term->e - single_term->b));
+        LastTerm.back() = 0;
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -4023,6 +4591,9 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
 
     WindowsActiveCount = 0;
     WindowsBorderHoverPadding = 0.0f;
+#ifdef IMGUI_ENABLE_STORAGE_HASH_MODE
+    WindowsById.SetHashMode(true);
+#endif
     CurrentWindow = NULL;
     HoveredWindow = NULL;
     HoveredWindowUnderMovingWindow = NULL;
@@ -4345,11 +4916,14 @@ void ImGui::Shutdown()
 
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
+    g.PlotRanges.clear();
     g.InputTextState.ClearFreeMemory();
     g.InputTextDeactivatedState.ClearFreeMemory();
 
     g.SettingsWindows.clear();
     g.SettingsHandlers.clear();
+    g.SettingsDirtyWindows.clear();
+    g.SettingsDirtyTables.clear();
 
     if (g.LogFile)
     {
@@ -4410,6 +4984,9 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* ctx, const char* name) : DrawListInst(NUL
     ID = ImHashStr(name);
     IDStack.push_back(ID);
     MoveId = GetID("#MOVE");
+#ifdef IMGUI_ENABLE_STORAGE_HASH_MODE
+    StateStorage.SetHashMode(true);
+#endif
     ScrollTarget = ImVec2(FLT_MAX, FLT_MAX);
     ScrollTargetCenterRatio = ImVec2(0.5f, 0.5f);
     AutoFitFramesX = AutoFitFramesY = -1;
@@ -14982,6 +15559,11 @@ void ImGui::LogButtons()
 //-----------------------------------------------------------------------------
 // - UpdateSettings() [Internal]
 // - MarkIniSettingsDirty() [Internal]
+// - GatherDirtySettings() [Internal]
+// - SaveSettingsRecordsHeader() [Internal]
+// - SaveWindowSettingsRecord() [Internal]
+// - SaveTableSettingsRecord() [Internal]
+// - LoadSettingsRecords() [Internal]
 // - FindSettingsHandler() [Internal]
 // - ClearIniSettings() [Internal]
 // - LoadIniSettingsFromDisk()
@@ -15034,9 +15616,275 @@ void ImGui::MarkIniSettingsDirty()
 void ImGui::MarkIniSettingsDirty(ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
-    if (!(window->Flags & ImGuiWindowFlags_NoSavedSettings))
-        if (g.SettingsDirtyTimer <= 0.0f)
-            g.SettingsDirtyTimer = g.IO.IniSavingRate;
+    if (window->Flags & ImGuiWindowFlags_NoSavedSettings)
+        return;
+    if (g.SettingsDirtyTimer <= 0.0f)
+        g.SettingsDirtyTimer = g.IO.IniSavingRate;
+    if (!window->SettingsDirty)
+    {
+        window->SettingsDirty = true;
+        g.SettingsDirtyWindows.push_back(window->ID);
+    }
+}
+
+static ImGuiWindowSettings* UpdateWindowSettings(ImGuiWindow* window);
+
+// For incremental saving: SaveIniSettingsToMemory() writes every settings entry, including the ones of windows which were never
+// instanced during this session. This returns the entries of the windows marked by MarkIniSettingsDirty(window) and of the
+// tables which called TableSaveSettings() since the last call, so the cost of saving follows the number of changes.
+// Windows entries are created on their first save, hence gathering their offsets first.
+void ImGui::GatherDirtySettings(ImVector<ImGuiWindowSettings*>* out_windows, ImVector<ImGuiTableSettings*>* out_tables)
+{
+    ImGuiContext& g = *GImGui;
+    ImVector<int> window_offsets;
+    for (ImGuiID id : g.SettingsDirtyWindows)
+    {
+        ImGuiWindow* window = FindWindowByID(id);
+        if (window == NULL || !window->SettingsDirty)
+            continue;
+        window->SettingsDirty = false;
+        if (window->Flags & ImGuiWindowFlags_NoSavedSettings)
+            continue;
+        window_offsets.push_back(g.SettingsWindows.offset_from_ptr(UpdateWindowSettings(window)));
+    }
+    g.SettingsDirtyWindows.resize(0);
+
+    out_windows->resize(0);
+    for (int offset : window_offsets)
+        out_windows->push_back(g.SettingsWindows.ptr_from_offset(offset));
+
+    out_tables->resize(0);
+    for (ImGuiID id : g.SettingsDirtyTables)
+    {
+        ImGuiTable* table = TableFindByID(id);
+        if (table == NULL || !table->IsSettingsQueued)
+            continue;
+        table->IsSettingsQueued = false;
+        if (ImGuiTableSettings* settings = TableGetBoundSettings(table))
+            out_tables->push_back(settings);
+    }
+    g.SettingsDirtyTables.resize(0);
+}
+
+// Binary records of settings entries, for incremental saving e.g. appending the entries returned by GatherDirtySettings() to a file.
+// Loading sorts the records by entry once to keep the latest of each, instead of looking up the existing settings for every entry as
+// LoadIniSettingsFromMemory() does, which is quadratic in the number of entries. Fields are written one by one in native byte order.
+#define IMGUI_SETTINGS_RECORDS_VERSION  1
+
+struct ImGuiSettingsRecordReader
+{
+    const char*     Data;
+    const char*     DataEnd;
+    bool            Error;
+
+    ImGuiSettingsRecordReader(const void* data, size_t data_size) { Data = (const char*)data; DataEnd = Data + data_size; Error = false; }
+    const char*     Skip(size_t size)               { if (Error || (size_t)(DataEnd - Data) < size) { Error = true; return NULL; } const char* p = Data; Data += size; return p; }
+    void            Read(void* dst, size_t size)    { const char* p = Skip(size); if (p != NULL) memcpy(dst, p, size); else memset(dst, 0, size); }
+};
+
+// Position of a record within the data, sorted by entry then by position
+struct ImGuiSettingsRecordRef
+{
+    ImU64           Key;                // Type << 32 | ID
+    size_t          Offset;
+};
+
+static int IMGUI_CDECL SettingsRecordRefCompare(const void* lhs, const void* rhs)
+{
+    const ImGuiSettingsRecordRef* a = (const ImGuiSettingsRecordRef*)lhs;
+    const ImGuiSettingsRecordRef* b = (const ImGuiSettingsRecordRef*)rhs;
+    if (a->Key != b->Key)
+        return (a->Key < b->Key) ? -1 : +1;
+    return (a->Offset < b->Offset) ? -1 : (a->Offset > b->Offset) ? +1 : 0;
+}
+
+static ImGuiID SettingsRecordHash(const ImGuiSettingsRecordHeader* header, const void* payload)
+{
+    ImGuiID seed = ImHashData(header, offsetof(ImGuiSettingsRecordHeader, Hash));
+    return ImHashData(payload, header->PayloadSize, seed);
+}
+
+static void SettingsRecordWrite(ImVector<char>* out_data, const void* data, size_t data_size)
+{
+    if (data_size == 0)
+        return;
+    const int offset = out_data->Size;
+    out_data->resize(offset + (int)data_size);
+    memcpy(out_data->Data + offset, data, data_size);
+}
+
+static int SettingsRecordBegin(ImVector<char>* out_data, ImU32 type, ImGuiID id)
+{
+    ImGuiSettingsRecordHeader header = {};
+    header.Type = type;
+    header.ID = id;
+    const int offset = out_data->Size;
+    SettingsRecordWrite(out_data, &header, sizeof(header));
+    return offset;
+}
+
+static void SettingsRecordEnd(ImVector<char>* out_data, int offset)
+{
+    ImGuiSettingsRecordHeader header;
+    memcpy(&header, out_data->Data + offset, sizeof(header));
+    header.PayloadSize = (ImU32)(out_data->Size - offset - (int)sizeof(header));
+    header.Hash = SettingsRecordHash(&header, out_data->Data + offset + sizeof(header));
+    memcpy(out_data->Data + offset, &header, sizeof(header));
+}
+
+void ImGui::SaveSettingsRecordsHeader(ImVector<char>* out_data)
+{
+    ImGuiSettingsRecordsHeader header;
+    memcpy(header.Magic, "IMSR", 4);
+    header.Version = IMGUI_SETTINGS_RECORDS_VERSION;
+    SettingsRecordWrite(out_data, &header, sizeof(header));
+}
+
+void ImGui::SaveWindowSettingsRecord(ImGuiWindowSettings* settings, ImVector<char>* out_data)
+{
+    const char* name = settings->GetName();
+    const ImU16 name_len = (ImU16)ImMin(ImStrlen(name), (size_t)0xFFFF);
+    const ImU8 flags[] = { (ImU8)settings->Collapsed, (ImU8)settings->IsChild };
+    const int offset = SettingsRecordBegin(out_data, ImGuiSettingsRecordType_Window, settings->ID);
+    SettingsRecordWrite(out_data, &settings->Pos, sizeof(settings->Pos));
+    SettingsRecordWrite(out_data, &settings->Size, sizeof(settings->Size));
+    SettingsRecordWrite(out_data, flags, sizeof(flags));
+    SettingsRecordWrite(out_data, &name_len, sizeof(name_len));
+    SettingsRecordWrite(out_data, name, name_len);
+    SettingsRecordEnd(out_data, offset);
+}
+
+void ImGui::SaveTableSettingsRecord(ImGuiTableSettings* settings, ImVector<char>* out_data)
+{
+    const int offset = SettingsRecordBegin(out_data, ImGuiSettingsRecordType_Table, settings->ID);
+    SettingsRecordWrite(out_data, &settings->SaveFlags, sizeof(settings->SaveFlags));
+    SettingsRecordWrite(out_data, &settings->RefScale, sizeof(settings->RefScale));
+    SettingsRecordWrite(out_data, &settings->ColumnsCount, sizeof(settings->ColumnsCount));
+    ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+    for (int column_n = 0; column_n < settings->ColumnsCount; column_n++, column++)
+    {
+        const ImGuiTableColumnIdx indices[] = { column->Index, column->DisplayOrder, column->SortOrder };
+        const ImS8 bits[] = { (ImS8)column->SortDirection, (ImS8)column->IsEnabled, (ImS8)column->IsStretch };
+        SettingsRecordWrite(out_data, &column->WidthOrWeight, sizeof(column->WidthOrWeight));
+        SettingsRecordWrite(out_data, &column->UserID, sizeof(column->UserID));
+        SettingsRecordWrite(out_data, indices, sizeof(indices));
+        SettingsRecordWrite(out_data, bits, sizeof(bits));
+    }
+    SettingsRecordEnd(out_data, offset);
+}
+
+static void LoadWindowSettingsRecord(const char* payload, ImU32 payload_size, ImVector<char>* name_buf)
+{
+    ImGuiSettingsRecordReader reader(payload, payload_size);
+    ImVec2ih pos, size;
+    ImU8 flags[2];
+    ImU16 name_len;
+    reader.Read(&pos, sizeof(pos));
+    reader.Read(&size, sizeof(size));
+    reader.Read(flags, sizeof(flags));
+    reader.Read(&name_len, sizeof(name_len));
+    const char* name = reader.Skip(name_len);
+    if (reader.Error)
+        return;
+    name_buf->resize(name_len + 1);
+    memcpy(name_buf->Data, name, name_len);
+    name_buf->Data[name_len] = 0;
+
+    ImGuiWindowSettings* settings = ImGui::CreateNewWindowSettings(name_buf->Data);
+    settings->ID = ImHashStr(name_buf->Data);
+    settings->Pos = pos;
+    settings->Size = size;
+    settings->Collapsed = flags[0] != 0;
+    settings->IsChild = flags[1] != 0;
+    settings->WantApply = true;
+}
+
+static void LoadTableSettingsRecord(ImGuiID id, const char* payload, ImU32 payload_size)
+{
+    ImGuiSettingsRecordReader reader(payload, payload_size);
+    ImGuiTableFlags save_flags;
+    float ref_scale;
+    ImGuiTableColumnIdx columns_count;
+    reader.Read(&save_flags, sizeof(save_flags));
+    reader.Read(&ref_scale, sizeof(ref_scale));
+    reader.Read(&columns_count, sizeof(columns_count));
+    if (reader.Error || columns_count <= 0 || columns_count > IMGUI_TABLE_MAX_COLUMNS)
+        return;
+
+    ImGuiTableSettings* settings = ImGui::TableSettingsCreate(id, columns_count);
+    settings->SaveFlags = save_flags;
+    settings->RefScale = ref_scale;
+    ImGuiTableColumnSettings* column = settings->GetColumnSettings();
+    for (int column_n = 0; column_n < columns_count; column_n++, column++)
+    {
+        ImGuiTableColumnIdx indices[3];
+        ImS8 bits[3];
+        reader.Read(&column->WidthOrWeight, sizeof(column->WidthOrWeight));
+        reader.Read(&column->UserID, sizeof(column->UserID));
+        reader.Read(indices, sizeof(indices));
+        reader.Read(bits, sizeof(bits));
+        column->Index = indices[0];
+        column->DisplayOrder = indices[1];
+        column->SortOrder = indices[2];
+        column->SortDirection = (ImU8)bits[0] & 3;
+        column->IsEnabled = bits[1];
+        column->IsStretch = (ImU8)bits[2] & 1;
+    }
+    if (reader.Error)
+        settings->ID = 0; // Ditch
+}
+
+size_t ImGui::LoadSettingsRecords(const void* data, size_t data_size)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.Initialized);
+    IM_ASSERT(g.SettingsWindows.empty() && g.SettingsTables.empty() && "Call LoadSettingsRecords() once, before the first frame!");
+    g.SettingsLoaded = true;
+
+    ImGuiSettingsRecordsHeader file_header;
+    if (data_size < sizeof(file_header))
+        return 0;
+    memcpy(&file_header, data, sizeof(file_header));
+    if (memcmp(file_header.Magic, "IMSR", 4) != 0 || file_header.Version != IMGUI_SETTINGS_RECORDS_VERSION)
+        return 0;
+
+    // Find records up to the first damaged one, e.g. from a write interrupted by a crash
+    const char* records_data = (const char*)data;
+    ImVector<ImGuiSettingsRecordRef> records;
+    size_t offset = sizeof(file_header);
+    while (data_size - offset >= sizeof(ImGuiSettingsRecordHeader))
+    {
+        ImGuiSettingsRecordHeader header;
+        memcpy(&header, records_data + offset, sizeof(header));
+        const char* payload = records_data + offset + sizeof(header);
+        if (header.PayloadSize > data_size - offset - sizeof(header) || SettingsRecordHash(&header, payload) != header.Hash)
+            break;
+        ImGuiSettingsRecordRef ref = { ((ImU64)header.Type << 32) | header.ID, offset };
+        records.push_back(ref);
+        offset += sizeof(header) + header.PayloadSize;
+    }
+
+    // Keep the latest record of each entry. Records of unknown types are skipped.
+    if (records.Size > 1)
+        ImQsort(records.Data, (size_t)records.Size, sizeof(ImGuiSettingsRecordRef), SettingsRecordRefCompare);
+    ImVector<char> name_buf;
+    for (int n = 0; n < records.Size; n++)
+    {
+        if (n + 1 < records.Size && records[n + 1].Key == records[n].Key)
+            continue;
+        ImGuiSettingsRecordHeader header;
+        memcpy(&header, records_data + records[n].Offset, sizeof(header));
+        const char* payload = records_data + records[n].Offset + sizeof(header);
+        if (header.Type == ImGuiSettingsRecordType_Window)
+            LoadWindowSettingsRecord(payload, header.PayloadSize, &name_buf);
+        else if (header.Type == ImGuiSettingsRecordType_Table)
+            LoadTableSettingsRecord(header.ID, payload, header.PayloadSize);
+    }
+
+    for (ImGuiSettingsHandler& handler : g.SettingsHandlers)
+        if (handler.ApplyAllFn != NULL)
+            handler.ApplyAllFn(&g, &handler);
+    return offset;
 }
 
 void ImGui::AddSettingsHandler(const ImGuiSettingsHandler* handler)
@@ -15288,6 +16136,25 @@ static void WindowSettingsHandler_ApplyAll(ImGuiContext* ctx, ImGuiSettingsHandl
         }
 }
 
+// Copy the state of a window into its settings entry, creating it on the first save
+static ImGuiWindowSettings* UpdateWindowSettings(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowSettings* settings = ImGui::FindWindowSettingsByWindow(window);
+    if (!settings)
+    {
+        settings = ImGui::CreateNewWindowSettings(window->Name);
+        window->SettingsOffset = g.SettingsWindows.offset_from_ptr(settings);
+    }
+    IM_ASSERT(settings->ID == window->ID);
+    settings->Pos = ImVec2ih(window->Pos);
+    settings->Size = ImVec2ih(window->SizeFull);
+    settings->IsChild = (window->Flags & ImGuiWindowFlags_ChildWindow) != 0;
+    settings->Collapsed = window->Collapsed;
+    settings->WantDelete = false;
+    return settings;
+}
+
 static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
 {
     // Gather data from windows that were active during this session
@@ -15297,19 +16164,7 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
     {
         if (window->Flags & ImGuiWindowFlags_NoSavedSettings)
             continue;
-
-        ImGuiWindowSettings* settings = ImGui::FindWindowSettingsByWindow(window);
-        if (!settings)
-        {
-            settings = ImGui::CreateNewWindowSettings(window->Name);
-            window->SettingsOffset = g.SettingsWindows.offset_from_ptr(settings);
-        }
-        IM_ASSERT(settings->ID == window->ID);
-        settings->Pos = ImVec2ih(window->Pos);
-        settings->Size = ImVec2ih(window->SizeFull);
-        settings->IsChild = (window->Flags & ImGuiWindowFlags_ChildWindow) != 0;
-        settings->Collapsed = window->Collapsed;
-        settings->WantDelete = false;
+        UpdateWindowSettings(window);
     }
 
     // Write to text buffer
@@ -17081,7 +17936,7 @@ void ImGui::DebugNodeFontGlyph(ImFont* font, const ImFontGlyph* glyph)
 // [DEBUG] Display contents of ImGuiStorage
 void ImGui::DebugNodeStorage(ImGuiStorage* storage, const char* label)
 {
-    if (!TreeNode(label, "%s: %d entries, %d bytes", label, storage->Data.Size, storage->Data.size_in_bytes()))
+    if (!TreeNode(label, "%s: %d entries, %d bytes%s", label, storage->Data.Size, storage->Data.size_in_bytes() + storage->HashSlots.size_in_bytes(), storage->HashMode ? " (hash mode)" : ""))
         return;
     for (const ImGuiStoragePair& p : storage->Data)
     {
@@ -178,6 +178,7 @@ struct ImFontConfig;                // Configuration data when adding a font or
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
 struct ImFontLoader;                // Opaque interface to a font loading backend (stb_truetype, FreeType etc.).
+struct ImFontTextLayoutCacheStats;  // Statistics of the text layout cache of a ImFontAtlas
 struct ImTextureData;               // Specs and pixel storage for a texture used by Dear ImGui.
 struct ImTextureRect;               // Coordinates of a rectangle within a texture.
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
@@ -199,6 +200,7 @@ struct ImGuiSelectionRequest;       // A selection request (stored in ImGuiMulti
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage (container sorted by key)
 struct ImGuiStoragePair;            // Helper for key->value storage (pair)
+struct ImGuiStorageHashSlot;        // Helper for key->value storage (hash index slot)
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
@@ -2688,6 +2690,8 @@ struct ImGuiTextFilter
     char                    InputBuf[256];
     ImVector<ImGuiTextRange>Filters;
     int                     CountGrep;
+    char                    InputBufUpper[256];     // Upper-cased copy of InputBuf
+    ImVector<ImGuiTextRange>FiltersUpper;           // Filters[] in InputBufUpper, without their '-' prefix
 };
 
 // Helper: Growable text buffer for logging/accumulating text
@@ -2722,6 +2726,13 @@ struct ImGuiStoragePair
     ImGuiStoragePair(ImGuiID _key, void* _val)  { key = _key; val_p = _val; }
 };
 
+// [Internal] Slot of the ImGuiStorage hash index (see ImGuiStorage::SetHashMode())
+struct ImGuiStorageHashSlot
+{
+    ImGuiID     key;
+    int         index;      // Index into ImGuiStorage::Data, -1 for an empty slot
+};
+
 // Helper: Key->Value storage
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
@@ -2734,11 +2745,15 @@ struct ImGuiStorage
 {
     // [Internal]
     ImVector<ImGuiStoragePair>      Data;
+    ImVector<ImGuiStorageHashSlot>  HashSlots;  // Open addressing index into Data, only in hash mode
+    bool                            HashMode;
+
+    ImGuiStorage()      { HashMode = false; }
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    void                Clear() { Data.clear(); HashSlots.clear(); }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2758,7 +2773,14 @@ struct ImGuiStorage
     IMGUI_API void**    GetVoidPtrRef(ImGuiID key, void* default_val = NULL);
 
     // Advanced: for quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // In hash mode this also rebuilds the index: call it after modifying Data directly.
     IMGUI_API void      BuildSortByKey();
+    // Advanced: hash mode, for storages holding many keys (e.g. very large trees). Same API, but queries and insertions are O(1).
+    // - Data is no longer sorted, pairs are indexed by a linear probing hash table (8 bytes per slot, at most 3/4 full).
+    // - Code searching Data with ImLowerBound() (e.g. ImGuiSelectionBasicStorage) requires the default sorted mode.
+    IMGUI_API void      SetHashMode(bool hash_mode);
+    // Remove a pair if it exists. In hash mode the last pair of Data is moved into the freed one.
+    IMGUI_API void      Remove(ImGuiID key);
     // Obsolete: use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
 
@@ -3187,6 +3209,8 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
     ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_NoSimdTessellation      = 1 << 4,  // Use the scalar code for anti-aliased AddPolyline()/AddConvexPolyFilled() even when the SIMD code is compiled in. Output is the same: for validation and benchmarks.
+    ImDrawListFlags_NoTextLayoutCache       = 1 << 5,  // Don't use the text layout cache of the font atlas in RenderText()/AddText(). Set on draw lists filled from other threads.
 };
 
 // Draw command list
@@ -3557,6 +3581,24 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_TextLayoutCache    = 1 << 3,   // Cache the layout of texts seen on consecutive frames: CalcTextSizeA() returns the cached size and RenderText() copies pre-positioned glyph quads of long or wrapped texts when they are fully visible. Text functions must then be called from one thread at a time, except RenderText() into draw lists with ImDrawListFlags_NoTextLayoutCache.
+    ImFontAtlasFlags_PackMaxRects       = 1 << 4,   // Pack with MaxRects instead of the stb_rectpack skyline: space of discarded glyphs and custom rectangles is reused right away and the texture grows in place, instead of waiting for a repack. Takes effect at the next build/repack.
+};
+
+// Statistics of the text layout cache (see ImFontAtlasFlags_TextLayoutCache). Counters are for the last complete frame unless noted.
+struct ImFontTextLayoutCacheStats
+{
+    int             Hits;               // CalcTextSizeA()/RenderText() calls served by a cached layout
+    int             Misses;             // Calls that decoded their text: text not cached yet, too long, changing every frame, or not fully visible
+    int             MissedBytes;        // Text decoded by missed calls
+    int             GlyphsCopied;       // Glyph quads copied by RenderText() hits
+    int             Insertions;
+    int             Evictions;          // Layouts unused for a while
+    int             Layouts;            // [Current] Number of cached layouts
+    int             MemoryBytes;        // [Current] Memory used by cached layouts
+    int             Invalidations;      // [Total] Cache flushes caused by font atlas changes (texture repack, discarded bakes, font rebuilds)
+
+    ImFontTextLayoutCacheStats()        { memset(this, 0, sizeof(*this)); }
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -3592,6 +3634,7 @@ struct ImFontAtlas
 
     IMGUI_API void              Clear();                    // Clear everything (input fonts, output glyphs/textures)
     IMGUI_API void              CompactCache();             // Compact cached glyphs and texture.
+    IMGUI_API ImFontTextLayoutCacheStats GetTextLayoutCacheStats() const; // See ImFontAtlasFlags_TextLayoutCache.
     IMGUI_API void              SetFontLoader(const ImFontLoader* font_loader); // Change font loader at runtime.
 
     // As we are transitioning toward a new font system, we expect to obsolete those soon:
@@ -18,6 +18,8 @@ Index of this file:
 // [SECTION] ImFontAtlas: glyph ranges helpers
 // [SECTION] ImFontGlyphRangesBuilder
 // [SECTION] ImFont
+// [SECTION] ImFontAtlas text layout cache
+// [SECTION] ImFontAtlas on-disk cache
 // [SECTION] ImGui Internal Render Helpers
 // [SECTION] Decompression code
 // [SECTION] Default font data (ProggyClean.ttf)
@@ -790,6 +792,337 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+//-----------------------------------------------------------------------------
+// SIMD tessellation of anti-aliased AddPolyline() and AddConvexPolyFilled()
+//-----------------------------------------------------------------------------
+// - Normals and averaged (miter) normals are computed several points at a time, then vertices and indices are written in a single pass.
+// - Every lane performs the same IEEE operations in the same order as IM_NORMALIZE2F_OVER_ZERO()/IM_FIXNORMAL2F(), and the inverse square root
+//   is the one ImRsqrt() uses, so the output is the same as the scalar code as long as the compiler does not contract the scalar code into
+//   fused multiply-adds (not done by MSVC /fp:precise, nor by GCC/Clang on x86 unless FMA is enabled).
+// - Set ImDrawListFlags_NoSimdTessellation on a draw list to use the scalar code.
+//-----------------------------------------------------------------------------
+
+#if (defined(IMGUI_ENABLE_SSE) || defined(IMGUI_ENABLE_NEON)) && !defined(IMGUI_DISABLE_SIMD_TESSELLATION)
+#define IMGUI_ENABLE_SIMD_TESSELLATION
+#endif
+
+#ifdef IMGUI_ENABLE_SIMD_TESSELLATION
+
+#if defined(IMGUI_ENABLE_AVX2)
+typedef __m256 ImSimdFloat;
+typedef __m256 ImSimdMask;
+static const int IM_SIMD_WIDTH = 8;
+static inline ImSimdFloat ImSimdSet1(float v)                                   { return _mm256_set1_ps(v); }
+static inline ImSimdFloat ImSimdAdd(ImSimdFloat a, ImSimdFloat b)               { return _mm256_add_ps(a, b); }
+static inline ImSimdFloat ImSimdMul(ImSimdFloat a, ImSimdFloat b)               { return _mm256_mul_ps(a, b); }
+static inline ImSimdFloat ImSimdSub(ImSimdFloat a, ImSimdFloat b)               { return _mm256_sub_ps(a, b); }
+static inline ImSimdFloat ImSimdDiv(ImSimdFloat a, ImSimdFloat b)               { return _mm256_div_ps(a, b); }
+static inline ImSimdFloat ImSimdMin(ImSimdFloat a, ImSimdFloat b)               { return _mm256_min_ps(a, b); }
+static inline ImSimdFloat ImSimdNeg(ImSimdFloat a)                              { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+static inline ImSimdFloat ImSimdRsqrt(ImSimdFloat a)                            { return _mm256_rsqrt_ps(a); }
+static inline ImSimdMask  ImSimdCmpGt(ImSimdFloat a, ImSimdFloat b)             { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+static inline ImSimdFloat ImSimdSelect(ImSimdMask m, ImSimdFloat a, ImSimdFloat b) { return _mm256_blendv_ps(b, a, m); }
+static inline void ImSimdLoadXY(const ImVec2* p, ImSimdFloat* x, ImSimdFloat* y)
+{
+    // Shuffles work within 128-bit halves: x0 x1 x4 x5 | x2 x3 x6 x7, then reorder the 64-bit quarters
+    __m256 a = _mm256_loadu_ps(&p[0].x);
+    __m256 b = _mm256_loadu_ps(&p[4].x);
+    *x = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0)));
+    *y = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+static inline void ImSimdStoreXY(ImVec2* p, ImSimdFloat x, ImSimdFloat y)
+{
+    x = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(x), _MM_SHUFFLE(3, 1, 2, 0)));
+    y = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(y), _MM_SHUFFLE(3, 1, 2, 0)));
+    _mm256_storeu_ps(&p[0].x, _mm256_unpacklo_ps(x, y));
+    _mm256_storeu_ps(&p[4].x, _mm256_unpackhi_ps(x, y));
+}
+#elif defined(IMGUI_ENABLE_SSE)
+typedef __m128 ImSimdFloat;
+typedef __m128 ImSimdMask;
+static const int IM_SIMD_WIDTH = 4;
+static inline ImSimdFloat ImSimdSet1(float v)                                   { return _mm_set1_ps(v); }
+static inline ImSimdFloat ImSimdAdd(ImSimdFloat a, ImSimdFloat b)               { return _mm_add_ps(a, b); }
+static inline ImSimdFloat ImSimdMul(ImSimdFloat a, ImSimdFloat b)               { return _mm_mul_ps(a, b); }
+static inline ImSimdFloat ImSimdSub(ImSimdFloat a, ImSimdFloat b)               { return _mm_sub_ps(a, b); }
+static inline ImSimdFloat ImSimdDiv(ImSimdFloat a, ImSimdFloat b)               { return _mm_div_ps(a, b); }
+static inline ImSimdFloat ImSimdMin(ImSimdFloat a, ImSimdFloat b)               { return _mm_min_ps(a, b); }
+static inline ImSimdFloat ImSimdNeg(ImSimdFloat a)                              { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+static inline ImSimdFloat ImSimdRsqrt(ImSimdFloat a)                            { return _mm_rsqrt_ps(a); }
+static inline ImSimdMask  ImSimdCmpGt(ImSimdFloat a, ImSimdFloat b)             { return _mm_cmpgt_ps(a, b); }
+static inline ImSimdFloat ImSimdSelect(ImSimdMask m, ImSimdFloat a, ImSimdFloat b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+static inline void ImSimdLoadXY(const ImVec2* p, ImSimdFloat* x, ImSimdFloat* y)
+{
+    __m128 a = _mm_loadu_ps(&p[0].x);
+    __m128 b = _mm_loadu_ps(&p[2].x);
+    *x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+    *y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+}
+static inline void ImSimdStoreXY(ImVec2* p, ImSimdFloat x, ImSimdFloat y)
+{
+    _mm_storeu_ps(&p[0].x, _mm_unpacklo_ps(x, y));
+    _mm_storeu_ps(&p[2].x, _mm_unpackhi_ps(x, y));
+}
+#elif defined(IMGUI_ENABLE_NEON)
+typedef float32x4_t ImSimdFloat;
+typedef uint32x4_t ImSimdMask;
+static const int IM_SIMD_WIDTH = 4;
+static inline ImSimdFloat ImSimdSet1(float v)                                   { return vdupq_n_f32(v); }
+static inline ImSimdFloat ImSimdAdd(ImSimdFloat a, ImSimdFloat b)               { return vaddq_f32(a, b); }
+static inline ImSimdFloat ImSimdMul(ImSimdFloat a, ImSimdFloat b)               { return vmulq_f32(a, b); }
+static inline ImSimdFloat ImSimdSub(ImSimdFloat a, ImSimdFloat b)               { return vsubq_f32(a, b); }
+static inline ImSimdFloat ImSimdDiv(ImSimdFloat a, ImSimdFloat b)               { return vdivq_f32(a, b); }
+static inline ImSimdFloat ImSimdMin(ImSimdFloat a, ImSimdFloat b)               { return vminq_f32(a, b); }
+static inline ImSimdFloat ImSimdNeg(ImSimdFloat a)                              { return vnegq_f32(a); }
+static inline ImSimdFloat ImSimdRsqrt(ImSimdFloat a)                            { return vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(a)); } // Same as the non-SSE ImRsqrt()
+static inline ImSimdMask  ImSimdCmpGt(ImSimdFloat a, ImSimdFloat b)             { return vcgtq_f32(a, b); }
+static inline ImSimdFloat ImSimdSelect(ImSimdMask m, ImSimdFloat a, ImSimdFloat b) { return vbslq_f32(m, a, b); }
+static inline void ImSimdLoadXY(const ImVec2* p, ImSimdFloat* x, ImSimdFloat* y) { float32x4x2_t v = vld2q_f32(&p[0].x); *x = v.val[0]; *y = v.val[1]; }
+static inline void ImSimdStoreXY(ImVec2* p, ImSimdFloat x, ImSimdFloat y)      { float32x4x2_t v; v.val[0] = x; v.val[1] = y; vst2q_f32(&p[0].x, v); }
+#endif
+
+// Normal of segment i, going from points[i] to points[(i + 1) % points_count], for i in [0, segments_count)
+static void ImTessellateSegmentNormals(const ImVec2* points, int points_count, int segments_count, ImVec2* out_normals)
+{
+    int i = 0;
+    for (; i + IM_SIMD_WIDTH < points_count && i + IM_SIMD_WIDTH <= segments_count; i += IM_SIMD_WIDTH)
+    {
+        ImSimdFloat x1, y1, x2, y2;
+        ImSimdLoadXY(points + i, &x1, &y1);
+        ImSimdLoadXY(points + i + 1, &x2, &y2);
+        ImSimdFloat dx = ImSimdSub(x2, x1);
+        ImSimdFloat dy = ImSimdSub(y2, y1);
+        ImSimdFloat d2 = ImSimdAdd(ImSimdMul(dx, dx), ImSimdMul(dy, dy));
+        ImSimdMask normalize = ImSimdCmpGt(d2, ImSimdSet1(0.0f));
+        ImSimdFloat inv_len = ImSimdRsqrt(d2);
+        dx = ImSimdSelect(normalize, ImSimdMul(dx, inv_len), dx);
+        dy = ImSimdSelect(normalize, ImSimdMul(dy, inv_len), dy);
+        ImSimdStoreXY(out_normals + i, dy, ImSimdNeg(dx));
+    }
+    for (; i < segments_count; i++)
+    {
+        const int i2 = (i + 1) == points_count ? 0 : i + 1;
+        float dx = points[i2].x - points[i].x;
+        float dy = points[i2].y - points[i].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[i].x = dy;
+        out_normals[i].y = -dx;
+    }
+}
+
+// Averaged normal at point i, between the normals of segments (i - 1) % normals_count and i, for i in [i_begin, i_end)
+static void ImTessellateAveragedNormals(const ImVec2* normals, int normals_count, int i_begin, int i_end, ImVec2* out_normals)
+{
+    int i = i_begin;
+    if (i == 0 && i < i_end)
+    {
+        float dm_x = (normals[normals_count - 1].x + normals[0].x) * 0.5f;
+        float dm_y = (normals[normals_count - 1].y + normals[0].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out_normals[0].x = dm_x;
+        out_normals[0].y = dm_y;
+        i++;
+    }
+    for (; i + IM_SIMD_WIDTH <= i_end; i += IM_SIMD_WIDTH)
+    {
+        ImSimdFloat x0, y0, x1, y1;
+        ImSimdLoadXY(normals + i - 1, &x0, &y0);
+        ImSimdLoadXY(normals + i, &x1, &y1);
+        ImSimdFloat dm_x = ImSimdMul(ImSimdAdd(x0, x1), ImSimdSet1(0.5f));
+        ImSimdFloat dm_y = ImSimdMul(ImSimdAdd(y0, y1), ImSimdSet1(0.5f));
+        ImSimdFloat d2 = ImSimdAdd(ImSimdMul(dm_x, dm_x), ImSimdMul(dm_y, dm_y));
+        ImSimdMask fix = ImSimdCmpGt(d2, ImSimdSet1(0.000001f));
+        ImSimdFloat inv_len2 = ImSimdMin(ImSimdDiv(ImSimdSet1(1.0f), d2), ImSimdSet1(IM_FIXNORMAL2F_MAX_INVLEN2));
+        dm_x = ImSimdSelect(fix, ImSimdMul(dm_x, inv_len2), dm_x);
+        dm_y = ImSimdSelect(fix, ImSimdMul(dm_y, inv_len2), dm_y);
+        ImSimdStoreXY(out_normals + i, dm_x, dm_y);
+    }
+    for (; i < i_end; i++)
+    {
+        float dm_x = (normals[i - 1].x + normals[i].x) * 0.5f;
+        float dm_y = (normals[i - 1].y + normals[i].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out_normals[i].x = dm_x;
+        out_normals[i].y = dm_y;
+    }
+}
+
+// Anti-aliased path of AddPolyline(), see the scalar code for details on each path
+static void ImDrawList_AddPolylineAntiAliasedSimd(ImDrawList* draw_list, const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
+{
+    const bool closed = (flags & ImDrawFlags_Closed) != 0;
+    const ImVec2 opaque_uv = draw_list->_Data->TexUvWhitePixel;
+    const int count = closed ? points_count : points_count - 1;
+    const bool thick_line = (thickness > draw_list->_FringeScale);
+    const float AA_SIZE = draw_list->_FringeScale;
+    const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+
+    thickness = ImMax(thickness, 1.0f);
+    const int integer_thickness = (int)thickness;
+    const float fractional_thickness = thickness - integer_thickness;
+    const bool use_texture = (draw_list->Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
+    const int vtx_per_point = use_texture ? 2 : (thick_line ? 4 : 3);
+
+    const int idx_count = use_texture ? (count * 6) : (thick_line ? count * 18 : count * 12);
+    const int vtx_count = points_count * vtx_per_point;
+    draw_list->PrimReserve(idx_count, vtx_count);
+
+    // Segment normals, then averaged normals at each point. The first point of an open line uses the normal of its segment.
+    draw_list->_Data->TempBuffer.reserve_discard(points_count * 2);
+    ImVec2* temp_normals = draw_list->_Data->TempBuffer.Data;
+    ImVec2* temp_averaged = temp_normals + points_count;
+    ImTessellateSegmentNormals(points, points_count, count, temp_normals);
+    if (!closed)
+    {
+        temp_normals[points_count - 1] = temp_normals[points_count - 2];
+        temp_averaged[0] = temp_normals[0];
+    }
+    ImTessellateAveragedNormals(temp_normals, points_count, closed ? 0 : 1, points_count, temp_averaged);
+
+    // Indices
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    const unsigned int vtx_base = draw_list->_VtxCurrentIdx;
+    unsigned int idx1 = vtx_base;
+    for (int i1 = 0; i1 < count; i1++)
+    {
+        const unsigned int idx2 = ((i1 + 1) == points_count) ? vtx_base : (idx1 + vtx_per_point);
+        if (use_texture)
+        {
+            idx_write[0] = (ImDrawIdx)(idx2 + 0); idx_write[1] = (ImDrawIdx)(idx1 + 0); idx_write[2] = (ImDrawIdx)(idx1 + 1);
+            idx_write[3] = (ImDrawIdx)(idx2 + 1); idx_write[4] = (ImDrawIdx)(idx1 + 1); idx_write[5] = (ImDrawIdx)(idx2 + 0);
+            idx_write += 6;
+        }
+        else if (!thick_line)
+        {
+            idx_write[0] = (ImDrawIdx)(idx2 + 0); idx_write[1] = (ImDrawIdx)(idx1 + 0); idx_write[2] = (ImDrawIdx)(idx1 + 2);
+            idx_write[3] = (ImDrawIdx)(idx1 + 2); idx_write[4] = (ImDrawIdx)(idx2 + 2); idx_write[5] = (ImDrawIdx)(idx2 + 0);
+            idx_write[6] = (ImDrawIdx)(idx2 + 1); idx_write[7] = (ImDrawIdx)(idx1 + 1); idx_write[8] = (ImDrawIdx)(idx1 + 0);
+            idx_write[9] = (ImDrawIdx)(idx1 + 0); idx_write[10] = (ImDrawIdx)(idx2 + 0); idx_write[11] = (ImDrawIdx)(idx2 + 1);
+            idx_write += 12;
+        }
+        else
+        {
+            idx_write[0]  = (ImDrawIdx)(idx2 + 1); idx_write[1]  = (ImDrawIdx)(idx1 + 1); idx_write[2]  = (ImDrawIdx)(idx1 + 2);
+            idx_write[3]  = (ImDrawIdx)(idx1 + 2); idx_write[4]  = (ImDrawIdx)(idx2 + 2); idx_write[5]  = (ImDrawIdx)(idx2 + 1);
+            idx_write[6]  = (ImDrawIdx)(idx2 + 1); idx_write[7]  = (ImDrawIdx)(idx1 + 1); idx_write[8]  = (ImDrawIdx)(idx1 + 0);
+            idx_write[9]  = (ImDrawIdx)(idx1 + 0); idx_write[10] = (ImDrawIdx)(idx2 + 0); idx_write[11] = (ImDrawIdx)(idx2 + 1);
+            idx_write[12] = (ImDrawIdx)(idx2 + 2); idx_write[13] = (ImDrawIdx)(idx1 + 2); idx_write[14] = (ImDrawIdx)(idx1 + 3);
+            idx_write[15] = (ImDrawIdx)(idx1 + 3); idx_write[16] = (ImDrawIdx)(idx2 + 3); idx_write[17] = (ImDrawIdx)(idx2 + 2);
+            idx_write += 18;
+        }
+        idx1 = idx2;
+    }
+    draw_list->_IdxWritePtr = idx_write;
+
+    // Vertices, offset from each point along its averaged normal
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    if (use_texture || !thick_line)
+    {
+        const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
+        const ImVec4 tex_uvs = use_texture ? draw_list->_Data->TexUvLines[integer_thickness] : ImVec4();
+        const ImVec2 tex_uv0(tex_uvs.x, tex_uvs.y);
+        const ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
+        for (int i = 0; i < points_count; i++)
+        {
+            const float dm_x = temp_averaged[i].x * half_draw_size;
+            const float dm_y = temp_averaged[i].y * half_draw_size;
+            if (use_texture)
+            {
+                vtx_write[0].pos.x = points[i].x + dm_x; vtx_write[0].pos.y = points[i].y + dm_y; vtx_write[0].uv = tex_uv0; vtx_write[0].col = col; // Left-side outer edge
+                vtx_write[1].pos.x = points[i].x - dm_x; vtx_write[1].pos.y = points[i].y - dm_y; vtx_write[1].uv = tex_uv1; vtx_write[1].col = col; // Right-side outer edge
+                vtx_write += 2;
+            }
+            else
+            {
+                vtx_write[0].pos = points[i];                                             vtx_write[0].uv = opaque_uv; vtx_write[0].col = col;       // Center of line
+                vtx_write[1].pos.x = points[i].x + dm_x; vtx_write[1].pos.y = points[i].y + dm_y; vtx_write[1].uv = opaque_uv; vtx_write[1].col = col_trans; // Left-side outer edge
+                vtx_write[2].pos.x = points[i].x - dm_x; vtx_write[2].pos.y = points[i].y - dm_y; vtx_write[2].uv = opaque_uv; vtx_write[2].col = col_trans; // Right-side outer edge
+                vtx_write += 3;
+            }
+        }
+    }
+    else
+    {
+        const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+        const float half_outer_thickness = half_inner_thickness + AA_SIZE;
+        for (int i = 0; i < points_count; i++)
+        {
+            const float dm_out_x = temp_averaged[i].x * half_outer_thickness;
+            const float dm_out_y = temp_averaged[i].y * half_outer_thickness;
+            const float dm_in_x = temp_averaged[i].x * half_inner_thickness;
+            const float dm_in_y = temp_averaged[i].y * half_inner_thickness;
+            vtx_write[0].pos.x = points[i].x + dm_out_x; vtx_write[0].pos.y = points[i].y + dm_out_y; vtx_write[0].uv = opaque_uv; vtx_write[0].col = col_trans;
+            vtx_write[1].pos.x = points[i].x + dm_in_x;  vtx_write[1].pos.y = points[i].y + dm_in_y;  vtx_write[1].uv = opaque_uv; vtx_write[1].col = col;
+            vtx_write[2].pos.x = points[i].x - dm_in_x;  vtx_write[2].pos.y = points[i].y - dm_in_y;  vtx_write[2].uv = opaque_uv; vtx_write[2].col = col;
+            vtx_write[3].pos.x = points[i].x - dm_out_x; vtx_write[3].pos.y = points[i].y - dm_out_y; vtx_write[3].uv = opaque_uv; vtx_write[3].col = col_trans;
+            vtx_write += 4;
+        }
+    }
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_VtxCurrentIdx += (ImDrawIdx)vtx_count;
+}
+
+// Anti-aliased path of AddConvexPolyFilled()
+static void ImDrawList_AddConvexPolyFilledAntiAliasedSimd(ImDrawList* draw_list, const ImVec2* points, const int points_count, ImU32 col)
+{
+    const ImVec2 uv = draw_list->_Data->TexUvWhitePixel;
+    const float AA_SIZE = draw_list->_FringeScale;
+    const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+    const int idx_count = (points_count - 2)*3 + points_count * 6;
+    const int vtx_count = (points_count * 2);
+    draw_list->PrimReserve(idx_count, vtx_count);
+
+    // Edge normals (edge i goes from point i to point i + 1), then averaged normals at each point
+    draw_list->_Data->TempBuffer.reserve_discard(points_count * 2);
+    ImVec2* temp_normals = draw_list->_Data->TempBuffer.Data;
+    ImVec2* temp_averaged = temp_normals + points_count;
+    ImTessellateSegmentNormals(points, points_count, points_count, temp_normals);
+    ImTessellateAveragedNormals(temp_normals, points_count, 0, points_count, temp_averaged);
+
+    // Indices for fill
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    const unsigned int vtx_inner_idx = draw_list->_VtxCurrentIdx;
+    const unsigned int vtx_outer_idx = draw_list->_VtxCurrentIdx + 1;
+    for (int i = 2; i < points_count; i++)
+    {
+        idx_write[0] = (ImDrawIdx)(vtx_inner_idx); idx_write[1] = (ImDrawIdx)(vtx_inner_idx + ((i - 1) << 1)); idx_write[2] = (ImDrawIdx)(vtx_inner_idx + (i << 1));
+        idx_write += 3;
+    }
+
+    // Vertices and indices for fringes
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+    {
+        const float dm_x = temp_averaged[i1].x * (AA_SIZE * 0.5f);
+        const float dm_y = temp_averaged[i1].y * (AA_SIZE * 0.5f);
+        vtx_write[0].pos.x = (points[i1].x - dm_x); vtx_write[0].pos.y = (points[i1].y - dm_y); vtx_write[0].uv = uv; vtx_write[0].col = col;        // Inner
+        vtx_write[1].pos.x = (points[i1].x + dm_x); vtx_write[1].pos.y = (points[i1].y + dm_y); vtx_write[1].uv = uv; vtx_write[1].col = col_trans;  // Outer
+        vtx_write += 2;
+
+        idx_write[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); idx_write[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); idx_write[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
+        idx_write[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); idx_write[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); idx_write[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
+        idx_write += 6;
+    }
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx += (ImDrawIdx)vtx_count;
+}
+
+#endif // #ifdef IMGUI_ENABLE_SIMD_TESSELLATION
+
+const char* ImDrawListGetTessellationBackendName()
+{
+#if !defined(IMGUI_ENABLE_SIMD_TESSELLATION)
+    return "Scalar";
+#elif defined(IMGUI_ENABLE_AVX2)
+    return "AVX2";
+#elif defined(IMGUI_ENABLE_SSE)
+    return "SSE2";
+#else
+    return "NEON";
+#endif
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -797,6 +1130,14 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
     if (points_count < 2 || (col & IM_COL32_A_MASK) == 0)
         return;
 
+#ifdef IMGUI_ENABLE_SIMD_TESSELLATION
+    if ((Flags & ImDrawListFlags_AntiAliasedLines) && !(Flags & ImDrawListFlags_NoSimdTessellation))
+    {
+        ImDrawList_AddPolylineAntiAliasedSimd(this, points, points_count, col, flags, thickness);
+        return;
+    }
+#endif
+
     const bool closed = (flags & ImDrawFlags_Closed) != 0;
     const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
     const int count = closed ? points_count : points_count - 1; // The number of line segments we need to draw
@@ -1055,6 +1396,14 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
     if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
         return;
 
+#ifdef IMGUI_ENABLE_SIMD_TESSELLATION
+    if ((Flags & ImDrawListFlags_AntiAliasedFill) && !(Flags & ImDrawListFlags_NoSimdTessellation))
+    {
+        ImDrawList_AddConvexPolyFilledAntiAliasedSimd(this, points, points_count, col);
+        return;
+    }
+#endif
+
     const ImVec2 uv = _Data->TexUvWhitePixel;
 
     if (Flags & ImDrawListFlags_AntiAliasedFill)
@@ -2521,6 +2870,7 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasBuildMain()
 // - ImFontAtlasBuildSetupFontLoader()
 // - ImFontAtlasBuildPreloadAllGlyphRanges()
+// - ImFontAtlasBuildPreloadGlyphRanges()
 // - ImFontAtlasBuildUpdatePointers()
 // - ImFontAtlasBuildRenderBitmapFromString()
 // - ImFontAtlasBuildUpdateBasicTexData()
@@ -2544,6 +2894,7 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasBuildAddTexture()
 // - ImFontAtlasBuildMakeSpace()
 // - ImFontAtlasBuildRepackTexture()
+// - ImFontAtlasBuildGrowTextureInPlace()
 // - ImFontAtlasBuildGrowTexture()
 // - ImFontAtlasBuildRepackOrGrowTexture()
 // - ImFontAtlasBuildGetTextureSizeEstimate()
@@ -2551,6 +2902,9 @@ void ImTextureData::DestroyPixels()
 // - ImFontAtlasBuildInit()
 // - ImFontAtlasBuildDestroy()
 //-----------------------------------------------------------------------------
+// - ImFontAtlasPackMaxRectsAdd()
+// - ImFontAtlasPackMaxRectsFree()
+// - ImFontAtlasPackMaxRectsGrow()
 // - ImFontAtlasPackInit()
 // - ImFontAtlasPackAllocRectEntry()
 // - ImFontAtlasPackReuseRectEntry()
@@ -2752,6 +3106,7 @@ void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas, int frame_count, bool rendere
     builder->FrameCount = frame_count;
     for (ImFont* font : atlas->Fonts)
         font->LastBaked = NULL;
+    ImFontAtlasTextLayoutCacheNewFrame(atlas);
 
     // Garbage collect BakedPool
     if (builder->BakedDiscardedCount > 0)
@@ -3437,6 +3792,48 @@ void ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas)
     }
 }
 
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+static const int IM_FONT_PRERASTERIZE_BATCH_SIZE = 32; // Glyphs per parallel_for() index
+static void ImGui_ImplStbTrueType_AddPrerasterizedGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked, ImWchar codepoint);
+static void ImGui_ImplStbTrueType_RasterizeGlyphBatch(int batch_index, void* job_data);
+#endif
+
+// Load the glyphs of 'ranges' ahead of use, in the order FindGlyph() would load them one by one.
+// With parallel_for, glyphs from stb_truetype sources are first rasterized and filtered on several threads, each into its own slice
+// of a scratch buffer. Packing, copying into the texture and post-processing then run serially in the usual order, so the atlas
+// is the same byte for byte as without parallel_for. Other loaders load their glyphs as usual.
+// stb_truetype allocates through IM_ALLOC() from the threads: the allocator must be thread-safe, and debug allocation counters may be off.
+void ImFontAtlasBuildPreloadGlyphRanges(ImFontAtlas* atlas, ImFont* font, float font_size, const ImWchar* ranges, ImFontAtlasParallelForFunc parallel_for, void* parallel_for_user_data)
+{
+    IM_ASSERT(font->ContainerAtlas == atlas);
+    ImFontBaked* baked = font->GetFontBaked(font_size);
+    ImFontAtlasBuilder* builder = atlas->Builder;
+
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+    if (parallel_for != NULL && !atlas->Locked && !(font->Flags & ImFontFlags_NoLoadGlyphs))
+    {
+        for (const ImWchar* range = ranges; range[0]; range += 2)
+            for (unsigned int c = range[0]; c <= range[1] && c <= IM_UNICODE_CODEPOINT_MAX; c++) //-V560
+                ImGui_ImplStbTrueType_AddPrerasterizedGlyph(atlas, font, baked, (ImWchar)c);
+        const int batch_count = (builder->PrerasterizedGlyphs.Size + IM_FONT_PRERASTERIZE_BATCH_SIZE - 1) / IM_FONT_PRERASTERIZE_BATCH_SIZE;
+        if (batch_count > 0)
+            parallel_for(batch_count, ImGui_ImplStbTrueType_RasterizeGlyphBatch, builder, parallel_for_user_data);
+    }
+#else
+    IM_UNUSED(parallel_for);
+    IM_UNUSED(parallel_for_user_data);
+#endif
+
+    for (const ImWchar* range = ranges; range[0]; range += 2)
+        for (unsigned int c = range[0]; c <= range[1] && c <= IM_UNICODE_CODEPOINT_MAX; c++) //-V560
+            baked->FindGlyph((ImWchar)c);
+
+    IM_ASSERT(atlas->Builder == builder);
+    builder->PrerasterizedGlyphs.clear();
+    builder->PrerasterizedGlyphsMap.Clear();
+    builder->PrerasterizedPixels.clear();
+}
+
 // FIXME: May make ImFont::Sources a ImSpan<> and move ownership to ImFontAtlas
 void ImFontAtlasBuildUpdatePointers(ImFontAtlas* atlas)
 {
@@ -3589,6 +3986,7 @@ bool ImFontAtlasFontInitOutput(ImFontAtlas* atlas, ImFont* font)
 void ImFontAtlasFontDestroyOutput(ImFontAtlas* atlas, ImFont* font)
 {
     font->ClearOutputData();
+    ImFontAtlasTextLayoutCacheClear(atlas);
     for (ImFontConfig* src : font->Sources)
     {
         const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
@@ -3764,11 +4162,12 @@ void ImFontAtlasBakedDiscardFontGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBa
     IM_UNUSED(font);
     baked->IndexLookup[c] = IM_FONTGLYPH_INDEX_UNUSED;
     baked->IndexAdvanceX[c] = baked->FallbackAdvanceX;
+    ImFontAtlasTextLayoutCacheClear(atlas);
 }
 
-ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id)
+// Create a baked font without any glyph. Caller is responsible for registering it in BakedMap.
+static ImFontBaked* ImFontAtlasBakedAddEmpty(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id)
 {
-    IMGUI_DEBUG_LOG_FONT("[font] Created baked %.2fpx\n", font_size);
     ImFontBaked* baked = atlas->Builder->BakedPool.push_back(ImFontBaked());
     baked->Size = font_size;
     baked->RasterizerDensity = font_rasterizer_density;
@@ -3792,7 +4191,13 @@ ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_si
             loader->FontBakedInit(atlas, src, baked, loader_data_p);
         loader_data_p += loader->FontBakedSrcLoaderDataSize;
     }
+    return baked;
+}
 
+ImFontBaked* ImFontAtlasBakedAdd(ImFontAtlas* atlas, ImFont* font, float font_size, float font_rasterizer_density, ImGuiID baked_id)
+{
+    IMGUI_DEBUG_LOG_FONT("[font] Created baked %.2fpx\n", font_size);
+    ImFontBaked* baked = ImFontAtlasBakedAddEmpty(atlas, font, font_size, font_rasterizer_density, baked_id);
     ImFontAtlasBuildSetupFontBakedBlanks(atlas, baked);
     return baked;
 }
@@ -3851,6 +4256,7 @@ void ImFontAtlasBakedDiscard(ImFontAtlas* atlas, ImFont* font, ImFontBaked* bake
     builder->BakedMap.SetVoidPtr(baked->BakedId, NULL);
     builder->BakedDiscardedCount++;
     baked->ClearOutputData();
+    ImFontAtlasTextLayoutCacheClear(atlas);
     baked->WantDestroy = true;
     font->LastBaked = NULL;
 }
@@ -3991,6 +4397,32 @@ static void ImFontAtlasDebugWriteTexToDisk(ImTextureData* tex, const char* descr
 }
 #endif
 
+static void ImFontAtlasPackMaxRectsGrow(ImFontAtlasBuilder* builder, int old_w, int old_h, int new_w, int new_h);
+
+// Refresh everything storing UV of packed rectangles, after they moved or the texture size changed
+static void ImFontAtlasTextureUpdateUVs(ImFontAtlas* atlas)
+{
+    // Patch glyphs UV
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+        for (ImFontGlyph& glyph : builder->BakedPool[baked_n].Glyphs)
+            if (glyph.PackId != ImFontAtlasRectId_Invalid)
+            {
+                ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph.PackId);
+                glyph.U0 = (r->x) * atlas->TexUvScale.x;
+                glyph.V0 = (r->y) * atlas->TexUvScale.y;
+                glyph.U1 = (r->x + r->w) * atlas->TexUvScale.x;
+                glyph.V1 = (r->y + r->h) * atlas->TexUvScale.y;
+            }
+    ImFontAtlasTextLayoutCacheClear(atlas);
+
+    // Update other cached UV
+    ImFontAtlasBuildUpdateLinesTexData(atlas);
+    ImFontAtlasBuildUpdateBasicTexData(atlas);
+
+    ImFontAtlasUpdateDrawListsSharedData(atlas);
+}
+
 void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
 {
     ImFontAtlasBuilder* builder = atlas->Builder;
@@ -4042,27 +4474,30 @@ void ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h)
     builder->RectsDiscardedCount = 0;
     builder->RectsDiscardedSurface = 0;
 
-    // Patch glyphs UV
-    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
-        for (ImFontGlyph& glyph : builder->BakedPool[baked_n].Glyphs)
-            if (glyph.PackId != ImFontAtlasRectId_Invalid)
-            {
-                ImTextureRect* r = ImFontAtlasPackGetRect(atlas, glyph.PackId);
-                glyph.U0 = (r->x) * atlas->TexUvScale.x;
-                glyph.V0 = (r->y) * atlas->TexUvScale.y;
-                glyph.U1 = (r->x + r->w) * atlas->TexUvScale.x;
-                glyph.V1 = (r->y + r->h) * atlas->TexUvScale.y;
-            }
-
-    // Update other cached UV
-    ImFontAtlasBuildUpdateLinesTexData(atlas);
-    ImFontAtlasBuildUpdateBasicTexData(atlas);
-
     builder->LockDisableResize = false;
-    ImFontAtlasUpdateDrawListsSharedData(atlas);
+    ImFontAtlasTextureUpdateUVs(atlas);
     //ImFontAtlasDebugWriteTexToDisk(new_tex, "After Pack");
 }
 
+// Only for ImFontAtlasFlags_PackMaxRects: rectangles keep their position and free space extends over the new area, so nothing gets packed again.
+static void ImFontAtlasTextureGrowInPlace(ImFontAtlas* atlas, int w, int h)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImTextureData* old_tex = atlas->TexData;
+    ImTextureData* new_tex = ImFontAtlasTextureAdd(atlas, w, h);
+    new_tex->UseColors = old_tex->UseColors;
+    new_tex->UsedRect = old_tex->UsedRect;
+    IMGUI_DEBUG_LOG_FONT("[font] Texture #%03d: grow in place %dx%d => Texture #%03d: %dx%d\n", old_tex->UniqueID, old_tex->Width, old_tex->Height, new_tex->UniqueID, new_tex->Width, new_tex->Height);
+    ImFontAtlasTextureBlockCopy(old_tex, 0, 0, new_tex, 0, 0, old_tex->Width, old_tex->Height);
+
+    // The skyline is unused, but kept sized to the texture for ImFontAtlasCacheSave()
+    builder->PackNodes.resize(w / 2);
+    stbrp_init_target((stbrp_context*)(void*)&builder->PackContext, w, h, builder->PackNodes.Data, builder->PackNodes.Size);
+    ImFontAtlasPackMaxRectsGrow(builder, old_tex->Width, old_tex->Height, w, h);
+
+    ImFontAtlasTextureUpdateUVs(atlas);
+}
+
 void ImFontAtlasTextureGrow(ImFontAtlas* atlas, int old_tex_w, int old_tex_h)
 {
     //ImFontAtlasDebugWriteTexToDisk(atlas->TexData, "Before Grow");
@@ -4092,7 +4527,12 @@ void ImFontAtlasTextureGrow(ImFontAtlas* atlas, int old_tex_w, int old_tex_h)
     if (new_tex_w == old_tex_w && new_tex_h == old_tex_h)
         return;
 
-    ImFontAtlasTextureRepack(atlas, new_tex_w, new_tex_h);
+    // Not while repacking (LockDisableResize), where old_tex_w/old_tex_h is the size which failed
+    ImTextureData* tex = atlas->TexData;
+    if (builder->PackMaxRects && !builder->LockDisableResize && tex->Width == old_tex_w && tex->Height == old_tex_h && new_tex_w >= old_tex_w && new_tex_h >= old_tex_h)
+        ImFontAtlasTextureGrowInPlace(atlas, new_tex_w, new_tex_h);
+    else
+        ImFontAtlasTextureRepack(atlas, new_tex_w, new_tex_h);
 }
 
 void ImFontAtlasTextureMakeSpace(ImFontAtlas* atlas)
@@ -4100,8 +4540,13 @@ void ImFontAtlasTextureMakeSpace(ImFontAtlas* atlas)
     // Can some baked contents be ditched?
     //IMGUI_DEBUG_LOG_FONT("[font] ImFontAtlasBuildMakeSpace()\n");
     ImFontAtlasBuilder* builder = atlas->Builder;
+    const int packed_count = builder->RectsPackedCount;
     ImFontAtlasBuildDiscardBakes(atlas, 2);
 
+    // With ImFontAtlasFlags_PackMaxRects discarded space is free already: let caller try again before growing.
+    if (builder->PackMaxRects && builder->RectsPackedCount < packed_count)
+        return;
+
     // Currently using a heuristic for repack without growing.
     if (builder->RectsDiscardedSurface < builder->RectsPackedSurface * 0.20f)
         ImFontAtlasTextureGrow(atlas);
@@ -4227,10 +4672,292 @@ void ImFontAtlasBuildDestroy(ImFontAtlas* atlas)
         atlas->FontLoader->LoaderShutdown(atlas);
         IM_ASSERT(atlas->FontLoaderData == NULL);
     }
+    ImFontAtlasTextLayoutCacheClear(atlas);
     IM_DELETE(atlas->Builder);
     atlas->Builder = NULL;
 }
 
+// MaxRects packing (ImFontAtlasFlags_PackMaxRects), after Jukka Jylanki's "A Thousand Ways to Pack the Bin".
+// Free space is kept as the list of maximal free rectangles, which may overlap each other. Unlike the skyline, space below
+// the top of packed rectangles is never lost, so discarded rectangles give their space back right away without a repack.
+// Free rectangles are linked from a grid cell: that of their top-left corner, or a last one for those larger than a cell.
+// As they can't extend past a cell, only the few cells around a rectangle need to be visited to find those touching it.
+static const int IM_FONTATLAS_PACK_CELL_SIZE = 64;
+
+static bool ImFontAtlasPackMaxRectsContains(const ImTextureRect& a, const ImTextureRect& b)
+{
+    return b.x >= a.x && b.y >= a.y && b.x + b.w <= a.x + a.w && b.y + b.h <= a.y + a.h;
+}
+
+static bool ImFontAtlasPackMaxRectsOverlaps(const ImTextureRect& a, const ImTextureRect& b)
+{
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+static void ImFontAtlasPackMaxRectsClear(ImFontAtlasBuilder* builder, int w, int h)
+{
+    const int cell_size = IM_FONTATLAS_PACK_CELL_SIZE;
+    builder->PackFreeCellsCountX = (w + cell_size - 1) / cell_size;
+    const int cells_count = builder->PackFreeCellsCountX * ((h + cell_size - 1) / cell_size);
+    builder->PackFreeRects.resize(0);
+    builder->PackFreeRectsFreeListStart = -1;
+    builder->PackFreeCells.resize(cells_count + 1);
+    memset(builder->PackFreeCells.Data, -1, builder->PackFreeCells.size_in_bytes());
+    builder->PackFreeCellsMaxSize.resize(cells_count);
+    if (cells_count > 0) // Data may be NULL, and memset(NULL, 0, 0) is still undefined
+        memset(builder->PackFreeCellsMaxSize.Data, 0, builder->PackFreeCellsMaxSize.size_in_bytes());
+}
+
+static void ImFontAtlasPackMaxRectsLink(ImFontAtlasBuilder* builder, const ImTextureRect& r)
+{
+    int free_idx = builder->PackFreeRectsFreeListStart;
+    if (free_idx != -1)
+        builder->PackFreeRectsFreeListStart = builder->PackFreeRects[free_idx].Next;
+    else
+        builder->PackFreeRects.resize((free_idx = builder->PackFreeRects.Size) + 1);
+
+    ImFontAtlasPackFreeRect* free_r = &builder->PackFreeRects[free_idx];
+    const int cell_size = IM_FONTATLAS_PACK_CELL_SIZE;
+    if (r.w <= cell_size && r.h <= cell_size)
+    {
+        free_r->Cell = (r.y / cell_size) * builder->PackFreeCellsCountX + (r.x / cell_size);
+        ImVec2ih& max_size = builder->PackFreeCellsMaxSize[free_r->Cell];
+        max_size.x = ImMax(max_size.x, (short)r.w);
+        max_size.y = ImMax(max_size.y, (short)r.h);
+    }
+    else
+    {
+        free_r->Cell = builder->PackFreeCells.Size - 1;
+    }
+    free_r->Rect = r;
+    free_r->Prev = -1;
+    free_r->Next = builder->PackFreeCells[free_r->Cell];
+    if (free_r->Next != -1)
+        builder->PackFreeRects[free_r->Next].Prev = free_idx;
+    builder->PackFreeCells[free_r->Cell] = free_idx;
+}
+
+static void ImFontAtlasPackMaxRectsUnlink(ImFontAtlasBuilder* builder, int free_idx)
+{
+    ImFontAtlasPackFreeRect* free_r = &builder->PackFreeRects[free_idx];
+    if (free_r->Prev != -1)
+        builder->PackFreeRects[free_r->Prev].Next = free_r->Next;
+    else
+        builder->PackFreeCells[free_r->Cell] = free_r->Next;
+    if (free_r->Next != -1)
+        builder->PackFreeRects[free_r->Next].Prev = free_r->Prev;
+    free_r->Rect.w = free_r->Rect.h = 0;
+    free_r->Next = builder->PackFreeRectsFreeListStart;
+    builder->PackFreeRectsFreeListStart = free_idx;
+}
+
+// Append to PackNearRects[] the free rectangles larger than a cell, and those with their top-left corner in [x0,x1)x[y0,y1) cells.
+static void ImFontAtlasPackMaxRectsGather(ImFontAtlasBuilder* builder, int x0, int y0, int x1, int y1)
+{
+    ImVector<int>& near_rects = builder->PackNearRects;
+    for (int free_idx = builder->PackFreeCells.back(); free_idx != -1; free_idx = builder->PackFreeRects[free_idx].Next)
+        near_rects.push_back(free_idx);
+
+    const int cell_size = IM_FONTATLAS_PACK_CELL_SIZE;
+    const int cells_count_x = builder->PackFreeCellsCountX;
+    const int cells_count_y = (builder->PackFreeCells.Size - 1) / cells_count_x;
+    if (x1 <= x0 || y1 <= y0 || x1 <= 0 || y1 <= 0)
+        return;
+    const int cell_x0 = ImMax(x0, 0) / cell_size;
+    const int cell_y0 = ImMax(y0, 0) / cell_size;
+    const int cell_x1 = ImMin((x1 - 1) / cell_size, cells_count_x - 1);
+    const int cell_y1 = ImMin((y1 - 1) / cell_size, cells_count_y - 1);
+    for (int cell_y = cell_y0; cell_y <= cell_y1; cell_y++)
+        for (int cell_x = cell_x0; cell_x <= cell_x1; cell_x++)
+            for (int free_idx = builder->PackFreeCells[cell_y * cells_count_x + cell_x]; free_idx != -1; free_idx = builder->PackFreeRects[free_idx].Next)
+                near_rects.push_back(free_idx);
+}
+
+// Add PackSplitRects[] to free rectangles, keeping only maximal ones.
+// When splitting free rectangles around a new one, existing rectangles are never contained in the split ones: only freeing space may remove some.
+static void ImFontAtlasPackMaxRectsMergeSplits(ImFontAtlasBuilder* builder, bool may_contain_existing)
+{
+    const int cell_size = IM_FONTATLAS_PACK_CELL_SIZE;
+    ImVector<ImTextureRect>& split_rects = builder->PackSplitRects;
+    ImVector<int>& near_rects = builder->PackNearRects;
+    for (int split_n = 0; split_n < split_rects.Size; split_n++)
+    {
+        const ImTextureRect split_r = split_rects[split_n];
+        if (split_r.w < builder->PackFreeRectsMinSize || split_r.h < builder->PackFreeRectsMinSize)
+            continue;
+
+        // Contained in another split rectangle (the first one of identical ones is kept), or in an existing one?
+        bool is_contained = false;
+        for (int other_n = 0; other_n < split_rects.Size && !is_contained; other_n++)
+        {
+            const ImTextureRect& other_r = split_rects[other_n];
+            is_contained = other_n != split_n && ImFontAtlasPackMaxRectsContains(other_r, split_r) && (other_n < split_n || !ImFontAtlasPackMaxRectsContains(split_r, other_r));
+        }
+        near_rects.resize(0);
+        if (!is_contained)
+            ImFontAtlasPackMaxRectsGather(builder, split_r.x + split_r.w - cell_size, split_r.y + split_r.h - cell_size, split_r.x + 1, split_r.y + 1);
+        for (int near_n = 0; near_n < near_rects.Size && !is_contained; near_n++)
+            is_contained = ImFontAtlasPackMaxRectsContains(builder->PackFreeRects[near_rects[near_n]].Rect, split_r);
+        if (is_contained)
+            continue;
+
+        if (may_contain_existing)
+        {
+            near_rects.resize(0);
+            ImFontAtlasPackMaxRectsGather(builder, split_r.x, split_r.y, split_r.x + split_r.w, split_r.y + split_r.h);
+            for (int free_idx : near_rects)
+                if (ImFontAtlasPackMaxRectsContains(split_r, builder->PackFreeRects[free_idx].Rect))
+                    ImFontAtlasPackMaxRectsUnlink(builder, free_idx);
+        }
+        ImFontAtlasPackMaxRectsLink(builder, split_r);
+    }
+    split_rects.resize(0);
+}
+
+// Best short side fit: the free rectangle leaving the smallest leftover on its shorter side, then on its longer side.
+static bool ImFontAtlasPackMaxRectsAdd(ImFontAtlasBuilder* builder, int w, int h, unsigned short* out_x, unsigned short* out_y)
+{
+    // Both leftovers fit in 16 bits: compare them as a single score. Stop at the first exact fit, e.g. space of a discarded glyph of the same size.
+    // Cells whose rectangles are all too small are skipped; their upper bound of sizes is tightened when visited.
+    int best_idx = -1;
+    unsigned int best_score = UINT_MAX;
+    for (int cell_n = builder->PackFreeCells.Size - 1; cell_n >= 0 && best_score != 0; cell_n--)
+    {
+        int free_idx = builder->PackFreeCells[cell_n];
+        if (free_idx == -1)
+            continue;
+        const bool is_large_cell = (cell_n == builder->PackFreeCells.Size - 1);
+        if (!is_large_cell && (builder->PackFreeCellsMaxSize[cell_n].x < w || builder->PackFreeCellsMaxSize[cell_n].y < h))
+            continue;
+        ImVec2ih max_size;
+        for (; free_idx != -1; free_idx = builder->PackFreeRects[free_idx].Next)
+        {
+            const ImTextureRect& free_r = builder->PackFreeRects[free_idx].Rect;
+            max_size.x = ImMax(max_size.x, (short)free_r.w);
+            max_size.y = ImMax(max_size.y, (short)free_r.h);
+            const int leftover_w = free_r.w - w;
+            const int leftover_h = free_r.h - h;
+            if ((leftover_w | leftover_h) < 0)
+                continue;
+            const unsigned int score = (leftover_w < leftover_h) ? ((unsigned int)leftover_w << 16) | (unsigned int)leftover_h : ((unsigned int)leftover_h << 16) | (unsigned int)leftover_w;
+            if (score < best_score)
+            {
+                best_idx = free_idx;
+                best_score = score;
+            }
+        }
+        if (!is_large_cell)
+            builder->PackFreeCellsMaxSize[cell_n] = max_size;
+    }
+    if (best_idx == -1)
+        return false;
+    const ImTextureRect used_r = { builder->PackFreeRects[best_idx].Rect.x, builder->PackFreeRects[best_idx].Rect.y, (unsigned short)w, (unsigned short)h };
+    *out_x = used_r.x;
+    *out_y = used_r.y;
+
+    // Split every free rectangle overlapping the new one into the (up to 4) maximal rectangles around it
+    const int cell_size = IM_FONTATLAS_PACK_CELL_SIZE;
+    ImVector<ImTextureRect>& split_rects = builder->PackSplitRects;
+    ImVector<int>& near_rects = builder->PackNearRects;
+    split_rects.resize(0);
+    near_rects.resize(0);
+    const int used_x1 = used_r.x + used_r.w;
+    const int used_y1 = used_r.y + used_r.h;
+    ImFontAtlasPackMaxRectsGather(builder, used_r.x - cell_size + 1, used_r.y - cell_size + 1, used_x1, used_y1);
+    for (int free_idx : near_rects)
+    {
+        const ImTextureRect free_r = builder->PackFreeRects[free_idx].Rect;
+        if (!ImFontAtlasPackMaxRectsOverlaps(free_r, used_r))
+            continue;
+        const int free_x1 = free_r.x + free_r.w;
+        const int free_y1 = free_r.y + free_r.h;
+        if (used_r.x > free_r.x)
+            split_rects.push_back({ free_r.x, free_r.y, (unsigned short)(used_r.x - free_r.x), free_r.h });
+        if (used_x1 < free_x1)
+            split_rects.push_back({ (unsigned short)used_x1, free_r.y, (unsigned short)(free_x1 - used_x1), free_r.h });
+        if (used_r.y > free_r.y)
+            split_rects.push_back({ free_r.x, free_r.y, free_r.w, (unsigned short)(used_r.y - free_r.y) });
+        if (used_y1 < free_y1)
+            split_rects.push_back({ free_r.x, (unsigned short)used_y1, free_r.w, (unsigned short)(free_y1 - used_y1) });
+        ImFontAtlasPackMaxRectsUnlink(builder, free_idx);
+    }
+    ImFontAtlasPackMaxRectsMergeSplits(builder, false);
+    return true;
+}
+
+// Give back space of a discarded rectangle. Besides the rectangle itself, add its union with neighbor free rectangles
+// sharing a whole side with it, so that freed space joins the space around it (a cheap approximation of maximal rectangles).
+static void ImFontAtlasPackMaxRectsFree(ImFontAtlasBuilder* builder, const ImTextureRect& r)
+{
+    const int cell_size = IM_FONTATLAS_PACK_CELL_SIZE;
+    ImVector<ImTextureRect>& split_rects = builder->PackSplitRects;
+    ImVector<int>& near_rects = builder->PackNearRects;
+    split_rects.resize(0);
+    split_rects.push_back(r);
+    near_rects.resize(0);
+    const int r_x1 = r.x + r.w;
+    const int r_y1 = r.y + r.h;
+    ImFontAtlasPackMaxRectsGather(builder, r.x - cell_size, r.y - cell_size, r_x1 + 1, r_y1 + 1);
+    for (int free_idx : near_rects)
+    {
+        const ImTextureRect& free_r = builder->PackFreeRects[free_idx].Rect;
+        const int free_x1 = free_r.x + free_r.w;
+        const int free_y1 = free_r.y + free_r.h;
+        if (free_x1 == r.x || r_x1 == free_r.x)
+        {
+            const unsigned short x = ImMin(free_r.x, r.x);
+            const unsigned short w = (unsigned short)(free_r.w + r.w);
+            if (free_r.y <= r.y && free_y1 >= r_y1)
+                split_rects.push_back({ x, r.y, w, r.h });
+            if (r.y <= free_r.y && r_y1 >= free_y1)
+                split_rects.push_back({ x, free_r.y, w, free_r.h });
+        }
+        if (free_y1 == r.y || r_y1 == free_r.y)
+        {
+            const unsigned short y = ImMin(free_r.y, r.y);
+            const unsigned short h = (unsigned short)(free_r.h + r.h);
+            if (free_r.x <= r.x && free_x1 >= r_x1)
+                split_rects.push_back({ r.x, y, r.w, h });
+            if (r.x <= free_r.x && r_x1 >= free_x1)
+                split_rects.push_back({ free_r.x, y, free_r.w, h });
+        }
+    }
+    ImFontAtlasPackMaxRectsMergeSplits(builder, true);
+}
+
+// Texture grew to the right and/or bottom: extend free rectangles reaching old edges, add the new area.
+static void ImFontAtlasPackMaxRectsGrow(ImFontAtlasBuilder* builder, int old_w, int old_h, int new_w, int new_h)
+{
+    // Move free rectangles to the grid of the new size, except extended ones which may contain others
+    ImVector<ImTextureRect>& split_rects = builder->PackSplitRects;
+    split_rects.resize(0);
+    for (const ImFontAtlasPackFreeRect& free_r : builder->PackFreeRects)
+        if (free_r.Rect.w != 0)
+            split_rects.push_back(free_r.Rect);
+    ImFontAtlasPackMaxRectsClear(builder, new_w, new_h);
+    int extended_count = 0;
+    for (int free_n = 0; free_n < split_rects.Size; free_n++)
+    {
+        ImTextureRect free_r = split_rects[free_n];
+        if (free_r.x + free_r.w != old_w && free_r.y + free_r.h != old_h)
+        {
+            ImFontAtlasPackMaxRectsLink(builder, free_r);
+            continue;
+        }
+        if (free_r.x + free_r.w == old_w)
+            free_r.w = (unsigned short)(new_w - free_r.x);
+        if (free_r.y + free_r.h == old_h)
+            free_r.h = (unsigned short)(new_h - free_r.y);
+        split_rects[extended_count++] = free_r;
+    }
+    split_rects.resize(extended_count);
+    if (new_w > old_w)
+        split_rects.push_back({ (unsigned short)old_w, 0, (unsigned short)(new_w - old_w), (unsigned short)new_h });
+    if (new_h > old_h)
+        split_rects.push_back({ 0, (unsigned short)old_h, (unsigned short)new_w, (unsigned short)(new_h - old_h) });
+    ImFontAtlasPackMaxRectsMergeSplits(builder, true);
+}
+
 void ImFontAtlasPackInit(ImFontAtlas * atlas)
 {
     ImTextureData* tex = atlas->TexData;
@@ -4244,6 +4971,13 @@ void ImFontAtlasPackInit(ImFontAtlas * atlas)
     builder->RectsPackedSurface = builder->RectsPackedCount = 0;
     builder->MaxRectSize = ImVec2i(0, 0);
     builder->MaxRectBounds = ImVec2i(0, 0);
+
+    builder->PackMaxRects = (atlas->Flags & ImFontAtlasFlags_PackMaxRects) != 0;
+    builder->PackFreeRectsMinSize = 1 + atlas->TexGlyphPadding;
+    ImFontAtlasPackMaxRectsClear(builder, builder->PackMaxRects ? tex->Width : 0, builder->PackMaxRects ? tex->Height : 0);
+    if (builder->PackMaxRects)
+        ImFontAtlasPackMaxRectsLink(builder, { 0, 0, (unsigned short)tex->Width, (unsigned short)tex->Height });
+    builder->RectsDiscardedList.resize(0);
 }
 
 // This is essentially a free-list pattern, it may be nice to wrap it into a dedicated type.
@@ -4280,7 +5014,7 @@ static ImFontAtlasRectId ImFontAtlasPackReuseRectEntry(ImFontAtlas* atlas, ImFon
     return ImFontAtlasRectId_Make(index_idx, index_entry->Generation);
 }
 
-// This is expected to be called in batches and followed by a repack
+// This is expected to be called in batches and followed by a repack (unless using ImFontAtlasFlags_PackMaxRects)
 void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
 {
     IM_ASSERT(id != ImFontAtlasRectId_Invalid);
@@ -4293,6 +5027,7 @@ void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
     int index_idx = ImFontAtlasRectId_GetIndex(id);
     ImFontAtlasRectEntry* index_entry = &builder->RectsIndex[index_idx];
     IM_ASSERT(index_entry->IsUsed && index_entry->TargetIndex >= 0);
+    const int rect_idx = index_entry->TargetIndex;
     index_entry->IsUsed = false;
     index_entry->TargetIndex = builder->RectsIndexFreeListStart;
     index_entry->Generation++;
@@ -4300,7 +5035,23 @@ void ImFontAtlasPackDiscardRect(ImFontAtlas* atlas, ImFontAtlasRectId id)
     const int pack_padding = atlas->TexGlyphPadding;
     builder->RectsIndexFreeListStart = index_idx;
     builder->RectsDiscardedCount++;
-    builder->RectsDiscardedSurface += (rect->w + pack_padding) * (rect->h + pack_padding);
+    if (builder->PackMaxRects)
+    {
+        // Space is reused right away: clear it so the next rectangles don't get stale pixels in their padding.
+        ImTextureData* tex = atlas->TexData;
+        const int pack_w = ImMin(rect->w + pack_padding, tex->Width - rect->x);
+        const int pack_h = ImMin(rect->h + pack_padding, tex->Height - rect->y);
+        ImFontAtlasTextureBlockFill(tex, rect->x, rect->y, pack_w, pack_h, IM_COL32_BLACK_TRANS);
+        ImFontAtlasTextureBlockQueueUpload(atlas, tex, rect->x, rect->y, pack_w, pack_h);
+        ImFontAtlasPackMaxRectsFree(builder, { rect->x, rect->y, (unsigned short)pack_w, (unsigned short)pack_h });
+        builder->RectsDiscardedList.push_back(rect_idx);
+        builder->RectsPackedCount--;
+        builder->RectsPackedSurface -= (rect->w + pack_padding) * (rect->h + pack_padding);
+    }
+    else
+    {
+        builder->RectsDiscardedSurface += (rect->w + pack_padding) * (rect->h + pack_padding);
+    }
     rect->w = rect->h = 0; // Clear rectangle so it won't be packed again
 }
 
@@ -4321,13 +5072,22 @@ ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFon
     for (int attempts_remaining = 3; attempts_remaining >= 0; attempts_remaining--)
     {
         // Try packing
-        stbrp_rect pack_r = {};
-        pack_r.w = w + pack_padding;
-        pack_r.h = h + pack_padding;
-        stbrp_pack_rects((stbrp_context*)(void*)&builder->PackContext, &pack_r, 1);
-        r.x = (unsigned short)pack_r.x;
-        r.y = (unsigned short)pack_r.y;
-        if (pack_r.was_packed)
+        bool was_packed;
+        if (builder->PackMaxRects)
+        {
+            was_packed = ImFontAtlasPackMaxRectsAdd(builder, w + pack_padding, h + pack_padding, &r.x, &r.y);
+        }
+        else
+        {
+            stbrp_rect pack_r = {};
+            pack_r.w = w + pack_padding;
+            pack_r.h = h + pack_padding;
+            stbrp_pack_rects((stbrp_context*)(void*)&builder->PackContext, &pack_r, 1);
+            r.x = (unsigned short)pack_r.x;
+            r.y = (unsigned short)pack_r.y;
+            was_packed = pack_r.was_packed != 0;
+        }
+        if (was_packed)
             break;
 
         // If we ran out of attempts, return fallback
@@ -4346,6 +5106,16 @@ ImFontAtlasRectId ImFontAtlasPackAddRect(ImFontAtlas* atlas, int w, int h, ImFon
     builder->RectsPackedCount++;
     builder->RectsPackedSurface += (w + pack_padding) * (h + pack_padding);
 
+    if (overwrite_entry == NULL && builder->RectsDiscardedList.Size > 0)
+    {
+        // Reuse a discarded entry of Rects[] (ImFontAtlasFlags_PackMaxRects: there may be no repack to reclaim them)
+        const int rect_idx = builder->RectsDiscardedList.back();
+        builder->RectsDiscardedList.pop_back();
+        builder->RectsDiscardedCount--;
+        builder->Rects[rect_idx] = r;
+        return ImFontAtlasPackAllocRectEntry(atlas, rect_idx);
+    }
+
     builder->Rects.push_back(r);
     if (overwrite_entry != NULL)
         return ImFontAtlasPackReuseRectEntry(atlas, overwrite_entry); // Write into an existing entry instead of adding one (used during repack)
@@ -4622,6 +5392,26 @@ static bool ImGui_ImplStbTrueType_FontBakedInit(ImFontAtlas* atlas, ImFontConfig
     return true;
 }
 
+// Rasterize a glyph into a cleared w*h Alpha8 bitmap, then apply oversampling filters. May be called from any thread.
+static void ImGui_ImplStbTrueType_RasterizeGlyph(const stbtt_fontinfo* font_info, int glyph_index, float scale_x, float scale_y, int oversample_h, int oversample_v, int w, int h, unsigned char* pixels)
+{
+    memset(pixels, 0, w * h * 1);
+    stbtt_MakeGlyphBitmapSubpixel(font_info, pixels, w - oversample_h + 1, h - oversample_v + 1, w, scale_x, scale_y, 0, 0, glyph_index);
+
+    // Oversampling
+    // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
+    if (oversample_h > 1)
+        stbtt__h_prefilter(pixels, w, h, w, oversample_h);
+    if (oversample_v > 1)
+        stbtt__v_prefilter(pixels, w, h, w, oversample_v);
+}
+
+static ImGuiID ImFontAtlasPrerasterizedGlyphKey(ImFontConfig* src, ImFontBaked* baked, ImWchar codepoint)
+{
+    const ImGuiID src_and_baked[2] = { ImHashData(&src, sizeof(src)), baked->BakedId };
+    return ImHashData(&codepoint, sizeof(codepoint), ImHashData(src_and_baked, sizeof(src_and_baked)));
+}
+
 static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
 {
     // Search for first font which has the glyph
@@ -4673,21 +5463,22 @@ static bool ImGui_ImplStbTrueType_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontC
         }
         ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
 
-        // Render
+        // Render, unless ImFontAtlasBuildPreloadGlyphRanges() already did
         stbtt_GetGlyphBitmapBox(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, &x0, &y0, &x1, &y1);
         ImFontAtlasBuilder* builder = atlas->Builder;
-        builder->TempBuffer.resize(w * h * 1);
-        unsigned char* bitmap_pixels = builder->TempBuffer.Data;
-        memset(bitmap_pixels, 0, w * h * 1);
-        stbtt_MakeGlyphBitmapSubpixel(&bd_font_data->FontInfo, bitmap_pixels, r->w - oversample_h + 1, r->h - oversample_v + 1, w,
-            scale_for_raster_x, scale_for_raster_y, 0, 0, glyph_index);
-
-        // Oversampling
-        // (those functions conveniently assert if pixels are not cleared, which is another safety layer)
-        if (oversample_h > 1)
-            stbtt__h_prefilter(bitmap_pixels, r->w, r->h, r->w, oversample_h);
-        if (oversample_v > 1)
-            stbtt__v_prefilter(bitmap_pixels, r->w, r->h, r->w, oversample_v);
+        unsigned char* bitmap_pixels = NULL;
+        if (int prerasterized_n = builder->PrerasterizedGlyphsMap.GetInt(ImFontAtlasPrerasterizedGlyphKey(src, baked, codepoint), 0))
+        {
+            const ImFontAtlasPrerasterizedGlyph* prerasterized = &builder->PrerasterizedGlyphs[prerasterized_n - 1];
+            IM_ASSERT(prerasterized->Src == src && prerasterized->GlyphIndex == glyph_index && prerasterized->Width == w && prerasterized->Height == h);
+            bitmap_pixels = builder->PrerasterizedPixels.Data + prerasterized->PixelsOffset;
+        }
+        else
+        {
+            builder->TempBuffer.resize(w * h * 1);
+            bitmap_pixels = builder->TempBuffer.Data;
+            ImGui_ImplStbTrueType_RasterizeGlyph(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, oversample_h, oversample_v, w, h, bitmap_pixels);
+        }
 
         const float ref_size = baked->ContainerFont->Sources[0]->SizePixels;
         const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
@@ -4730,6 +5521,75 @@ const ImFontLoader* ImFontAtlasGetFontLoaderForStbTruetype()
     return &loader;
 }
 
+// Register a glyph to rasterize ahead, if the first source accepting the codepoint uses stb_truetype and has it.
+// Mirrors the source selection of ImFontBaked_BuildLoadGlyph() and the metrics of ImGui_ImplStbTrueType_FontBakedLoadGlyph().
+static void ImGui_ImplStbTrueType_AddPrerasterizedGlyph(ImFontAtlas* atlas, ImFont* font, ImFontBaked* baked, ImWchar codepoint)
+{
+    if (baked->IsGlyphLoaded(codepoint))
+        return;
+    ImFontAtlas_FontHookRemapCodepoint(atlas, font, &codepoint);
+    if (codepoint == font->EllipsisChar && font->EllipsisAutoBake)
+        return;
+
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    for (ImFontConfig* src : font->Sources)
+    {
+        if (src->GlyphExcludeRanges && !ImFontAtlasBuildAcceptCodepointForSource(src, codepoint))
+            continue;
+        const ImFontLoader* loader = src->FontLoader ? src->FontLoader : atlas->FontLoader;
+        if (loader->FontBakedLoadGlyph != ImGui_ImplStbTrueType_FontBakedLoadGlyph)
+            return; // Other loaders load the glyph themselves
+        ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (ImGui_ImplStbTrueType_FontSrcData*)src->FontLoaderData;
+        int glyph_index = stbtt_FindGlyphIndex(&bd_font_data->FontInfo, (int)codepoint);
+        if (glyph_index == 0)
+            continue;
+
+        const ImGuiID key = ImFontAtlasPrerasterizedGlyphKey(src, baked, codepoint);
+        if (builder->PrerasterizedGlyphsMap.GetInt(key, 0) != 0)
+            return; // Overlapping ranges
+
+        int oversample_h, oversample_v;
+        ImFontAtlasBuildGetOversampleFactors(src, baked, &oversample_h, &oversample_v);
+        const float rasterizer_density = src->RasterizerDensity * baked->RasterizerDensity;
+        const float scale_for_raster_x = bd_font_data->ScaleFactor * baked->Size * rasterizer_density * oversample_h;
+        const float scale_for_raster_y = bd_font_data->ScaleFactor * baked->Size * rasterizer_density * oversample_v;
+        int x0, y0, x1, y1;
+        stbtt_GetGlyphBitmapBoxSubpixel(&bd_font_data->FontInfo, glyph_index, scale_for_raster_x, scale_for_raster_y, 0, 0, &x0, &y0, &x1, &y1);
+        if (x0 == x1 || y0 == y1)
+            return;
+
+        ImFontAtlasPrerasterizedGlyph glyph;
+        glyph.Src = src;
+        glyph.GlyphIndex = glyph_index;
+        glyph.Width = (x1 - x0 + oversample_h - 1);
+        glyph.Height = (y1 - y0 + oversample_v - 1);
+        glyph.OversampleH = oversample_h;
+        glyph.OversampleV = oversample_v;
+        glyph.ScaleX = scale_for_raster_x;
+        glyph.ScaleY = scale_for_raster_y;
+        glyph.PixelsOffset = builder->PrerasterizedPixels.Size;
+        builder->PrerasterizedPixels.resize(builder->PrerasterizedPixels.Size + glyph.Width * glyph.Height);
+        builder->PrerasterizedGlyphsMap.SetInt(key, builder->PrerasterizedGlyphs.Size + 1);
+        builder->PrerasterizedGlyphs.push_back(glyph);
+        return;
+    }
+}
+
+// Worker side: only reads font data and writes to the glyphs own slice of PrerasterizedPixels[]
+static void ImGui_ImplStbTrueType_RasterizeGlyphBatch(int batch_index, void* job_data)
+{
+    ImFontAtlasBuilder* builder = (ImFontAtlasBuilder*)job_data;
+    const int glyph_begin = batch_index * IM_FONT_PRERASTERIZE_BATCH_SIZE;
+    const int glyph_end = ImMin(glyph_begin + IM_FONT_PRERASTERIZE_BATCH_SIZE, builder->PrerasterizedGlyphs.Size);
+    for (int glyph_n = glyph_begin; glyph_n < glyph_end; glyph_n++)
+    {
+        const ImFontAtlasPrerasterizedGlyph* glyph = &builder->PrerasterizedGlyphs.Data[glyph_n];
+        const ImGui_ImplStbTrueType_FontSrcData* bd_font_data = (const ImGui_ImplStbTrueType_FontSrcData*)glyph->Src->FontLoaderData;
+        ImGui_ImplStbTrueType_RasterizeGlyph(&bd_font_data->FontInfo, glyph->GlyphIndex, glyph->ScaleX, glyph->ScaleY, glyph->OversampleH, glyph->OversampleV,
+            glyph->Width, glyph->Height, builder->PrerasterizedPixels.Data + glyph->PixelsOffset);
+    }
+}
+
 #endif // IMGUI_ENABLE_STB_TRUETYPE
 
 //-------------------------------------------------------------------------
@@ -5465,6 +6325,22 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
     if (!text_end)
         text_end = text_begin + ImStrlen(text_begin); // FIXME-OPT: Need to avoid this.
 
+    // Cached layout
+    ImFontAtlas* atlas = ContainerAtlas;
+    if (max_width == FLT_MAX && (atlas->Flags & ImFontAtlasFlags_TextLayoutCache) && atlas->Builder != NULL && !atlas->Builder->TextLayoutCache.Busy)
+    {
+        ImFontTextLayoutCacheStats* stats = &atlas->Builder->TextLayoutCache.FrameStats;
+        if (ImFontTextLayout* layout = ImFontAtlasTextLayoutCacheFind(atlas, this, size, wrap_width, text_begin, text_end))
+        {
+            stats->Hits++;
+            if (remaining)
+                *remaining = text_end;
+            return layout->TextSize;
+        }
+        stats->Misses++;
+        stats->MissedBytes += (int)(text_end - text_begin);
+    }
+
     const float line_height = size;
     ImFontBaked* baked = GetFontBaked(size);
     const float scale = size / baked->Size;
@@ -5583,9 +6459,38 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     draw_list->PrimRectUV(ImVec2(x1, y1), ImVec2(x2, y2), ImVec2(u1, v1), ImVec2(u2, v2), col);
 }
 
+// Text layout cache, see ImFontAtlasFlags_TextLayoutCache
+static const int IM_FONT_TEXT_LAYOUT_MAX_TEXT_LENGTH = 1024;    // Longer texts are never cached
+static const int IM_FONT_TEXT_LAYOUT_MIN_RENDER_LENGTH = 64;    // RenderText() lays out shorter unwrapped texts again: emitting their vertices costs about as much as the lookup saves
+static const int IM_FONT_TEXT_LAYOUT_MAX_COUNT = 8192;
+static const int IM_FONT_TEXT_LAYOUT_UNUSED_FRAMES = 60;        // Layouts unused for that many frames are evicted
+static const int IM_FONT_TEXT_LAYOUT_MAX_CANDIDATES = 4096;
+static bool ImFontTextLayout_Render(const ImFontTextLayout* layout, ImDrawList* draw_list, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect);
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip)
 {
+    // Cached layout, when fully visible
+    ImFontAtlas* atlas = ContainerAtlas;
+    if ((atlas->Flags & ImFontAtlasFlags_TextLayoutCache) && !(draw_list->Flags & ImDrawListFlags_NoTextLayoutCache) && atlas->Builder != NULL && !atlas->Builder->TextLayoutCache.Busy && IM_TRUNC(pos.y) <= clip_rect.w)
+    {
+        if (!text_end)
+            text_end = text_begin + ImStrlen(text_begin);
+        if (wrap_width > 0.0f || text_end - text_begin >= IM_FONT_TEXT_LAYOUT_MIN_RENDER_LENGTH)
+        {
+            ImFontTextLayoutCacheStats* stats = &atlas->Builder->TextLayoutCache.FrameStats;
+            ImFontTextLayout* layout = ImFontAtlasTextLayoutCacheFind(atlas, this, size, wrap_width, text_begin, text_end);
+            if (layout && ImFontTextLayout_Render(layout, draw_list, pos, col, clip_rect))
+            {
+                stats->Hits++;
+                stats->GlyphsCopied += layout->Vertices.Size / 4;
+                return;
+            }
+            stats->Misses++;
+            stats->MissedBytes += (int)(text_end - text_begin);
+        }
+    }
+
     // Align to be pixel perfect
 begin:
     float x = IM_TRUNC(pos.x);
@@ -5788,6 +6693,695 @@ begin:
     draw_list->_VtxCurrentIdx = vtx_index;
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImFontAtlas text layout cache
+//-----------------------------------------------------------------------------
+// - ImFontAtlasTextLayoutCacheFind()
+// - ImFontAtlasTextLayoutCacheNewFrame()
+// - ImFontAtlasTextLayoutCacheClear()
+// - ImFontAtlas::GetTextLayoutCacheStats()
+//-----------------------------------------------------------------------------
+// With ImFontAtlasFlags_TextLayoutCache, texts seen on two different frames get their layout cached, keyed by hash of text, font, size,
+// rasterizer density and wrap width. CalcTextSizeA() then returns the cached size without decoding anything, and RenderText() copies
+// the cached glyph quads of long or wrapped texts offset to the text position, as long as the whole text is visible (no clipping, no skipped lines).
+// Layouts hold glyph UV, so they are all flushed when glyphs UV may change: texture repack, discarded bakes or glyphs, font rebuilds.
+//-----------------------------------------------------------------------------
+
+static int ImFontTextLayout_MemoryBytes(const ImFontTextLayout* layout)
+{
+    return (int)sizeof(ImFontTextLayout) + layout->Text.Capacity + layout->Vertices.Capacity * (int)sizeof(ImDrawVert);
+}
+
+// Same walk as RenderText(), from (0, 0) and without clipping
+static void ImFontTextLayout_Build(ImFontTextLayout* layout, ImFont* font, const char* text_begin, const char* text_end)
+{
+    const float size = layout->Size;
+    const float wrap_width = layout->WrapWidth;
+    layout->TextSize = font->CalcTextSizeA(size, FLT_MAX, wrap_width, text_begin, text_end, NULL);
+    layout->Bounds = ImVec4(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+    const float line_height = size;
+    ImFontBaked* baked = font->GetFontBaked(size);
+    const float scale = size / baked->Size;
+    const bool word_wrap_enabled = (wrap_width > 0.0f);
+    const char* word_wrap_eol = NULL;
+
+    float x = 0.0f;
+    float y = 0.0f;
+    const char* s = text_begin;
+    while (s < text_end)
+    {
+        if (word_wrap_enabled)
+        {
+            if (!word_wrap_eol)
+                word_wrap_eol = font->CalcWordWrapPosition(size, s, text_end, wrap_width - x);
+
+            if (s >= word_wrap_eol)
+            {
+                x = 0.0f;
+                y += line_height;
+                word_wrap_eol = NULL;
+                s = CalcWordWrapNextLineStartA(s, text_end); // Wrapping skips upcoming blanks
+                continue;
+            }
+        }
+
+        // Decode and advance source
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+
+        if (c < 32)
+        {
+            if (c == '\n')
+            {
+                x = 0.0f;
+                y += line_height;
+                continue;
+            }
+            if (c == '\r')
+                continue;
+        }
+
+        const ImFontGlyph* glyph = baked->FindGlyph((ImWchar)c);
+        if (glyph->Visible)
+        {
+            const float x1 = x + glyph->X0 * scale;
+            const float x2 = x + glyph->X1 * scale;
+            const float y1 = y + glyph->Y0 * scale;
+            const float y2 = y + glyph->Y1 * scale;
+            const ImU32 col_bits = glyph->Colored ? ~IM_COL32_A_MASK : 0;
+            ImDrawVert vtx[4];
+            vtx[0].pos = ImVec2(x1, y1); vtx[0].uv = ImVec2(glyph->U0, glyph->V0); vtx[0].col = col_bits;
+            vtx[1].pos = ImVec2(x2, y1); vtx[1].uv = ImVec2(glyph->U1, glyph->V0); vtx[1].col = col_bits;
+            vtx[2].pos = ImVec2(x2, y2); vtx[2].uv = ImVec2(glyph->U1, glyph->V1); vtx[2].col = col_bits;
+            vtx[3].pos = ImVec2(x1, y2); vtx[3].uv = ImVec2(glyph->U0, glyph->V1); vtx[3].col = col_bits;
+            layout->Vertices.push_back(vtx[0]);
+            layout->Vertices.push_back(vtx[1]);
+            layout->Vertices.push_back(vtx[2]);
+            layout->Vertices.push_back(vtx[3]);
+            layout->Bounds = ImVec4(ImMin(layout->Bounds.x, x1), ImMin(layout->Bounds.y, y1), ImMax(layout->Bounds.z, x2), ImMax(layout->Bounds.w, y2));
+            layout->LastLineY = y;
+        }
+        x += glyph->AdvanceX * scale;
+    }
+}
+
+// Emit a cached layout at a RenderText() position. Return false when part of the text would be clipped: RenderText() takes the regular path then.
+static bool ImFontTextLayout_Render(const ImFontTextLayout* layout, ImDrawList* draw_list, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect)
+{
+    const int vtx_count = layout->Vertices.Size;
+    if (vtx_count == 0)
+        return true;
+
+    // Align to be pixel perfect
+    const float x = IM_TRUNC(pos.x);
+    const float y = IM_TRUNC(pos.y);
+    const ImVec4& b = layout->Bounds;
+    if (x + b.x < clip_rect.x || y + b.y < clip_rect.y || x + b.z > clip_rect.z || y + b.w > clip_rect.w)
+        return false;
+    if (y + layout->Size < clip_rect.y || y + layout->LastLineY > clip_rect.w)
+        return false;
+
+    const int idx_count = vtx_count / 4 * 6;
+    draw_list->PrimReserve(idx_count, vtx_count);
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    unsigned int vtx_index = draw_list->_VtxCurrentIdx;
+    const ImDrawVert* vtx_read = layout->Vertices.Data;
+    for (int n = 0; n < vtx_count; n += 4)
+    {
+        vtx_write[0].pos.x = vtx_read[0].pos.x + x; vtx_write[0].pos.y = vtx_read[0].pos.y + y; vtx_write[0].col = vtx_read[0].col | col; vtx_write[0].uv = vtx_read[0].uv;
+        vtx_write[1].pos.x = vtx_read[1].pos.x + x; vtx_write[1].pos.y = vtx_read[1].pos.y + y; vtx_write[1].col = vtx_read[1].col | col; vtx_write[1].uv = vtx_read[1].uv;
+        vtx_write[2].pos.x = vtx_read[2].pos.x + x; vtx_write[2].pos.y = vtx_read[2].pos.y + y; vtx_write[2].col = vtx_read[2].col | col; vtx_write[2].uv = vtx_read[2].uv;
+        vtx_write[3].pos.x = vtx_read[3].pos.x + x; vtx_write[3].pos.y = vtx_read[3].pos.y + y; vtx_write[3].col = vtx_read[3].col | col; vtx_write[3].uv = vtx_read[3].uv;
+        idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+        idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+        vtx_read += 4;
+        vtx_write += 4;
+        vtx_index += 4;
+        idx_write += 6;
+    }
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_index;
+    return true;
+}
+
+ImFontTextLayout* ImFontAtlasTextLayoutCacheFind(ImFontAtlas* atlas, ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontTextLayoutCache* cache = &builder->TextLayoutCache;
+    const int text_len = (int)(text_end - text_begin);
+    if (text_len > IM_FONT_TEXT_LAYOUT_MAX_TEXT_LENGTH)
+        return NULL;
+
+    // Keys never leave the cache: use the fastest hash whatever ImHashData() is configured to
+    const float params[3] = { size, font->CurrentRasterizerDensity, wrap_width };
+    const ImGuiID key = ImHashDataWide(text_begin, (size_t)text_len, ImHashDataWide(params, sizeof(params), ImHashDataWide(&font, sizeof(font))));
+    const int layout_n = cache->LayoutsMap.GetInt(key, 0) - 1;
+    if (layout_n >= 0)
+    {
+        ImFontTextLayout* layout = cache->Layouts[layout_n];
+        if (layout->Font != font || layout->Size != size || layout->RasterizerDensity != font->CurrentRasterizerDensity || layout->WrapWidth != wrap_width)
+            return NULL; // Hash collision: first come first served
+        if (layout->Text.Size != text_len || memcmp(layout->Text.Data, text_begin, (size_t)text_len) != 0)
+            return NULL;
+        layout->LastUsedFrame = builder->FrameCount;
+        return layout;
+    }
+
+    // Only cache texts seen on an earlier frame
+    const int first_seen_frame = cache->Candidates.GetInt(key, INT_MAX);
+    if (first_seen_frame == INT_MAX)
+    {
+        cache->Candidates.SetInt(key, builder->FrameCount);
+        return NULL;
+    }
+    if (first_seen_frame >= builder->FrameCount || cache->Layouts.Size >= IM_FONT_TEXT_LAYOUT_MAX_COUNT)
+        return NULL;
+
+    // Loading glyphs may grow and repack the texture, which flushes the cache: give up on this text if it happens
+    ImFontTextLayout* layout = IM_NEW(ImFontTextLayout)();
+    layout->Key = key;
+    layout->Font = font;
+    layout->Size = size;
+    layout->RasterizerDensity = font->CurrentRasterizerDensity;
+    layout->WrapWidth = wrap_width;
+    layout->LastUsedFrame = builder->FrameCount;
+    layout->Text.resize(text_len);
+    memcpy(layout->Text.Data, text_begin, (size_t)text_len);
+
+    const int invalidations = cache->FrameStats.Invalidations;
+    cache->Busy = true;
+    ImFontTextLayout_Build(layout, font, text_begin, text_end);
+    cache->Busy = false;
+    if (atlas->Builder != builder || cache->FrameStats.Invalidations != invalidations)
+    {
+        IM_DELETE(layout);
+        return NULL;
+    }
+    layout->Vertices.shrink(layout->Vertices.Size);
+
+    cache->Candidates.Remove(key);
+    cache->LayoutsMap.SetInt(key, cache->Layouts.Size + 1);
+    cache->Layouts.push_back(layout);
+    cache->FrameStats.Insertions++;
+    cache->FrameStats.Layouts++;
+    cache->FrameStats.MemoryBytes += ImFontTextLayout_MemoryBytes(layout);
+    return layout;
+}
+
+void ImFontAtlasTextLayoutCacheNewFrame(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImFontTextLayoutCache* cache = &builder->TextLayoutCache;
+
+    // Evict layouts unused for a while (swap with last)
+    for (int layout_n = 0; layout_n < cache->Layouts.Size; )
+    {
+        ImFontTextLayout* layout = cache->Layouts[layout_n];
+        if (layout->LastUsedFrame + IM_FONT_TEXT_LAYOUT_UNUSED_FRAMES >= builder->FrameCount)
+        {
+            layout_n++;
+            continue;
+        }
+        cache->LayoutsMap.Remove(layout->Key);
+        cache->FrameStats.Evictions++;
+        cache->FrameStats.Layouts--;
+        cache->FrameStats.MemoryBytes -= ImFontTextLayout_MemoryBytes(layout);
+        IM_DELETE(layout);
+        ImFontTextLayout* last = cache->Layouts.back();
+        cache->Layouts.pop_back();
+        if (layout_n < cache->Layouts.Size)
+        {
+            cache->Layouts[layout_n] = last;
+            cache->LayoutsMap.SetInt(last->Key, layout_n + 1);
+        }
+    }
+    if (cache->Candidates.Data.Size > IM_FONT_TEXT_LAYOUT_MAX_CANDIDATES)
+        cache->Candidates.Clear();
+
+    // Roll statistics. Current values carry over.
+    cache->LastFrameStats = cache->FrameStats;
+    ImFontTextLayoutCacheStats* stats = &cache->FrameStats;
+    stats->Hits = stats->Misses = stats->MissedBytes = stats->GlyphsCopied = stats->Insertions = stats->Evictions = 0;
+}
+
+void ImFontAtlasTextLayoutCacheClear(ImFontAtlas* atlas)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    if (builder == NULL)
+        return;
+    ImFontTextLayoutCache* cache = &builder->TextLayoutCache;
+    for (ImFontTextLayout* layout : cache->Layouts)
+        IM_DELETE(layout);
+    cache->Layouts.clear();
+    cache->LayoutsMap.Clear();
+    cache->FrameStats.Layouts = 0;
+    cache->FrameStats.MemoryBytes = 0;
+    cache->FrameStats.Invalidations++;
+}
+
+ImFontTextLayoutCacheStats ImFontAtlas::GetTextLayoutCacheStats() const
+{
+    if (Builder == NULL)
+        return ImFontTextLayoutCacheStats();
+    ImFontTextLayoutCacheStats stats = Builder->TextLayoutCache.LastFrameStats;
+    stats.Layouts = Builder->TextLayoutCache.FrameStats.Layouts;
+    stats.MemoryBytes = Builder->TextLayoutCache.FrameStats.MemoryBytes;
+    stats.Invalidations = Builder->TextLayoutCache.FrameStats.Invalidations;
+    return stats;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImFontAtlas on-disk cache
+//-----------------------------------------------------------------------------
+// - ImFontAtlasCacheGetKey()
+// - ImFontAtlasCacheSave()
+// - ImFontAtlasCacheLoad()
+//-----------------------------------------------------------------------------
+// Serialize the baked output of an atlas (texture, packing state, baked fonts with their glyphs) so a later run using the same fonts
+// can restore it instead of rasterizing again. Data is only meant to be read back by the same build: structures are stored as raw bytes,
+// and the key hashes font files contents, sources options, atlas settings, Dear ImGui version and the size of stored structures.
+// Loading must happen after adding fonts and before anything gets baked or packed. The atlas stays dynamic afterwards.
+//-----------------------------------------------------------------------------
+
+#define IMGUI_FONT_ATLAS_CACHE_VERSION  2
+
+struct ImFontAtlasCacheHeader
+{
+    char            Magic[4];           // "IMFA"
+    int             Version;            // IMGUI_FONT_ATLAS_CACHE_VERSION
+    ImGuiID         Key;                // ImFontAtlasCacheGetKey()
+    ImGuiID         PayloadHash;
+    unsigned int    PayloadSize;
+};
+
+// Baked font as stored in cache data. Arrays point into the data, which may not be aligned.
+struct ImFontAtlasCacheBaked
+{
+    int             FontIdx;
+    float           Metrics[5];         // Size, RasterizerDensity, Ascent, Descent, FallbackAdvanceX
+    int             FallbackGlyphIndex;
+    int             MetricsTotalSurface;
+    int             IndexSize;
+    const char*     IndexAdvanceX;
+    const char*     IndexLookup;
+    int             GlyphsCount;
+    const char*     Glyphs;
+};
+
+struct ImFontAtlasCacheReader
+{
+    const char*     Data;
+    const char*     DataEnd;
+    bool            Error;
+
+    ImFontAtlasCacheReader(const void* data, size_t data_size) { Data = (const char*)data; DataEnd = Data + data_size; Error = false; }
+    const char*     Skip(size_t size)               { if (Error || (size_t)(DataEnd - Data) < size) { Error = true; return NULL; } const char* p = Data; Data += size; return p; }
+    void            Read(void* dst, size_t size)    { const char* p = Skip(size); if (p != NULL) memcpy(dst, p, size); else memset(dst, 0, size); }
+    int             ReadInt()                       { int v; Read(&v, sizeof(v)); return v; }
+    int             ReadCount(int max_count)        { int v = ReadInt(); if (v < 0 || v > max_count) { Error = true; v = 0; } return v; }
+};
+
+static void ImFontAtlasCacheWrite(ImVector<char>* out_data, const void* data, size_t data_size)
+{
+    if (data_size == 0)
+        return;
+    const int offset = out_data->Size;
+    out_data->resize(offset + (int)data_size);
+    memcpy(out_data->Data + offset, data, data_size);
+}
+
+static void ImFontAtlasCacheWriteInt(ImVector<char>* out_data, int v)
+{
+    ImFontAtlasCacheWrite(out_data, &v, sizeof(v));
+}
+
+static ImGuiID ImFontAtlasCacheHashRanges(const ImWchar* ranges, ImGuiID seed)
+{
+    int ranges_size = 0;
+    if (ranges != NULL)
+        while (ranges[ranges_size] != 0)
+            ranges_size++;
+    return ImHashDataWide(ranges, ranges_size * sizeof(ImWchar), seed);
+}
+
+// stbrp_node pointers are stored as indices: -1 for NULL, PackNodes.Size + n for the context own extra[n]
+static int ImFontAtlasCachePackNodeToIndex(ImFontAtlasBuilder* builder, stbrp_node* node)
+{
+    stbrp_context* pack_context = (stbrp_context*)(void*)&builder->PackContext;
+    if (node == NULL)
+        return -1;
+    if (node >= pack_context->extra && node < pack_context->extra + IM_ARRAYSIZE(pack_context->extra))
+        return builder->PackNodes.Size + (int)(node - pack_context->extra);
+    IM_ASSERT(node >= builder->PackNodes.Data && node < builder->PackNodes.Data + builder->PackNodes.Size);
+    return (int)(node - builder->PackNodes.Data);
+}
+
+static stbrp_node* ImFontAtlasCachePackNodeFromIndex(ImFontAtlasBuilder* builder, int node_idx)
+{
+    stbrp_context* pack_context = (stbrp_context*)(void*)&builder->PackContext;
+    if (node_idx < 0)
+        return NULL;
+    if (node_idx >= builder->PackNodes.Size)
+        return &pack_context->extra[node_idx - builder->PackNodes.Size];
+    return &builder->PackNodes.Data[node_idx];
+}
+
+// Hash of everything affecting baked output. Font data is hashed by contents as it is usually loaded again from a file.
+ImGuiID ImFontAtlasCacheGetKey(ImFontAtlas* atlas)
+{
+    const int settings[] =
+    {
+        IMGUI_VERSION_NUM, IMGUI_FONT_ATLAS_CACHE_VERSION,
+        (int)sizeof(ImWchar), (int)sizeof(ImFontGlyph), (int)sizeof(ImTextureRect), (int)sizeof(ImFontAtlasRectEntry), (int)sizeof(stbrp_node),
+        atlas->Flags & (ImFontAtlasFlags_NoPowerOfTwoHeight | ImFontAtlasFlags_NoMouseCursors | ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_PackMaxRects),
+        (int)atlas->TexDesiredFormat, atlas->TexGlyphPadding, atlas->Fonts.Size, atlas->Sources.Size,
+    };
+    ImGuiID key = ImHashDataWide(settings, sizeof(settings));
+    key = ImHashStr(atlas->FontLoader ? atlas->FontLoader->Name : "", 0, key);
+    for (ImFontConfig& src : atlas->Sources)
+    {
+        const int options_i[] =
+        {
+            atlas->Fonts.find_index(src.DstFont), src.FontDataSize, (int)src.FontNo, (int)src.FontLoaderFlags, (int)src.Flags,
+            src.MergeMode, src.PixelSnapH, src.PixelSnapV, src.OversampleH, src.OversampleV, (int)src.EllipsisChar,
+        };
+        const float options_f[] =
+        {
+            src.SizePixels, src.GlyphOffset.x, src.GlyphOffset.y, src.GlyphMinAdvanceX, src.GlyphMaxAdvanceX, src.GlyphExtraAdvanceX,
+            src.RasterizerMultiply, src.RasterizerDensity,
+        };
+        key = ImHashDataWide(options_i, sizeof(options_i), key);
+        key = ImHashDataWide(options_f, sizeof(options_f), key);
+        key = ImHashDataWide(src.FontData, (size_t)src.FontDataSize, key);
+        key = ImFontAtlasCacheHashRanges(src.GlyphRanges, key);
+        key = ImFontAtlasCacheHashRanges(src.GlyphExcludeRanges, key);
+        key = ImHashStr(src.FontLoader ? src.FontLoader->Name : "", 0, key);
+    }
+    return key;
+}
+
+void ImFontAtlasCacheSave(ImFontAtlas* atlas, ImVector<char>* out_data)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    ImTextureData* tex = atlas->TexData;
+    IM_ASSERT(builder != NULL && tex != NULL && tex->Pixels != NULL);
+    out_data->resize(sizeof(ImFontAtlasCacheHeader));
+
+    // Texture
+    ImFontAtlasCacheWriteInt(out_data, tex->Width);
+    ImFontAtlasCacheWriteInt(out_data, tex->Height);
+    ImFontAtlasCacheWriteInt(out_data, (int)tex->Format);
+    ImFontAtlasCacheWrite(out_data, &tex->UsedRect, sizeof(tex->UsedRect));
+    ImFontAtlasCacheWrite(out_data, tex->Pixels, (size_t)tex->GetSizeInBytes());
+
+    // Packing state
+    const int rects_state[] =
+    {
+        builder->PackIdMouseCursors, builder->PackIdLinesTexData, builder->RectsIndexFreeListStart,
+        builder->RectsPackedCount, builder->RectsPackedSurface, builder->RectsDiscardedCount, builder->RectsDiscardedSurface,
+        builder->MaxRectSize.x, builder->MaxRectSize.y, builder->MaxRectBounds.x, builder->MaxRectBounds.y,
+    };
+    ImFontAtlasCacheWrite(out_data, rects_state, sizeof(rects_state));
+    ImFontAtlasCacheWriteInt(out_data, builder->Rects.Size);
+    ImFontAtlasCacheWrite(out_data, builder->Rects.Data, builder->Rects.size_in_bytes());
+    ImFontAtlasCacheWriteInt(out_data, builder->RectsIndex.Size);
+    ImFontAtlasCacheWrite(out_data, builder->RectsIndex.Data, builder->RectsIndex.size_in_bytes());
+
+    stbrp_context* pack_context = (stbrp_context*)(void*)&builder->PackContext;
+    const int context_state[] =
+    {
+        pack_context->width, pack_context->height, pack_context->align, pack_context->init_mode, pack_context->heuristic, pack_context->num_nodes,
+        ImFontAtlasCachePackNodeToIndex(builder, pack_context->active_head), ImFontAtlasCachePackNodeToIndex(builder, pack_context->free_head),
+    };
+    ImFontAtlasCacheWrite(out_data, context_state, sizeof(context_state));
+    ImFontAtlasCacheWriteInt(out_data, builder->PackNodes.Size);
+    for (int node_n = 0; node_n < builder->PackNodes.Size + IM_ARRAYSIZE(pack_context->extra); node_n++)
+    {
+        stbrp_node* node = ImFontAtlasCachePackNodeFromIndex(builder, node_n);
+        const int node_state[] = { node->x, node->y, ImFontAtlasCachePackNodeToIndex(builder, node->next) };
+        ImFontAtlasCacheWrite(out_data, node_state, sizeof(node_state));
+    }
+    ImFontAtlasCacheWriteInt(out_data, builder->PackMaxRects ? 1 : 0);
+    int free_rects_count = 0;
+    for (const ImFontAtlasPackFreeRect& free_r : builder->PackFreeRects)
+        free_rects_count += (free_r.Rect.w != 0) ? 1 : 0;
+    ImFontAtlasCacheWriteInt(out_data, free_rects_count);
+    for (const ImFontAtlasPackFreeRect& free_r : builder->PackFreeRects)
+        if (free_r.Rect.w != 0)
+            ImFontAtlasCacheWrite(out_data, &free_r.Rect, sizeof(free_r.Rect));
+
+    // Baked fonts (skipping those queued for destroy)
+    int baked_count = 0;
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+        if (!builder->BakedPool[baked_n].WantDestroy)
+            baked_count++;
+    ImFontAtlasCacheWriteInt(out_data, baked_count);
+    for (int baked_n = 0; baked_n < builder->BakedPool.Size; baked_n++)
+    {
+        ImFontBaked* baked = &builder->BakedPool[baked_n];
+        if (baked->WantDestroy)
+            continue;
+        const float metrics[] = { baked->Size, baked->RasterizerDensity, baked->Ascent, baked->Descent, baked->FallbackAdvanceX };
+        IM_ASSERT(baked->IndexAdvanceX.Size == baked->IndexLookup.Size);
+        ImFontAtlasCacheWriteInt(out_data, atlas->Fonts.find_index(baked->ContainerFont));
+        ImFontAtlasCacheWrite(out_data, metrics, sizeof(metrics));
+        ImFontAtlasCacheWriteInt(out_data, baked->FallbackGlyphIndex);
+        ImFontAtlasCacheWriteInt(out_data, (int)baked->MetricsTotalSurface);
+        ImFontAtlasCacheWriteInt(out_data, baked->IndexLookup.Size);
+        ImFontAtlasCacheWrite(out_data, baked->IndexAdvanceX.Data, baked->IndexAdvanceX.size_in_bytes());
+        ImFontAtlasCacheWrite(out_data, baked->IndexLookup.Data, baked->IndexLookup.size_in_bytes());
+        ImFontAtlasCacheWriteInt(out_data, baked->Glyphs.Size);
+        ImFontAtlasCacheWrite(out_data, baked->Glyphs.Data, baked->Glyphs.size_in_bytes());
+    }
+
+    ImFontAtlasCacheHeader header;
+    memcpy(header.Magic, "IMFA", 4);
+    header.Version = IMGUI_FONT_ATLAS_CACHE_VERSION;
+    header.Key = ImFontAtlasCacheGetKey(atlas);
+    header.PayloadSize = (unsigned int)(out_data->Size - (int)sizeof(header));
+    header.PayloadHash = ImHashDataWide(out_data->Data + sizeof(header), header.PayloadSize);
+    memcpy(out_data->Data, &header, sizeof(header));
+}
+
+// Everything is validated before touching the atlas: on failure the atlas is left as is and will bake as usual.
+bool ImFontAtlasCacheLoad(ImFontAtlas* atlas, const void* data, size_t data_size)
+{
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    IM_ASSERT(builder != NULL && "Add fonts before loading cache data!");
+    const int builtin_rects_count = (builder->PackIdMouseCursors != ImFontAtlasRectId_Invalid ? 1 : 0) + (builder->PackIdLinesTexData != ImFontAtlasRectId_Invalid ? 1 : 0);
+    if (builder->BakedPool.Size > 0 || builder->RectsPackedCount > builtin_rects_count)
+    {
+        IMGUI_DEBUG_LOG_FONT("[font] Cache: atlas already has baked fonts or custom rectangles, ignoring cache.\n");
+        return false;
+    }
+
+    ImFontAtlasCacheHeader header;
+    if (data_size < sizeof(header))
+    {
+        IMGUI_DEBUG_LOG_FONT("[font] Cache: truncated data, ignoring cache.\n");
+        return false;
+    }
+    memcpy(&header, data, sizeof(header));
+    const char* payload = (const char*)data + sizeof(header);
+    if (memcmp(header.Magic, "IMFA", 4) != 0 || header.Version != IMGUI_FONT_ATLAS_CACHE_VERSION)
+    {
+        IMGUI_DEBUG_LOG_FONT("[font] Cache: unknown format, ignoring cache.\n");
+        return false;
+    }
+    if (header.Key != ImFontAtlasCacheGetKey(atlas))
+    {
+        IMGUI_DEBUG_LOG_FONT("[font] Cache: fonts or settings changed, ignoring cache.\n");
+        return false;
+    }
+    if (header.PayloadSize != data_size - sizeof(header) || header.PayloadHash != ImHashDataWide(payload, header.PayloadSize))
+    {
+        IMGUI_DEBUG_LOG_FONT("[font] Cache: corrupted data, ignoring cache.\n");
+        return false;
+    }
+
+    // Texture
+    ImFontAtlasCacheReader reader(payload, header.PayloadSize);
+    const int tex_w = reader.ReadCount(atlas->TexMaxWidth);
+    const int tex_h = reader.ReadCount(atlas->TexMaxHeight);
+    const ImTextureFormat tex_format = (ImTextureFormat)reader.ReadInt();
+    ImTextureRect tex_used_rect;
+    reader.Read(&tex_used_rect, sizeof(tex_used_rect));
+    bool valid = (tex_format == atlas->TexDesiredFormat && tex_w > 0 && tex_h > 0);
+    const char* tex_pixels = reader.Skip(valid ? (size_t)tex_w * tex_h * ImTextureDataGetFormatBytesPerPixel(tex_format) : 0);
+
+    // Packing state
+    int rects_state[11];
+    reader.Read(rects_state, sizeof(rects_state));
+    const int rects_count = reader.ReadCount(ImFontAtlasRectId_IndexMask_);
+    const char* rects = reader.Skip(rects_count * sizeof(ImTextureRect));
+    const int rects_index_count = reader.ReadCount(ImFontAtlasRectId_IndexMask_);
+    const char* rects_index = reader.Skip(rects_index_count * sizeof(ImFontAtlasRectEntry));
+    for (int entry_n = 0; entry_n < rects_index_count && !reader.Error; entry_n++)
+    {
+        ImFontAtlasRectEntry entry;
+        memcpy(&entry, rects_index + entry_n * sizeof(entry), sizeof(entry));
+        valid &= (entry.IsUsed ? (entry.TargetIndex >= 0 && entry.TargetIndex < rects_count) : (entry.TargetIndex >= -1 && entry.TargetIndex < rects_index_count));
+    }
+
+    stbrp_context* pack_context = (stbrp_context*)(void*)&builder->PackContext;
+    int context_state[8];
+    reader.Read(context_state, sizeof(context_state));
+    const int nodes_count = reader.ReadCount(tex_w);
+    const int nodes_total_count = nodes_count + IM_ARRAYSIZE(pack_context->extra);
+    const char* nodes = reader.Skip(nodes_total_count * sizeof(int) * 3);
+    valid &= (nodes_count == tex_w / 2);
+    valid &= (context_state[6] >= -1 && context_state[6] < nodes_total_count && context_state[7] >= -1 && context_state[7] < nodes_total_count);
+    for (int node_n = 0; node_n < nodes_total_count && !reader.Error; node_n++)
+    {
+        int node_state[3];
+        memcpy(node_state, nodes + node_n * sizeof(node_state), sizeof(node_state));
+        valid &= (node_state[2] >= -1 && node_state[2] < nodes_total_count);
+    }
+    const bool pack_max_rects = reader.ReadInt() != 0;
+    const int free_rects_count = reader.ReadCount(ImFontAtlasRectId_IndexMask_);
+    const char* free_rects = reader.Skip(free_rects_count * sizeof(ImTextureRect));
+    valid &= (pack_max_rects == ((atlas->Flags & ImFontAtlasFlags_PackMaxRects) != 0)) && (pack_max_rects || free_rects_count == 0);
+    for (int free_n = 0; free_n < free_rects_count && !reader.Error; free_n++)
+    {
+        ImTextureRect free_r;
+        memcpy(&free_r, free_rects + free_n * sizeof(free_r), sizeof(free_r));
+        valid &= (free_r.w > 0 && free_r.h > 0 && free_r.x + free_r.w <= tex_w && free_r.y + free_r.h <= tex_h);
+    }
+
+    // Baked fonts
+    ImVector<ImFontAtlasCacheBaked> cached_bakeds;
+    cached_bakeds.resize(reader.ReadCount(0xFFFF));
+    for (ImFontAtlasCacheBaked& cached_baked : cached_bakeds)
+    {
+        cached_baked.FontIdx = reader.ReadInt();
+        reader.Read(cached_baked.Metrics, sizeof(cached_baked.Metrics));
+        cached_baked.FallbackGlyphIndex = reader.ReadInt();
+        cached_baked.MetricsTotalSurface = reader.ReadInt();
+        cached_baked.IndexSize = reader.ReadCount(IM_UNICODE_CODEPOINT_MAX + 1);
+        cached_baked.IndexAdvanceX = reader.Skip(cached_baked.IndexSize * sizeof(float));
+        cached_baked.IndexLookup = reader.Skip(cached_baked.IndexSize * sizeof(ImU16));
+        cached_baked.GlyphsCount = reader.ReadCount(IM_FONTGLYPH_INDEX_NOT_FOUND - 1);
+        cached_baked.Glyphs = reader.Skip(cached_baked.GlyphsCount * sizeof(ImFontGlyph));
+        if (reader.Error)
+            break;
+        valid &= (cached_baked.FontIdx >= 0 && cached_baked.FontIdx < atlas->Fonts.Size);
+        valid &= (cached_baked.Metrics[0] > 0.0f && cached_baked.Metrics[1] > 0.0f);
+        valid &= (cached_baked.FallbackGlyphIndex >= -1 && cached_baked.FallbackGlyphIndex < cached_baked.GlyphsCount);
+        for (int c = 0; c < cached_baked.IndexSize; c++)
+        {
+            ImU16 glyph_idx;
+            memcpy(&glyph_idx, cached_baked.IndexLookup + c * sizeof(ImU16), sizeof(glyph_idx));
+            valid &= (glyph_idx < cached_baked.GlyphsCount || glyph_idx == IM_FONTGLYPH_INDEX_UNUSED || glyph_idx == IM_FONTGLYPH_INDEX_NOT_FOUND);
+        }
+        for (int glyph_n = 0; glyph_n < cached_baked.GlyphsCount; glyph_n++)
+        {
+            ImFontGlyph glyph;
+            memcpy(&glyph, cached_baked.Glyphs + glyph_n * sizeof(ImFontGlyph), sizeof(glyph));
+            valid &= ((int)glyph.Codepoint < cached_baked.IndexSize);
+            valid &= (glyph.PackId == ImFontAtlasRectId_Invalid || ImFontAtlasRectId_GetIndex(glyph.PackId) < rects_index_count);
+        }
+    }
+    if (reader.Error || reader.Data != reader.DataEnd || !valid)
+    {
+        IMGUI_DEBUG_LOG_FONT("[font] Cache: invalid data, ignoring cache.\n");
+        return false;
+    }
+
+    // Restore baked fonts
+    for (ImFontAtlasCacheBaked& cached_baked : cached_bakeds)
+    {
+        ImFont* font = atlas->Fonts[cached_baked.FontIdx];
+        const ImGuiID baked_id = ImFontAtlasBakedGetId(font->FontId, cached_baked.Metrics[0], cached_baked.Metrics[1]);
+        ImFontBaked* baked = ImFontAtlasBakedAddEmpty(atlas, font, cached_baked.Metrics[0], cached_baked.Metrics[1], baked_id);
+        baked->Ascent = cached_baked.Metrics[2];
+        baked->Descent = cached_baked.Metrics[3];
+        baked->FallbackAdvanceX = cached_baked.Metrics[4];
+        baked->FallbackGlyphIndex = cached_baked.FallbackGlyphIndex;
+        baked->MetricsTotalSurface = (unsigned int)cached_baked.MetricsTotalSurface;
+        baked->IndexAdvanceX.resize(cached_baked.IndexSize);
+        baked->IndexLookup.resize(cached_baked.IndexSize);
+        baked->Glyphs.resize(cached_baked.GlyphsCount);
+        memcpy(baked->IndexAdvanceX.Data, cached_baked.IndexAdvanceX, baked->IndexAdvanceX.size_in_bytes());
+        memcpy(baked->IndexLookup.Data, cached_baked.IndexLookup, baked->IndexLookup.size_in_bytes());
+        memcpy(baked->Glyphs.Data, cached_baked.Glyphs, baked->Glyphs.size_in_bytes());
+        builder->BakedMap.SetVoidPtr(baked_id, baked);
+        for (ImFontGlyph& glyph : baked->Glyphs)
+        {
+            const int page_n = glyph.Codepoint / 8192;
+            font->Used8kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
+            if (glyph.Colored)
+                atlas->TexPixelsUseColors = true;
+        }
+    }
+
+    // Restore texture
+    ImTextureData* tex = ImFontAtlasTextureAdd(atlas, tex_w, tex_h);
+    memcpy(tex->Pixels, tex_pixels, (size_t)tex->GetSizeInBytes());
+    tex->UsedRect = tex_used_rect;
+    tex->UseColors = atlas->TexPixelsUseColors;
+
+    // Restore packing state
+    builder->PackIdMouseCursors = rects_state[0];
+    builder->PackIdLinesTexData = rects_state[1];
+    builder->RectsIndexFreeListStart = rects_state[2];
+    builder->RectsPackedCount = rects_state[3];
+    builder->RectsPackedSurface = rects_state[4];
+    builder->RectsDiscardedCount = rects_state[5];
+    builder->RectsDiscardedSurface = rects_state[6];
+    builder->MaxRectSize = ImVec2i(rects_state[7], rects_state[8]);
+    builder->MaxRectBounds = ImVec2i(rects_state[9], rects_state[10]);
+    builder->Rects.resize(rects_count);
+    builder->RectsIndex.resize(rects_index_count);
+    memcpy(builder->Rects.Data, rects, builder->Rects.size_in_bytes());
+    memcpy(builder->RectsIndex.Data, rects_index, builder->RectsIndex.size_in_bytes());
+
+    builder->PackNodes.resize(nodes_count);
+    pack_context->width = context_state[0];
+    pack_context->height = context_state[1];
+    pack_context->align = context_state[2];
+    pack_context->init_mode = context_state[3];
+    pack_context->heuristic = context_state[4];
+    pack_context->num_nodes = context_state[5];
+    pack_context->active_head = ImFontAtlasCachePackNodeFromIndex(builder, context_state[6]);
+    pack_context->free_head = ImFontAtlasCachePackNodeFromIndex(builder, context_state[7]);
+    for (int node_n = 0; node_n < nodes_total_count; node_n++)
+    {
+        int node_state[3];
+        memcpy(node_state, nodes + node_n * sizeof(node_state), sizeof(node_state));
+        stbrp_node* node = ImFontAtlasCachePackNodeFromIndex(builder, node_n);
+        node->x = node_state[0];
+        node->y = node_state[1];
+        node->next = ImFontAtlasCachePackNodeFromIndex(builder, node_state[2]);
+    }
+    builder->PackMaxRects = pack_max_rects;
+    ImFontAtlasPackMaxRectsClear(builder, pack_max_rects ? tex_w : 0, pack_max_rects ? tex_h : 0);
+    for (int free_n = 0; free_n < free_rects_count; free_n++)
+    {
+        ImTextureRect free_r;
+        memcpy(&free_r, free_rects + free_n * sizeof(free_r), sizeof(free_r));
+        ImFontAtlasPackMaxRectsLink(builder, free_r);
+    }
+    builder->RectsDiscardedList.resize(0);
+    if (pack_max_rects)
+        for (int rect_n = 0; rect_n < builder->Rects.Size; rect_n++)
+            if (builder->Rects[rect_n].w == 0 && builder->Rects[rect_n].h == 0)
+                builder->RectsDiscardedList.push_back(rect_n);
+
+    // Refresh UV of builtin rectangles (they are found, so nothing gets drawn again)
+    ImFontAtlasBuildUpdateLinesTexData(atlas);
+    ImFontAtlasBuildUpdateBasicTexData(atlas);
+    ImFontAtlasTextLayoutCacheClear(atlas);
+    ImFontAtlasUpdateDrawListsSharedData(atlas);
+    IMGUI_DEBUG_LOG_FONT("[font] Cache: loaded %dx%d texture, %d baked fonts.\n", tex_w, tex_h, cached_bakeds.Size);
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGui Internal Render Helpers
 //-----------------------------------------------------------------------------
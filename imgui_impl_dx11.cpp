@@ -6,6 +6,7 @@
 //  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
 //  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
+//  [X] Renderer: Streaming vertex/index buffers (ring-buffered WRITE_NO_OVERWRITE appends, geometric growth). See ImGui_ImplDX11_SetBufferStreaming().
 
 // You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -17,6 +18,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-16: DirectX11: Added buffer streaming mode (enabled by default): vertices/indices are appended to ring buffers mapped with D3D11_MAP_WRITE_NO_OVERWRITE, which grow geometrically.
 //  2025-06-11: DirectX11: Added support for ImGuiBackendFlags_RendererHasTextures, for dynamic font atlas.
 //  2025-05-07: DirectX11: Honor draw_data->FramebufferScale to allow for custom backends and experiment using it (consistently with other renderer backends, even though in normal condition it is not set under Windows).
 //  2025-01-06: DirectX11: Expose VertexConstantBuffer in ImGui_ImplDX11_RenderState. Reset projection matrix in ImDrawCallback_ResetRenderState handler.
@@ -43,6 +45,7 @@
 #include "imgui.h"
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_dx11.h"
+#include "imgui_impl_streaming.h"
 
 // DirectX
 #include <stdio.h>
@@ -82,8 +85,11 @@ struct ImGui_ImplDX11_Data
     ID3D11DepthStencilState*    pDepthStencilState;
     int                         VertexBufferSize;
     int                         IndexBufferSize;
+    bool                        BufferStreaming;
+    ImGui_ImplStreamingRing     VertexRing;
+    ImGui_ImplStreamingRing     IndexRing;
 
-    ImGui_ImplDX11_Data()       { memset((void*)this, 0, sizeof(*this)); VertexBufferSize = 5000; IndexBufferSize = 10000; }
+    ImGui_ImplDX11_Data()       { memset((void*)this, 0, sizeof(*this)); VertexBufferSize = 5000; IndexBufferSize = 10000; BufferStreaming = true; VertexRing = ImGui_ImplStreamingRing(8192); IndexRing = ImGui_ImplStreamingRing(16384); }
 };
 
 struct VERTEX_CONSTANT_BUFFER_DX11
@@ -174,7 +180,39 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
                 ImGui_ImplDX11_UpdateTexture(tex);
 
     // Create and grow vertex/index buffers if needed
-    if (!bd->pVB || bd->VertexBufferSize < draw_data->TotalVtxCount)
+    if (bd->BufferStreaming)
+    {
+        if (bd->VertexRing.EnsureCapacity(draw_data->TotalVtxCount))
+        {
+            if (bd->pVB) { bd->pVB->Release(); bd->pVB = nullptr; }
+            D3D11_BUFFER_DESC desc = {};
+            desc.Usage = D3D11_USAGE_DYNAMIC;
+            desc.ByteWidth = bd->VertexRing.Capacity * sizeof(ImDrawVert);
+            desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+            desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+            desc.MiscFlags = 0;
+            if (bd->pd3dDevice->CreateBuffer(&desc, nullptr, &bd->pVB) < 0)
+            {
+                bd->VertexRing.Reset();
+                return;
+            }
+        }
+        if (bd->IndexRing.EnsureCapacity(draw_data->TotalIdxCount))
+        {
+            if (bd->pIB) { bd->pIB->Release(); bd->pIB = nullptr; }
+            D3D11_BUFFER_DESC desc = {};
+            desc.Usage = D3D11_USAGE_DYNAMIC;
+            desc.ByteWidth = bd->IndexRing.Capacity * sizeof(ImDrawIdx);
+            desc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+            desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+            if (bd->pd3dDevice->CreateBuffer(&desc, nullptr, &bd->pIB) < 0)
+            {
+                bd->IndexRing.Reset();
+                return;
+            }
+        }
+    }
+    else if (!bd->pVB || bd->VertexBufferSize < draw_data->TotalVtxCount)
     {
         if (bd->pVB) { bd->pVB->Release(); bd->pVB = nullptr; }
         bd->VertexBufferSize = draw_data->TotalVtxCount + 5000;
@@ -187,7 +225,7 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
         if (bd->pd3dDevice->CreateBuffer(&desc, nullptr, &bd->pVB) < 0)
             return;
     }
-    if (!bd->pIB || bd->IndexBufferSize < draw_data->TotalIdxCount)
+    if (!bd->BufferStreaming && (!bd->pIB || bd->IndexBufferSize < draw_data->TotalIdxCount))
     {
         if (bd->pIB) { bd->pIB->Release(); bd->pIB = nullptr; }
         bd->IndexBufferSize = draw_data->TotalIdxCount + 10000;
@@ -201,13 +239,24 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
     }
 
     // Upload vertex/index data into a single contiguous GPU buffer
+    // (When streaming, append after the previous frames without overwriting data the GPU may still be reading, and discard only when wrapping around)
+    ImGui_ImplStreamingAllocation vtx_alloc = { 0, true };
+    ImGui_ImplStreamingAllocation idx_alloc = { 0, true };
+    if (bd->BufferStreaming)
+    {
+        vtx_alloc = bd->VertexRing.Allocate(draw_data->TotalVtxCount);
+        idx_alloc = bd->IndexRing.Allocate(draw_data->TotalIdxCount);
+    }
     D3D11_MAPPED_SUBRESOURCE vtx_resource, idx_resource;
-    if (device->Map(bd->pVB, 0, D3D11_MAP_WRITE_DISCARD, 0, &vtx_resource) != S_OK)
+    if (device->Map(bd->pVB, 0, vtx_alloc.Discard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE, 0, &vtx_resource) != S_OK)
         return;
-    if (device->Map(bd->pIB, 0, D3D11_MAP_WRITE_DISCARD, 0, &idx_resource) != S_OK)
+    if (device->Map(bd->pIB, 0, idx_alloc.Discard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE, 0, &idx_resource) != S_OK)
+    {
+        device->Unmap(bd->pVB, 0);
         return;
-    ImDrawVert* vtx_dst = (ImDrawVert*)vtx_resource.pData;
-    ImDrawIdx* idx_dst = (ImDrawIdx*)idx_resource.pData;
+    }
+    ImDrawVert* vtx_dst = (ImDrawVert*)vtx_resource.pData + vtx_alloc.Offset;
+    ImDrawIdx* idx_dst = (ImDrawIdx*)idx_resource.pData + idx_alloc.Offset;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* draw_list = draw_data->CmdLists[n];
@@ -278,8 +327,8 @@ void ImGui_ImplDX11_RenderDrawData(ImDrawData* draw_data)
 
     // Render command lists
     // (Because we merged all buffers into a single one, we maintain our own offset into them)
-    int global_idx_offset = 0;
-    int global_vtx_offset = 0;
+    int global_idx_offset = idx_alloc.Offset;
+    int global_vtx_offset = vtx_alloc.Offset;
     ImVec2 clip_off = draw_data->DisplayPos;
     ImVec2 clip_scale = draw_data->FramebufferScale;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
@@ -600,6 +649,8 @@ void    ImGui_ImplDX11_InvalidateDeviceObjects()
     if (bd->pFontSampler)           { bd->pFontSampler->Release(); bd->pFontSampler = nullptr; }
     if (bd->pIB)                    { bd->pIB->Release(); bd->pIB = nullptr; }
     if (bd->pVB)                    { bd->pVB->Release(); bd->pVB = nullptr; }
+    bd->VertexRing.Reset();
+    bd->IndexRing.Reset();
     if (bd->pBlendState)            { bd->pBlendState->Release(); bd->pBlendState = nullptr; }
     if (bd->pDepthStencilState)     { bd->pDepthStencilState->Release(); bd->pDepthStencilState = nullptr; }
     if (bd->pRasterizerState)       { bd->pRasterizerState->Release(); bd->pRasterizerState = nullptr; }
@@ -662,6 +713,32 @@ void ImGui_ImplDX11_Shutdown()
     IM_DELETE(bd);
 }
 
+void ImGui_ImplDX11_SetBufferStreaming(bool enabled)
+{
+    ImGui_ImplDX11_Data* bd = ImGui_ImplDX11_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplDX11_Init()?");
+    if (bd->BufferStreaming == enabled)
+        return;
+
+    // Buffers are sized differently by each mode: recreate them on next render
+    if (bd->pIB) { bd->pIB->Release(); bd->pIB = nullptr; }
+    if (bd->pVB) { bd->pVB->Release(); bd->pVB = nullptr; }
+    bd->VertexRing.Reset();
+    bd->IndexRing.Reset();
+    bd->BufferStreaming = enabled;
+}
+
+void ImGui_ImplDX11_GetBufferStreamingStats(ImGui_ImplDX11_BufferStreamingStats* out_stats)
+{
+    ImGui_ImplDX11_Data* bd = ImGui_ImplDX11_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplDX11_Init()?");
+    out_stats->VertexCapacity = bd->BufferStreaming ? bd->VertexRing.Capacity : bd->VertexBufferSize;
+    out_stats->IndexCapacity = bd->BufferStreaming ? bd->IndexRing.Capacity : bd->IndexBufferSize;
+    out_stats->GrowCount = bd->VertexRing.GrowCount + bd->IndexRing.GrowCount;
+    out_stats->DiscardCount = bd->VertexRing.DiscardCount + bd->IndexRing.DiscardCount;
+    out_stats->NoOverwriteCount = bd->VertexRing.NoOverwriteCount + bd->IndexRing.NoOverwriteCount;
+}
+
 void ImGui_ImplDX11_NewFrame()
 {
     ImGui_ImplDX11_Data* bd = ImGui_ImplDX11_GetBackendData();
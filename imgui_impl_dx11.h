@@ -6,6 +6,7 @@
 //  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
 //  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
 //  [X] Renderer: Expose selected render state for draw callbacks to use. Access in '(ImGui_ImplXXXX_RenderState*)GetPlatformIO().Renderer_RenderState'.
+//  [X] Renderer: Streaming vertex/index buffers (ring-buffered WRITE_NO_OVERWRITE appends, geometric growth). See ImGui_ImplDX11_SetBufferStreaming().
 
 // You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -37,6 +38,19 @@ IMGUI_IMPL_API void     ImGui_ImplDX11_InvalidateDeviceObjects();
 // (Advanced) Use e.g. if you need to precisely control the timing of texture updates (e.g. for staged rendering), by setting ImDrawData::Textures = NULL to handle this manually.
 IMGUI_IMPL_API void     ImGui_ImplDX11_UpdateTexture(ImTextureData* tex);
 
+// Buffer streaming (enabled by default): append each frame's vertices/indices to ring buffers mapped with D3D11_MAP_WRITE_NO_OVERWRITE,
+// discarding only when wrapping around, and grow them geometrically. When disabled, buffers are discarded every frame and regrown with a fixed slack.
+struct ImGui_ImplDX11_BufferStreamingStats
+{
+    int                     VertexCapacity;     // Elements
+    int                     IndexCapacity;      // Elements
+    int                     GrowCount;          // Streaming mode only; counts vertex and index buffers
+    int                     DiscardCount;       // Streaming mode only; counts vertex and index buffers
+    int                     NoOverwriteCount;   // Streaming mode only; counts vertex and index buffers
+};
+IMGUI_IMPL_API void     ImGui_ImplDX11_SetBufferStreaming(bool enabled);
+IMGUI_IMPL_API void     ImGui_ImplDX11_GetBufferStreamingStats(ImGui_ImplDX11_BufferStreamingStats* out_stats);
+
 // [BETA] Selected render state data shared with callbacks.
 // This is temporarily stored in GetPlatformIO().Renderer_RenderState during the ImGui_ImplDX11_RenderDrawData() call.
 // (Please open an issue if you feel you need access to more data)
@@ -0,0 +1,498 @@
+// dear imgui: Renderer Backend for CPU software rasterization
+// This can be used along with a Platform Backend, or headless without any (e.g. UI captures and UI performance tests on machines without a GPU).
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftware_Image*' as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Tile-binned rasterization, optionally spread across threads through a user provided parallel-for.
+// Missing features:
+//  [ ] Renderer: User callbacks are not invoked (ImDrawCallback_ResetRenderState is a no-op as there is no render state).
+
+// The rasterizer mirrors what the GPU backends configure:
+// - Pixel centers are sampled at (x+0.5, y+0.5), vertex positions are snapped to 1/16th of a pixel and coverage is decided
+//   with exact integer edge functions and a consistent tie-breaking rule, so edges shared by two triangles are drawn exactly once.
+// - Textures are sampled bilinearly with clamp addressing (required by anti-aliased lines baked in the font atlas).
+// - Blending is (SrcAlpha, InvSrcAlpha) for color and (One, InvSrcAlpha) for alpha, like imgui_impl_dx11.cpp.
+// - The target is split into tiles. Triangles are binned to the tiles they overlap in submission order,
+//   then every tile is rasterized independently, which is what allows tiles to run in parallel without changing the result.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_software.h"
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+// Clang/GCC warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic ignored "-Wold-style-cast"         // warning: use of old-style cast                            // yes, they are more terse.
+#pragma clang diagnostic ignored "-Wsign-conversion"        // warning: implicit conversion changes signedness
+#endif
+
+#define IMGUI_IMPL_SOFTWARE_TILE_SIZE           64
+#define IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS       4
+#define IMGUI_IMPL_SOFTWARE_SUBPIXEL_SCALE      (1 << IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS)
+
+// Texture as seen by the rasterizer
+struct ImGui_ImplSoftware_Sampler
+{
+    const unsigned char*    Pixels;         // NULL: untextured (sample as opaque white)
+    int                     Width;
+    int                     Height;
+    int                     Pitch;
+    int                     BytesPerPixel;  // 4 (RGBA32) or 1 (Alpha8)
+};
+
+// Triangle after setup; vertices are reordered so that the signed area is positive
+struct ImGui_ImplSoftware_Triangle
+{
+    int64_t                 EdgeA[3], EdgeB[3], EdgeC[3];   // Edge functions in subpixel units: E(x,y) = A*x + B*y + C, E >= 0 inside
+    int64_t                 EdgeBias[3];                    // 0 or -1; pixels exactly on an edge belong to one triangle only
+    float                   InvArea;
+    ImVec2                  UV[3];
+    ImVec4                  Col[3];
+    int                     MinX, MinY, MaxX, MaxY;         // Pixel bounds (max exclusive), already intersected with clip rectangle and target
+    int                     SamplerIndex;
+    bool                    Flat;                           // Same color and uv on every vertex: shade once per triangle
+};
+
+// Per-frame scratch buffers, kept in the backend data when initialized as the renderer backend to avoid reallocating every frame
+struct ImGui_ImplSoftware_Scratch
+{
+    ImVector<ImGui_ImplSoftware_Triangle>   Triangles;
+    ImVector<ImGui_ImplSoftware_Sampler>    Samplers;
+    ImVector<int>                           TileOffsets;    // Start of each tile in TileTriangles (TileCount + 1 entries)
+    ImVector<int>                           TileCursors;
+    ImVector<int>                           TileTriangles;  // Triangle indices, in submission order for each tile
+};
+
+struct ImGui_ImplSoftware_Data
+{
+    ImGui_ImplSoftware_Scratch  Scratch;
+
+    ImGui_ImplSoftware_Data()   { }
+};
+
+// State shared by the tile jobs of one ImGui_ImplSoftware_RenderDrawData() call
+struct ImGui_ImplSoftware_RenderContext
+{
+    const ImGui_ImplSoftware_Image*     Target;
+    const ImGui_ImplSoftware_Scratch*   Scratch;
+    int                                 TilesX;
+};
+
+// Set as io.BackendRendererName by ImGui_ImplSoftware_Init(). Compared by address: when used as a capture renderer,
+// io.BackendRendererUserData belongs to another backend (e.g. ImGui_ImplDX11_Data) and must not be reinterpreted.
+static const char ImGui_ImplSoftware_RendererName[] = "imgui_impl_software";
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+// It is STRONGLY preferred that you use docking branch with multi-viewports (== single Dear ImGui context + multiple windows) instead of multiple Dear ImGui contexts.
+// Returns NULL when the software backend is not the renderer backend of the current context.
+static ImGui_ImplSoftware_Data* ImGui_ImplSoftware_GetBackendData()
+{
+    if (ImGui::GetCurrentContext() == nullptr)
+        return nullptr;
+    ImGuiIO& io = ImGui::GetIO();
+    return io.BackendRendererName == ImGui_ImplSoftware_RendererName ? (ImGui_ImplSoftware_Data*)io.BackendRendererUserData : nullptr;
+}
+
+// Functions
+template<typename T> static inline T ImGui_ImplSoftware_Min(T a, T b) { return a < b ? a : b; }
+template<typename T> static inline T ImGui_ImplSoftware_Max(T a, T b) { return a > b ? a : b; }
+static inline float ImGui_ImplSoftware_Saturate(float v)        { return v < 0.0f ? 0.0f : v > 1.0f ? 1.0f : v; }
+static inline int   ImGui_ImplSoftware_ClampInt(int v, int mn, int mx) { return v < mn ? mn : v > mx ? mx : v; }
+
+static ImVec4 ImGui_ImplSoftware_UnpackColor(ImU32 col)
+{
+    const float s = 1.0f / 255.0f;
+    return ImVec4(((col >> IM_COL32_R_SHIFT) & 0xFF) * s, ((col >> IM_COL32_G_SHIFT) & 0xFF) * s, ((col >> IM_COL32_B_SHIFT) & 0xFF) * s, ((col >> IM_COL32_A_SHIFT) & 0xFF) * s);
+}
+
+static ImVec4 ImGui_ImplSoftware_FetchTexel(const ImGui_ImplSoftware_Sampler& sampler, int x, int y)
+{
+    const unsigned char* p = sampler.Pixels + (size_t)y * sampler.Pitch + (size_t)x * sampler.BytesPerPixel;
+    const float s = 1.0f / 255.0f;
+    if (sampler.BytesPerPixel == 1)
+        return ImVec4(1.0f, 1.0f, 1.0f, p[0] * s);
+    return ImVec4(p[0] * s, p[1] * s, p[2] * s, p[3] * s);
+}
+
+// Bilinear filtering, clamp addressing
+static ImVec4 ImGui_ImplSoftware_Sample(const ImGui_ImplSoftware_Sampler& sampler, ImVec2 uv)
+{
+    if (sampler.Pixels == nullptr)
+        return ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
+
+    float fx = uv.x * sampler.Width - 0.5f;
+    float fy = uv.y * sampler.Height - 0.5f;
+    float x0f = floorf(fx);
+    float y0f = floorf(fy);
+    float tx = fx - x0f;
+    float ty = fy - y0f;
+    int x0 = ImGui_ImplSoftware_ClampInt((int)x0f, 0, sampler.Width - 1);
+    int y0 = ImGui_ImplSoftware_ClampInt((int)y0f, 0, sampler.Height - 1);
+    int x1 = ImGui_ImplSoftware_ClampInt((int)x0f + 1, 0, sampler.Width - 1);
+    int y1 = ImGui_ImplSoftware_ClampInt((int)y0f + 1, 0, sampler.Height - 1);
+
+    ImVec4 t00 = ImGui_ImplSoftware_FetchTexel(sampler, x0, y0);
+    ImVec4 t10 = ImGui_ImplSoftware_FetchTexel(sampler, x1, y0);
+    ImVec4 t01 = ImGui_ImplSoftware_FetchTexel(sampler, x0, y1);
+    ImVec4 t11 = ImGui_ImplSoftware_FetchTexel(sampler, x1, y1);
+    float w00 = (1.0f - tx) * (1.0f - ty), w10 = tx * (1.0f - ty), w01 = (1.0f - tx) * ty, w11 = tx * ty;
+    return ImVec4(
+        t00.x * w00 + t10.x * w10 + t01.x * w01 + t11.x * w11,
+        t00.y * w00 + t10.y * w10 + t01.y * w01 + t11.y * w11,
+        t00.z * w00 + t10.z * w10 + t01.z * w01 + t11.z * w11,
+        t00.w * w00 + t10.w * w10 + t01.w * w01 + t11.w * w11);
+}
+
+static inline void ImGui_ImplSoftware_Blend(unsigned char* dst, const ImVec4& src)
+{
+    float sa = ImGui_ImplSoftware_Saturate(src.w);
+    if (sa <= 0.0f)
+        return;
+    if (sa >= 1.0f)
+    {
+        dst[0] = (unsigned char)(ImGui_ImplSoftware_Saturate(src.x) * 255.0f + 0.5f);
+        dst[1] = (unsigned char)(ImGui_ImplSoftware_Saturate(src.y) * 255.0f + 0.5f);
+        dst[2] = (unsigned char)(ImGui_ImplSoftware_Saturate(src.z) * 255.0f + 0.5f);
+        dst[3] = 255;
+        return;
+    }
+    const float s = 1.0f / 255.0f;
+    float inv_sa = 1.0f - sa;
+    dst[0] = (unsigned char)((ImGui_ImplSoftware_Saturate(src.x) * sa + dst[0] * s * inv_sa) * 255.0f + 0.5f);
+    dst[1] = (unsigned char)((ImGui_ImplSoftware_Saturate(src.y) * sa + dst[1] * s * inv_sa) * 255.0f + 0.5f);
+    dst[2] = (unsigned char)((ImGui_ImplSoftware_Saturate(src.z) * sa + dst[2] * s * inv_sa) * 255.0f + 0.5f);
+    dst[3] = (unsigned char)((sa + dst[3] * s * inv_sa) * 255.0f + 0.5f);
+}
+
+static ImGui_ImplSoftware_Sampler ImGui_ImplSoftware_ResolveSampler(const ImDrawCmd* pcmd, bool is_renderer_backend)
+{
+    ImGui_ImplSoftware_Sampler sampler = {};
+    if (ImTextureData* tex = pcmd->TexRef._TexData)
+    {
+        // Texture owned by Dear ImGui (e.g. font atlas): the CPU copy is always up to date
+        if (tex->Pixels != nullptr && (tex->Format == ImTextureFormat_RGBA32 || tex->Format == ImTextureFormat_Alpha8))
+        {
+            sampler.Pixels = tex->Pixels;
+            sampler.Width = tex->Width;
+            sampler.Height = tex->Height;
+            sampler.BytesPerPixel = tex->BytesPerPixel;
+            sampler.Pitch = tex->GetPitch();
+        }
+    }
+    else if (is_renderer_backend && pcmd->TexRef._TexID != ImTextureID_Invalid)
+    {
+        // User texture
+        const ImGui_ImplSoftware_Image* image = (const ImGui_ImplSoftware_Image*)(intptr_t)pcmd->TexRef._TexID;
+        sampler.Pixels = image->Pixels;
+        sampler.Width = image->Width;
+        sampler.Height = image->Height;
+        sampler.BytesPerPixel = 4;
+        sampler.Pitch = image->Pitch;
+    }
+    return sampler;
+}
+
+// Setup a triangle for rasterization; returns false when it covers no pixel
+static bool ImGui_ImplSoftware_SetupTriangle(ImGui_ImplSoftware_Triangle* tri, const ImDrawVert* v0, const ImDrawVert* v1, const ImDrawVert* v2, ImVec2 pos_off, ImVec2 pos_scale, const int clip[4])
+{
+    const ImDrawVert* v[3] = { v0, v1, v2 };
+    int64_t x[3], y[3];
+    for (int i = 0; i < 3; i++)
+    {
+        x[i] = (int64_t)lrintf((v[i]->pos.x - pos_off.x) * pos_scale.x * IMGUI_IMPL_SOFTWARE_SUBPIXEL_SCALE);
+        y[i] = (int64_t)lrintf((v[i]->pos.y - pos_off.y) * pos_scale.y * IMGUI_IMPL_SOFTWARE_SUBPIXEL_SCALE);
+    }
+
+    // Reorder to a positive area, dropping degenerate triangles
+    int64_t area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]);
+    if (area == 0)
+        return false;
+    if (area < 0)
+    {
+        const ImDrawVert* tv = v[1]; v[1] = v[2]; v[2] = tv;
+        int64_t t = x[1]; x[1] = x[2]; x[2] = t;
+        t = y[1]; y[1] = y[2]; y[2] = t;
+        area = -area;
+    }
+
+    // Pixel bounds
+    int64_t min_x = ImGui_ImplSoftware_Min(ImGui_ImplSoftware_Min(x[0], x[1]), x[2]), max_x = ImGui_ImplSoftware_Max(ImGui_ImplSoftware_Max(x[0], x[1]), x[2]);
+    int64_t min_y = ImGui_ImplSoftware_Min(ImGui_ImplSoftware_Min(y[0], y[1]), y[2]), max_y = ImGui_ImplSoftware_Max(ImGui_ImplSoftware_Max(y[0], y[1]), y[2]);
+    tri->MinX = ImGui_ImplSoftware_Max(clip[0], (int)(min_x >> IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS));
+    tri->MinY = ImGui_ImplSoftware_Max(clip[1], (int)(min_y >> IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS));
+    tri->MaxX = ImGui_ImplSoftware_Min(clip[2], (int)(max_x >> IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS) + 1);
+    tri->MaxY = ImGui_ImplSoftware_Min(clip[3], (int)(max_y >> IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS) + 1);
+    if (tri->MinX >= tri->MaxX || tri->MinY >= tri->MaxY)
+        return false;
+
+    // Edge i is opposite to vertex i, so that E_i / area is the barycentric weight of vertex i
+    for (int i = 0; i < 3; i++)
+    {
+        int a = (i + 1) % 3;
+        int b = (i + 2) % 3;
+        tri->EdgeA[i] = y[a] - y[b];
+        tri->EdgeB[i] = x[b] - x[a];
+        tri->EdgeC[i] = x[a] * y[b] - y[a] * x[b];
+        // Flipping an edge flips the signs of A and B, so exactly one of the two triangles sharing an edge owns the pixels on it
+        bool owns_edge = tri->EdgeA[i] > 0 || (tri->EdgeA[i] == 0 && tri->EdgeB[i] > 0);
+        tri->EdgeBias[i] = owns_edge ? 0 : -1;
+    }
+    tri->InvArea = 1.0f / (float)area;
+
+    for (int i = 0; i < 3; i++)
+    {
+        tri->UV[i] = v[i]->uv;
+        tri->Col[i] = ImGui_ImplSoftware_UnpackColor(v[i]->col);
+    }
+    tri->Flat = v[0]->col == v[1]->col && v[0]->col == v[2]->col
+        && v[0]->uv.x == v[1]->uv.x && v[0]->uv.x == v[2]->uv.x
+        && v[0]->uv.y == v[1]->uv.y && v[0]->uv.y == v[2]->uv.y;
+    return true;
+}
+
+static void ImGui_ImplSoftware_RasterizeTriangle(const ImGui_ImplSoftware_Image* target, const ImGui_ImplSoftware_Triangle& tri, const ImGui_ImplSoftware_Sampler& sampler, int tile_min_x, int tile_min_y, int tile_max_x, int tile_max_y)
+{
+    int x0 = ImGui_ImplSoftware_Max(tri.MinX, tile_min_x), x1 = ImGui_ImplSoftware_Min(tri.MaxX, tile_max_x);
+    int y0 = ImGui_ImplSoftware_Max(tri.MinY, tile_min_y), y1 = ImGui_ImplSoftware_Min(tri.MaxY, tile_max_y);
+    if (x0 >= x1 || y0 >= y1)
+        return;
+
+    ImVec4 flat_color(0.0f, 0.0f, 0.0f, 0.0f);
+    if (tri.Flat)
+    {
+        ImVec4 texel = ImGui_ImplSoftware_Sample(sampler, tri.UV[0]);
+        flat_color = ImVec4(tri.Col[0].x * texel.x, tri.Col[0].y * texel.y, tri.Col[0].z * texel.z, tri.Col[0].w * texel.w);
+        if (flat_color.w <= 0.0f)
+            return;
+    }
+
+    // Edge functions at the center of the first pixel, then stepped by A along x and by B along y
+    const int64_t half = IMGUI_IMPL_SOFTWARE_SUBPIXEL_SCALE / 2;
+    const int64_t px = ((int64_t)x0 << IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS) + half;
+    const int64_t py = ((int64_t)y0 << IMGUI_IMPL_SOFTWARE_SUBPIXEL_BITS) + half;
+    int64_t e_row[3], step_x[3], step_y[3];
+    for (int i = 0; i < 3; i++)
+    {
+        e_row[i] = tri.EdgeA[i] * px + tri.EdgeB[i] * py + tri.EdgeC[i] + tri.EdgeBias[i];
+        step_x[i] = tri.EdgeA[i] * IMGUI_IMPL_SOFTWARE_SUBPIXEL_SCALE;
+        step_y[i] = tri.EdgeB[i] * IMGUI_IMPL_SOFTWARE_SUBPIXEL_SCALE;
+    }
+
+    for (int y = y0; y < y1; y++)
+    {
+        int64_t e0 = e_row[0], e1 = e_row[1], e2 = e_row[2];
+        unsigned char* dst = target->Pixels + (size_t)y * target->Pitch + (size_t)x0 * 4;
+        for (int x = x0; x < x1; x++, dst += 4, e0 += step_x[0], e1 += step_x[1], e2 += step_x[2])
+        {
+            if ((e0 | e1 | e2) < 0)
+                continue;
+            if (tri.Flat)
+            {
+                ImGui_ImplSoftware_Blend(dst, flat_color);
+                continue;
+            }
+
+            // Undo the bias so that weights on owned edges are exactly 0
+            float w0 = (float)(e0 - tri.EdgeBias[0]) * tri.InvArea;
+            float w1 = (float)(e1 - tri.EdgeBias[1]) * tri.InvArea;
+            float w2 = (float)(e2 - tri.EdgeBias[2]) * tri.InvArea;
+            ImVec2 uv(tri.UV[0].x * w0 + tri.UV[1].x * w1 + tri.UV[2].x * w2, tri.UV[0].y * w0 + tri.UV[1].y * w1 + tri.UV[2].y * w2);
+            ImVec4 col(
+                tri.Col[0].x * w0 + tri.Col[1].x * w1 + tri.Col[2].x * w2,
+                tri.Col[0].y * w0 + tri.Col[1].y * w1 + tri.Col[2].y * w2,
+                tri.Col[0].z * w0 + tri.Col[1].z * w1 + tri.Col[2].z * w2,
+                tri.Col[0].w * w0 + tri.Col[1].w * w1 + tri.Col[2].w * w2);
+            ImVec4 texel = ImGui_ImplSoftware_Sample(sampler, uv);
+            ImGui_ImplSoftware_Blend(dst, ImVec4(col.x * texel.x, col.y * texel.y, col.z * texel.z, col.w * texel.w));
+        }
+        for (int i = 0; i < 3; i++)
+            e_row[i] += step_y[i];
+    }
+}
+
+static void ImGui_ImplSoftware_RasterizeTile(void* job_data, int tile_index)
+{
+    const ImGui_ImplSoftware_RenderContext* ctx = (const ImGui_ImplSoftware_RenderContext*)job_data;
+    const ImGui_ImplSoftware_Scratch* scratch = ctx->Scratch;
+    int tile_min_x = (tile_index % ctx->TilesX) * IMGUI_IMPL_SOFTWARE_TILE_SIZE;
+    int tile_min_y = (tile_index / ctx->TilesX) * IMGUI_IMPL_SOFTWARE_TILE_SIZE;
+    int tile_max_x = ImGui_ImplSoftware_Min(tile_min_x + IMGUI_IMPL_SOFTWARE_TILE_SIZE, ctx->Target->Width);
+    int tile_max_y = ImGui_ImplSoftware_Min(tile_min_y + IMGUI_IMPL_SOFTWARE_TILE_SIZE, ctx->Target->Height);
+    for (int n = scratch->TileOffsets[tile_index]; n < scratch->TileOffsets[tile_index + 1]; n++)
+    {
+        const ImGui_ImplSoftware_Triangle& tri = scratch->Triangles[scratch->TileTriangles[n]];
+        ImGui_ImplSoftware_RasterizeTriangle(ctx->Target, tri, scratch->Samplers[tri.SamplerIndex], tile_min_x, tile_min_y, tile_max_x, tile_max_y);
+    }
+}
+
+// Render function
+void ImGui_ImplSoftware_RenderDrawData(ImDrawData* draw_data, const ImGui_ImplSoftware_Image* target, ImGui_ImplSoftware_ParallelForFn parallel_for, void* parallel_for_user_data)
+{
+    // Avoid rendering when minimized
+    if (draw_data->DisplaySize.x <= 0.0f || draw_data->DisplaySize.y <= 0.0f)
+        return;
+    IM_ASSERT(target != nullptr && target->Pixels != nullptr && target->Pitch >= target->Width * 4);
+    if (target->Width <= 0 || target->Height <= 0)
+        return;
+
+    // When used as a capture renderer, textures and user texture identifiers belong to the active renderer backend:
+    // leave their status alone, and only sample the CPU copy of textures owned by Dear ImGui
+    ImGui_ImplSoftware_Data* bd = ImGui_ImplSoftware_GetBackendData();
+    const bool is_renderer_backend = (bd != nullptr);
+    if (is_renderer_backend && draw_data->Textures != nullptr)
+        for (ImTextureData* tex : *draw_data->Textures)
+            if (tex->Status != ImTextureStatus_OK)
+                ImGui_ImplSoftware_UpdateTexture(tex);
+
+    ImGui_ImplSoftware_Scratch local_scratch;
+    ImGui_ImplSoftware_Scratch* scratch = is_renderer_backend ? &bd->Scratch : &local_scratch;
+    scratch->Triangles.resize(0);
+    scratch->Samplers.resize(0);
+
+    // Setup triangles, in submission order
+    ImVec2 clip_off = draw_data->DisplayPos;
+    ImVec2 clip_scale = draw_data->FramebufferScale;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != nullptr)
+                continue; // There is no render state to reset, and user callbacks expect the render state of a GPU backend
+
+            // Project scissor/clipping rectangles into framebuffer space
+            ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+            ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+            if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                continue;
+            const int clip[4] =
+            {
+                ImGui_ImplSoftware_ClampInt((int)clip_min.x, 0, target->Width), ImGui_ImplSoftware_ClampInt((int)clip_min.y, 0, target->Height),
+                ImGui_ImplSoftware_ClampInt((int)clip_max.x, 0, target->Width), ImGui_ImplSoftware_ClampInt((int)clip_max.y, 0, target->Height),
+            };
+            if (clip[0] >= clip[2] || clip[1] >= clip[3])
+                continue;
+
+            scratch->Samplers.push_back(ImGui_ImplSoftware_ResolveSampler(pcmd, is_renderer_backend));
+            const int sampler_index = scratch->Samplers.Size - 1;
+
+            const ImDrawIdx* idx = draw_list->IdxBuffer.Data + pcmd->IdxOffset;
+            const ImDrawVert* vtx = draw_list->VtxBuffer.Data + pcmd->VtxOffset;
+            for (unsigned int i = 0; i + 2 < pcmd->ElemCount; i += 3)
+            {
+                ImGui_ImplSoftware_Triangle tri;
+                if (!ImGui_ImplSoftware_SetupTriangle(&tri, &vtx[idx[i]], &vtx[idx[i + 1]], &vtx[idx[i + 2]], clip_off, clip_scale, clip))
+                    continue;
+                tri.SamplerIndex = sampler_index;
+                scratch->Triangles.push_back(tri);
+            }
+        }
+    }
+
+    // Bin triangles to tiles: count, prefix sum, then fill in submission order
+    const int tiles_x = (target->Width + IMGUI_IMPL_SOFTWARE_TILE_SIZE - 1) / IMGUI_IMPL_SOFTWARE_TILE_SIZE;
+    const int tiles_y = (target->Height + IMGUI_IMPL_SOFTWARE_TILE_SIZE - 1) / IMGUI_IMPL_SOFTWARE_TILE_SIZE;
+    const int tile_count = tiles_x * tiles_y;
+    scratch->TileOffsets.resize(tile_count + 1);
+    memset(scratch->TileOffsets.Data, 0, (size_t)scratch->TileOffsets.size_in_bytes());
+    for (const ImGui_ImplSoftware_Triangle& tri : scratch->Triangles)
+        for (int ty = tri.MinY / IMGUI_IMPL_SOFTWARE_TILE_SIZE; ty <= (tri.MaxY - 1) / IMGUI_IMPL_SOFTWARE_TILE_SIZE; ty++)
+            for (int tx = tri.MinX / IMGUI_IMPL_SOFTWARE_TILE_SIZE; tx <= (tri.MaxX - 1) / IMGUI_IMPL_SOFTWARE_TILE_SIZE; tx++)
+                scratch->TileOffsets[ty * tiles_x + tx + 1]++;
+    for (int tile = 0; tile < tile_count; tile++)
+        scratch->TileOffsets[tile + 1] += scratch->TileOffsets[tile];
+    scratch->TileTriangles.resize(scratch->TileOffsets[tile_count]);
+    scratch->TileCursors.resize(tile_count);
+    memcpy(scratch->TileCursors.Data, scratch->TileOffsets.Data, (size_t)scratch->TileCursors.size_in_bytes());
+    for (int tri_i = 0; tri_i < scratch->Triangles.Size; tri_i++)
+    {
+        const ImGui_ImplSoftware_Triangle& tri = scratch->Triangles[tri_i];
+        for (int ty = tri.MinY / IMGUI_IMPL_SOFTWARE_TILE_SIZE; ty <= (tri.MaxY - 1) / IMGUI_IMPL_SOFTWARE_TILE_SIZE; ty++)
+            for (int tx = tri.MinX / IMGUI_IMPL_SOFTWARE_TILE_SIZE; tx <= (tri.MaxX - 1) / IMGUI_IMPL_SOFTWARE_TILE_SIZE; tx++)
+                scratch->TileTriangles[scratch->TileCursors[ty * tiles_x + tx]++] = tri_i;
+    }
+
+    // Rasterize tiles; they never overlap so they can run on any thread in any order
+    ImGui_ImplSoftware_RenderContext ctx;
+    ctx.Target = target;
+    ctx.Scratch = scratch;
+    ctx.TilesX = tiles_x;
+    if (parallel_for != nullptr)
+        parallel_for(parallel_for_user_data, tile_count, ImGui_ImplSoftware_RasterizeTile, &ctx);
+    else
+        for (int tile = 0; tile < tile_count; tile++)
+            ImGui_ImplSoftware_RasterizeTile(&ctx, tile);
+}
+
+// Textures are sampled straight from ImTextureData::Pixels: there is nothing to upload, only statuses to acknowledge
+void ImGui_ImplSoftware_UpdateTexture(ImTextureData* tex)
+{
+    if (tex->Status == ImTextureStatus_WantCreate)
+    {
+        IM_ASSERT(tex->TexID == ImTextureID_Invalid && tex->BackendUserData == nullptr);
+        IM_ASSERT(tex->Format == ImTextureFormat_RGBA32 || tex->Format == ImTextureFormat_Alpha8);
+        tex->SetTexID((ImTextureID)(intptr_t)tex);
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantUpdates)
+    {
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
+    {
+        tex->SetTexID(ImTextureID_Invalid);
+        tex->SetStatus(ImTextureStatus_Destroyed);
+    }
+}
+
+bool    ImGui_ImplSoftware_Init()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IMGUI_CHECKVERSION();
+    IM_ASSERT(io.BackendRendererUserData == nullptr && "Already initialized a renderer backend!");
+
+    // Setup backend capabilities flags
+    ImGui_ImplSoftware_Data* bd = IM_NEW(ImGui_ImplSoftware_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = ImGui_ImplSoftware_RendererName;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;   // We can honor ImGuiPlatformIO::Textures[] requests during render.
+
+    return true;
+}
+
+void    ImGui_ImplSoftware_Shutdown()
+{
+    ImGui_ImplSoftware_Data* bd = ImGui_ImplSoftware_GetBackendData();
+    IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    // Destroy all textures
+    for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
+        if (tex->RefCount == 1 && tex->TexID != ImTextureID_Invalid)
+        {
+            tex->SetTexID(ImTextureID_Invalid);
+            tex->SetStatus(ImTextureStatus_Destroyed);
+        }
+
+    io.BackendRendererName = nullptr;
+    io.BackendRendererUserData = nullptr;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    IM_DELETE(bd);
+}
+
+void    ImGui_ImplSoftware_NewFrame()
+{
+    ImGui_ImplSoftware_Data* bd = ImGui_ImplSoftware_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplSoftware_Init()?");
+    IM_UNUSED(bd);
+}
+
+//-----------------------------------------------------------------------------
+
+#endif // #ifndef IMGUI_DISABLE
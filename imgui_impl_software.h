@@ -0,0 +1,46 @@
+// dear imgui: Renderer Backend for CPU software rasterization
+// This can be used along with a Platform Backend, or headless without any (e.g. UI captures and UI performance tests on machines without a GPU).
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftware_Image*' as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Tile-binned rasterization, optionally spread across threads through a user provided parallel-for.
+// Missing features:
+//  [ ] Renderer: User callbacks are not invoked (ImDrawCallback_ResetRenderState is a no-op as there is no render state).
+
+// Two ways of using this backend:
+// - As the renderer backend: call ImGui_ImplSoftware_Init()/NewFrame()/Shutdown() like any other renderer backend.
+// - As a capture renderer next to another renderer backend (e.g. DX11): only call ImGui_ImplSoftware_RenderDrawData().
+//   Textures owned by Dear ImGui (e.g. the font atlas) are sampled straight from ImTextureData::Pixels.
+//   User texture identifiers belong to the other backend and are drawn untextured.
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+// RGBA8 image (non premultiplied alpha, same channel order as ImTextureFormat_RGBA32). Used both for render targets and user textures.
+struct ImGui_ImplSoftware_Image
+{
+    unsigned char*  Pixels;
+    int             Width;
+    int             Height;
+    int             Pitch;      // Bytes between two rows
+};
+
+// Parallel-for hook used to rasterize tiles on multiple threads.
+// Must call job(job_data, i) for every i in [0, job_count), in any order and from any thread, and return once all calls are done.
+typedef void (*ImGui_ImplSoftware_JobFn)(void* job_data, int job_index);
+typedef void (*ImGui_ImplSoftware_ParallelForFn)(void* user_data, int job_count, ImGui_ImplSoftware_JobFn job, void* job_data);
+
+// Follow "Getting Started" link and check examples/ folder to learn about using backends!
+IMGUI_IMPL_API bool     ImGui_ImplSoftware_Init();
+IMGUI_IMPL_API void     ImGui_ImplSoftware_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoftware_NewFrame();
+// Blend draw_data over the existing content of 'target'. 'parallel_for' may be NULL to rasterize on the calling thread.
+IMGUI_IMPL_API void     ImGui_ImplSoftware_RenderDrawData(ImDrawData* draw_data, const ImGui_ImplSoftware_Image* target, ImGui_ImplSoftware_ParallelForFn parallel_for = nullptr, void* parallel_for_user_data = nullptr);
+
+// (Advanced) Use e.g. if you need to precisely control the timing of texture updates (e.g. for staged rendering), by setting ImDrawData::Textures = NULL to handle this manually.
+IMGUI_IMPL_API void     ImGui_ImplSoftware_UpdateTexture(ImTextureData* tex);
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,71 @@
+// dear imgui: Streaming buffer policy shared by renderer backends
+// Graphics API agnostic: decides where each frame's vertices/indices go in a dynamic buffer, and when that buffer must be discarded or regrown.
+
+// Each frame appends its data after the previous frame's data and maps the buffer without synchronization (e.g. D3D11_MAP_WRITE_NO_OVERWRITE),
+// as the GPU never reads the region being written. When the data does not fit before the end of the buffer the ring wraps to the start
+// and the buffer is discarded (e.g. D3D11_MAP_WRITE_DISCARD), which lets the driver hand out fresh memory while previous frames are still in flight.
+// Capacity grows geometrically, so a UI that keeps getting bigger triggers O(log n) reallocations instead of one every few frames.
+
+#pragma once
+#include "imgui.h"      // IM_ASSERT
+#ifndef IMGUI_DISABLE
+
+struct ImGui_ImplStreamingAllocation
+{
+    int     Offset;     // First element to write
+    bool    Discard;    // Previous content may be discarded (the ring wrapped, or the buffer is new); otherwise map without overwriting in-flight data
+};
+
+struct ImGui_ImplStreamingRing
+{
+    int     Capacity;       // Elements; 0 when there is no backing buffer
+    int     Head;           // Next free element
+    int     MinCapacity;    // Capacity of a new buffer
+    int     GrowCount;      // Statistics
+    int     DiscardCount;
+    int     NoOverwriteCount;
+
+    ImGui_ImplStreamingRing(int min_capacity = 0) { Capacity = Head = 0; MinCapacity = min_capacity; GrowCount = DiscardCount = NoOverwriteCount = 0; }
+
+    // Forget the backing buffer (e.g. after the device objects were invalidated)
+    void    Reset() { Capacity = Head = 0; }
+
+    // Returns true when the backing buffer must be (re)created with 'Capacity' elements. Previous content is lost.
+    // Keeps room for at least two frames of 'count' elements, so that most frames append instead of discarding.
+    bool    EnsureCapacity(int count)
+    {
+        const int required = count * 2;
+        if (Capacity > 0 && required <= Capacity)
+            return false;
+        int new_capacity = Capacity > 0 ? Capacity * 2 : (MinCapacity > 0 ? MinCapacity : 1);
+        while (new_capacity < required)
+            new_capacity *= 2;
+        Capacity = new_capacity;
+        Head = 0;
+        GrowCount++;
+        return true;
+    }
+
+    // Reserve 'count' contiguous elements. Call EnsureCapacity(count) first.
+    ImGui_ImplStreamingAllocation Allocate(int count)
+    {
+        IM_ASSERT(count <= Capacity);
+        ImGui_ImplStreamingAllocation alloc;
+        if (Head == 0 || Head + count > Capacity)
+        {
+            alloc.Offset = 0;
+            alloc.Discard = true;
+            DiscardCount++;
+        }
+        else
+        {
+            alloc.Offset = Head;
+            alloc.Discard = false;
+            NoOverwriteCount++;
+        }
+        Head = alloc.Offset + count;
+        return alloc;
+    }
+};
+
+#endif // #ifndef IMGUI_DISABLE
@@ -68,6 +68,17 @@ Index of this file:
 #include <nmmintrin.h>
 #endif
 #endif
+#if defined(IMGUI_ENABLE_SSE) && (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_SSE2
+#endif
+#if defined(IMGUI_ENABLE_SSE) && defined(__AVX2__)
+#define IMGUI_ENABLE_AVX2
+#endif
+// Enable NEON intrinsics on ARM64 (ARMv7 NEON has no vector division/square root, which the tessellator relies on)
+#if (defined(__aarch64__) || defined(_M_ARM64)) && !defined(IMGUI_DISABLE_NEON)
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>
+#endif
 // Emscripten has partial SSE 4.2 support where _mm_crc32_u32 is not available. See https://emscripten.org/docs/porting/simd.html#id11 and #8213
 #if defined(IMGUI_ENABLE_SSE4_2) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(__EMSCRIPTEN__)
 #define IMGUI_ENABLE_SSE4_2_CRC
@@ -137,13 +148,18 @@ Index of this file:
 struct ImBitVector;                 // Store 1-bit per value
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImGuiTextIndex;              // Maintain a line index for a text buffer.
+struct ImGuiTextFilterIndex;        // Upper-cased copy of a list of items, to apply ImGuiTextFilter to all of them at once
+struct ImGuiTextDocument;           // Piece table text storage edited by InputTextLarge()
 
 // ImDrawList/ImFontAtlas
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
 struct ImFontAtlasBuilder;          // Internal storage for incrementally packing and building a ImFontAtlas
 struct ImFontAtlasPostProcessData;  // Data available to potential texture post-processing functions
+struct ImFontAtlasPrerasterizedGlyph; // Glyph bitmap rasterized ahead of loading, possibly on another thread
 struct ImFontAtlasRectEntry;        // Packed rectangle lookup entry
+struct ImFontTextLayout;            // Cached layout of a text run
+struct ImFontTextLayoutCache;       // Cached layouts of the texts of a ImFontAtlas
 
 // ImGui
 struct ImGuiBoxSelectState;         // Box-selection state (currently used by multi-selection, could potentially be used by others)
@@ -176,6 +192,7 @@ struct ImGuiTabItem;                // Storage for a tab item (within a tab bar)
 struct ImGuiTable;                  // Storage for a table
 struct ImGuiTableHeaderData;        // Storage for TableAngledHeadersRow()
 struct ImGuiTableColumn;            // Storage for one column of a table
+struct ImGuiTableData;              // Row order and row heights of a data-backed table (see TableDataBeginRows())
 struct ImGuiTableInstanceData;      // Storage for one instance of a same table
 struct ImGuiTableTempData;          // Temporary storage for one table (one per table in the stack), shared between tables.
 struct ImGuiTableSettings;          // Storage for a table .ini settings
@@ -364,8 +381,77 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 //-----------------------------------------------------------------------------
 
 // Helpers: Hashing
+// - ImHashData()/ImHashStr() use the hash selected in imconfig.h: CRC32c through a lookup table (default, or SSE 4.2 with IMGUI_ENABLE_SSE4_2_CRC),
+//   CRC32c through hardware instructions detected at runtime (IMGUI_HASH_CRC32C_HW) or a hash consuming 8 bytes per step (IMGUI_HASH_WIDE).
+// - Every hash is also available under its own name, e.g. to measure them against each other.
+// - ImHashStrConstexpr() returns the same value as ImHashStr() and can run at compile-time for string literals (requires C++14).
 IMGUI_API ImGuiID       ImHashData(const void* data, size_t data_size, ImGuiID seed = 0);
 IMGUI_API ImGuiID       ImHashStr(const char* data, size_t data_size = 0, ImGuiID seed = 0);
+IMGUI_API ImGuiID       ImHashDataCrc32Table(const void* data, size_t data_size, ImGuiID seed = 0);
+IMGUI_API ImGuiID       ImHashStrCrc32Table(const char* data, size_t data_size = 0, ImGuiID seed = 0);
+IMGUI_API ImGuiID       ImHashDataCrc32cHw(const void* data, size_t data_size, ImGuiID seed = 0);  // Same values as the CRC32c table, falls back to it when the CPU has no CRC32c instructions
+IMGUI_API ImGuiID       ImHashStrCrc32cHw(const char* data, size_t data_size = 0, ImGuiID seed = 0);
+IMGUI_API bool          ImHashCrc32cHwAvailable();
+IMGUI_API ImGuiID       ImHashDataWide(const void* data, size_t data_size, ImGuiID seed = 0);
+IMGUI_API ImGuiID       ImHashStrWide(const char* data, size_t data_size = 0, ImGuiID seed = 0);
+
+#if defined(IMGUI_HASH_CRC32C_HW) && defined(IMGUI_HASH_WIDE)
+#error "IMGUI_HASH_CRC32C_HW and IMGUI_HASH_WIDE are mutually exclusive."
+#endif
+#if defined(IMGUI_HASH_CRC32C_HW) && defined(IMGUI_USE_LEGACY_CRC32_ADLER)
+#error "IMGUI_USE_LEGACY_CRC32_ADLER uses a different polynomial than the CRC32c hardware instructions."
+#endif
+
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+#define IM_CONSTEXPR14          constexpr
+#else
+#define IM_CONSTEXPR14
+#endif
+
+// Wide hash (IMGUI_HASH_WIDE): xxHash-style multiply/rotate rounds over little-endian 64-bit words, then a final avalanche.
+static inline IM_CONSTEXPR14 ImU64 ImHashWideLoad(const char* p, size_t n)         { ImU64 v = 0; for (size_t i = 0; i < n; i++) v |= (ImU64)(unsigned char)p[i] << (i * 8); return v; }
+static inline IM_CONSTEXPR14 ImU64 ImHashWideRotl(ImU64 v, int r)                  { return (v << r) | (v >> (64 - r)); }
+static inline IM_CONSTEXPR14 ImU64 ImHashWideRound(ImU64 h, ImU64 word)            { return ImHashWideRotl(h ^ (ImHashWideRotl(word * 0xC2B2AE3D27D4EB4FULL, 31) * 0x9E3779B185EBCA87ULL), 27) * 0x9E3779B185EBCA87ULL + 0x165667B19E3779F9ULL; }
+static inline IM_CONSTEXPR14 ImU64 ImHashWideBegin(size_t data_size, ImGuiID seed) { return ((ImU64)seed + 0x165667B19E3779F9ULL) ^ ((ImU64)data_size * 0x9E3779B185EBCA87ULL); }
+static inline IM_CONSTEXPR14 ImGuiID ImHashWideEnd(ImU64 h)                        { h ^= h >> 33; h *= 0xC2B2AE3D27D4EB4FULL; h ^= h >> 29; h *= 0x165667B19E3779F9ULL; h ^= h >> 32; return (ImGuiID)h; }
+
+// CRC32c (or CRC32 with IMGUI_USE_LEGACY_CRC32_ADLER), one bit at a time: slow, only meant for compile-time evaluation.
+static inline IM_CONSTEXPR14 ImU32 ImHashCrc32Bitwise(ImU32 crc, unsigned char c)
+{
+#ifdef IMGUI_USE_LEGACY_CRC32_ADLER
+    const ImU32 poly = 0xEDB88320;
+#else
+    const ImU32 poly = 0x82F63B78;
+#endif
+    crc ^= c;
+    for (int bit = 0; bit < 8; bit++)
+        crc = (crc >> 1) ^ (poly & (0u - (crc & 1)));
+    return crc;
+}
+
+// e.g. 'constexpr ImGuiID id = ImHashStrConstexpr("Save##Toolbar");'. Supports "###" like ImHashStr().
+static inline IM_CONSTEXPR14 ImGuiID ImHashStrConstexpr(const char* str, ImGuiID seed = 0)
+{
+    // Only the part starting at the last "###" contributes to the hash
+    size_t len = 0, start = 0;
+    for (; str[len] != 0; len++)
+        if (str[len] == '#' && str[len + 1] == '#' && str[len + 2] == '#')
+            start = len;
+#if defined(IMGUI_HASH_WIDE)
+    ImU64 h = ImHashWideBegin(len - start, seed);
+    size_t i = start;
+    for (; i + 8 <= len; i += 8)
+        h = ImHashWideRound(h, ImHashWideLoad(str + i, 8));
+    if (i < len)
+        h = ImHashWideRound(h, ImHashWideLoad(str + i, len - i));
+    return ImHashWideEnd(h);
+#else
+    ImU32 crc = ~seed;
+    for (size_t i = start; i < len; i++)
+        crc = ImHashCrc32Bitwise(crc, (unsigned char)str[i]);
+    return ~crc;
+#endif
+}
 
 // Helpers: Sorting
 #ifndef ImQsort
@@ -513,6 +599,8 @@ static inline ImVec2 ImMul(const ImVec2& lhs, const ImVec2& rhs)
 static inline bool   ImIsFloatAboveGuaranteedIntegerPrecision(float f)          { return f <= -16777216 || f >= 16777216; }
 static inline float  ImExponentialMovingAverage(float avg, float sample, int n) { avg -= avg / n; avg += sample / n; return avg; }
 IM_MSVC_RUNTIME_CHECKS_RESTORE
+// - Bulk maths helpers (SIMD when available)
+IMGUI_API void       ImMinMaxFloats(const float* values, int values_count, float* in_out_min, float* in_out_max); // Accumulate min/max of values into *in_out_min/*in_out_max, ignoring NaN values
 
 // Helpers: Geometry
 IMGUI_API ImVec2     ImBezierCubicCalc(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, float t);
@@ -798,6 +886,23 @@ struct ImGuiTextIndex
     void            append(const char* base, int old_size, int new_size);
 };
 
+// Helper: Upper-cased copy of a list of items, stored contiguously to apply a ImGuiTextFilter to all of them at once.
+// Filter() outputs the same items as calling PassFilter() on each of them, typically in a fraction of the time for large lists.
+struct IMGUI_API ImGuiTextFilterIndex
+{
+    ImVector<char>  ItemsBuf;                   // Upper-cased text of all items, each one zero-terminated
+    ImVector<int>   ItemsOffsets;               // Offset of each item in ItemsBuf
+    ImVector<int>   PassedItems;                // Output of Filter(): indices of the items passing the filter, in ascending order
+    ImVector<int>   ItemsFirstFilter;           // Temporary storage for Filter(): index of the first filter found in each item, or -1
+    ImVector<char>  LastTerm;                   // Upper-cased, zero-terminated term of the last Filter() call when it was a single Grep filter, otherwise empty
+
+    void            Clear()                     { ItemsBuf.clear(); ItemsOffsets.clear(); ItemsFirstFilter.clear(); ClearFilterResult(); }
+    void            ClearFilterResult()         { PassedItems.resize(0); LastTerm.resize(0); }
+    int             GetItemsCount() const       { return ItemsOffsets.Size; }
+    void            AddItem(const char* text, const char* text_end = NULL);
+    void            Filter(const ImGuiTextFilter& filter);
+};
+
 // Helper: ImGuiStorage
 IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStoragePair* in_end, ImGuiID key);
 
@@ -861,6 +966,9 @@ struct IMGUI_API ImDrawListSharedData
     void SetCircleTessellationMaxError(float max_error);
 };
 
+// Instruction set of the anti-aliased AddPolyline()/AddConvexPolyFilled() tessellation: "AVX2", "SSE2", "NEON" or "Scalar"
+IMGUI_API const char*   ImDrawListGetTessellationBackendName();
+
 struct ImDrawDataBuilder
 {
     ImVector<ImDrawList*>*  Layers[2];      // Pointers to global layers for: regular, tooltip. LayersP[0] is owned by DrawData.
@@ -1133,6 +1241,37 @@ enum ImGuiPlotType
     ImGuiPlotType_Histogram,
 };
 
+// Summary of a range of plot values. PlotEx() decimates series larger than the plot width to one range per pixel column.
+struct ImGuiPlotRange
+{
+    float       First;                  // First value of the range
+    float       Last;                   // Last value of the range
+    float       Min;                    // Ignoring NaN values (FLT_MAX if the range only holds NaN values)
+    float       Max;                    // Ignoring NaN values (-FLT_MAX if the range only holds NaN values)
+};
+typedef void (*ImGuiPlotRangeGetter)(void* data, int idx_begin, int idx_end, ImGuiPlotRange* out_range); // Summary of values [idx_begin, idx_end) of data. PlotEx() applies values_offset and splits ranges wrapping around the end of data.
+
+// Fixed capacity ring buffer of plot values, for streaming data such as frame times.
+// The min/max of each block of IMGUI_PLOT_RING_SERIES_BLOCK_SIZE values is updated while pushing. Summarizing a range reads the blocks it covers
+// and only scans values at both ends, so decimating the series costs about plot width * block size rather than values count.
+#define IMGUI_PLOT_RING_SERIES_BLOCK_SIZE   64
+struct IMGUI_API ImGuiPlotRingSeries
+{
+    ImVector<float>     Values;                 // Capacity values, the oldest one at Values[Head]
+    ImVector<ImVec2>    BlocksMinMax;           // Min (x) and max (y) of each block of Values[], ignoring NaN values. Only the last written block may be incomplete.
+    int                 Head;                   // Index of the oldest value
+    int                 Count;                  // Number of values, up to capacity
+
+    ImGuiPlotRingSeries()                       { Head = Count = 0; }
+    void                Init(int capacity);     // Set capacity and clear
+    void                Clear()                 { Head = Count = 0; }
+    int                 GetCapacity() const     { return Values.Size; }
+    float               GetValue(int idx) const { IM_ASSERT(idx >= 0 && idx < Count); int n = Head + idx; return Values.Data[n < Values.Size ? n : n - Values.Size]; } // From oldest (0) to newest (Count - 1)
+    void                Push(float v);          // Overwrite the oldest value when full
+    void                PushN(const float* values, int values_count);
+    void                GetRange(int idx_begin, int idx_end, ImGuiPlotRange* out_range) const;
+};
+
 // Storage data for BeginComboPreview()/EndComboPreview()
 struct IMGUI_API ImGuiComboPreviewData
 {
@@ -1253,6 +1392,96 @@ struct IMGUI_API ImGuiInputTextState
     void        ReloadUserBufAndMoveToEnd();
 };
 
+// A span of ImGuiTextDocument text, stored in its original or added buffer
+struct ImGuiTextPiece
+{
+    int                     Offset;                 // Offset in ImGuiTextDocument::Original or ImGuiTextDocument::Added
+    int                     Length;
+    bool                    IsAdded;                // Stored in ImGuiTextDocument::Added
+
+    ImGuiTextPiece(int offset, int length, bool is_added) { Offset = offset; Length = length; IsAdded = is_added; }
+};
+
+// One insertion or deletion in the undo stack of a ImGuiTextDocument
+struct ImGuiTextUndoRecord
+{
+    int                     Offset;                 // Document offset of the edit
+    int                     Length;
+    int                     TextOffset;             // Inserted or deleted text, in ImGuiTextDocument::UndoText
+    int                     Group;                  // Records of the same group are undone/redone together (e.g. a typed word, replacing a selection)
+    bool                    IsInsert;
+};
+
+// Text storage for InputTextLarge(), for documents too large for InputTextEx() which edits a flat buffer and scans it every frame.
+// - The text is a piece table: a list of spans of the read-only Original buffer and of the append-only Added buffer.
+//   Typing extends the last added piece, so an edit costs a lookup from the previously edited piece rather than moving the text after it.
+// - LineStarts[] is updated incrementally. The offset shift of the lines after an edit is kept pending in LineDelta, applied to lines from
+//   LineDeltaFirst onward when reading them, and only moved when editing another line: typing on a line doesn't touch the other lines.
+//   Adding or removing lines moves the LineStarts[] entries after them, 4 bytes per line.
+// - InputTextLarge() only lays out and renders the visible lines, through ImGuiListClipper.
+// Offsets are in bytes of UTF-8 text.
+struct IMGUI_API ImGuiTextDocument
+{
+    ImVector<char>          Original;               // Text given to SetText()
+    ImVector<char>          Added;                  // Text inserted since, append-only
+    ImVector<ImGuiTextPiece> Pieces;
+    int                     Length;                 // Document length in bytes
+    int                     PieceCacheIndex;        // Last piece found by FindPiece() and its document offset, where the next lookup starts
+    int                     PieceCacheStart;
+    ImVector<int>           LineStarts;             // Document offset of each line, LineDelta excluded from LineDeltaFirst onward. Always at least 1 line.
+    int                     LineDeltaFirst;
+    int                     LineDelta;
+    ImVector<ImGuiTextUndoRecord> UndoRecords;
+    ImVector<char>          UndoText;
+    int                     UndoPos;                // Records before UndoPos are done, records from UndoPos are undone (available to redo)
+    int                     UndoGroupNext;
+    bool                    UndoGroupOpen;          // Next typed text may extend the last group
+    ImVector<char>          LineBuf;                // Temporary storage for GetLineText() when a line spans several pieces
+    float                   ContentWidth;           // Widest line rendered so far, for horizontal scrolling. Measuring every line would defeat the purpose.
+
+    // Editing state, used by InputTextLarge()
+    int                     Cursor;
+    int                     SelectionStart;         // Selection is between SelectionStart and Cursor
+    float                   CursorPreferredX;       // Kept while moving up/down, -1.0f when not set
+    float                   CursorAnim;             // Blinking, reset when moving the cursor
+    bool                    CursorFollow;           // Scroll to the cursor on the next frame
+    bool                    Edited;                 // Edited during the last InputTextLarge() call
+
+    ImGuiTextDocument()                             { Length = PieceCacheIndex = PieceCacheStart = LineDeltaFirst = LineDelta = UndoPos = UndoGroupNext = Cursor = SelectionStart = 0; UndoGroupOpen = CursorFollow = Edited = false; ContentWidth = CursorAnim = 0.0f; CursorPreferredX = -1.0f; LineStarts.push_back(0); }
+    void                    SetText(const char* text, const char* text_end = NULL); // Reset the document, clear the undo stack
+    void                    GetText(ImVector<char>* out_text) const;                 // Zero-terminated copy of the document
+    void                    GetTextRange(int offset_begin, int offset_end, ImVector<char>* out_text); // Not zero-terminated
+    int                     GetLength() const       { return Length; }
+    char                    GetChar(int offset);
+    int                     GetLineCount() const    { return LineStarts.Size; }
+    int                     GetLineStart(int line_n) const { return LineStarts.Data[line_n] + ((line_n >= LineDeltaFirst) ? LineDelta : 0); }
+    int                     GetLineEnd(int line_n) const   { return (line_n + 1 < LineStarts.Size) ? GetLineStart(line_n + 1) - 1 : Length; } // Excluding '\n'
+    int                     FindLine(int offset) const;                             // Line containing offset
+    const char*             GetLineText(int line_n, const char** out_text_end);     // Valid until the next edit or GetLineText() call
+
+    // Edits are recorded in the undo stack
+    void                    Insert(int offset, const char* text, const char* text_end = NULL);
+    void                    Delete(int offset, int length);
+    bool                    Undo();
+    bool                    Redo();
+    void                    CloseUndoGroup()        { UndoGroupOpen = false; }
+
+    // Cursor & Selection
+    bool                    HasSelection() const    { return Cursor != SelectionStart; }
+    int                     GetSelectionMin() const { return ImMin(Cursor, SelectionStart); }
+    int                     GetSelectionMax() const { return ImMax(Cursor, SelectionStart); }
+    void                    SetCursor(int offset, bool keep_selection = false) { Cursor = ImClamp(offset, 0, Length); if (!keep_selection) SelectionStart = Cursor; CursorFollow = true; CursorAnim = 0.0f; }
+
+    // [Internal]
+    int                     FindPiece(int offset, int* out_piece_start);           // Piece containing offset, or Pieces.Size when offset == Length
+    int                     SplitPiece(int offset);                                 // Index of the piece starting at offset, splitting the piece containing it
+    void                    CopyText(int offset_begin, int offset_end, char* dst);
+    void                    MoveLineDeltaFirst(int line_n);
+    void                    InsertRaw(int offset, const char* text, int length);
+    void                    DeleteRaw(int offset, int length);
+    void                    AddUndoRecord(int offset, const char* text, int length, bool is_insert); // text == NULL: copy the document text being deleted
+};
+
 enum ImGuiWindowRefreshFlags_
 {
     ImGuiWindowRefreshFlags_None                = 0,
@@ -1985,6 +2214,28 @@ struct ImGuiSettingsHandler
     ImGuiSettingsHandler() { memset(this, 0, sizeof(*this)); }
 };
 
+// Binary settings records (see SaveWindowSettingsRecord()): a ImGuiSettingsRecordsHeader followed by records, each one a
+// ImGuiSettingsRecordHeader followed by PayloadSize bytes. The latest record of an entry (Type, ID) replaces the previous ones.
+enum ImGuiSettingsRecordType_
+{
+    ImGuiSettingsRecordType_Window = 1,
+    ImGuiSettingsRecordType_Table  = 2,
+};
+
+struct ImGuiSettingsRecordsHeader
+{
+    char        Magic[4];       // "IMSR"
+    int         Version;        // IMGUI_SETTINGS_RECORDS_VERSION
+};
+
+struct ImGuiSettingsRecordHeader
+{
+    ImU32       PayloadSize;
+    ImU32       Type;           // ImGuiSettingsRecordType_
+    ImGuiID     ID;             // Window or table ID
+    ImGuiID     Hash;           // Hash of the other header fields and of the payload, to detect torn writes
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Localization support
 //-----------------------------------------------------------------------------
@@ -2429,6 +2680,7 @@ struct ImGuiContext
     ImVector<char>          ClipboardHandlerData;               // If no custom clipboard handler is defined
     ImVector<ImGuiID>       MenusIdSubmittedThisFrame;          // A list of menu IDs that were rendered at least once
     ImGuiTypingSelectState  TypingSelectState;                  // State for GetTypingSelectRequest()
+    ImVector<ImGuiPlotRange> PlotRanges;                        // Temporary storage for PlotEx(): one range per pixel column when decimating
 
     // Platform support
     ImGuiPlatformImeData    PlatformImeData;                    // Data updated by current frame. Will be applied at end of the frame. For some backends, this is required to have WantVisible=true in order to receive text message.
@@ -2445,6 +2697,8 @@ struct ImGuiContext
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
+    ImVector<ImGuiID>                   SettingsDirtyWindows;   // Windows changed since the last GatherDirtySettings(), for incremental saving
+    ImVector<ImGuiID>                   SettingsDirtyTables;    // Tables changed since the last GatherDirtySettings()
     ImVector<ImGuiContextHook>          Hooks;                  // Hooks for extensions (e.g. test engine)
     ImGuiID                             HookIdNext;             // Next available HookId
 
@@ -2664,6 +2918,7 @@ struct IMGUI_API ImGuiWindow
     float                   FontWindowScaleParents;
     float                   FontRefSize;                        // This is a copy of window->CalcFontSize() at the time of Begin(), trying to phase out CalcFontSize() especially as it may be called on non-current window.
     int                     SettingsOffset;                     // Offset into SettingsWindows[] (offsets are always valid as we only grow the array from the back)
+    bool                    SettingsDirty;                      // Queued in g.SettingsDirtyWindows
 
     ImDrawList*             DrawList;                           // == &DrawListInst (for backward compatibility reason with code using imgui_internal.h we keep this a pointer)
     ImDrawList              DrawListInst;
@@ -2993,6 +3248,7 @@ struct IMGUI_API ImGuiTable
     bool                        DisableDefaultContextMenu;  // Disable default context menu. You may submit your own using TableBeginContextMenuPopup()/EndPopup()
     bool                        IsSettingsRequestLoad;
     bool                        IsSettingsDirty;            // Set when table settings have changed and needs to be reported into ImGuiTableSetttings data.
+    bool                        IsSettingsQueued;           // Queued in g.SettingsDirtyTables
     bool                        IsDefaultDisplayOrder;      // Set when display order is unchanged from default (DisplayOrder contains 0...Count-1)
     bool                        IsResetAllRequest;
     bool                        IsResetDisplayOrderRequest;
@@ -3036,6 +3292,47 @@ struct IMGUI_API ImGuiTableTempData
     ImGuiTableTempData()        { memset(this, 0, sizeof(*this)); LastTimeActive = -1.0f; }
 };
 
+// Compare data rows row_a and row_b on the column of one sort spec: < 0 when row_a comes first in ascending order, 0 when equal.
+typedef int (*ImGuiTableDataCompareFunc)(const ImGuiTableColumnSortSpecs* sort_spec, int row_a, int row_b, void* user_data);
+
+// Row order and row heights of a table whose rows live in user data, for tables of 100k+ rows.
+// - Order[] is a stable sort permutation of the data rows, only rebuilt by Sort() when the sort specs or the data version change.
+//   Sorting the user data every frame, or even copying it, costs more than the rest of the table once rows are counted in 100k.
+// - Row heights may vary. They are summed in display order into a Fenwick tree, so the offset of a row, the row at a scroll offset
+//   and changing the height of a row are O(log N). Sums are kept in double, as float would lose pixels past 16M.
+// - TableDataBeginRows()/TableDataEndRows() seek the cursor over the rows outside of the clip rect, as ImGuiListClipper does for rows
+//   of a fixed height. TableDataNextRow() measures each submitted row and grows its height when its contents didn't fit.
+// Rows are data rows (index into user data) or display rows (index into Order[]).
+struct IMGUI_API ImGuiTableData
+{
+    ImVector<int>           Order;                  // Display row -> data row
+    ImVector<int>           DisplayRows;            // Data row -> display row
+    ImVector<float>         Heights;                // Height of each data row, including cell padding
+    ImVector<double>        HeightSums;             // Fenwick tree over the heights in display order, 1-based: [i] sums the (i & -i) rows ending at display row i - 1
+    ImVector<int>           SortBuffer;
+    int                     RowsCount;
+    int                     HeightSumsTopStep;      // Highest power of two <= RowsCount, first step of FindRow()
+    ImU64                   DataVersion;            // Data version Order[] was sorted for
+    bool                    OrderValid;
+    int                     SortCount;              // Number of times Order[] was rebuilt, for debugging
+
+    // Set by TableDataBeginRows()
+    float                   RowsStartY;             // Cursor position of display row 0
+    int                     DisplayStart;           // Visible display rows, DisplayEnd excluded
+    int                     DisplayEnd;
+    int                     CurrentRow;             // Display row submitted by the last TableDataNextRow(), -1 before the first
+
+    ImGuiTableData()                                { RowsCount = HeightSumsTopStep = SortCount = DisplayStart = DisplayEnd = 0; CurrentRow = -1; DataVersion = 0; OrderValid = false; RowsStartY = 0.0f; }
+    void                    SetRowsCount(int rows_count, float row_height); // Reset every row to row_height, in data order
+    bool                    Sort(ImGuiTableSortSpecs* sort_specs, ImU64 data_version, ImGuiTableDataCompareFunc compare, void* user_data); // Rebuild Order[] if sort_specs->SpecsDirty or data_version changed. Return true when rebuilt. sort_specs may be NULL (data order).
+    void                    SetRowHeight(int data_row, float height);
+    float                   GetRowHeight(int display_row) const { return Heights[Order[display_row]]; }
+    double                  GetRowOffset(int display_row) const; // Sum of the heights of the display rows before display_row
+    double                  GetTotalHeight() const  { return GetRowOffset(RowsCount); }
+    int                     FindRow(double offset) const;  // Display row at offset from the top of display row 0, clamped to existing rows
+    void                    BuildHeightSums();
+};
+
 // sizeof() ~ 16
 struct ImGuiTableColumnSettings
 {
@@ -3170,6 +3467,13 @@ namespace ImGui
     IMGUI_API void                  RemoveSettingsHandler(const char* type_name);
     IMGUI_API ImGuiSettingsHandler* FindSettingsHandler(const char* type_name);
 
+    // Settings - Binary records, for incremental saving
+    IMGUI_API void                  GatherDirtySettings(ImVector<ImGuiWindowSettings*>* out_windows, ImVector<ImGuiTableSettings*>* out_tables); // Settings of the windows and tables changed since the last call. Pointers are valid until settings are created.
+    IMGUI_API void                  SaveSettingsRecordsHeader(ImVector<char>* out_data);
+    IMGUI_API void                  SaveWindowSettingsRecord(ImGuiWindowSettings* settings, ImVector<char>* out_data); // Append one record
+    IMGUI_API void                  SaveTableSettingsRecord(ImGuiTableSettings* settings, ImVector<char>* out_data);   // Append one record
+    IMGUI_API size_t                LoadSettingsRecords(const void* data, size_t data_size); // Call once before the first frame instead of loading .ini data. Return the size of the valid data (records after a damaged one are ignored), 0 if the header doesn't match.
+
     // Settings - Windows
     IMGUI_API ImGuiWindowSettings*  CreateNewWindowSettings(const char* name);
     IMGUI_API ImGuiWindowSettings*  FindWindowSettingsByID(ImGuiID id);
@@ -3440,6 +3744,11 @@ namespace ImGui
     IMGUI_API void          TablePopColumnChannel();
     IMGUI_API void          TableAngledHeadersRowEx(ImGuiID row_id, float angle, float max_label_width, const ImGuiTableHeaderData* data, int data_count);
 
+    // Tables: Data-backed rows
+    IMGUI_API void          TableDataBeginRows(ImGuiTableData* data);                       // Call after the headers rows. Seek to the first visible display row, then submit rows data->DisplayStart to data->DisplayEnd with TableDataNextRow().
+    IMGUI_API void          TableDataNextRow(ImGuiTableData* data, int display_row, ImGuiTableRowFlags row_flags = 0); // TableNextRow() with the height of display_row
+    IMGUI_API void          TableDataEndRows(ImGuiTableData* data);                         // Seek past the last display row
+
     // Tables: Internals
     inline    ImGuiTable*   GetCurrentTable() { ImGuiContext& g = *GImGui; return g.CurrentTable; }
     IMGUI_API ImGuiTable*   TableFindByID(ImGuiID id);
@@ -3593,6 +3902,7 @@ namespace ImGui
 
     // InputText
     IMGUI_API bool          InputTextEx(const char* label, const char* hint, char* buf, int buf_size, const ImVec2& size_arg, ImGuiInputTextFlags flags, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
+    IMGUI_API bool          InputTextLarge(const char* label, ImGuiTextDocument* doc, const ImVec2& size_arg = ImVec2(0, 0), ImGuiInputTextFlags flags = 0); // Multi-line editor over a piece table, for documents of several MB. Supports ImGuiInputTextFlags_ReadOnly, ImGuiInputTextFlags_AllowTabInput.
     IMGUI_API void          InputTextDeactivateHook(ImGuiID id);
     IMGUI_API bool          TempInputText(const ImRect& bb, ImGuiID id, const char* label, char* buf, int buf_size, ImGuiInputTextFlags flags);
     IMGUI_API bool          TempInputScalar(const ImRect& bb, ImGuiID id, const char* label, ImGuiDataType data_type, void* p_data, const char* format, const void* p_clamp_min = NULL, const void* p_clamp_max = NULL);
@@ -3607,7 +3917,8 @@ namespace ImGui
     IMGUI_API void          ColorPickerOptionsPopup(const float* ref_col, ImGuiColorEditFlags flags);
 
     // Plot
-    IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg);
+    IMGUI_API int           PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg, ImGuiPlotRangeGetter range_getter = NULL); // With more values than pixel columns, draw the min/max of each column's range (given by range_getter when set, otherwise read through values_getter)
+    IMGUI_API void          PlotRingSeries(ImGuiPlotType plot_type, const char* label, const ImGuiPlotRingSeries* series, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, const ImVec2& size_arg = ImVec2(0, 0));
 
     // Shade functions (write over already created vertices)
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
@@ -3775,11 +4086,70 @@ typedef stbrp_node stbrp_node_im;
 #endif
 struct stbrp_context_opaque { char data[80]; };
 
+// Layout of a text run, as RenderText() positions it from (0, 0) without clipping (see ImFontAtlasFlags_TextLayoutCache)
+struct ImFontTextLayout
+{
+    ImGuiID                     Key;
+    ImFont*                     Font;
+    float                       Size;
+    float                       RasterizerDensity;
+    float                       WrapWidth;
+    ImVector<char>              Text;                   // Copy of the text, to rule out hash collisions
+    ImVec2                      TextSize;               // CalcTextSizeA() result with max_width == FLT_MAX
+    ImVector<ImDrawVert>        Vertices;               // 4 per visible glyph. 'col' holds the bits OR-ed into the text color: ~IM_COL32_A_MASK for colored glyphs, 0 otherwise.
+    ImVec4                      Bounds;                 // Union of all quads (x1, y1, x2, y2)
+    float                       LastLineY;              // Offset of the line holding the last quad
+    int                         LastUsedFrame;
+
+    ImFontTextLayout()          { memset(this, 0, sizeof(*this)); }
+};
+
+struct ImFontTextLayoutCache
+{
+    ImVector<ImFontTextLayout*> Layouts;
+    ImGuiStorage                LayoutsMap;             // Key --> index into Layouts[] + 1 (hash mode)
+    ImGuiStorage                Candidates;             // Key --> frame the text was first seen on (hash mode). Texts get cached when seen again on a later frame, so text changing every frame never does.
+    bool                        Busy;                   // Set while laying out a text for the cache: nested text functions bypass the cache
+    ImFontTextLayoutCacheStats  FrameStats;             // Current frame
+    ImFontTextLayoutCacheStats  LastFrameStats;
+};
+
+// Glyph bitmap rasterized ahead by ImFontAtlasBuildPreloadGlyphRanges(), until the font loader packs it
+struct ImFontAtlasPrerasterizedGlyph
+{
+    ImFontConfig*               Src;
+    int                         GlyphIndex;             // Index in the font file
+    int                         Width, Height;          // Includes oversampling
+    int                         OversampleH, OversampleV;
+    float                       ScaleX, ScaleY;         // Font units to raster pixels
+    int                         PixelsOffset;           // Into ImFontAtlasBuilder::PrerasterizedPixels[], Alpha8
+};
+
+// Free space for ImFontAtlasFlags_PackMaxRects, in a doubly linked list per grid cell
+struct ImFontAtlasPackFreeRect
+{
+    ImTextureRect               Rect;                   // Empty when unused
+    int                         Cell;                   // Index into ImFontAtlasBuilder::PackFreeCells[]
+    int                         Prev;                   // Index into ImFontAtlasBuilder::PackFreeRects[], -1 if first of its cell
+    int                         Next;                   // Index into ImFontAtlasBuilder::PackFreeRects[], -1 if last of its cell. Next unused entry when unused.
+};
+
+// Runs job(0..count-1, job_data), possibly on several threads, and returns once they are all done
+typedef void (*ImFontAtlasParallelForFunc)(int count, void (*job)(int index, void* job_data), void* job_data, void* user_data);
+
 // Internal storage for incrementally packing and building a ImFontAtlas
 struct ImFontAtlasBuilder
 {
     stbrp_context_opaque        PackContext;            // Actually 'stbrp_context' but we don't want to define this in the header file.
     ImVector<stbrp_node_im>     PackNodes;
+    ImVector<ImFontAtlasPackFreeRect> PackFreeRects;    // ImFontAtlasFlags_PackMaxRects: maximal free rectangles (overlapping each other), padding included
+    ImVector<int>               PackFreeCells;          // ImFontAtlasFlags_PackMaxRects: grid cell -> first free rectangle with its top-left corner in the cell, -1 if none. Last entry for those larger than a cell.
+    ImVector<ImVec2ih>          PackFreeCellsMaxSize;   // ImFontAtlasFlags_PackMaxRects: grid cell -> upper bound of the size of its free rectangles
+    ImVector<ImTextureRect>     PackSplitRects;         // ImFontAtlasFlags_PackMaxRects: scratch buffer of free rectangles to add
+    ImVector<int>               PackNearRects;          // ImFontAtlasFlags_PackMaxRects: scratch buffer of PackFreeRects[] indices
+    int                         PackFreeRectsFreeListStart; // ImFontAtlasFlags_PackMaxRects: first unused entry of PackFreeRects[]
+    int                         PackFreeRectsMinSize;   // ImFontAtlasFlags_PackMaxRects: smaller free rectangles can't fit anything and are dropped
+    int                         PackFreeCellsCountX;    // ImFontAtlasFlags_PackMaxRects: grid width
     ImVector<ImTextureRect>     Rects;
     ImVector<ImFontAtlasRectEntry> RectsIndex;          // ImFontAtlasRectId -> index into Rects[]
     ImVector<unsigned char>     TempBuffer;             // Misc scratch buffer
@@ -3788,10 +4158,12 @@ struct ImFontAtlasBuilder
     int                         RectsPackedSurface;     // Number of packed pixels. Used when compacting to heuristically find the ideal texture size.
     int                         RectsDiscardedCount;
     int                         RectsDiscardedSurface;
+    ImVector<int>               RectsDiscardedList;     // ImFontAtlasFlags_PackMaxRects: discarded Rects[] entries, reused by the next rectangles
     int                         FrameCount;             // Current frame count
     ImVec2i                     MaxRectSize;            // Largest rectangle to pack (de-facto used as a "minimum texture size")
     ImVec2i                     MaxRectBounds;          // Bottom-right most used pixels
     bool                        LockDisableResize;      // Disable resizing texture
+    bool                        PackMaxRects;           // ImFontAtlasFlags_PackMaxRects as of the last ImFontAtlasPackInit()
     bool                        PreloadedAllGlyphsRanges; // Set when missing ImGuiBackendFlags_RendererHasTextures features forces atlas to preload everything.
 
     // Cache of all ImFontBaked
@@ -3803,7 +4175,15 @@ struct ImFontAtlasBuilder
     ImFontAtlasRectId           PackIdMouseCursors;     // White pixel + mouse cursors. Also happen to be fallback in case of packing failure.
     ImFontAtlasRectId           PackIdLinesTexData;
 
-    ImFontAtlasBuilder()        { memset(this, 0, sizeof(*this)); FrameCount = -1; RectsIndexFreeListStart = -1; PackIdMouseCursors = PackIdLinesTexData = -1; }
+    // Text layouts (ImFontAtlasFlags_TextLayoutCache)
+    ImFontTextLayoutCache       TextLayoutCache;
+
+    // Glyphs rasterized ahead, only during ImFontAtlasBuildPreloadGlyphRanges()
+    ImVector<ImFontAtlasPrerasterizedGlyph> PrerasterizedGlyphs;
+    ImGuiStorage                PrerasterizedGlyphsMap; // Hash of (src, baked, codepoint) --> index into PrerasterizedGlyphs[] + 1 (hash mode)
+    ImVector<unsigned char>     PrerasterizedPixels;
+
+    ImFontAtlasBuilder()        { memset(this, 0, sizeof(*this)); FrameCount = -1; RectsIndexFreeListStart = -1; PackIdMouseCursors = PackIdLinesTexData = -1; TextLayoutCache.LayoutsMap.SetHashMode(true); TextLayoutCache.Candidates.SetHashMode(true); PrerasterizedGlyphsMap.SetHashMode(true); }
 };
 
 IMGUI_API void              ImFontAtlasBuildInit(ImFontAtlas* atlas);
@@ -3814,6 +4194,14 @@ IMGUI_API void              ImFontAtlasBuildUpdatePointers(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasBuildRenderBitmapFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char);
 IMGUI_API void              ImFontAtlasBuildClear(ImFontAtlas* atlas); // Clear output and custom rects
 
+IMGUI_API ImFontTextLayout* ImFontAtlasTextLayoutCacheFind(ImFontAtlas* atlas, ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end); // NULL when not cached (yet)
+IMGUI_API void              ImFontAtlasTextLayoutCacheNewFrame(ImFontAtlas* atlas);
+IMGUI_API void              ImFontAtlasTextLayoutCacheClear(ImFontAtlas* atlas); // Invalidate every layout, e.g. after glyphs UV changed
+
+IMGUI_API ImGuiID           ImFontAtlasCacheGetKey(ImFontAtlas* atlas); // Hash of font files contents, sources options and atlas settings
+IMGUI_API void              ImFontAtlasCacheSave(ImFontAtlas* atlas, ImVector<char>* out_data); // Serialize texture, packing state and baked fonts
+IMGUI_API bool              ImFontAtlasCacheLoad(ImFontAtlas* atlas, const void* data, size_t data_size); // Call after adding fonts, before anything is baked. Return false and leave atlas untouched if data doesn't match.
+
 IMGUI_API ImTextureData*    ImFontAtlasTextureAdd(ImFontAtlas* atlas, int w, int h);
 IMGUI_API void              ImFontAtlasTextureMakeSpace(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasTextureRepack(ImFontAtlas* atlas, int w, int h);
@@ -3823,6 +4211,7 @@ IMGUI_API ImVec2i           ImFontAtlasTextureGetSizeEstimate(ImFontAtlas* atlas
 
 IMGUI_API void              ImFontAtlasBuildSetupFontSpecialGlyphs(ImFontAtlas* atlas, ImFont* font, ImFontConfig* src);
 IMGUI_API void              ImFontAtlasBuildLegacyPreloadAllGlyphRanges(ImFontAtlas* atlas); // Legacy
+IMGUI_API void              ImFontAtlasBuildPreloadGlyphRanges(ImFontAtlas* atlas, ImFont* font, float font_size, const ImWchar* ranges, ImFontAtlasParallelForFunc parallel_for = NULL, void* parallel_for_user_data = NULL); // Load glyphs ahead of use. With parallel_for, stb_truetype glyphs are rasterized on several threads first: the atlas is the same byte for byte.
 IMGUI_API void              ImFontAtlasBuildGetOversampleFactors(ImFontConfig* src, ImFontBaked* baked, int* out_oversample_h, int* out_oversample_v);
 IMGUI_API void              ImFontAtlasBuildDiscardBakes(ImFontAtlas* atlas, int unused_frames);
 
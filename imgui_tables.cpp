@@ -14,6 +14,7 @@ Index of this file:
 // [SECTION] Tables: Columns width management
 // [SECTION] Tables: Drawing
 // [SECTION] Tables: Sorting
+// [SECTION] Tables: Data-backed rows
 // [SECTION] Tables: Headers
 // [SECTION] Tables: Context Menu
 // [SECTION] Tables: Settings (.ini data)
@@ -3053,6 +3054,246 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
     table->SortSpecs.SpecsCount = table->SortSpecsCount;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] Tables: Data-backed rows
+//-------------------------------------------------------------------------
+// - ImGuiTableData::SetRowsCount()
+// - ImGuiTableData::Sort()
+// - ImGuiTableData::SetRowHeight()
+// - ImGuiTableData::GetRowOffset()
+// - ImGuiTableData::FindRow()
+// - ImGuiTableData::BuildHeightSums()
+// - TableDataBeginRows()
+// - TableDataNextRow()
+// - TableDataEndRows()
+//-------------------------------------------------------------------------
+
+void ImGuiTableData::SetRowsCount(int rows_count, float row_height)
+{
+    IM_ASSERT(rows_count >= 0 && row_height >= 0.0f);
+    RowsCount = rows_count;
+    Order.resize(rows_count);
+    DisplayRows.resize(rows_count);
+    Heights.resize(rows_count);
+    for (int n = 0; n < rows_count; n++)
+    {
+        Order[n] = DisplayRows[n] = n;
+        Heights[n] = row_height;
+    }
+    BuildHeightSums();
+    OrderValid = false;
+    DisplayStart = DisplayEnd = 0;
+}
+
+static int TableDataCompareRows(const ImGuiTableSortSpecs* sort_specs, ImGuiTableDataCompareFunc compare, void* user_data, int row_a, int row_b)
+{
+    for (int n = 0; n < sort_specs->SpecsCount; n++)
+    {
+        const ImGuiTableColumnSortSpecs* sort_spec = &sort_specs->Specs[n];
+        const int delta = compare(sort_spec, row_a, row_b, user_data);
+        if (delta != 0)
+            return (sort_spec->SortDirection == ImGuiSortDirection_Descending) ? -delta : delta;
+    }
+    return 0;
+}
+
+// Stable merge sort starting from the data order, so that rows which compare equal stay in data order whatever the previous sort was.
+// Insertion sort runs of 16 rows, then merge them in passes alternating between Order[] and SortBuffer[]. Merging skips pairs of
+// runs already in order, which makes sorting presorted data (e.g. rows appended in order) close to linear.
+bool ImGuiTableData::Sort(ImGuiTableSortSpecs* sort_specs, ImU64 data_version, ImGuiTableDataCompareFunc compare, void* user_data)
+{
+    const bool specs_dirty = (sort_specs != NULL && sort_specs->SpecsDirty);
+    if (OrderValid && !specs_dirty && data_version == DataVersion)
+        return false;
+
+    for (int n = 0; n < RowsCount; n++)
+        Order[n] = n;
+    if (sort_specs != NULL && sort_specs->SpecsCount > 0 && RowsCount > 1)
+    {
+        IM_ASSERT(compare != NULL);
+        const int run_size = 16;
+        for (int run_start = 0; run_start < RowsCount; run_start += run_size)
+        {
+            const int run_end = ImMin(run_start + run_size, RowsCount);
+            for (int i = run_start + 1; i < run_end; i++)
+            {
+                const int row = Order[i];
+                int j = i;
+                for (; j > run_start && TableDataCompareRows(sort_specs, compare, user_data, row, Order[j - 1]) < 0; j--)
+                    Order[j] = Order[j - 1];
+                Order[j] = row;
+            }
+        }
+
+        SortBuffer.resize(RowsCount);
+        int* src = Order.Data;
+        int* dst = SortBuffer.Data;
+        for (int width = run_size; width < RowsCount; width *= 2)
+        {
+            for (int lo = 0; lo < RowsCount; lo += width * 2)
+            {
+                const int mid = ImMin(lo + width, RowsCount);
+                const int hi = ImMin(lo + width * 2, RowsCount);
+                if (mid == hi || TableDataCompareRows(sort_specs, compare, user_data, src[mid], src[mid - 1]) >= 0)
+                {
+                    memcpy(dst + lo, src + lo, (size_t)(hi - lo) * sizeof(int));
+                    continue;
+                }
+                int i = lo, j = mid, k = lo;
+                while (i < mid && j < hi)
+                    dst[k++] = (TableDataCompareRows(sort_specs, compare, user_data, src[j], src[i]) < 0) ? src[j++] : src[i++];
+                while (i < mid)
+                    dst[k++] = src[i++];
+                while (j < hi)
+                    dst[k++] = src[j++];
+            }
+            ImSwap(src, dst);
+        }
+        if (src != Order.Data)
+            memcpy(Order.Data, src, (size_t)RowsCount * sizeof(int));
+    }
+    for (int n = 0; n < RowsCount; n++)
+        DisplayRows[Order[n]] = n;
+    BuildHeightSums();
+
+    if (sort_specs != NULL)
+        sort_specs->SpecsDirty = false;
+    DataVersion = data_version;
+    OrderValid = true;
+    SortCount++;
+    return true;
+}
+
+void ImGuiTableData::SetRowHeight(int data_row, float height)
+{
+    IM_ASSERT(data_row >= 0 && data_row < RowsCount && height >= 0.0f);
+    const double delta = (double)height - (double)Heights[data_row];
+    Heights[data_row] = height;
+    if (delta == 0.0)
+        return;
+    for (int i = DisplayRows[data_row] + 1; i <= RowsCount; i += i & -i)
+        HeightSums[i] += delta;
+}
+
+double ImGuiTableData::GetRowOffset(int display_row) const
+{
+    IM_ASSERT(display_row >= 0 && display_row <= RowsCount);
+    double offset = 0.0;
+    for (int i = display_row; i > 0; i -= i & -i)
+        offset += HeightSums[i];
+    return offset;
+}
+
+// Descend the implicit tree from the top step: each step skips a whole node when the offset is past it.
+int ImGuiTableData::FindRow(double offset) const
+{
+    if (RowsCount == 0)
+        return 0;
+    int pos = 0;
+    for (int step = HeightSumsTopStep; step > 0; step >>= 1)
+        if (pos + step <= RowsCount && HeightSums[pos + step] <= offset)
+        {
+            pos += step;
+            offset -= HeightSums[pos];
+        }
+    return ImMin(pos, RowsCount - 1);
+}
+
+// O(N): each node adds itself into its parent once
+void ImGuiTableData::BuildHeightSums()
+{
+    HeightSums.resize(RowsCount + 1);
+    HeightSums[0] = 0.0;
+    for (int i = 1; i <= RowsCount; i++)
+        HeightSums[i] = Heights[Order[i - 1]];
+    for (int i = 1; i <= RowsCount; i++)
+    {
+        const int parent = i + (i & -i);
+        if (parent <= RowsCount)
+            HeightSums[parent] += HeightSums[i];
+    }
+    HeightSumsTopStep = 0;
+    while (HeightSumsTopStep * 2 <= RowsCount)
+        HeightSumsTopStep = HeightSumsTopStep ? HeightSumsTopStep * 2 : 1;
+}
+
+// Same as ImGuiListClipper_SeekCursorAndSetupPrevLine(), with the number of rows skipped known rather than derived from a fixed row height
+static void TableDataSeekCursor(ImGuiTable* table, float pos_y, float prev_row_height, int rows_skipped)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = table->InnerWindow;
+    if (table->IsInsideRow)
+        ImGui::TableEndRow(table);
+    window->DC.CursorPos.y = pos_y;
+    window->DC.CursorMaxPos.y = ImMax(window->DC.CursorMaxPos.y, pos_y - g.Style.ItemSpacing.y);
+    window->DC.CursorPosPrevLine.y = pos_y - prev_row_height;
+    window->DC.PrevLineSize.y = prev_row_height - g.Style.ItemSpacing.y;
+    table->RowPosY2 = pos_y;
+    table->RowBgColorCounter += rows_skipped;
+}
+
+// Grow the last submitted row if its contents didn't fit: the rows after it are placed from their submitted position this frame,
+// and from the updated offsets next frame.
+static void TableDataEndMeasuredRow(ImGuiTable* table, ImGuiTableData* data)
+{
+    if (data->CurrentRow == -1 || !table->IsInsideRow)
+        return;
+    ImGui::TableEndRow(table);
+    const float measured_height = table->RowPosY2 - table->RowPosY1;
+    if (measured_height > data->GetRowHeight(data->CurrentRow))
+        data->SetRowHeight(data->Order[data->CurrentRow], measured_height);
+}
+
+// The visible range is taken from the clip rect, which TableEndRow() moved below the frozen rows.
+// Unlike ImGuiListClipper, rows out of view are not submitted for keyboard navigation: moving past the visible rows scrolls one page.
+void ImGui::TableDataBeginRows(ImGuiTableData* data)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL && "Need to call TableDataBeginRows() after BeginTable()!");
+    IM_ASSERT(data->OrderValid && "Need to call ImGuiTableData::Sort() before TableDataBeginRows()!");
+    IM_ASSERT(table->CurrentRow + 1 >= table->FreezeRowsCount && "Frozen rows need to be submitted before TableDataBeginRows()!");
+    if (!table->IsLayoutLocked)
+        TableUpdateLayout(table);
+    if (table->IsInsideRow)
+        TableEndRow(table);
+
+    ImGuiWindow* window = table->InnerWindow;
+    data->RowsStartY = window->DC.CursorPos.y;
+    data->CurrentRow = -1;
+    if (data->RowsCount == 0)
+    {
+        data->DisplayStart = data->DisplayEnd = 0;
+        return;
+    }
+    data->DisplayStart = data->FindRow((double)(window->ClipRect.Min.y - data->RowsStartY));
+    data->DisplayEnd = data->FindRow((double)(window->ClipRect.Max.y - data->RowsStartY)) + 1;
+    if (data->DisplayStart > 0)
+        TableDataSeekCursor(table, data->RowsStartY + (float)data->GetRowOffset(data->DisplayStart), data->GetRowHeight(data->DisplayStart - 1), data->DisplayStart);
+}
+
+void ImGui::TableDataNextRow(ImGuiTableData* data, int display_row, ImGuiTableRowFlags row_flags)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(display_row >= 0 && display_row < data->RowsCount);
+
+    TableDataEndMeasuredRow(table, data);
+    TableNextRow(row_flags, data->GetRowHeight(display_row));
+    data->CurrentRow = display_row;
+}
+
+void ImGui::TableDataEndRows(ImGuiTableData* data)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL);
+    TableDataEndMeasuredRow(table, data);
+    if (data->RowsCount > 0 && data->DisplayEnd < data->RowsCount)
+        TableDataSeekCursor(table, data->RowsStartY + (float)data->GetTotalHeight(), data->GetRowHeight(data->RowsCount - 1), data->RowsCount - data->DisplayEnd);
+    data->CurrentRow = -1;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Headers
 //-------------------------------------------------------------------------
@@ -3738,6 +3979,12 @@ void ImGui::TableSaveSettings(ImGuiTable* table)
     settings->SaveFlags &= table->Flags;
     settings->RefScale = save_ref_scale ? table->RefScale : 0.0f;
 
+    if (!table->IsSettingsQueued)
+    {
+        table->IsSettingsQueued = true;
+        g.SettingsDirtyTables.push_back(table->ID);
+    }
+
     MarkIniSettingsDirty();
 }
 
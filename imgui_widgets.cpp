@@ -15,6 +15,7 @@ Index of this file:
 // [SECTION] Widgets: SliderScalar, SliderFloat, SliderInt, etc.
 // [SECTION] Widgets: InputScalar, InputFloat, InputInt, etc.
 // [SECTION] Widgets: InputText, InputTextMultiline
+// [SECTION] Widgets: InputTextLarge
 // [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
 // [SECTION] Widgets: TreeNode, CollapsingHeader, etc.
 // [SECTION] Widgets: Selectable
@@ -5513,6 +5514,779 @@ void ImGui::DebugNodeInputTextState(ImGuiInputTextState* state)
 #endif
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] Widgets: InputTextLarge
+//-------------------------------------------------------------------------
+// - ImGuiTextDocument [Internal]
+// - InputTextLargeCalcWidth() [Internal]
+// - InputTextLargeFindColumn() [Internal]
+// - InputTextLargeReplaceSelection() [Internal]
+// - InputTextLarge() [Internal]
+//-------------------------------------------------------------------------
+
+void ImGuiTextDocument::SetText(const char* text, const char* text_end)
+{
+    if (text_end == NULL)
+        text_end = text + ImStrlen(text);
+    Length = (int)(text_end - text);
+    Original.resize(Length);
+    if (Length > 0)
+        memcpy(Original.Data, text, (size_t)Length);
+    Added.resize(0);
+    Pieces.resize(0);
+    if (Length > 0)
+        Pieces.push_back(ImGuiTextPiece(0, Length, false));
+    PieceCacheIndex = PieceCacheStart = 0;
+
+    LineStarts.resize(0);
+    LineStarts.push_back(0);
+    for (const char* p = text; (p = (const char*)ImMemchr(p, '\n', text_end - p)) != NULL; p++)
+        LineStarts.push_back((int)(p - text) + 1);
+    LineDeltaFirst = LineDelta = 0;
+
+    UndoRecords.resize(0);
+    UndoText.resize(0);
+    UndoPos = UndoGroupNext = 0;
+    UndoGroupOpen = false;
+    ContentWidth = 0.0f;
+    CursorPreferredX = -1.0f;
+    SetCursor(0);
+}
+
+void ImGuiTextDocument::GetText(ImVector<char>* out_text) const
+{
+    out_text->resize(Length + 1);
+    char* dst = out_text->Data;
+    for (const ImGuiTextPiece& piece : Pieces)
+    {
+        memcpy(dst, (piece.IsAdded ? Added.Data : Original.Data) + piece.Offset, (size_t)piece.Length);
+        dst += piece.Length;
+    }
+    *dst = 0;
+}
+
+void ImGuiTextDocument::GetTextRange(int offset_begin, int offset_end, ImVector<char>* out_text)
+{
+    out_text->resize(offset_end - offset_begin);
+    CopyText(offset_begin, offset_end, out_text->Data);
+}
+
+char ImGuiTextDocument::GetChar(int offset)
+{
+    IM_ASSERT(offset >= 0 && offset < Length);
+    int piece_start;
+    const ImGuiTextPiece& piece = Pieces.Data[FindPiece(offset, &piece_start)];
+    return (piece.IsAdded ? Added.Data : Original.Data)[piece.Offset + offset - piece_start];
+}
+
+int ImGuiTextDocument::FindLine(int offset) const
+{
+    // Binary search for the last line starting at or before offset
+    int line_min = 0;
+    int line_max = LineStarts.Size;
+    while (line_max - line_min > 1)
+    {
+        const int line_mid = (line_min + line_max) >> 1;
+        if (GetLineStart(line_mid) <= offset)
+            line_min = line_mid;
+        else
+            line_max = line_mid;
+    }
+    return line_min;
+}
+
+const char* ImGuiTextDocument::GetLineText(int line_n, const char** out_text_end)
+{
+    const int line_start = GetLineStart(line_n);
+    const int line_end = GetLineEnd(line_n);
+    if (line_start == line_end)
+    {
+        *out_text_end = "";
+        return *out_text_end;
+    }
+
+    // Point into the piece when the line doesn't cross a piece boundary, which is the case of most lines
+    int piece_start;
+    const ImGuiTextPiece& piece = Pieces.Data[FindPiece(line_start, &piece_start)];
+    if (line_end <= piece_start + piece.Length)
+    {
+        const char* text = (piece.IsAdded ? Added.Data : Original.Data) + piece.Offset + line_start - piece_start;
+        *out_text_end = text + (line_end - line_start);
+        return text;
+    }
+    GetTextRange(line_start, line_end, &LineBuf);
+    *out_text_end = LineBuf.Data + LineBuf.Size;
+    return LineBuf.Data;
+}
+
+void ImGuiTextDocument::Insert(int offset, const char* text, const char* text_end)
+{
+    IM_ASSERT(offset >= 0 && offset <= Length);
+    if (text_end == NULL)
+        text_end = text + ImStrlen(text);
+    const int length = (int)(text_end - text);
+    if (length == 0)
+        return;
+    AddUndoRecord(offset, text, length, true);
+    InsertRaw(offset, text, length);
+}
+
+void ImGuiTextDocument::Delete(int offset, int length)
+{
+    IM_ASSERT(offset >= 0 && length >= 0 && offset + length <= Length);
+    if (length == 0)
+        return;
+    AddUndoRecord(offset, NULL, length, false);
+    DeleteRaw(offset, length);
+}
+
+bool ImGuiTextDocument::Undo()
+{
+    if (UndoPos == 0)
+        return false;
+    const int group = UndoRecords.Data[UndoPos - 1].Group;
+    while (UndoPos > 0 && UndoRecords.Data[UndoPos - 1].Group == group)
+    {
+        const ImGuiTextUndoRecord& rec = UndoRecords.Data[--UndoPos];
+        if (rec.IsInsert)
+            DeleteRaw(rec.Offset, rec.Length);
+        else
+            InsertRaw(rec.Offset, UndoText.Data + rec.TextOffset, rec.Length);
+        SetCursor(rec.IsInsert ? rec.Offset : rec.Offset + rec.Length);
+    }
+    UndoGroupOpen = false;
+    return true;
+}
+
+bool ImGuiTextDocument::Redo()
+{
+    if (UndoPos == UndoRecords.Size)
+        return false;
+    const int group = UndoRecords.Data[UndoPos].Group;
+    while (UndoPos < UndoRecords.Size && UndoRecords.Data[UndoPos].Group == group)
+    {
+        const ImGuiTextUndoRecord& rec = UndoRecords.Data[UndoPos++];
+        if (rec.IsInsert)
+            InsertRaw(rec.Offset, UndoText.Data + rec.TextOffset, rec.Length);
+        else
+            DeleteRaw(rec.Offset, rec.Length);
+        SetCursor(rec.IsInsert ? rec.Offset + rec.Length : rec.Offset);
+    }
+    UndoGroupOpen = false;
+    return true;
+}
+
+int ImGuiTextDocument::FindPiece(int offset, int* out_piece_start)
+{
+    IM_ASSERT(offset >= 0 && offset <= Length);
+    if (offset == Length)
+    {
+        *out_piece_start = Length;
+        return Pieces.Size;
+    }
+
+    // Walk from the last piece found: edits and rendering mostly look up nearby offsets
+    int piece_n = PieceCacheIndex;
+    int piece_start = PieceCacheStart;
+    while (offset < piece_start)
+        piece_start -= Pieces.Data[--piece_n].Length;
+    while (offset >= piece_start + Pieces.Data[piece_n].Length)
+        piece_start += Pieces.Data[piece_n++].Length;
+    PieceCacheIndex = piece_n;
+    PieceCacheStart = piece_start;
+    *out_piece_start = piece_start;
+    return piece_n;
+}
+
+int ImGuiTextDocument::SplitPiece(int offset)
+{
+    int piece_start;
+    const int piece_n = FindPiece(offset, &piece_start);
+    if (piece_n == Pieces.Size || piece_start == offset)
+        return piece_n;
+
+    ImGuiTextPiece* piece = &Pieces.Data[piece_n];
+    const int split = offset - piece_start;
+    const ImGuiTextPiece tail(piece->Offset + split, piece->Length - split, piece->IsAdded);
+    piece->Length = split;
+    Pieces.insert(Pieces.Data + piece_n + 1, tail);
+    PieceCacheIndex = piece_n + 1;
+    PieceCacheStart = offset;
+    return piece_n + 1;
+}
+
+void ImGuiTextDocument::CopyText(int offset_begin, int offset_end, char* dst)
+{
+    IM_ASSERT(offset_begin >= 0 && offset_begin <= offset_end && offset_end <= Length);
+    if (offset_begin == offset_end)
+        return;
+    int piece_start;
+    int piece_n = FindPiece(offset_begin, &piece_start);
+    for (int offset = offset_begin; offset < offset_end; piece_n++)
+    {
+        const ImGuiTextPiece& piece = Pieces.Data[piece_n];
+        const int copy_begin = offset - piece_start;
+        const int copy_length = ImMin(piece.Length - copy_begin, offset_end - offset);
+        memcpy(dst, (piece.IsAdded ? Added.Data : Original.Data) + piece.Offset + copy_begin, (size_t)copy_length);
+        dst += copy_length;
+        offset += copy_length;
+        piece_start += piece.Length;
+    }
+}
+
+// Lines before line_n hold their actual offset, lines from line_n onward hold their offset minus LineDelta.
+// Only the lines between the old and new LineDeltaFirst are touched, so consecutive edits on a same line are O(1).
+void ImGuiTextDocument::MoveLineDeltaFirst(int line_n)
+{
+    if (LineDelta != 0)
+    {
+        for (int n = LineDeltaFirst; n < line_n; n++)
+            LineStarts.Data[n] += LineDelta;
+        for (int n = line_n; n < LineDeltaFirst; n++)
+            LineStarts.Data[n] -= LineDelta;
+    }
+    LineDeltaFirst = line_n;
+}
+
+void ImGuiTextDocument::InsertRaw(int offset, const char* text, int length)
+{
+    IM_ASSERT(length > 0);
+
+    // Line index: the lines after the edited one are shifted through LineDelta, new lines are inserted after it
+    const int line_n = FindLine(offset);
+    MoveLineDeltaFirst(line_n + 1);
+    LineDelta += length;
+    int new_lines_count = 0;
+    for (const char* p = text; (p = (const char*)ImMemchr(p, '\n', text + length - p)) != NULL; p++)
+        new_lines_count++;
+    if (new_lines_count > 0)
+    {
+        const int moved_count = LineStarts.Size - (line_n + 1);
+        LineStarts.resize(LineStarts.Size + new_lines_count);
+        memmove(LineStarts.Data + line_n + 1 + new_lines_count, LineStarts.Data + line_n + 1, (size_t)moved_count * sizeof(int));
+        int* dst = LineStarts.Data + line_n + 1;
+        for (const char* p = text; (p = (const char*)ImMemchr(p, '\n', text + length - p)) != NULL; p++)
+            *dst++ = offset + (int)(p - text) + 1 - LineDelta;
+    }
+
+    // Pieces: typing after the last inserted text extends its piece
+    const int added_offset = Added.Size;
+    Added.resize(Added.Size + length);
+    memcpy(Added.Data + added_offset, text, (size_t)length);
+    const int piece_n = SplitPiece(offset);
+    ImGuiTextPiece* prev_piece = (piece_n > 0) ? &Pieces.Data[piece_n - 1] : NULL;
+    if (prev_piece && prev_piece->IsAdded && prev_piece->Offset + prev_piece->Length == added_offset)
+    {
+        PieceCacheIndex = piece_n - 1;
+        PieceCacheStart = offset - prev_piece->Length;
+        prev_piece->Length += length;
+    }
+    else
+    {
+        Pieces.insert(Pieces.Data + piece_n, ImGuiTextPiece(added_offset, length, true));
+        PieceCacheIndex = piece_n;
+        PieceCacheStart = offset;
+    }
+    Length += length;
+}
+
+void ImGuiTextDocument::DeleteRaw(int offset, int length)
+{
+    IM_ASSERT(length > 0);
+
+    // Line index: the lines starting inside the deleted text are removed, the lines after it are shifted through LineDelta
+    const int line_first = FindLine(offset);
+    const int line_last = FindLine(offset + length);
+    MoveLineDeltaFirst(line_first + 1);
+    if (line_last > line_first)
+        LineStarts.erase(LineStarts.Data + line_first + 1, LineStarts.Data + line_last + 1);
+    LineDelta -= length;
+
+    // Pieces
+    const int piece_first = SplitPiece(offset);
+    const int piece_last = SplitPiece(offset + length);
+    Pieces.erase(Pieces.Data + piece_first, Pieces.Data + piece_last);
+    Length -= length;
+    if (piece_first < Pieces.Size)
+    {
+        PieceCacheIndex = piece_first;
+        PieceCacheStart = offset;
+    }
+    else
+    {
+        PieceCacheIndex = PieceCacheStart = 0;
+    }
+}
+
+void ImGuiTextDocument::AddUndoRecord(int offset, const char* text, int length, bool is_insert)
+{
+    // Discard undone records
+    if (UndoPos < UndoRecords.Size)
+    {
+        UndoText.resize(UndoRecords.Data[UndoPos].TextOffset);
+        UndoRecords.resize(UndoPos);
+        UndoGroupOpen = false;
+    }
+
+    // Typing and erasing contiguous text without crossing a line are undone together.
+    // An insertion where the previous record deleted text (replacing a selection) joins its group too.
+    ImGuiTextUndoRecord* last_rec = (UndoGroupOpen && UndoRecords.Size > 0) ? &UndoRecords.back() : NULL;
+    const int text_offset = UndoText.Size;
+    UndoText.resize(UndoText.Size + length);
+    if (text)
+        memcpy(UndoText.Data + text_offset, text, (size_t)length);
+    else
+        CopyText(offset, offset + length, UndoText.Data + text_offset);
+    const bool has_new_line = ImMemchr(UndoText.Data + text_offset, '\n', (size_t)length) != NULL;
+    if (last_rec && !has_new_line && is_insert && last_rec->IsInsert && last_rec->Offset + last_rec->Length == offset)
+    {
+        last_rec->Length += length; // Text of the last record is at the end of UndoText
+        return;
+    }
+    bool join_group = false;
+    if (last_rec && !has_new_line)
+    {
+        if (is_insert)
+            join_group = !last_rec->IsInsert && last_rec->Offset == offset;
+        else
+            join_group = !last_rec->IsInsert && (offset + length == last_rec->Offset || offset == last_rec->Offset);
+    }
+
+    ImGuiTextUndoRecord rec;
+    rec.Offset = offset;
+    rec.Length = length;
+    rec.TextOffset = text_offset;
+    rec.Group = join_group ? last_rec->Group : UndoGroupNext++;
+    rec.IsInsert = is_insert;
+    UndoRecords.push_back(rec);
+    UndoPos = UndoRecords.Size;
+    UndoGroupOpen = !has_new_line;
+}
+
+static float InputTextLargeCalcWidth(ImGuiContext* ctx, const char* text_begin, const char* text_end)
+{
+    ImGuiContext& g = *ctx;
+    return g.Font->CalcTextSizeA(g.FontSize, FLT_MAX, 0.0f, text_begin, text_end).x;
+}
+
+// Byte offset in the line of the character boundary closest to x
+static int InputTextLargeFindColumn(ImGuiContext* ctx, const char* text_begin, const char* text_end, float x)
+{
+    ImGuiContext& g = *ctx;
+    float line_width = 0.0f;
+    for (const char* s = text_begin; s < text_end; )
+    {
+        unsigned int c;
+        const int c_len = ImTextCharFromUtf8(&c, s, text_end);
+        const float char_width = g.FontBaked->GetCharAdvance((ImWchar)c) * g.FontBakedScale;
+        if (x < line_width + char_width * 0.5f)
+            return (int)(s - text_begin);
+        line_width += char_width;
+        s += c_len;
+    }
+    return (int)(text_end - text_begin);
+}
+
+static int InputTextLargePrevChar(ImGuiTextDocument* doc, int offset)
+{
+    if (offset > 0)
+        offset--;
+    while (offset > 0 && (doc->GetChar(offset) & 0xC0) == 0x80) // Skip UTF-8 continuation bytes
+        offset--;
+    return offset;
+}
+
+static int InputTextLargeNextChar(ImGuiTextDocument* doc, int offset)
+{
+    if (offset < doc->GetLength())
+        offset++;
+    while (offset < doc->GetLength() && (doc->GetChar(offset) & 0xC0) == 0x80)
+        offset++;
+    return offset;
+}
+
+static bool InputTextLargeIsWordChar(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || (c & 0x80) != 0;
+}
+
+static int InputTextLargePrevWord(ImGuiTextDocument* doc, int offset)
+{
+    while (offset > 0 && !InputTextLargeIsWordChar(doc->GetChar(offset - 1)))
+        offset--;
+    while (offset > 0 && InputTextLargeIsWordChar(doc->GetChar(offset - 1)))
+        offset--;
+    return offset;
+}
+
+static int InputTextLargeNextWord(ImGuiTextDocument* doc, int offset)
+{
+    const int length = doc->GetLength();
+    while (offset < length && InputTextLargeIsWordChar(doc->GetChar(offset)))
+        offset++;
+    while (offset < length && !InputTextLargeIsWordChar(doc->GetChar(offset)))
+        offset++;
+    return offset;
+}
+
+// Delete the selection and insert text in its place, as a single undo step
+static void InputTextLargeReplaceSelection(ImGuiTextDocument* doc, const char* text, const char* text_end)
+{
+    if (doc->HasSelection())
+    {
+        const int selection_min = doc->GetSelectionMin();
+        doc->Delete(selection_min, doc->GetSelectionMax() - selection_min);
+        doc->SetCursor(selection_min);
+    }
+    const int cursor = doc->Cursor;
+    doc->Insert(cursor, text, text_end);
+    doc->SetCursor(cursor + (int)(text_end - text));
+    doc->Edited = true;
+}
+
+static void InputTextLargeDeleteRange(ImGuiTextDocument* doc, int offset_begin, int offset_end)
+{
+    if (offset_begin < offset_end)
+    {
+        doc->Delete(offset_begin, offset_end - offset_begin);
+        doc->Edited = true;
+    }
+    doc->SetCursor(offset_begin);
+}
+
+// Multi-line editor over a ImGuiTextDocument. Only the visible lines are laid out: the content height comes from the line count,
+// the content width from the widest line rendered so far. No ImGuiInputTextState is involved, the document holds the editing state.
+// Unlike InputTextEx() there is no callback or character filtering, and the document is edited in place (no revert on Escape).
+bool ImGui::InputTextLarge(const char* label, ImGuiTextDocument* doc, const ImVec2& size_arg, ImGuiInputTextFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    const ImGuiStyle& style = g.Style;
+    const ImGuiID id = window->GetID(label);
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 frame_size = CalcItemSize(size_arg, CalcItemWidth(), g.FontSize * 16.0f + style.FramePadding.y * 2.0f);
+    const ImVec2 total_size = ImVec2(frame_size.x + (label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f), frame_size.y);
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Min + total_size);
+    doc->Edited = false;
+
+    BeginGroup();
+    ImVec2 backup_pos = window->DC.CursorPos;
+    ItemSize(total_bb, style.FramePadding.y);
+    if (!ItemAdd(total_bb, id, &frame_bb, ImGuiItemFlags_Inputable))
+    {
+        EndGroup();
+        return false;
+    }
+    ImGuiLastItemData item_data_backup = g.LastItemData;
+    window->DC.CursorPos = backup_pos;
+    if (g.LastItemData.ItemFlags & ImGuiItemFlags_ReadOnly)
+        flags |= ImGuiInputTextFlags_ReadOnly;
+    const bool is_readonly = (flags & ImGuiInputTextFlags_ReadOnly) != 0;
+    if (g.NavActivateId == id && (g.NavActivateFlags & ImGuiActivateFlags_FromTabbing) && (flags & ImGuiInputTextFlags_AllowTabInput))
+        g.NavActivateId = 0;
+    const bool input_requested_by_nav = (g.ActiveId != id) && (g.NavActivateId == id);
+
+    // Content size is known without measuring the text, so the child window can scroll the whole document
+    const float line_height = g.FontSize;
+    SetNextWindowContentSize(ImVec2(doc->ContentWidth + style.FramePadding.x * 2.0f, doc->GetLineCount() * line_height + style.FramePadding.y * 2.0f));
+    const ImGuiID backup_activate_id = g.NavActivateId;
+    if (g.ActiveId == id) // Prevent reactivation
+        g.NavActivateId = 0;
+    PushStyleColor(ImGuiCol_ChildBg, style.Colors[ImGuiCol_FrameBg]);
+    PushStyleVar(ImGuiStyleVar_ChildRounding, style.FrameRounding);
+    PushStyleVar(ImGuiStyleVar_ChildBorderSize, style.FrameBorderSize);
+    PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
+    bool child_visible = BeginChildEx(label, id, frame_bb.GetSize(), ImGuiChildFlags_Borders, ImGuiWindowFlags_NoMove | ImGuiWindowFlags_HorizontalScrollbar);
+    g.NavActivateId = backup_activate_id;
+    PopStyleVar(3);
+    PopStyleColor();
+    if (!child_visible)
+    {
+        EndChild();
+        EndGroup();
+        return false;
+    }
+    ImGuiWindow* draw_window = g.CurrentWindow;
+    draw_window->DC.NavLayersActiveMaskNext |= (1 << draw_window->DC.NavLayerCurrent);
+    draw_window->DC.CursorPos += style.FramePadding;
+    const ImVec2 text_origin = draw_window->DC.CursorPos;
+    const ImRect text_clip_rect = draw_window->InnerClipRect;
+
+    bool hovered = (g.HoveredWindow == draw_window) && text_clip_rect.Contains(io.MousePos) && (g.ActiveId == 0 || g.ActiveId == id);
+    if (hovered)
+        SetMouseCursor(ImGuiMouseCursor_TextInput);
+    if (hovered && g.NavHighlightItemUnderNav)
+        hovered = false;
+    const bool user_clicked = hovered && io.MouseClicked[0];
+    if (g.ActiveId != id && (user_clicked || input_requested_by_nav))
+    {
+        SetActiveID(id, window);
+        SetFocusID(id, window);
+        FocusWindow(window);
+        doc->CloseUndoGroup();
+        doc->CursorAnim = 0.0f;
+    }
+
+    // Mouse: click, double-click word, Shift+click and drag select
+    if (g.ActiveId == id && io.MouseDown[0] && (hovered || !io.MouseClicked[0]) && text_clip_rect.Contains(io.MouseClickedPos[0]) && !input_requested_by_nav)
+    {
+        const int line_n = ImClamp((int)ImFloor((io.MousePos.y - text_origin.y) / line_height), 0, doc->GetLineCount() - 1);
+        const char* line_end;
+        const char* line = doc->GetLineText(line_n, &line_end);
+        const int offset = doc->GetLineStart(line_n) + InputTextLargeFindColumn(&g, line, line_end, io.MousePos.x - text_origin.x);
+        if (io.MouseClicked[0] && io.MouseClickedCount[0] == 2)
+        {
+            doc->SetCursor(InputTextLargePrevWord(doc, InputTextLargeNextChar(doc, offset)));
+            doc->SetCursor(InputTextLargeNextWord(doc, doc->Cursor), true);
+        }
+        else if (io.MouseClicked[0] || doc->Cursor != offset)
+        {
+            doc->SetCursor(offset, io.MouseClicked[0] ? io.KeyShift : true);
+        }
+        doc->CursorPreferredX = -1.0f;
+        doc->CloseUndoGroup();
+    }
+
+    if (g.ActiveId == id)
+    {
+        const ImGuiKey always_owned_keys[] = { ImGuiKey_LeftArrow, ImGuiKey_RightArrow, ImGuiKey_UpArrow, ImGuiKey_DownArrow, ImGuiKey_PageUp, ImGuiKey_PageDown, ImGuiKey_Enter, ImGuiKey_KeypadEnter, ImGuiKey_Delete, ImGuiKey_Backspace, ImGuiKey_Home, ImGuiKey_End };
+        for (ImGuiKey key : always_owned_keys)
+            SetKeyOwner(key, id);
+        if (user_clicked)
+            SetKeyOwner(ImGuiKey_MouseLeft, id);
+        g.ActiveIdUsingNavDirMask |= (1 << ImGuiDir_Left) | (1 << ImGuiDir_Right) | (1 << ImGuiDir_Up) | (1 << ImGuiDir_Down);
+        if (flags & ImGuiInputTextFlags_AllowTabInput)
+            SetKeyOwner(ImGuiKey_Tab, id);
+    }
+
+    bool clear_active_id = (g.ActiveId == id) && io.MouseClicked[0] && !hovered && !user_clicked;
+    if (g.ActiveId == id && !g.ActiveIdIsJustActivated && !clear_active_id)
+    {
+        const bool is_osx = io.ConfigMacOSXBehaviors;
+        const bool is_wordmove_key_down = is_osx ? io.KeyAlt : io.KeyCtrl;
+        const bool is_shift = io.KeyShift;
+        const ImGuiInputFlags f_repeat = ImGuiInputFlags_Repeat;
+        const int lines_per_page = ImMax((int)((draw_window->InnerRect.GetHeight() - style.FramePadding.y * 2.0f) / line_height), 1);
+        const int cursor_line_n = doc->FindLine(doc->Cursor);
+        const int cursor_line_start = doc->GetLineStart(cursor_line_n);
+        const int cursor_line_end = doc->GetLineEnd(cursor_line_n);
+        int move_lines = 0;
+
+        const bool is_cut   = Shortcut(ImGuiMod_Ctrl | ImGuiKey_X, f_repeat, id) && !is_readonly && doc->HasSelection();
+        const bool is_copy  = Shortcut(ImGuiMod_Ctrl | ImGuiKey_C, 0, id) && doc->HasSelection();
+        const bool is_paste = Shortcut(ImGuiMod_Ctrl | ImGuiKey_V, f_repeat, id) && !is_readonly;
+        const bool is_undo  = Shortcut(ImGuiMod_Ctrl | ImGuiKey_Z, f_repeat, id) && !is_readonly;
+        const bool is_redo  = (Shortcut(ImGuiMod_Ctrl | ImGuiKey_Y, f_repeat, id) || Shortcut(ImGuiMod_Ctrl | ImGuiMod_Shift | ImGuiKey_Z, f_repeat, id)) && !is_readonly;
+        const bool is_select_all = Shortcut(ImGuiMod_Ctrl | ImGuiKey_A, 0, id);
+        const bool is_tab = (flags & ImGuiInputTextFlags_AllowTabInput) && Shortcut(ImGuiKey_Tab, f_repeat, id) && !is_readonly;
+        const bool is_cancel = Shortcut(ImGuiKey_Escape, f_repeat, id);
+
+        if (IsKeyPressed(ImGuiKey_LeftArrow))
+            doc->SetCursor((doc->HasSelection() && !is_shift) ? doc->GetSelectionMin() : is_wordmove_key_down ? InputTextLargePrevWord(doc, doc->Cursor) : InputTextLargePrevChar(doc, doc->Cursor), is_shift);
+        else if (IsKeyPressed(ImGuiKey_RightArrow))
+            doc->SetCursor((doc->HasSelection() && !is_shift) ? doc->GetSelectionMax() : is_wordmove_key_down ? InputTextLargeNextWord(doc, doc->Cursor) : InputTextLargeNextChar(doc, doc->Cursor), is_shift);
+        else if (IsKeyPressed(ImGuiKey_UpArrow))
+            move_lines = -1;
+        else if (IsKeyPressed(ImGuiKey_DownArrow))
+            move_lines = +1;
+        else if (IsKeyPressed(ImGuiKey_PageUp))
+            move_lines = -lines_per_page;
+        else if (IsKeyPressed(ImGuiKey_PageDown))
+            move_lines = +lines_per_page;
+        else if (IsKeyPressed(ImGuiKey_Home))
+            doc->SetCursor(io.KeyCtrl ? 0 : cursor_line_start, is_shift);
+        else if (IsKeyPressed(ImGuiKey_End))
+            doc->SetCursor(io.KeyCtrl ? doc->GetLength() : cursor_line_end, is_shift);
+        else if (IsKeyPressed(ImGuiKey_Delete) && !is_readonly)
+        {
+            if (doc->HasSelection())
+                InputTextLargeDeleteRange(doc, doc->GetSelectionMin(), doc->GetSelectionMax());
+            else
+                InputTextLargeDeleteRange(doc, doc->Cursor, is_wordmove_key_down ? InputTextLargeNextWord(doc, doc->Cursor) : InputTextLargeNextChar(doc, doc->Cursor));
+        }
+        else if (IsKeyPressed(ImGuiKey_Backspace) && !is_readonly)
+        {
+            if (doc->HasSelection())
+                InputTextLargeDeleteRange(doc, doc->GetSelectionMin(), doc->GetSelectionMax());
+            else
+                InputTextLargeDeleteRange(doc, is_wordmove_key_down ? InputTextLargePrevWord(doc, doc->Cursor) : InputTextLargePrevChar(doc, doc->Cursor), doc->Cursor);
+        }
+        else if ((IsKeyPressed(ImGuiKey_Enter) || IsKeyPressed(ImGuiKey_KeypadEnter)) && !is_readonly)
+        {
+            const char new_line[] = "\n";
+            InputTextLargeReplaceSelection(doc, new_line, new_line + 1);
+        }
+        else if (is_tab)
+        {
+            const char tab[] = "\t";
+            InputTextLargeReplaceSelection(doc, tab, tab + 1);
+        }
+        else if (is_cancel)
+        {
+            clear_active_id = true;
+        }
+        else if (is_select_all)
+        {
+            doc->SetCursor(0);
+            doc->SetCursor(doc->GetLength(), true);
+        }
+        else if (is_cut || is_copy)
+        {
+            ImVector<char> clipboard_text;
+            doc->GetTextRange(doc->GetSelectionMin(), doc->GetSelectionMax(), &clipboard_text);
+            clipboard_text.push_back(0);
+            SetClipboardText(clipboard_text.Data);
+            if (is_cut)
+                InputTextLargeDeleteRange(doc, doc->GetSelectionMin(), doc->GetSelectionMax());
+        }
+        else if (is_paste)
+        {
+            if (const char* clipboard = GetClipboardText())
+                InputTextLargeReplaceSelection(doc, clipboard, clipboard + ImStrlen(clipboard));
+            doc->CloseUndoGroup();
+        }
+        else if (is_undo)
+        {
+            doc->Edited |= doc->Undo();
+        }
+        else if (is_redo)
+        {
+            doc->Edited |= doc->Redo();
+        }
+
+        // Up/Down keep the column the cursor was on before the first move
+        if (move_lines != 0)
+        {
+            const char* line_end;
+            const char* line = doc->GetLineText(cursor_line_n, &line_end);
+            const float preferred_x = (doc->CursorPreferredX >= 0.0f) ? doc->CursorPreferredX : InputTextLargeCalcWidth(&g, line, line + (doc->Cursor - cursor_line_start));
+            const int line_n = ImClamp(cursor_line_n + move_lines, 0, doc->GetLineCount() - 1);
+            line = doc->GetLineText(line_n, &line_end);
+            doc->SetCursor(doc->GetLineStart(line_n) + InputTextLargeFindColumn(&g, line, line_end, preferred_x), is_shift);
+            doc->CursorPreferredX = preferred_x;
+        }
+        else if (doc->CursorFollow)
+        {
+            doc->CursorPreferredX = -1.0f;
+        }
+        if (doc->CursorFollow && !doc->Edited) // Moving the cursor ends the typed word
+            doc->CloseUndoGroup();
+
+        // Text input. Ctrl is ignored except with Alt, for AltGr
+        const bool ignore_char_inputs = (io.KeyCtrl && !io.KeyAlt) || (is_osx && io.KeyCtrl);
+        if (!ignore_char_inputs && !is_readonly)
+            for (ImWchar c : io.InputQueueCharacters)
+            {
+                if (c < 0x20 || c == 0x7F) // Tab and new lines go through the key handling above
+                    continue;
+                char c_utf8[5];
+                ImTextCharToUtf8(c_utf8, c);
+                InputTextLargeReplaceSelection(doc, c_utf8, c_utf8 + ImStrlen(c_utf8));
+            }
+        io.InputQueueCharacters.resize(0);
+    }
+    if (clear_active_id && g.ActiveId == id)
+        ClearActiveID();
+
+    // Scroll to the cursor (applied next frame)
+    const float inner_width = draw_window->InnerRect.GetWidth() - style.FramePadding.x * 2.0f;
+    const float inner_height = draw_window->InnerRect.GetHeight() - style.FramePadding.y * 2.0f;
+    if (doc->CursorFollow)
+    {
+        const int cursor_line_n = doc->FindLine(doc->Cursor);
+        const char* line_end;
+        const char* line = doc->GetLineText(cursor_line_n, &line_end);
+        const float cursor_x = InputTextLargeCalcWidth(&g, line, line + (doc->Cursor - doc->GetLineStart(cursor_line_n)));
+        const float cursor_y = cursor_line_n * line_height;
+        doc->ContentWidth = ImMax(doc->ContentWidth, cursor_x + 1.0f);
+        if (cursor_y < draw_window->Scroll.y)
+            SetScrollY(draw_window, cursor_y);
+        else if (cursor_y + line_height > draw_window->Scroll.y + inner_height)
+            SetScrollY(draw_window, cursor_y + line_height - inner_height);
+        if (cursor_x < draw_window->Scroll.x)
+            SetScrollX(draw_window, ImMax(cursor_x - inner_width * 0.25f, 0.0f));
+        else if (cursor_x > draw_window->Scroll.x + inner_width)
+            SetScrollX(draw_window, cursor_x - inner_width * 0.75f);
+        doc->CursorFollow = false;
+    }
+
+    // Render the visible lines only
+    const bool render_cursor = (g.ActiveId == id);
+    const int selection_min = doc->GetSelectionMin();
+    const int selection_max = doc->GetSelectionMax();
+    const ImU32 col_text = GetColorU32(ImGuiCol_Text);
+    const ImU32 col_selection = GetColorU32(ImGuiCol_TextSelectedBg, render_cursor ? 1.0f : 0.6f);
+    ImDrawList* draw_list = draw_window->DrawList;
+    ImVec2 cursor_screen_pos(-FLT_MAX, -FLT_MAX);
+    PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(style.ItemSpacing.x, 0.0f));
+    ImGuiListClipper clipper;
+    clipper.Begin(doc->GetLineCount(), line_height);
+    while (clipper.Step())
+        for (int line_n = clipper.DisplayStart; line_n < clipper.DisplayEnd; line_n++)
+        {
+            const ImVec2 line_pos = draw_window->DC.CursorPos;
+            const int line_start = doc->GetLineStart(line_n);
+            const int line_end_offset = doc->GetLineEnd(line_n);
+            const char* line_end;
+            const char* line = doc->GetLineText(line_n, &line_end);
+            const float line_width = InputTextLargeCalcWidth(&g, line, line_end);
+            doc->ContentWidth = ImMax(doc->ContentWidth, line_width);
+            if (selection_min < selection_max && selection_min <= line_end_offset && selection_max >= line_start)
+            {
+                const float x0 = (selection_min > line_start) ? InputTextLargeCalcWidth(&g, line, line + (selection_min - line_start)) : 0.0f;
+                float x1 = (selection_max <= line_end_offset) ? InputTextLargeCalcWidth(&g, line, line + (selection_max - line_start)) : line_width;
+                if (selection_max > line_end_offset)
+                    x1 += IM_TRUNC(g.FontBaked->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected new lines
+                draw_list->AddRectFilled(line_pos + ImVec2(x0, 0.0f), line_pos + ImVec2(x1, line_height), col_selection);
+            }
+            draw_list->AddText(g.Font, g.FontSize, line_pos, col_text, line, line_end);
+            if (render_cursor && doc->Cursor >= line_start && doc->Cursor <= line_end_offset)
+                cursor_screen_pos = ImTrunc(line_pos + ImVec2(InputTextLargeCalcWidth(&g, line, line + (doc->Cursor - line_start)), line_height));
+            ItemSize(ImVec2(line_width, line_height));
+        }
+    PopStyleVar();
+
+    // Draw blinking cursor
+    if (render_cursor && cursor_screen_pos.x != -FLT_MAX)
+    {
+        doc->CursorAnim += io.DeltaTime;
+        bool cursor_is_visible = (!g.IO.ConfigInputTextCursorBlink) || (doc->CursorAnim <= 0.0f) || ImFmod(doc->CursorAnim, 1.20f) <= 0.80f;
+        ImRect cursor_screen_rect(cursor_screen_pos.x, cursor_screen_pos.y - g.FontSize + 0.5f, cursor_screen_pos.x + 1.0f, cursor_screen_pos.y - 1.5f);
+        if (cursor_is_visible && cursor_screen_rect.Overlaps(text_clip_rect))
+            draw_list->AddLine(cursor_screen_rect.Min, cursor_screen_rect.GetBL(), GetColorU32(ImGuiCol_InputTextCursor), 1.0f);
+        if (!is_readonly)
+        {
+            ImGuiPlatformImeData* ime_data = &g.PlatformImeData;
+            ime_data->WantVisible = true;
+            ime_data->WantTextInput = true;
+            ime_data->InputPos = ImVec2(cursor_screen_pos.x - 1.0f, cursor_screen_pos.y - g.FontSize);
+            ime_data->InputLineHeight = g.FontSize;
+            ime_data->ViewportId = window->Viewport->ID;
+        }
+    }
+
+    g.NextItemData.ItemFlags |= (ImGuiItemFlags)ImGuiItemFlags_Inputable | ImGuiItemFlags_NoTabStop;
+    EndChild();
+    item_data_backup.StatusFlags |= (g.LastItemData.StatusFlags & ImGuiItemStatusFlags_HoveredWindow);
+    if (label_size.x > 0)
+        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, frame_bb.Min.y + style.FramePadding.y), label);
+    EndGroup();
+    if (g.LastItemData.ID == 0 || g.LastItemData.ID != GetWindowScrollbarID(draw_window, ImGuiAxis_Y))
+    {
+        g.LastItemData.ID = id;
+        g.LastItemData.ItemFlags = item_data_backup.ItemFlags;
+        g.LastItemData.StatusFlags = item_data_backup.StatusFlags;
+    }
+    if (doc->Edited)
+        MarkItemEdited(id);
+    return doc->Edited;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
 //-------------------------------------------------------------------------
@@ -8553,6 +9327,8 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 // - PlotEx() [Internal]
 // - PlotLines()
 // - PlotHistogram()
+// - ImGuiPlotRingSeries
+// - PlotRingSeries() [Internal]
 //-------------------------------------------------------------------------
 // Plot/Graph widgets are not very good.
 // Consider writing your own, or using a third-party one, see:
@@ -8560,7 +9336,36 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 // - others https://github.com/ocornut/imgui/wiki/Useful-Extensions
 //-------------------------------------------------------------------------
 
-int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
+// Summarize values [idx_begin, idx_end) of data, which must not wrap around
+static void PlotGetRange(float (*values_getter)(void* data, int idx), ImGuiPlotRangeGetter range_getter, void* data, int idx_begin, int idx_end, ImGuiPlotRange* out_range)
+{
+    IM_ASSERT(idx_begin < idx_end);
+    if (range_getter)
+    {
+        range_getter(data, idx_begin, idx_end, out_range);
+        return;
+    }
+    out_range->Min = FLT_MAX;
+    out_range->Max = -FLT_MAX;
+    for (int idx = idx_begin; idx < idx_end; idx++)
+    {
+        const float v = values_getter(data, idx);
+        if (idx == idx_begin)
+            out_range->First = v;
+        out_range->Last = v;
+        if (v != v) // Ignore NaN values
+            continue;
+        out_range->Min = ImMin(out_range->Min, v);
+        out_range->Max = ImMax(out_range->Max, v);
+    }
+}
+
+static inline int PlotGetColumnFirstIndex(int values_count, int columns_count, int column_n)
+{
+    return (int)(((ImS64)values_count * column_n) / columns_count);
+}
+
+int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg, ImGuiPlotRangeGetter range_getter)
 {
     ImGuiContext& g = *GImGui;
     ImGuiWindow* window = GetCurrentWindow();
@@ -8582,18 +9387,55 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     bool hovered;
     ButtonBehavior(frame_bb, id, &hovered, NULL);
 
+    // With more values than pixel columns, summarize the values covered by each column into their first, last, min and max values.
+    // Drawing one vertical min/max segment per column keeps every spike visible, where sampling one value per column would alias them away.
+    const int columns_count = (int)inner_bb.GetWidth();
+    const bool decimate = (columns_count > 0 && values_count > columns_count * 2);
+    if (decimate)
+    {
+        g.PlotRanges.resize(columns_count);
+        for (int column_n = 0; column_n < columns_count; column_n++)
+        {
+            const int idx_begin = PlotGetColumnFirstIndex(values_count, columns_count, column_n);
+            const int idx_end = PlotGetColumnFirstIndex(values_count, columns_count, column_n + 1);
+            const int data_begin = (idx_begin + values_offset) % values_count;
+            const int data_count_before_wrap = ImMin(idx_end - idx_begin, values_count - data_begin);
+            ImGuiPlotRange* range = &g.PlotRanges.Data[column_n];
+            PlotGetRange(values_getter, range_getter, data, data_begin, data_begin + data_count_before_wrap, range);
+            if (data_count_before_wrap < idx_end - idx_begin)
+            {
+                ImGuiPlotRange range_after_wrap;
+                PlotGetRange(values_getter, range_getter, data, 0, idx_end - idx_begin - data_count_before_wrap, &range_after_wrap);
+                range->Last = range_after_wrap.Last;
+                range->Min = ImMin(range->Min, range_after_wrap.Min);
+                range->Max = ImMax(range->Max, range_after_wrap.Max);
+            }
+        }
+    }
+
     // Determine scale from values if not specified
     if (scale_min == FLT_MAX || scale_max == FLT_MAX)
     {
         float v_min = FLT_MAX;
         float v_max = -FLT_MAX;
-        for (int i = 0; i < values_count; i++)
+        if (decimate)
         {
-            const float v = values_getter(data, i);
-            if (v != v) // Ignore NaN values
-                continue;
-            v_min = ImMin(v_min, v);
-            v_max = ImMax(v_max, v);
+            for (const ImGuiPlotRange& range : g.PlotRanges)
+            {
+                v_min = ImMin(v_min, range.Min);
+                v_max = ImMax(v_max, range.Max);
+            }
+        }
+        else
+        {
+            for (int i = 0; i < values_count; i++)
+            {
+                const float v = values_getter(data, i);
+                if (v != v) // Ignore NaN values
+                    continue;
+                v_min = ImMin(v_min, v);
+                v_max = ImMax(v_max, v);
+            }
         }
         if (scale_min == FLT_MAX)
             scale_min = v_min;
@@ -8605,7 +9447,65 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
 
     const int values_count_min = (plot_type == ImGuiPlotType_Lines) ? 2 : 1;
     int idx_hovered = -1;
-    if (values_count >= values_count_min)
+    if (decimate)
+    {
+        const float column_w = inner_bb.GetWidth() / (float)columns_count;
+
+        // Tooltip on hover
+        int column_hovered = -1;
+        if (hovered && inner_bb.Contains(g.IO.MousePos))
+        {
+            column_hovered = ImClamp((int)((g.IO.MousePos.x - inner_bb.Min.x) / column_w), 0, columns_count - 1);
+            const ImGuiPlotRange& range = g.PlotRanges[column_hovered];
+            const int idx_begin = PlotGetColumnFirstIndex(values_count, columns_count, column_hovered);
+            const int idx_end = PlotGetColumnFirstIndex(values_count, columns_count, column_hovered + 1);
+            SetTooltip("%d..%d\nmin: %8.4g\nmax: %8.4g", idx_begin, idx_end - 1, range.Min, range.Max);
+            idx_hovered = idx_begin;
+        }
+
+        const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+        const float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (1 + scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);
+        const float histogram_zero_line_y = ImLerp(inner_bb.Min.y, inner_bb.Max.y, histogram_zero_line_t);
+        const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
+        const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
+        #define PLOT_VALUE_TO_Y(_V)  ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate(((_V) - scale_min) * inv_scale))
+
+        float prev_x = 0.0f;
+        float prev_last = 0.0f;
+        bool prev_connect = false;
+        for (int column_n = 0; column_n < columns_count; column_n++)
+        {
+            const ImGuiPlotRange& range = g.PlotRanges.Data[column_n];
+            const ImU32 col = (column_n == column_hovered) ? col_hovered : col_base;
+            const float x0 = inner_bb.Min.x + column_w * (float)column_n;
+            if (range.Min > range.Max) // Only NaN values: leave a gap
+            {
+                prev_connect = false;
+                continue;
+            }
+            const float y_min = PLOT_VALUE_TO_Y(range.Min); // Bottom of the column
+            const float y_max = PLOT_VALUE_TO_Y(range.Max); // Top of the column
+            if (plot_type == ImGuiPlotType_Lines)
+            {
+                // Connect the previous column's last value to this column's first value, then span this column's min/max
+                const float x = x0 + column_w * 0.5f;
+                if (prev_connect && range.First == range.First)
+                    window->DrawList->AddLine(ImVec2(prev_x, PLOT_VALUE_TO_Y(prev_last)), ImVec2(x, PLOT_VALUE_TO_Y(range.First)), col);
+                if (y_min > y_max)
+                    window->DrawList->AddLine(ImVec2(x, y_max), ImVec2(x, y_min), col);
+                prev_x = x;
+                prev_last = range.Last;
+                prev_connect = (range.Last == range.Last);
+            }
+            else if (plot_type == ImGuiPlotType_Histogram)
+            {
+                // Span from the zero line to the farthest extent of the column's values
+                window->DrawList->AddRectFilled(ImVec2(x0, ImMin(y_max, histogram_zero_line_y)), ImVec2(x0 + column_w, ImMax(y_min, histogram_zero_line_y)), col);
+            }
+        }
+        #undef PLOT_VALUE_TO_Y
+    }
+    else if (values_count >= values_count_min)
     {
         int res_w = ImMin((int)frame_size.x, values_count) + ((plot_type == ImGuiPlotType_Lines) ? -1 : 0);
         int item_count = values_count + ((plot_type == ImGuiPlotType_Lines) ? -1 : 0);
@@ -8691,10 +9591,23 @@ static float Plot_ArrayGetter(void* data, int idx)
     return v;
 }
 
+// Tightly packed arrays are summarized with ImMinMaxFloats() instead of one Plot_ArrayGetter() call per value
+static void Plot_ArrayRangeGetter(void* data, int idx_begin, int idx_end, ImGuiPlotRange* out_range)
+{
+    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
+    IM_ASSERT(plot_data->Stride == sizeof(float));
+    const float* values = plot_data->Values + idx_begin;
+    out_range->First = values[0];
+    out_range->Last = values[idx_end - idx_begin - 1];
+    out_range->Min = FLT_MAX;
+    out_range->Max = -FLT_MAX;
+    ImMinMaxFloats(values, idx_end - idx_begin, &out_range->Min, &out_range->Max);
+}
+
 void ImGui::PlotLines(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
 {
     ImGuiPlotArrayGetterData data(values, stride);
-    PlotEx(ImGuiPlotType_Lines, label, &Plot_ArrayGetter, (void*)&data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
+    PlotEx(ImGuiPlotType_Lines, label, &Plot_ArrayGetter, (void*)&data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size, (stride == sizeof(float)) ? &Plot_ArrayRangeGetter : NULL);
 }
 
 void ImGui::PlotLines(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
@@ -8705,7 +9618,7 @@ void ImGui::PlotLines(const char* label, float (*values_getter)(void* data, int
 void ImGui::PlotHistogram(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
 {
     ImGuiPlotArrayGetterData data(values, stride);
-    PlotEx(ImGuiPlotType_Histogram, label, &Plot_ArrayGetter, (void*)&data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
+    PlotEx(ImGuiPlotType_Histogram, label, &Plot_ArrayGetter, (void*)&data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size, (stride == sizeof(float)) ? &Plot_ArrayRangeGetter : NULL);
 }
 
 void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
@@ -8713,6 +9626,107 @@ void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data,
     PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+void ImGuiPlotRingSeries::Init(int capacity)
+{
+    IM_ASSERT(capacity > 0);
+    Values.resize(capacity);
+    BlocksMinMax.resize((capacity + IMGUI_PLOT_RING_SERIES_BLOCK_SIZE - 1) / IMGUI_PLOT_RING_SERIES_BLOCK_SIZE);
+    Clear();
+}
+
+void ImGuiPlotRingSeries::Push(float v)
+{
+    IM_ASSERT(Values.Size > 0 && "Call Init() first!");
+    int write_n = Head + Count;
+    if (write_n >= Values.Size)
+        write_n -= Values.Size;
+    Values.Data[write_n] = v;
+    if (Count < Values.Size)
+        Count++;
+    else
+        Head = (Head + 1 == Values.Size) ? 0 : Head + 1;
+
+    // Restart the block summary when writing its first value: the values still stored after write_n are summarized again when overwritten
+    ImVec2& block = BlocksMinMax.Data[write_n / IMGUI_PLOT_RING_SERIES_BLOCK_SIZE];
+    if (write_n % IMGUI_PLOT_RING_SERIES_BLOCK_SIZE == 0)
+        block = ImVec2(FLT_MAX, -FLT_MAX);
+    if (v == v) // Ignore NaN values
+    {
+        block.x = ImMin(block.x, v);
+        block.y = ImMax(block.y, v);
+    }
+}
+
+void ImGuiPlotRingSeries::PushN(const float* values, int values_count)
+{
+    for (int n = 0; n < values_count; n++)
+        Push(values[n]);
+}
+
+// Summarize values [idx_begin, idx_end), from oldest (0) to newest (Count - 1).
+// The block holding the newest value is the only one whose summary may not cover all of its stored values, so it is always scanned.
+void ImGuiPlotRingSeries::GetRange(int idx_begin, int idx_end, ImGuiPlotRange* out_range) const
+{
+    IM_ASSERT(idx_begin >= 0 && idx_begin < idx_end && idx_end <= Count);
+    const int capacity = Values.Size;
+    const int block_size = IMGUI_PLOT_RING_SERIES_BLOCK_SIZE;
+    int newest_n = Head + Count - 1;
+    if (newest_n >= capacity)
+        newest_n -= capacity;
+    const int newest_block_n = newest_n / block_size;
+
+    out_range->First = GetValue(idx_begin);
+    out_range->Last = GetValue(idx_end - 1);
+    out_range->Min = FLT_MAX;
+    out_range->Max = -FLT_MAX;
+
+    // Split the logical range at the end of Values[]
+    int data_begin = Head + idx_begin;
+    if (data_begin >= capacity)
+        data_begin -= capacity;
+    int remaining = idx_end - idx_begin;
+    while (remaining > 0)
+    {
+        const int data_end = ImMin(data_begin + remaining, capacity);
+        remaining -= data_end - data_begin;
+        for (int n = data_begin; n < data_end; )
+        {
+            const int block_n = n / block_size;
+            const int block_end = ImMin((block_n + 1) * block_size, capacity);
+            const int scan_end = ImMin(block_end, data_end);
+            if (n == block_n * block_size && scan_end == block_end && block_n != newest_block_n)
+            {
+                const ImVec2& block = BlocksMinMax.Data[block_n];
+                out_range->Min = ImMin(out_range->Min, block.x);
+                out_range->Max = ImMax(out_range->Max, block.y);
+            }
+            else
+            {
+                ImMinMaxFloats(Values.Data + n, scan_end - n, &out_range->Min, &out_range->Max);
+            }
+            n = scan_end;
+        }
+        data_begin = 0;
+    }
+}
+
+static float PlotRingSeries_ValueGetter(void* data, int idx)
+{
+    const ImGuiPlotRingSeries* series = (const ImGuiPlotRingSeries*)data;
+    return series->GetValue(idx);
+}
+
+static void PlotRingSeries_RangeGetter(void* data, int idx_begin, int idx_end, ImGuiPlotRange* out_range)
+{
+    const ImGuiPlotRingSeries* series = (const ImGuiPlotRingSeries*)data;
+    series->GetRange(idx_begin, idx_end, out_range);
+}
+
+void ImGui::PlotRingSeries(ImGuiPlotType plot_type, const char* label, const ImGuiPlotRingSeries* series, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
+{
+    PlotEx(plot_type, label, &PlotRingSeries_ValueGetter, (void*)series, series->Count, 0, overlay_text, scale_min, scale_max, size_arg, &PlotRingSeries_RangeGetter);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.